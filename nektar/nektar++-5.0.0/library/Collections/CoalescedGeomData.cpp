@@ -42,7 +42,59 @@ using namespace std;
 namespace Nektar {
 namespace Collections {
 
-CoalescedGeomData::CoalescedGeomData(void)
+void GeomVmul(const bool                          deformed,
+              const int                           nElmt,
+              const int                           n,
+              const NekDouble                    *fac,
+              const Array<OneD, const NekDouble> &x,
+                    Array<OneD,       NekDouble> &y)
+{
+    if (deformed)
+    {
+        Vmath::Vmul(n, fac, 1, &x[0], 1, &y[0], 1);
+        return;
+    }
+
+    const int nPts = n / nElmt;
+    for (int e = 0; e < nElmt; ++e)
+    {
+        Vmath::Smul(nPts, fac[e], &x[0] + e*nPts, 1, &y[0] + e*nPts, 1);
+    }
+}
+
+void GeomVvtvp(const bool                          deformed,
+               const int                           nElmt,
+               const int                           n,
+               const NekDouble                    *fac,
+               const Array<OneD, const NekDouble> &x,
+               const Array<OneD, const NekDouble> &y,
+                     Array<OneD,       NekDouble> &z)
+{
+    if (deformed)
+    {
+        Vmath::Vvtvp(n, fac, 1, &x[0], 1, &y[0], 1, &z[0], 1);
+        return;
+    }
+
+    const int nPts = n / nElmt;
+    for (int e = 0; e < nElmt; ++e)
+    {
+        Vmath::Svtvp(nPts, fac[e], &x[0] + e*nPts, 1,
+                     &y[0] + e*nPts, 1, &z[0] + e*nPts, 1);
+    }
+}
+
+/**
+ * @param pCollExp        Expansions of the collection.
+ * @param metricOnTheFly  If true, derivative factors of deformed collections
+ *                        are recomputed from the coordinate mapping whenever
+ *                        they are applied rather than being stored.
+ */
+CoalescedGeomData::CoalescedGeomData(
+        const vector<StdRegions::StdExpansionSharedPtr> &pCollExp,
+        const bool metricOnTheFly)
+    : m_collExp(pCollExp), m_deformed(true), m_deformedSet(false),
+      m_metricOnTheFly(metricOnTheFly)
 {
 }
 
@@ -50,6 +102,34 @@ CoalescedGeomData::~CoalescedGeomData(void)
 {
 }
 
+/**
+ * @brief Returns true if any element of the collection has a deformed
+ * geometry. Otherwise the Jacobian and derivative factors returned by
+ * GetJac() and GetDerivFactors() hold a single value per element.
+ */
+bool CoalescedGeomData::IsDeformed(
+        vector<StdRegions::StdExpansionSharedPtr> &pCollExp)
+{
+    if (!m_deformedSet)
+    {
+        m_deformed = false;
+        for (int i = 0; i < pCollExp.size(); ++i)
+        {
+            const LocalRegions::Expansion *lep =
+                dynamic_cast<const LocalRegions::Expansion*>(&(*pCollExp[i]));
+
+            if (lep->GetMetricInfo()->GetGtype() == SpatialDomains::eDeformed)
+            {
+                m_deformed = true;
+                break;
+            }
+        }
+        m_deformedSet = true;
+    }
+
+    return m_deformed;
+}
+
 const Array<OneD, const NekDouble> &CoalescedGeomData::GetJac(
         vector<StdRegions::StdExpansionSharedPtr> &pCollExp)
 {
@@ -60,14 +140,17 @@ const Array<OneD, const NekDouble> &CoalescedGeomData::GetJac(
         LibUtilities::PointsKeyVector ptsKeys = pCollExp[0]->GetPointsKeys();
         int nElmts = pCollExp.size();
 
-        // set up Cached Jacobians to be continuous
+        // set up Cached Jacobians to be continuous. Regular collections
+        // only keep the constant Jacobian of each element.
         int npts = 1;
-        for (int i = 0; i < ptsKeys.size(); ++i)
+        if (IsDeformed(pCollExp))
         {
-            npts   *= ptsKeys[i].GetNumPoints();
+            for (int i = 0; i < ptsKeys.size(); ++i)
+            {
+                npts   *= ptsKeys[i].GetNumPoints();
+            }
         }
 
-
         Array<OneD, NekDouble> newjac(npts*nElmts);
 
         //copy Jacobians into a continuous list and set new chatched value
@@ -160,9 +243,12 @@ const Array<TwoD, const NekDouble> &CoalescedGeomData::GetDerivFactors(
 
         // set up Cached Jacobians to be continuous
         int npts = 1;
-        for (int i = 0; i < dim; ++i)
+        if (IsDeformed(pCollExp))
         {
-            npts   *= ptsKeys[i].GetNumPoints();
+            for (int i = 0; i < dim; ++i)
+            {
+                npts   *= ptsKeys[i].GetNumPoints();
+            }
         }
 
 
@@ -175,9 +261,13 @@ const Array<TwoD, const NekDouble> &CoalescedGeomData::GetDerivFactors(
             const StdRegions::StdExpansion * sep = &(*pCollExp[i]);
             const LocalRegions::Expansion  * lep = dynamic_cast<const LocalRegions::Expansion*>( sep );
 
-            const Array<TwoD, const NekDouble> Dfac = lep->GetMetricInfo()->GetDerivFactors( ptsKeys );
+            // Evaluate into scratch storage rather than through
+            // GetDerivFactors(), so that newDFac is the only stored copy.
+            lep->GetMetricInfo()->GetDerivFactorsUncached(
+                ptsKeys, m_dfacScratch, m_dfacWork);
+            const Array<TwoD, const NekDouble> &Dfac = m_dfacScratch;
 
-            if( lep->GetMetricInfo()->GetGtype() == SpatialDomains::eDeformed)
+            if (lep->GetMetricInfo()->GetGtype() == SpatialDomains::eDeformed)
             {
                 for (int j = 0; j < dim*coordim; ++j)
                 {
@@ -200,5 +290,195 @@ const Array<TwoD, const NekDouble> &CoalescedGeomData::GetDerivFactors(
     return m_twoDGeomData[eDerivFactors];
 }
 
+/**
+ * @brief Returns true if the derivative factors of this collection are
+ * recomputed on the fly. Regular collections always store their factors since
+ * they only require one value per element.
+ */
+bool CoalescedGeomData::IsMetricOnTheFly()
+{
+    return m_metricOnTheFly && IsDeformed(m_collExp);
+}
+
+/**
+ * @brief Evaluate the derivative factors of a single element at the
+ * quadrature points of the collection without storing them.
+ *
+ * The factors are written to storage which is reused by the next element, and
+ * @p deformed is set if they hold one value per quadrature point.
+ */
+Array<TwoD, const NekDouble> CoalescedGeomData::GetElmtDerivFactors(
+        const int  elmt,
+              bool &deformed)
+{
+    const StdRegions::StdExpansion *sep = &(*m_collExp[elmt]);
+    const LocalRegions::Expansion  *lep =
+        dynamic_cast<const LocalRegions::Expansion*>(sep);
+    const SpatialDomains::GeomFactorsSharedPtr &metric =
+        lep->GetMetricInfo();
+
+    deformed = metric->GetGtype() == SpatialDomains::eDeformed;
+    metric->GetDerivFactorsUncached(m_collExp[0]->GetPointsKeys(),
+                                    m_dfacScratch, m_dfacWork);
+    return m_dfacScratch;
+}
+
+/**
+ * @brief Convert derivatives with respect to the reference coordinates into
+ * derivatives with respect to the Cartesian coordinates,
+ * \f$ out_i = \sum_j \frac{\partial \xi_j}{\partial x_i} in_j \f$.
+ *
+ * @param dir   Cartesian direction to compute into out[0], or -1 to compute
+ *              all coordinate directions.
+ * @param in    Reference derivatives of the collection, one per dimension.
+ * @param out   Cartesian derivatives.
+ */
+void CoalescedGeomData::ApplyDerivFactors(
+        const int                                    dir,
+        const Array<OneD, Array<OneD, NekDouble> >  &in,
+              Array<OneD, Array<OneD, NekDouble> >  &out)
+{
+    const int nElmts  = m_collExp.size();
+    const int dim     = m_collExp[0]->GetShapeDimension();
+    const int coordim = m_collExp[0]->GetCoordim();
+    const int nqtot   = m_collExp[0]->GetTotPoints();
+    const int ntot    = nElmts*nqtot;
+
+    const int start = dir < 0 ? 0       : dir;
+    const int end   = dir < 0 ? coordim : dir + 1;
+
+    if (!IsMetricOnTheFly())
+    {
+        const Array<TwoD, const NekDouble> &df = GetDerivFactors(m_collExp);
+        const bool deformed = IsDeformed(m_collExp);
+
+        for (int i = start; i < end; ++i)
+        {
+            Array<OneD, NekDouble> &o = out[i - start];
+            GeomVmul(deformed, nElmts, ntot, &df[i*dim][0], in[0], o);
+            for (int j = 1; j < dim; ++j)
+            {
+                GeomVvtvp(deformed, nElmts, ntot, &df[i*dim+j][0], in[j],
+                          o, o);
+            }
+        }
+        return;
+    }
+
+    for (int e = 0; e < nElmts; ++e)
+    {
+        bool deformed;
+        Array<TwoD, const NekDouble> df = GetElmtDerivFactors(e, deformed);
+        const int  offset   = e*nqtot;
+
+        for (int i = start; i < end; ++i)
+        {
+            NekDouble *o = &out[i - start][0] + offset;
+            for (int j = 0; j < dim; ++j)
+            {
+                const NekDouble *x = &in[j][0] + offset;
+                if (deformed)
+                {
+                    if (j == 0)
+                    {
+                        Vmath::Vmul(nqtot, &df[i*dim][0], 1, x, 1, o, 1);
+                    }
+                    else
+                    {
+                        Vmath::Vvtvp(nqtot, &df[i*dim+j][0], 1, x, 1,
+                                     o, 1, o, 1);
+                    }
+                }
+                else
+                {
+                    if (j == 0)
+                    {
+                        Vmath::Smul(nqtot, df[i*dim][0], x, 1, o, 1);
+                    }
+                    else
+                    {
+                        Vmath::Svtvp(nqtot, df[i*dim+j][0], x, 1, o, 1, o, 1);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Apply the transpose of the derivative factors, as required for inner
+ * products with respect to the derivative of the basis,
+ * \f$ out_j = \sum_i \frac{\partial \xi_j}{\partial x_i} in_i \f$.
+ *
+ * @param in    Cartesian components of the collection.
+ * @param out   Components in the reference directions, one per dimension.
+ */
+void CoalescedGeomData::ApplyDerivFactorsTranspose(
+        const Array<OneD, Array<OneD, const NekDouble> > &in,
+              Array<OneD, Array<OneD,       NekDouble> > &out)
+{
+    const int nElmts  = m_collExp.size();
+    const int dim     = m_collExp[0]->GetShapeDimension();
+    const int coordim = m_collExp[0]->GetCoordim();
+    const int nqtot   = m_collExp[0]->GetTotPoints();
+    const int ntot    = nElmts*nqtot;
+
+    if (!IsMetricOnTheFly())
+    {
+        const Array<TwoD, const NekDouble> &df = GetDerivFactors(m_collExp);
+        const bool deformed = IsDeformed(m_collExp);
+
+        for (int j = 0; j < dim; ++j)
+        {
+            GeomVmul(deformed, nElmts, ntot, &df[j][0], in[0], out[j]);
+            for (int i = 1; i < coordim; ++i)
+            {
+                GeomVvtvp(deformed, nElmts, ntot, &df[j+i*dim][0], in[i],
+                          out[j], out[j]);
+            }
+        }
+        return;
+    }
+
+    for (int e = 0; e < nElmts; ++e)
+    {
+        bool deformed;
+        Array<TwoD, const NekDouble> df = GetElmtDerivFactors(e, deformed);
+        const int  offset   = e*nqtot;
+
+        for (int j = 0; j < dim; ++j)
+        {
+            NekDouble *o = &out[j][0] + offset;
+            for (int i = 0; i < coordim; ++i)
+            {
+                const NekDouble *x = &in[i][0] + offset;
+                if (deformed)
+                {
+                    if (i == 0)
+                    {
+                        Vmath::Vmul(nqtot, &df[j][0], 1, x, 1, o, 1);
+                    }
+                    else
+                    {
+                        Vmath::Vvtvp(nqtot, &df[j+i*dim][0], 1, x, 1,
+                                     o, 1, o, 1);
+                    }
+                }
+                else
+                {
+                    if (i == 0)
+                    {
+                        Vmath::Smul(nqtot, df[j][0], x, 1, o, 1);
+                    }
+                    else
+                    {
+                        Vmath::Svtvp(nqtot, df[j+i*dim][0], x, 1, o, 1, o, 1);
+                    }
+                }
+            }
+        }
+    }
+}
+
 }
 }
@@ -39,6 +39,7 @@
 #include <vector>
 
 #include <StdRegions/StdExpansion.h>
+#include <SpatialDomains/GeomFactors.h>
 
 namespace Nektar {
 namespace Collections {
@@ -50,13 +51,43 @@ enum GeomData
     eDerivFactors
 };
 
+/**
+ * Geometric data of a collection is stored element by element. For deformed
+ * collections there is one value per quadrature point, whereas collections
+ * made entirely of regular (affine) elements only store one constant per
+ * element. The helpers below apply such a factor in either layout, where @p n
+ * is the total number of quadrature points in the collection.
+ */
+
+/// y = fac * x
+void GeomVmul(const bool                          deformed,
+              const int                           nElmt,
+              const int                           n,
+              const NekDouble                    *fac,
+              const Array<OneD, const NekDouble> &x,
+                    Array<OneD,       NekDouble> &y);
+
+/// z = fac * x + y
+void GeomVvtvp(const bool                          deformed,
+               const int                           nElmt,
+               const int                           n,
+               const NekDouble                    *fac,
+               const Array<OneD, const NekDouble> &x,
+               const Array<OneD, const NekDouble> &y,
+                     Array<OneD,       NekDouble> &z);
+
 class CoalescedGeomData
 {
     public:
-        CoalescedGeomData(void);
+        CoalescedGeomData(
+                const std::vector<StdRegions::StdExpansionSharedPtr> &pCollExp,
+                const bool metricOnTheFly = false);
 
         virtual ~CoalescedGeomData(void);
 
+        bool IsDeformed(
+                std::vector<StdRegions::StdExpansionSharedPtr> &pColLExp);
+
         const Array<OneD, const NekDouble> &GetJac(
                 std::vector<StdRegions::StdExpansionSharedPtr> &pColLExp);
 
@@ -66,9 +97,31 @@ class CoalescedGeomData
         const Array<TwoD, const NekDouble> &GetDerivFactors(
                 std::vector<StdRegions::StdExpansionSharedPtr> &pColLExp);
 
+        bool IsMetricOnTheFly();
+
+        void ApplyDerivFactors(
+                const int                                    dir,
+                const Array<OneD, Array<OneD, NekDouble> >  &in,
+                      Array<OneD, Array<OneD, NekDouble> >  &out);
+
+        void ApplyDerivFactorsTranspose(
+                const Array<OneD, Array<OneD, const NekDouble> > &in,
+                      Array<OneD, Array<OneD,       NekDouble> > &out);
+
     private:
+        std::vector<StdRegions::StdExpansionSharedPtr> m_collExp;
         std::map<GeomData,Array<OneD, NekDouble> > m_oneDGeomData;
         std::map<GeomData,Array<TwoD, NekDouble> > m_twoDGeomData;
+        bool m_deformed;
+        bool m_deformedSet;
+        bool m_metricOnTheFly;
+        /// Derivative factors of a single element, reused between elements.
+        Array<TwoD, NekDouble> m_dfacScratch;
+        /// Workspace for evaluating the derivative factors of an element.
+        SpatialDomains::DerivFactorsWork m_dfacWork;
+
+        Array<TwoD, const NekDouble> GetElmtDerivFactors(const int elmt,
+                                                         bool &deformed);
 };
 
 typedef std::shared_ptr<CoalescedGeomData>   CoalescedGeomDataSharedPtr;
@@ -45,10 +45,12 @@ namespace Collections {
  */
 Collection::Collection(
         vector<StdRegions::StdExpansionSharedPtr>    pCollExp,
-        OperatorImpMap                              &impTypes)
+        OperatorImpMap                              &impTypes,
+        const bool                                   metricOnTheFly)
 {
     // Initialise geometry data.
-    m_geomData = MemoryManager<CoalescedGeomData>::AllocateSharedPtr();
+    m_geomData = MemoryManager<CoalescedGeomData>::AllocateSharedPtr(
+        pCollExp, metricOnTheFly);
 
     // Loop over all operator types.
     for (int i = 0; i < SIZE_OperatorType; ++i)
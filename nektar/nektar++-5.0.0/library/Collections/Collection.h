@@ -56,7 +56,9 @@ class Collection
 
         COLLECTIONS_EXPORT Collection(
                 std::vector<StdRegions::StdExpansionSharedPtr>  pCollExp,
-                OperatorImpMap                                 &impTypes);
+                OperatorImpMap                                 &impTypes,
+                const bool                                      metricOnTheFly
+                                                                    = false);
 
         inline void ApplyOperator(
                 const OperatorType                           &op,
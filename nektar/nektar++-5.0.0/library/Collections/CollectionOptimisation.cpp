@@ -61,6 +61,7 @@ CollectionOptimisation::CollectionOptimisation(
 
     m_setByXml    = false;
     m_autotune    = false;
+    m_metricOnTheFly = false;
     m_maxCollSize = 0;
     m_defaultType = defaultType == eNoImpType ? eIterPerExp : defaultType;
 
@@ -137,6 +138,23 @@ CollectionOptimisation::CollectionOptimisation(
             const char *maxSize = xmlCol->Attribute("MAXSIZE");
             m_maxCollSize = (maxSize ? atoi(maxSize) : 0);
 
+            // Select whether metric terms are stored or recomputed
+            const char *metric = xmlCol->Attribute("METRIC");
+            if (metric)
+            {
+                string metricStr = metric;
+                if (boost::iequals(metricStr, "ONTHEFLY"))
+                {
+                    m_metricOnTheFly = true;
+                }
+                else
+                {
+                    ASSERTL0(boost::iequals(metricStr, "STORED"),
+                             "METRIC should be STORED or ONTHEFLY, not "
+                             + metricStr);
+                }
+            }
+
             const char *defaultImpl = xmlCol->Attribute("DEFAULT");
             m_defaultType = defaultType;
 
@@ -251,6 +269,12 @@ CollectionOptimisation::CollectionOptimisation(
             // Print out operator map
             if (verbose)
             {
+                if (m_metricOnTheFly)
+                {
+                    cout << "Collection derivative factors of deformed "
+                         << "elements computed on the fly" << endl;
+                }
+
                 if (!m_setByXml && !m_autotune)
                 {
                     cout << "Setting Collection optimisation using: "
@@ -135,6 +135,13 @@ class CollectionOptimisation
             return m_autotune;
         }
 
+        /// Whether derivative factors of deformed elements should be
+        /// recomputed on demand rather than stored.
+        bool IsUsingMetricOnTheFly()
+        {
+            return m_metricOnTheFly;
+        }
+
         /// Get Operator Implementation Map from XMl or using default;
         COLLECTIONS_EXPORT OperatorImpMap  GetOperatorImpMap(
                 StdRegions::StdExpansionSharedPtr pExp);
@@ -157,6 +164,7 @@ class CollectionOptimisation
         std::map<OperatorType, std::map<ElmtOrder, ImplementationType> > m_global;
         bool m_setByXml;
         bool m_autotune;
+        bool m_metricOnTheFly;
         ImplementationType m_defaultType;
         unsigned int m_maxCollSize;
 };
@@ -75,7 +75,8 @@ class IProductWRTBase_StdMat : public Operator
             ASSERTL1(wsp.num_elements() == m_wspSize,
                      "Incorrect workspace size");
 
-            Vmath::Vmul(m_jac.num_elements(),m_jac,1,input,1,wsp,1);
+            GeomVmul(m_deformed, m_numElmt, m_stdExp->GetTotPoints()*m_numElmt,
+                     &m_jac[0], input, wsp);
 
             Blas::Dgemm('N', 'N', m_mat->GetRows(), m_numElmt,
                         m_mat->GetColumns(), 1.0, m_mat->GetRawPtr(),
@@ -96,6 +97,7 @@ class IProductWRTBase_StdMat : public Operator
     protected:
         DNekMatSharedPtr                m_mat;
         Array<OneD, const NekDouble>    m_jac;
+        bool                            m_deformed;
 
     private:
         IProductWRTBase_StdMat(
@@ -103,7 +105,8 @@ class IProductWRTBase_StdMat : public Operator
                 CoalescedGeomDataSharedPtr                pGeomData)
             : Operator(pCollExp, pGeomData)
         {
-            m_jac = pGeomData->GetJac(pCollExp);
+            m_jac      = pGeomData->GetJac(pCollExp);
+            m_deformed = pGeomData->IsDeformed(pCollExp);
             StdRegions::StdMatrixKey key(StdRegions::eIProductWRTBase,
                                          m_stdExp->DetShapeType(), *m_stdExp);
             m_mat = m_stdExp->GetStdMatrix(key);
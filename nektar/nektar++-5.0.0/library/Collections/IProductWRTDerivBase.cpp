@@ -89,21 +89,12 @@ class IProductWRTDerivBase_StdMat : public Operator
             }
 
             // calculate dx/dxi in[0] + dy/dxi in[1] + dz/dxi in[2]
-            for(int i = 0; i < m_dim; ++i)
-            {
-                Vmath::Vmul (ntot,m_derivFac[i],1, in[0],1,
-                             tmp[i],1);
-                for(int j = 1; j < m_coordim; ++j)
-                {
-                    Vmath::Vvtvp (ntot,m_derivFac[i +j*m_dim],1,
-                                  in[j],1, tmp[i], 1, tmp[i],1);
-                }
-            }
+            m_geomData->ApplyDerivFactorsTranspose(in, tmp);
 
             // calculate Iproduct WRT Std Deriv
 
             // First component
-            Vmath::Vmul(ntot,m_jac,1,tmp[0],1,tmp[0],1);
+            GeomVmul(m_deformed, m_numElmt, ntot, &m_jac[0], tmp[0], tmp[0]);
             Blas::Dgemm('N', 'N', m_iProdWRTStdDBase[0]->GetRows(),
                         m_numElmt,m_iProdWRTStdDBase[0]->GetColumns(),
                         1.0, m_iProdWRTStdDBase[0]->GetRawPtr(),
@@ -114,7 +105,8 @@ class IProductWRTDerivBase_StdMat : public Operator
             // Other components
             for(int i = 1; i < m_dim; ++i)
             {
-                Vmath::Vmul(ntot,m_jac,1,tmp[i],1,tmp[i],1);
+                GeomVmul(m_deformed, m_numElmt, ntot, &m_jac[0], tmp[i],
+                         tmp[i]);
                 Blas::Dgemm('N', 'N', m_iProdWRTStdDBase[i]->GetRows(),
                             m_numElmt,m_iProdWRTStdDBase[i]->GetColumns(),
                             1.0, m_iProdWRTStdDBase[i]->GetRawPtr(),
@@ -136,7 +128,8 @@ class IProductWRTDerivBase_StdMat : public Operator
 
     protected:
         Array<OneD, DNekMatSharedPtr>   m_iProdWRTStdDBase;
-        Array<TwoD, const NekDouble>    m_derivFac;
+        CoalescedGeomDataSharedPtr      m_geomData;
+        bool                            m_deformed;
         Array<OneD, const NekDouble>    m_jac;
         int                             m_dim;
         int                             m_coordim;
@@ -171,7 +164,8 @@ class IProductWRTDerivBase_StdMat : public Operator
                                      + j*nmodes, 1);
                 }
             }
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_geomData = pGeomData;
+            m_deformed = pGeomData->IsDeformed(pCollExp);
             m_jac      = pGeomData->GetJac(pCollExp);
             m_wspSize = m_dim*nqtot*m_numElmt;
         }
@@ -263,20 +257,11 @@ class IProductWRTDerivBase_IterPerExp : public Operator
             }
 
             // calculate dx/dxi in[0] + dy/dxi in[2] + dz/dxi in[3]
-            for(int i = 0; i < m_dim; ++i)
-            {
-                Vmath::Vmul (ntot,m_derivFac[i],1, in[0],1,
-                             tmp[i],1);
-                for(int j = 1; j < m_coordim; ++j)
-                {
-                    Vmath::Vvtvp (ntot,m_derivFac[i +j*m_dim],1,
-                                  in[j],1, tmp[i], 1, tmp[i],1);
-                }
-            }
+            m_geomData->ApplyDerivFactorsTranspose(in, tmp);
 
             // calculate Iproduct WRT Std Deriv
             // first component
-            Vmath::Vmul(ntot,m_jac,1,tmp[0],1,tmp[0],1);
+            GeomVmul(m_deformed, m_numElmt, ntot, &m_jac[0], tmp[0], tmp[0]);
             for(int n = 0; n < m_numElmt; ++n)
             {
                 m_stdExp->IProductWRTDerivBase(0,tmp[0]+n*nPhys,
@@ -287,7 +272,8 @@ class IProductWRTDerivBase_IterPerExp : public Operator
             for(int i = 1; i < m_dim; ++i)
             {
                 // multiply by Jacobian
-                Vmath::Vmul(ntot,m_jac,1,tmp[i],1,tmp[i],1);
+                GeomVmul(m_deformed, m_numElmt, ntot, &m_jac[0], tmp[i],
+                         tmp[i]);
                 for(int n = 0; n < m_numElmt; ++n)
                 {
                     m_stdExp->IProductWRTDerivBase(i,tmp[i]+n*nPhys,tmp[0]);
@@ -308,7 +294,8 @@ class IProductWRTDerivBase_IterPerExp : public Operator
         }
 
     protected:
-        Array<TwoD, const NekDouble>    m_derivFac;
+        CoalescedGeomDataSharedPtr      m_geomData;
+        bool                            m_deformed;
         Array<OneD, const NekDouble>    m_jac;
         int                             m_dim;
         int                             m_coordim;
@@ -325,7 +312,8 @@ class IProductWRTDerivBase_IterPerExp : public Operator
 
             int nqtot  = m_stdExp->GetTotPoints();
 
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_geomData = pGeomData;
+            m_deformed = pGeomData->IsDeformed(pCollExp);
             m_jac      = pGeomData->GetJac(pCollExp);
             m_wspSize  = m_dim*nqtot*m_numElmt;
         }
@@ -523,9 +511,8 @@ class IProductWRTDerivBase_SumFac_Seg : public Operator
             boost::ignore_unused(output1, output2);
 
             Vmath::Vmul(m_numElmt*m_nquad0, m_jac, 1, input, 1, wsp, 1);
-            Vmath::Vmul(m_numElmt*m_nquad0, &m_derivFac[0][0], 1,
-                                            &wsp[0],           1,
-                                            &wsp[0],           1);
+            GeomVmul(m_deformed, m_numElmt, m_numElmt*m_nquad0,
+                     &m_derivFac[0][0], wsp, wsp);
 
             // out = B0*in;
             Blas::Dgemm('T', 'N', m_nmodes0, m_numElmt, m_nquad0,
@@ -550,6 +537,7 @@ class IProductWRTDerivBase_SumFac_Seg : public Operator
         Array<OneD, const NekDouble>    m_jac;
         Array<OneD, const NekDouble>    m_derbase0;
         Array<TwoD, const NekDouble>    m_derivFac;
+        bool                            m_deformed;
 
     private:
         IProductWRTDerivBase_SumFac_Seg(
@@ -562,6 +550,7 @@ class IProductWRTDerivBase_SumFac_Seg : public Operator
         {
             m_wspSize = m_numElmt*m_nquad0;
             m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_deformed = pGeomData->IsDeformed(pCollExp);
             m_jac = pGeomData->GetJacWithStdWeights(pCollExp);
         }
 };
@@ -609,16 +598,7 @@ class IProductWRTDerivBase_SumFac_Quad : public Operator
             wsp1   = wsp + 2*nmax;
 
             // calculate dx/dxi in[0] + dy/dxi in[1]
-            for(int i = 0; i < 2; ++i)
-            {
-                Vmath::Vmul (ntot,m_derivFac[i],1, in[0],1,
-                             tmp[i],1);
-                for(int j = 1; j < 2; ++j)
-                {
-                    Vmath::Vvtvp (ntot,m_derivFac[i +j*2],1,
-                                  in[j],1, tmp[i], 1, tmp[i],1);
-                }
-            }
+            m_geomData->ApplyDerivFactorsTranspose(in, tmp);
 
             // Iproduct wrt derivative of base 0
             QuadIProduct(false, m_colldir1,m_numElmt,
@@ -655,7 +635,7 @@ class IProductWRTDerivBase_SumFac_Quad : public Operator
         const bool                      m_colldir0;
         const bool                      m_colldir1;
         int                             m_coordim;
-        Array<TwoD, const NekDouble>    m_derivFac;
+        CoalescedGeomDataSharedPtr      m_geomData;
         Array<OneD, const NekDouble>    m_jac;
         Array<OneD, const NekDouble>    m_base0;
         Array<OneD, const NekDouble>    m_base1;
@@ -681,7 +661,7 @@ class IProductWRTDerivBase_SumFac_Quad : public Operator
             LibUtilities::PointsKeyVector PtsKey = m_stdExp->GetPointsKeys();
             m_coordim  = pCollExp[0]->GetCoordim();
 
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_geomData = pGeomData;
             m_jac      = pGeomData->GetJacWithStdWeights(pCollExp);
             m_wspSize  = 4 * m_numElmt * (max(m_nquad0*m_nquad1,
                                               m_nmodes0*m_nmodes1));
@@ -761,16 +741,7 @@ class IProductWRTDerivBase_SumFac_Tri : public Operator
             tmp[0] = wsp; tmp[1] = wsp + nmax;
             wsp1   = wsp + 2*nmax;
 
-            for(int i = 0; i < 2; ++i)
-            {
-                Vmath::Vmul (ntot,m_derivFac[i],1, in[0],1, tmp[i],1);
-
-                for(int j = 1; j < 2; ++j)
-                {
-                    Vmath::Vvtvp (ntot,m_derivFac[i +j*2],1,
-                                  in[j],1, tmp[i], 1, tmp[i],1);
-                }
-            }
+            m_geomData->ApplyDerivFactorsTranspose(in, tmp);
 
             // Multiply by factor: 2/(1-z1)
             for (int i = 0; i < m_numElmt; ++i)
@@ -815,7 +786,7 @@ class IProductWRTDerivBase_SumFac_Tri : public Operator
         const bool                      m_colldir0;
         const bool                      m_colldir1;
         int                             m_coordim;
-        Array<TwoD, const NekDouble>    m_derivFac;
+        CoalescedGeomDataSharedPtr      m_geomData;
         Array<OneD, const NekDouble>    m_jac;
         Array<OneD, const NekDouble>    m_base0;
         Array<OneD, const NekDouble>    m_base1;
@@ -844,7 +815,7 @@ class IProductWRTDerivBase_SumFac_Tri : public Operator
             LibUtilities::PointsKeyVector PtsKey = m_stdExp->GetPointsKeys();
             m_coordim  = pCollExp[0]->GetCoordim();
 
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_geomData = pGeomData;
             m_jac      = pGeomData->GetJacWithStdWeights(pCollExp);
             m_wspSize  = 4 * m_numElmt * (max(m_nquad0*m_nquad1,
                                               m_nmodes0*m_nmodes1));
@@ -932,16 +903,7 @@ class IProductWRTDerivBase_SumFac_Hex : public Operator
             }
 
             // calculate dx/dxi in[0] + dy/dxi in[1] + dz/dxi in[2]
-            for(int i = 0; i < 3; ++i)
-            {
-                Vmath::Vmul (ntot,m_derivFac[i],1, in[0],1,
-                             tmp[i],1);
-                for(int j = 1; j < 3; ++j)
-                {
-                    Vmath::Vvtvp (ntot,m_derivFac[i+3*j],1,
-                                  in[j],1, tmp[i], 1, tmp[i],1);
-                }
-            }
+            m_geomData->ApplyDerivFactorsTranspose(in, tmp);
 
             wsp1   = wsp + 3*nmax;
 
@@ -994,7 +956,7 @@ class IProductWRTDerivBase_SumFac_Hex : public Operator
         Array<OneD, const NekDouble>    m_derbase0;
         Array<OneD, const NekDouble>    m_derbase1;
         Array<OneD, const NekDouble>    m_derbase2;
-        Array<TwoD, const NekDouble>    m_derivFac;
+        CoalescedGeomDataSharedPtr      m_geomData;
 
     private:
         IProductWRTDerivBase_SumFac_Hex(
@@ -1021,7 +983,7 @@ class IProductWRTDerivBase_SumFac_Hex : public Operator
             m_jac      = pGeomData->GetJacWithStdWeights(pCollExp);
             m_wspSize  = 6 * m_numElmt * (max(m_nquad0*m_nquad1*m_nquad2,
                                               m_nmodes0*m_nmodes1*m_nmodes2));
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_geomData = pGeomData;
         }
 };
 
@@ -1120,15 +1082,7 @@ class IProductWRTDerivBase_SumFac_Tet : public Operator
                 tmp[i] = wsp + i*nmax;
             }
 
-            for(int i = 0; i < 3; ++i)
-            {
-                Vmath::Vmul (ntot,m_derivFac[i],1, in[0],1,tmp[i],1);
-                for(int j = 1; j < 3; ++j)
-                {
-                    Vmath::Vvtvp (ntot,m_derivFac[i+3*j],1,
-                                  in[j],1, tmp[i], 1, tmp[i],1);
-                }
-            }
+            m_geomData->ApplyDerivFactorsTranspose(in, tmp);
 
             wsp1   = wsp + 3*nmax;
 
@@ -1204,7 +1158,7 @@ class IProductWRTDerivBase_SumFac_Tet : public Operator
         Array<OneD, const NekDouble>    m_derbase0;
         Array<OneD, const NekDouble>    m_derbase1;
         Array<OneD, const NekDouble>    m_derbase2;
-        Array<TwoD, const NekDouble>    m_derivFac;
+        CoalescedGeomDataSharedPtr      m_geomData;
         Array<OneD, NekDouble>          m_fac0;
         Array<OneD, NekDouble>          m_fac1;
         Array<OneD, NekDouble>          m_fac2;
@@ -1233,7 +1187,7 @@ class IProductWRTDerivBase_SumFac_Tet : public Operator
             m_jac      = pGeomData->GetJacWithStdWeights(pCollExp);
             m_wspSize  = 6 * m_numElmt * (max(m_nquad0*m_nquad1*m_nquad2,
                                               m_nmodes0*m_nmodes1*m_nmodes2));
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_geomData = pGeomData;
 
 
             const Array<OneD, const NekDouble>& z0
@@ -1371,16 +1325,7 @@ class IProductWRTDerivBase_SumFac_Prism : public Operator
                 tmp[i] = wsp + i*nmax;
             }
 
-            for(int i = 0; i < 3; ++i)
-            {
-                Vmath::Vmul (ntot,m_derivFac[i],1, in[0],1,
-                             tmp[i],1);
-                for(int j = 1; j < 3; ++j)
-                {
-                    Vmath::Vvtvp (ntot,m_derivFac[i+3*j],1,
-                                  in[j],1, tmp[i], 1, tmp[i],1);
-                }
-            }
+            m_geomData->ApplyDerivFactorsTranspose(in, tmp);
             wsp1   = wsp + 3*nmax;
 
             // Sort into eta factors
@@ -1442,7 +1387,7 @@ class IProductWRTDerivBase_SumFac_Prism : public Operator
         Array<OneD, const NekDouble>    m_derbase0;
         Array<OneD, const NekDouble>    m_derbase1;
         Array<OneD, const NekDouble>    m_derbase2;
-        Array<TwoD, const NekDouble>    m_derivFac;
+        CoalescedGeomDataSharedPtr      m_geomData;
         Array<OneD, NekDouble>          m_fac0;
         Array<OneD, NekDouble>          m_fac1;
         bool                            m_sortTopVertex;
@@ -1469,7 +1414,7 @@ class IProductWRTDerivBase_SumFac_Prism : public Operator
             m_jac      = pGeomData->GetJacWithStdWeights(pCollExp);
             m_wspSize  = 6 * m_numElmt * (max(m_nquad0*m_nquad1*m_nquad2,
                                               m_nmodes0*m_nmodes1*m_nmodes2));
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_geomData = pGeomData;
 
             if(m_stdExp->GetBasis(0)->GetBasisType()
                     == LibUtilities::eModified_A)
@@ -1608,15 +1553,7 @@ class IProductWRTDerivBase_SumFac_Pyr : public Operator
                 tmp[i] = wsp + i*nmax;
             }
             
-            for(int i = 0; i < 3; ++i)
-            {
-                Vmath::Vmul (ntot,m_derivFac[i],1, in[0],1, tmp[i],1);
-                for(int j = 1; j < 3; ++j)
-                {
-                    Vmath::Vvtvp (ntot,m_derivFac[i+3*j],1,
-                                  in[j],1, tmp[i], 1, tmp[i],1);
-                }
-            }
+            m_geomData->ApplyDerivFactorsTranspose(in, tmp);
             wsp1   = wsp + 3*nmax;
 
             // Sort into eta factors
@@ -1686,7 +1623,7 @@ class IProductWRTDerivBase_SumFac_Pyr : public Operator
         Array<OneD, const NekDouble>    m_derbase0;
         Array<OneD, const NekDouble>    m_derbase1;
         Array<OneD, const NekDouble>    m_derbase2;
-        Array<TwoD, const NekDouble>    m_derivFac;
+        CoalescedGeomDataSharedPtr      m_geomData;
         Array<OneD, NekDouble>          m_fac0;
         Array<OneD, NekDouble>          m_fac1;
         Array<OneD, NekDouble>          m_fac2;
@@ -1714,7 +1651,7 @@ class IProductWRTDerivBase_SumFac_Pyr : public Operator
             m_jac      = pGeomData->GetJacWithStdWeights(pCollExp);
             m_wspSize  = 6 * m_numElmt * (max(m_nquad0*m_nquad1*m_nquad2,
                                               m_nmodes0*m_nmodes1*m_nmodes2));
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_geomData = pGeomData;
 
             if(m_stdExp->GetBasis(0)->GetBasisType()
                     == LibUtilities::eModified_A)
@@ -92,17 +92,7 @@ class PhysDeriv_StdMat : public Operator
             }
 
             // calculate full derivative
-            for(int i = 0; i < m_coordim; ++i)
-            {
-                Vmath::Zero(ntot,out[i],1);
-                for(int j = 0; j < m_dim; ++j)
-                {
-                    Vmath::Vvtvp (ntot, m_derivFac[i*m_dim+j], 1,
-                                        Diff[j],               1,
-                                        out[i],                1,
-                                        out[i],                1);
-                }
-            }
+            m_geomData->ApplyDerivFactors(-1, Diff, out);
         }
 
         virtual void operator()(
@@ -132,19 +122,13 @@ class PhysDeriv_StdMat : public Operator
             }
 
             // calculate full derivative
-            Vmath::Zero(ntot,output,1);
-            for(int j = 0; j < m_dim; ++j)
-            {
-                Vmath::Vvtvp (ntot, m_derivFac[dir*m_dim+j], 1,
-                                    Diff[j],               1,
-                                    output,                1,
-                                    output,                1);
-            }
+            Array<OneD, Array<OneD, NekDouble> > out(1, output);
+            m_geomData->ApplyDerivFactors(dir, Diff, out);
         }
 
     protected:
         Array<OneD, DNekMatSharedPtr>   m_derivMat;
-        Array<TwoD, const NekDouble>    m_derivFac;
+        CoalescedGeomDataSharedPtr      m_geomData;
         int                             m_dim;
         int                             m_coordim;
 
@@ -179,7 +163,7 @@ class PhysDeriv_StdMat : public Operator
                                  &(m_derivMat[i]->GetPtr())[0] + j*nqtot, 1);
                 }
             }
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_geomData = pGeomData;
             m_wspSize = 3*nqtot*m_numElmt;
         }
 };
@@ -264,17 +248,7 @@ class PhysDeriv_IterPerExp : public Operator
             }
 
             // calculate full derivative
-            for(int i = 0; i < m_coordim; ++i)
-            {
-                Vmath::Vmul(ntot,m_derivFac[i*m_dim],1,Diff[0],1,out[i],1);
-                for(int j = 1; j < m_dim; ++j)
-                {
-                    Vmath::Vvtvp (ntot, m_derivFac[i*m_dim+j], 1,
-                                        Diff[j],               1,
-                                        out[i],                1,
-                                        out[i],                1);
-                }
-            }
+            m_geomData->ApplyDerivFactors(-1, Diff, out);
         }
 
         virtual void operator()(
@@ -303,18 +277,12 @@ class PhysDeriv_IterPerExp : public Operator
             }
 
             // calculate full derivative
-            Vmath::Vmul(ntot,m_derivFac[dir*m_dim],1,Diff[0],1,output,1);
-            for(int j = 1; j < m_dim; ++j)
-            {
-                Vmath::Vvtvp (ntot, m_derivFac[dir*m_dim+j], 1,
-                                    Diff[j],               1,
-                                    output,                1,
-                                    output,                1);
-            }
+            Array<OneD, Array<OneD, NekDouble> > out(1, output);
+            m_geomData->ApplyDerivFactors(dir, Diff, out);
         }
 
     protected:
-        Array<TwoD, const NekDouble>    m_derivFac;
+        CoalescedGeomDataSharedPtr      m_geomData;
         int                             m_dim;
         int                             m_coordim;
 
@@ -333,7 +301,7 @@ class PhysDeriv_IterPerExp : public Operator
             {
                 nqtot *= PtsKey[i].GetNumPoints();
             }
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_geomData = pGeomData;
             m_wspSize = 3*nqtot*m_numElmt;
         }
 };
@@ -537,17 +505,12 @@ class PhysDeriv_SumFac_Seg : public Operator
                         input.get(), m_nquad0, 0.0,
                         diff0.get(), m_nquad0);
 
-            Vmath::Vmul  (nqcol, m_derivFac[0], 1, diff0, 1, output0, 1);
-
-            if (m_coordim == 2)
-            {
-                Vmath::Vmul  (nqcol, m_derivFac[1], 1, diff0, 1, output1, 1);
-            }
-            else if (m_coordim == 3)
-            {
-                Vmath::Vmul  (nqcol, m_derivFac[1], 1, diff0, 1, output1, 1);
-                Vmath::Vmul  (nqcol, m_derivFac[2], 1, diff0, 1, output2, 1);
-            }
+            // calculate full derivative
+            Array<OneD, Array<OneD, NekDouble> > Diff(1);
+            Diff[0] = diff0;
+            Array<OneD, Array<OneD, NekDouble> > out(3);
+            out[0] = output0; out[1] = output1; out[2] = output2;
+            m_geomData->ApplyDerivFactors(-1, Diff, out);
         }
 
         virtual void operator()(
@@ -570,13 +533,17 @@ class PhysDeriv_SumFac_Seg : public Operator
                         input.get(), m_nquad0, 0.0,
                         diff0.get(), m_nquad0);
 
-            Vmath::Vmul(nqcol, m_derivFac[dir], 1, diff0, 1, output, 1);
+            // calculate full derivative
+            Array<OneD, Array<OneD, NekDouble> > Diff(1);
+            Diff[0] = diff0;
+            Array<OneD, Array<OneD, NekDouble> > out(1, output);
+            m_geomData->ApplyDerivFactors(dir, Diff, out);
         }
 
     protected:
         int                             m_coordim;
         const int                       m_nquad0;
-        Array<TwoD, const NekDouble>    m_derivFac;
+        CoalescedGeomDataSharedPtr      m_geomData;
         NekDouble                      *m_Deriv0;
 
     private:
@@ -589,7 +556,7 @@ class PhysDeriv_SumFac_Seg : public Operator
             LibUtilities::PointsKeyVector PtsKey = m_stdExp->GetPointsKeys();
             m_coordim = pCollExp[0]->GetCoordim();
 
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_geomData = pGeomData;
 
             m_Deriv0 = &((m_stdExp->GetBasis(0)->GetD())->GetPtr())[0];
             m_wspSize = m_nquad0*m_numElmt;
@@ -649,19 +616,13 @@ class PhysDeriv_SumFac_Quad : public Operator
                             diff1.get() + cnt, m_nquad0);
             }
 
-            Vmath::Vmul  (nqcol, m_derivFac[0], 1, diff0, 1, output0, 1);
-            Vmath::Vvtvp (nqcol, m_derivFac[1], 1, diff1, 1, output0, 1,
-                                                             output0, 1);
-            Vmath::Vmul  (nqcol, m_derivFac[2], 1, diff0, 1, output1, 1);
-            Vmath::Vvtvp (nqcol, m_derivFac[3], 1, diff1, 1, output1, 1,
-                                                             output1, 1);
-
-            if (m_coordim == 3)
-            {
-                Vmath::Vmul  (nqcol, m_derivFac[4], 1, diff0, 1, output2, 1);
-                Vmath::Vvtvp (nqcol, m_derivFac[5], 1, diff1, 1, output2, 1,
-                                                                 output2, 1);
-            }
+            // calculate full derivative
+            Array<OneD, Array<OneD, NekDouble> > Diff(2);
+            Diff[0] = diff0;
+            Diff[1] = diff1;
+            Array<OneD, Array<OneD, NekDouble> > out(3);
+            out[0] = output0; out[1] = output1; out[2] = output2;
+            m_geomData->ApplyDerivFactors(-1, Diff, out);
         }
 
         virtual void operator()(
@@ -695,16 +656,19 @@ class PhysDeriv_SumFac_Quad : public Operator
                             diff1.get() + cnt, m_nquad0);
             }
 
-            Vmath::Vmul  (nqcol, m_derivFac[2*dir]  , 1, diff0, 1, output, 1);
-            Vmath::Vvtvp (nqcol, m_derivFac[2*dir+1], 1, diff1, 1, output, 1,
-                                                                   output, 1);
+            // calculate full derivative
+            Array<OneD, Array<OneD, NekDouble> > Diff(2);
+            Diff[0] = diff0;
+            Diff[1] = diff1;
+            Array<OneD, Array<OneD, NekDouble> > out(1, output);
+            m_geomData->ApplyDerivFactors(dir, Diff, out);
         }
 
     protected:
         int                             m_coordim;
         const int                       m_nquad0;
         const int                       m_nquad1;
-        Array<TwoD, const NekDouble>    m_derivFac;
+        CoalescedGeomDataSharedPtr      m_geomData;
         NekDouble                      *m_Deriv0;
         NekDouble                      *m_Deriv1;
 
@@ -719,7 +683,7 @@ class PhysDeriv_SumFac_Quad : public Operator
             LibUtilities::PointsKeyVector PtsKey = m_stdExp->GetPointsKeys();
             m_coordim = pCollExp[0]->GetCoordim();
 
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_geomData = pGeomData;
 
             m_Deriv0 = &((m_stdExp->GetBasis(0)->GetD())->GetPtr())[0];
             m_Deriv1 = &((m_stdExp->GetBasis(1)->GetD())->GetPtr())[0];
@@ -787,21 +751,13 @@ class PhysDeriv_SumFac_Tri : public Operator
                              diff1.get()+cnt,1,diff1.get()+cnt,1);
             }
 
-
-            Vmath::Vmul  (nqcol, m_derivFac[0], 1, diff0, 1, output0, 1);
-            Vmath::Vvtvp (nqcol, m_derivFac[1], 1, diff1, 1,
-                          output0, 1, output0, 1);
-            Vmath::Vmul  (nqcol, m_derivFac[2], 1, diff0, 1, output1, 1);
-            Vmath::Vvtvp (nqcol, m_derivFac[3], 1, diff1, 1,
-                          output1, 1, output1, 1);
-
-            if (m_coordim == 3)
-            {
-                Vmath::Vmul  (nqcol, m_derivFac[4], 1, diff0, 1,
-                              output2, 1);
-                Vmath::Vvtvp (nqcol, m_derivFac[5], 1, diff1, 1,
-                              output2, 1, output2, 1);
-            }
+            // calculate full derivative
+            Array<OneD, Array<OneD, NekDouble> > Diff(2);
+            Diff[0] = diff0;
+            Diff[1] = diff1;
+            Array<OneD, Array<OneD, NekDouble> > out(3);
+            out[0] = output0; out[1] = output1; out[2] = output2;
+            m_geomData->ApplyDerivFactors(-1, Diff, out);
         }
 
         virtual void operator()(
@@ -844,17 +800,19 @@ class PhysDeriv_SumFac_Tri : public Operator
                              diff1.get()+cnt,1,diff1.get()+cnt,1);
             }
 
-
-            Vmath::Vmul  (nqcol, m_derivFac[2*dir]  , 1, diff0, 1, output, 1);
-            Vmath::Vvtvp (nqcol, m_derivFac[2*dir+1], 1, diff1, 1, output, 1,
-                                                                   output, 1);
+            // calculate full derivative
+            Array<OneD, Array<OneD, NekDouble> > Diff(2);
+            Diff[0] = diff0;
+            Diff[1] = diff1;
+            Array<OneD, Array<OneD, NekDouble> > out(1, output);
+            m_geomData->ApplyDerivFactors(dir, Diff, out);
         }
 
     protected:
         int                             m_coordim;
         const int                       m_nquad0;
         const int                       m_nquad1;
-        Array<TwoD, const NekDouble>    m_derivFac;
+        CoalescedGeomDataSharedPtr      m_geomData;
         NekDouble                      *m_Deriv0;
         NekDouble                      *m_Deriv1;
         Array<OneD, NekDouble>          m_fac0;
@@ -871,7 +829,7 @@ class PhysDeriv_SumFac_Tri : public Operator
             LibUtilities::PointsKeyVector PtsKey = m_stdExp->GetPointsKeys();
             m_coordim = pCollExp[0]->GetCoordim();
 
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_geomData = pGeomData;
 
             const Array<OneD, const NekDouble>& z0
                                             = m_stdExp->GetBasis(0)->GetZ();
@@ -969,17 +927,7 @@ class PhysDeriv_SumFac_Hex : public Operator
             }
 
             // calculate full derivative
-            for(int i = 0; i < m_coordim; ++i)
-            {
-                Vmath::Vmul(ntot,m_derivFac[i*3],1,Diff[0],1,out[i],1);
-                for(int j = 1; j < 3; ++j)
-                {
-                    Vmath::Vvtvp (ntot, m_derivFac[i*3+j], 1,
-                                        Diff[j],               1,
-                                        out[i],                1,
-                                        out[i],                1);
-                }
-            }
+            m_geomData->ApplyDerivFactors(-1, Diff, out);
         }
 
         virtual void operator()(
@@ -1020,18 +968,12 @@ class PhysDeriv_SumFac_Hex : public Operator
             }
 
             // calculate full derivative
-            Vmath::Vmul(ntot,m_derivFac[dir*3],1,Diff[0],1,output,1);
-            for(int j = 1; j < 3; ++j)
-            {
-                Vmath::Vvtvp (ntot, m_derivFac[dir*3+j], 1,
-                                    Diff[j],               1,
-                                    output,                1,
-                                    output,                1);
-            }
+            Array<OneD, Array<OneD, NekDouble> > out(1, output);
+            m_geomData->ApplyDerivFactors(dir, Diff, out);
         }
 
     protected:
-        Array<TwoD, const NekDouble>    m_derivFac;
+        CoalescedGeomDataSharedPtr      m_geomData;
         int                             m_coordim;
         const int                       m_nquad0;
         const int                       m_nquad1;
@@ -1053,7 +995,7 @@ class PhysDeriv_SumFac_Hex : public Operator
 
             m_coordim = pCollExp[0]->GetCoordim();
 
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_geomData = pGeomData;
 
             m_Deriv0 = &((m_stdExp->GetBasis(0)->GetD())->GetPtr())[0];
             m_Deriv1 = &((m_stdExp->GetBasis(1)->GetD())->GetPtr())[0];
@@ -1161,15 +1103,7 @@ class PhysDeriv_SumFac_Tet : public Operator
             }
 
             // calculate full derivative
-            for(int i = 0; i < m_coordim; ++i)
-            {
-                Vmath::Vmul(ntot,m_derivFac[i*3],1,Diff[0],1,out[i],1);
-                for(int j = 1; j < 3; ++j)
-                {
-                    Vmath::Vvtvp (ntot, m_derivFac[i*3+j], 1,
-                                        Diff[j], 1, out[i], 1, out[i], 1);
-                }
-            }
+            m_geomData->ApplyDerivFactors(-1, Diff, out);
         }
 
         virtual void operator()(
@@ -1246,16 +1180,12 @@ class PhysDeriv_SumFac_Tet : public Operator
             }
 
             // calculate full derivative
-            Vmath::Vmul(ntot,m_derivFac[dir*3],1,Diff[0],1,output,1);
-            for(int j = 1; j < 3; ++j)
-            {
-                Vmath::Vvtvp (ntot, m_derivFac[dir*3+j], 1,
-                                    Diff[j], 1, output, 1, output, 1);
-            }
+            Array<OneD, Array<OneD, NekDouble> > out(1, output);
+            m_geomData->ApplyDerivFactors(dir, Diff, out);
         }
 
     protected:
-        Array<TwoD, const NekDouble>    m_derivFac;
+        CoalescedGeomDataSharedPtr      m_geomData;
         int                             m_coordim;
         const int                       m_nquad0;
         const int                       m_nquad1;
@@ -1281,7 +1211,7 @@ class PhysDeriv_SumFac_Tet : public Operator
 
             m_coordim = pCollExp[0]->GetCoordim();
 
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_geomData = pGeomData;
 
             m_Deriv0 = &((m_stdExp->GetBasis(0)->GetD())->GetPtr())[0];
             m_Deriv1 = &((m_stdExp->GetBasis(1)->GetD())->GetPtr())[0];
@@ -1399,15 +1329,7 @@ class PhysDeriv_SumFac_Prism : public Operator
             }
 
             // calculate full derivative
-            for(int i = 0; i < m_coordim; ++i)
-            {
-                Vmath::Vmul(ntot,m_derivFac[i*3],1,Diff[0],1,out[i],1);
-                for(int j = 1; j < 3; ++j)
-                {
-                    Vmath::Vvtvp (ntot, m_derivFac[i*3+j], 1,
-                                        Diff[j], 1, out[i], 1, out[i], 1);
-                }
-            }
+            m_geomData->ApplyDerivFactors(-1, Diff, out);
         }
 
         virtual void operator()(
@@ -1462,16 +1384,12 @@ class PhysDeriv_SumFac_Prism : public Operator
             }
 
             // calculate full derivative
-            Vmath::Vmul(ntot,m_derivFac[dir*3],1,Diff[0],1,output,1);
-            for(int j = 1; j < 3; ++j)
-            {
-                Vmath::Vvtvp (ntot, m_derivFac[dir*3+j], 1,
-                                    Diff[j], 1, output, 1, output, 1);
-            }
+            Array<OneD, Array<OneD, NekDouble> > out(1, output);
+            m_geomData->ApplyDerivFactors(dir, Diff, out);
         }
 
     protected:
-        Array<TwoD, const NekDouble>    m_derivFac;
+        CoalescedGeomDataSharedPtr      m_geomData;
         int                             m_coordim;
         const int                       m_nquad0;
         const int                       m_nquad1;
@@ -1495,7 +1413,7 @@ class PhysDeriv_SumFac_Prism : public Operator
 
             m_coordim = pCollExp[0]->GetCoordim();
 
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_geomData = pGeomData;
 
             const Array<OneD, const NekDouble>& z0
                                             = m_stdExp->GetBasis(0)->GetZ();
@@ -1609,15 +1527,7 @@ class PhysDeriv_SumFac_Pyr : public Operator
             }
 
             // calculate full derivative
-            for(int i = 0; i < m_coordim; ++i)
-            {
-                Vmath::Vmul(ntot,m_derivFac[i*3],1,Diff[0],1,out[i],1);
-                for(int j = 1; j < 3; ++j)
-                {
-                    Vmath::Vvtvp (ntot, m_derivFac[i*3+j], 1,
-                                        Diff[j], 1, out[i], 1, out[i], 1);
-                }
-            }
+            m_geomData->ApplyDerivFactors(-1, Diff, out);
         }
 
         virtual void operator()(
@@ -1678,16 +1588,12 @@ class PhysDeriv_SumFac_Pyr : public Operator
             }
 
             // calculate full derivative
-            Vmath::Vmul(ntot,m_derivFac[dir*3],1,Diff[0],1,output,1);
-            for(int j = 1; j < 3; ++j)
-            {
-                Vmath::Vvtvp (ntot, m_derivFac[dir*3+j], 1,
-                                    Diff[j], 1, output, 1, output, 1);
-            }
+            Array<OneD, Array<OneD, NekDouble> > out(1, output);
+            m_geomData->ApplyDerivFactors(dir, Diff, out);
         }
 
     protected:
-        Array<TwoD, const NekDouble>    m_derivFac;
+        CoalescedGeomDataSharedPtr      m_geomData;
         int                             m_coordim;
         const int                       m_nquad0;
         const int                       m_nquad1;
@@ -1712,7 +1618,7 @@ class PhysDeriv_SumFac_Pyr : public Operator
 
             m_coordim = pCollExp[0]->GetCoordim();
 
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_geomData = pGeomData;
 
             const Array<OneD, const NekDouble>& z0
                                             = m_stdExp->GetBasis(0)->GetZ();
@@ -0,0 +1,133 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
+
+#include <LibUtilities/Memory/NekMemoryManager.hpp>
+#include <LibUtilities/BasicUtils/SessionReader.h>
+#include <LibUtilities/BasicUtils/Vmath.hpp>
+#include <MultiRegions/DisContField2D.h>
+#include <SpatialDomains/MeshGraph.h>
+
+using namespace std;
+using namespace Nektar;
+
+// Updates the time-dependent Dirichlet conditions of a field at several
+// times, and compares the values and coefficients of each boundary region
+// with the direct evaluation of its expression followed by
+// FwdTrans_BndConstrained. Separable conditions are updated by scaling
+// cached values and the others are projected with cached elemental
+// matrices, so that both paths are checked over repeated updates.
+int main(int argc, char *argv[])
+{
+    LibUtilities::SessionReaderSharedPtr vSession
+            = LibUtilities::SessionReader::CreateInstance(argc, argv);
+
+    MultiRegions::DisContField2DSharedPtr Exp;
+    int i, j;
+
+    if(argc < 2)
+    {
+        fprintf(stderr,"Usage: BndCondExpression meshfile\n");
+        exit(1);
+    }
+
+    try
+    {
+        //----------------------------------------------
+        // Read in mesh from input file
+        SpatialDomains::MeshGraphSharedPtr graph2D =
+            SpatialDomains::MeshGraph::Read(vSession);
+        //----------------------------------------------
+
+        //----------------------------------------------
+        // Define Expansion
+        Exp = MemoryManager<MultiRegions::DisContField2D>::
+            AllocateSharedPtr(vSession, graph2D, vSession->GetVariable(0));
+        //----------------------------------------------
+
+        const Array<OneD, const MultiRegions::ExpListSharedPtr> &bndExp =
+            Exp->GetBndCondExpansions();
+        const Array<OneD, const SpatialDomains::BoundaryConditionShPtr>
+            &bndCond = Exp->GetBndConditions();
+
+        NekDouble errSep    = 0.0;
+        NekDouble errNonSep = 0.0;
+        int       nSep      = 0;
+        int       nNonSep   = 0;
+
+        // Each time is visited twice so that the cached data is reused
+        // for a time it has already been evaluated at.
+        const NekDouble times[] = { 0.0, 0.3, 1.1, 0.3, 2.5 };
+        for (auto &time : times)
+        {
+            Exp->EvaluateBoundaryConditions(time, vSession->GetVariable(0));
+
+            for (i = 0; i < bndExp.num_elements(); ++i)
+            {
+                if (bndCond[i]->GetBoundaryConditionType() !=
+                    SpatialDomains::eDirichlet)
+                {
+                    continue;
+                }
+
+                const LibUtilities::Equation &condition =
+                    std::static_pointer_cast<
+                        SpatialDomains::DirichletBoundaryCondition>(
+                            bndCond[i])->m_dirichletCondition;
+
+                //----------------------------------------------
+                // Direct evaluation and projection of the condition
+                int npoints = bndExp[i]->GetNpoints();
+                int ncoeffs = bndExp[i]->GetNcoeffs();
+                Array<OneD, NekDouble> x0(npoints, 0.0);
+                Array<OneD, NekDouble> x1(npoints, 0.0);
+                Array<OneD, NekDouble> x2(npoints, 0.0);
+                Array<OneD, NekDouble> phys  (npoints);
+                Array<OneD, NekDouble> coeffs(ncoeffs);
+
+                bndExp[i]->GetCoords(x0, x1, x2);
+                condition.Evaluate(x0, x1, x2, time, phys);
+                bndExp[i]->FwdTrans_BndConstrained(phys, coeffs);
+                //----------------------------------------------
+
+                NekDouble err = 0.0;
+                for (j = 0; j < npoints; ++j)
+                {
+                    err = max(err, fabs(bndExp[i]->GetPhys()[j] - phys[j]));
+                }
+                for (j = 0; j < ncoeffs; ++j)
+                {
+                    err = max(err,
+                              fabs(bndExp[i]->GetCoeffs()[j] - coeffs[j]));
+                }
+
+                LibUtilities::EquationSharedPtr timeFactor, spaceFactor;
+                if (condition.Separate("t", timeFactor, spaceFactor))
+                {
+                    errSep = max(errSep, err);
+                    ++nSep;
+                }
+                else
+                {
+                    errNonSep = max(errNonSep, err);
+                    ++nNonSep;
+                }
+            }
+        }
+
+        cout << "Separable conditions:     " << nSep    << endl;
+        cout << "Non-separable conditions: " << nNonSep << endl;
+        cout << "L infinity error (variable sep): "    << errSep    << endl;
+        cout << "L infinity error (variable nonsep): " << errNonSep << endl;
+    }
+    catch (const std::runtime_error&)
+    {
+        cout << "Caught an error" << endl;
+        return 1;
+    }
+
+    vSession->Finalise();
+
+    return 0;
+}
@@ -0,0 +1,143 @@
+#include <cstdio>
+#include <cstdlib>
+
+#include <LibUtilities/Memory/NekMemoryManager.hpp>
+#include <LibUtilities/BasicUtils/SessionReader.h>
+#include <LibUtilities/Communication/Comm.h>
+#include <MultiRegions/ContField2D.h>
+#include <SpatialDomains/MeshGraph.h>
+
+using namespace std;
+using namespace Nektar;
+
+// Solves the Helmholtz problem for several right-hand sides sharing one
+// linear system, once field by field and once through HelmSolveMultiple,
+// and reports the largest difference between the two sets of solutions.
+int main(int argc, char *argv[])
+{
+    LibUtilities::SessionReaderSharedPtr vSession
+            = LibUtilities::SessionReader::CreateInstance(argc, argv);
+
+    const int nFields = 3;
+    MultiRegions::ContField2DSharedPtr Exp;
+    Array<OneD, MultiRegions::ExpListSharedPtr> fields(nFields);
+    Array<OneD, Array<OneD, NekDouble> > fce(nFields), single(nFields);
+    Array<OneD, Array<OneD, NekDouble> > multiple(nFields);
+    Array<OneD, NekDouble> xc0, xc1, xc2;
+    StdRegions::ConstFactorMap factors;
+    FlagList flags;
+    int i, nq;
+
+    if(argc < 2)
+    {
+        fprintf(stderr,"Usage: HelmSolveMultiple2D meshfile\n");
+        exit(1);
+    }
+
+    try
+    {
+        //----------------------------------------------
+        // Read in mesh from input file
+        SpatialDomains::MeshGraphSharedPtr graph2D =
+            SpatialDomains::MeshGraph::Read(vSession);
+        //----------------------------------------------
+
+        flags.set(eUseGlobal, false);
+        factors[StdRegions::eFactorLambda] = vSession->GetParameter("Lambda");
+
+        if (vSession->GetComm()->GetRank() == 0)
+        {
+            cout << "Solving 2D Helmholtz for " << nFields << " fields: "
+                 << endl;
+            cout << "         Solver type  : "
+                 << vSession->GetSolverInfo("GlobalSysSoln") << endl;
+            cout << endl;
+        }
+
+        //----------------------------------------------
+        // Define expansions. Copies share the assembly map and therefore
+        // the linear system.
+        Exp = MemoryManager<MultiRegions::ContField2D>::
+            AllocateSharedPtr(vSession,graph2D,vSession->GetVariable(0));
+        for (i = 0; i < nFields; ++i)
+        {
+            fields[i] = MemoryManager<MultiRegions::ContField2D>::
+                AllocateSharedPtr(*Exp);
+        }
+        //----------------------------------------------
+
+        nq  = Exp->GetTotPoints();
+        xc0 = Array<OneD,NekDouble>(nq,0.0);
+        xc1 = Array<OneD,NekDouble>(nq,0.0);
+        xc2 = Array<OneD,NekDouble>(nq,0.0);
+        Exp->GetCoords(xc0,xc1);
+
+        //----------------------------------------------
+        // Define a differently scaled forcing function for each field
+        LibUtilities::EquationSharedPtr ffunc =
+            vSession->GetFunction("Forcing",0);
+        for (i = 0; i < nFields; ++i)
+        {
+            fce[i] = Array<OneD,NekDouble>(nq);
+            ffunc->Evaluate(xc0, xc1, xc2, fce[i]);
+            Vmath::Smul(nq, 1.0 - 0.75*i, fce[i], 1, fce[i], 1);
+        }
+        //----------------------------------------------
+
+        //----------------------------------------------
+        // Solve each field on its own
+        for (i = 0; i < nFields; ++i)
+        {
+            single[i] = Array<OneD,NekDouble>(Exp->GetNcoeffs(), 0.0);
+            fields[i]->HelmSolve(fce[i], single[i], flags, factors);
+        }
+        //----------------------------------------------
+
+        //----------------------------------------------
+        // Solve all fields together
+        for (i = 0; i < nFields; ++i)
+        {
+            multiple[i] = Array<OneD,NekDouble>(Exp->GetNcoeffs(), 0.0);
+        }
+        fields[0]->HelmSolveMultiple(fields, fce, multiple, flags, factors);
+        //----------------------------------------------
+
+        //----------------------------------------------
+        // Compare the two sets of solutions
+        NekDouble vDiff = 0.0;
+        Array<OneD,NekDouble> phys0(nq), phys1(nq);
+        for (i = 0; i < nFields; ++i)
+        {
+            Exp->BwdTrans(single[i], phys0);
+            Exp->BwdTrans(multiple[i], phys1);
+            vDiff = max(vDiff, Exp->Linf(phys0, phys1));
+        }
+        //----------------------------------------------
+
+        //----------------------------------------------
+        // Error of the first field against the exact solution
+        LibUtilities::EquationSharedPtr ex_sol =
+            vSession->GetFunction("ExactSolution",0);
+        ex_sol->Evaluate(xc0, xc1, xc2, phys1);
+        Exp->BwdTrans(multiple[0], phys0);
+
+        NekDouble vLinfError = Exp->Linf(phys0, phys1);
+        NekDouble vL2Error   = Exp->L2  (phys0, phys1);
+        if (vSession->GetComm()->GetRank() == 0)
+        {
+            cout << "L infinity error (variable u): " << vLinfError << endl;
+            cout << "L 2 error (variable u):        " << vL2Error << endl;
+            cout << "L infinity error (variable diff): " << vDiff << endl;
+        }
+        //----------------------------------------------
+    }
+    catch (const std::runtime_error&)
+    {
+        cout << "Caught an error" << endl;
+        return 1;
+    }
+
+    vSession->Finalise();
+
+    return 0;
+}
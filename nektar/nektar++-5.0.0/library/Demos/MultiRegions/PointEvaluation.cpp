@@ -0,0 +1,197 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
+
+#include <LibUtilities/Memory/NekMemoryManager.hpp>
+#include <LibUtilities/BasicUtils/SessionReader.h>
+#include <LibUtilities/BasicUtils/Vmath.hpp>
+#include <MultiRegions/ExpList2D.h>
+#include <MultiRegions/ExpList3D.h>
+#include <MultiRegions/PointEvaluationPlan.h>
+#include <SpatialDomains/MeshGraph.h>
+
+using namespace std;
+using namespace Nektar;
+
+// Quadratic field, which is interpolated exactly from the quadrature points
+// of straight-sided elements.
+static NekDouble Field(const NekDouble x, const NekDouble y, const NekDouble z)
+{
+    return 1.0 + x*y - 0.5*y*z + 0.25*x*x;
+}
+
+// Locates a lattice of points covering the mesh, visited in a scrambled
+// order, with ExpList::GetExpIndices and evaluates a field at these points
+// with a MultiRegions::PointEvaluationPlan. The batched location is checked
+// against the location of each point on its own, the local coordinates are
+// mapped back to the points and the evaluated values are compared with the
+// elemental evaluation and the exact field.
+int main(int argc, char *argv[])
+{
+    LibUtilities::SessionReaderSharedPtr vSession
+            = LibUtilities::SessionReader::CreateInstance(argc, argv);
+
+    MultiRegions::ExpListSharedPtr Exp;
+    int i, d;
+
+    if(argc < 2)
+    {
+        fprintf(stderr,"Usage: PointEvaluation meshfile\n");
+        exit(1);
+    }
+
+    try
+    {
+        //----------------------------------------------
+        // Read in mesh from input file
+        SpatialDomains::MeshGraphSharedPtr graph =
+            SpatialDomains::MeshGraph::Read(vSession);
+        //----------------------------------------------
+
+        //----------------------------------------------
+        // Define Expansion
+        int dim = graph->GetMeshDimension();
+        switch (dim)
+        {
+            case 2:
+                Exp = MemoryManager<MultiRegions::ExpList2D>::
+                    AllocateSharedPtr(vSession, graph);
+                break;
+            case 3:
+                Exp = MemoryManager<MultiRegions::ExpList3D>::
+                    AllocateSharedPtr(vSession, graph);
+                break;
+            default:
+                ASSERTL0(false, "Mesh dimension must be 2 or 3.");
+                break;
+        }
+        //----------------------------------------------
+
+        //----------------------------------------------
+        // Set up the field at the quadrature points
+        int nq = Exp->GetTotPoints();
+        Array<OneD, Array<OneD, NekDouble> > xq(3);
+        for (d = 0; d < 3; ++d)
+        {
+            xq[d] = Array<OneD, NekDouble>(nq, 0.0);
+        }
+        Exp->GetCoords(xq[0], xq[1], xq[2]);
+
+        Array<OneD, NekDouble> phys(nq);
+        for (i = 0; i < nq; ++i)
+        {
+            phys[i] = Field(xq[0][i], xq[1][i], xq[2][i]);
+        }
+        //----------------------------------------------
+
+        //----------------------------------------------
+        // Lattice of points over the bounding box of the mesh, enlarged so
+        // that some points lie outside of the domain. The points are stored
+        // in a scrambled order.
+        const int nLat = dim == 2 ? 40 : 15;
+        int npts = dim == 2 ? nLat * nLat : nLat * nLat * nLat;
+
+        Array<OneD, NekDouble> xmin(dim), len(dim);
+        for (d = 0; d < dim; ++d)
+        {
+            xmin[d] = Vmath::Vmin(nq, xq[d], 1);
+            len [d] = Vmath::Vmax(nq, xq[d], 1) - xmin[d];
+        }
+
+        Array<OneD, Array<OneD, NekDouble> > coords(dim);
+        for (d = 0; d < dim; ++d)
+        {
+            coords[d] = Array<OneD, NekDouble>(npts);
+        }
+        for (i = 0; i < npts; ++i)
+        {
+            int idx = (int)((7919L * i) % npts);
+            for (d = 0; d < dim; ++d)
+            {
+                int    l = idx % nLat;
+                idx     /= nLat;
+                coords[d][i] = xmin[d] - 0.1 * len[d] +
+                    (l + 0.5) * 1.2 * len[d] / nLat;
+            }
+        }
+        //----------------------------------------------
+
+        //----------------------------------------------
+        // Locate the points and evaluate the field
+        MultiRegions::PointEvaluationPlan plan(Exp, coords);
+
+        Array<OneD, NekDouble> values(npts, 0.0);
+        plan.Evaluate(phys, values);
+        //----------------------------------------------
+
+        //----------------------------------------------
+        // Check the location and the evaluation of each point
+        const Array<OneD, const int> &elmtIds = plan.GetElmtIds();
+        const Array<OneD, const Array<OneD, NekDouble> > &locCoords =
+            plan.GetLocCoords();
+
+        int       nMismatch = 0;
+        NekDouble coordErr  = 0.0;
+        NekDouble diff      = 0.0;
+        NekDouble err       = 0.0;
+
+        Array<OneD, NekDouble> gloCoord(3, 0.0), locCoord(3, 0.0);
+        Array<OneD, NekDouble> mapped(3, 0.0), tmp;
+        for (i = 0; i < npts; ++i)
+        {
+            for (d = 0; d < dim; ++d)
+            {
+                gloCoord[d] = coords[d][i];
+            }
+
+            int id = Exp->GetExpIndex(gloCoord, locCoord,
+                                      NekConstants::kNekZeroTol);
+            if ((id >= 0) != (elmtIds[i] >= 0))
+            {
+                ++nMismatch;
+            }
+
+            if (elmtIds[i] < 0)
+            {
+                continue;
+            }
+
+            LocalRegions::ExpansionSharedPtr elmt = Exp->GetExp(elmtIds[i]);
+            for (d = 0; d < dim; ++d)
+            {
+                locCoord[d] = locCoords[d][i];
+            }
+
+            elmt->GetCoord(locCoord, mapped);
+            for (d = 0; d < dim; ++d)
+            {
+                coordErr = max(coordErr, fabs(mapped[d] - gloCoord[d]));
+            }
+
+            NekDouble val = elmt->StdPhysEvaluate(
+                locCoord, tmp = phys + Exp->GetPhys_Offset(elmtIds[i]));
+            diff = max(diff, fabs(values[i] - val));
+            err  = max(err,  fabs(values[i] -
+                                  Field(gloCoord[0], gloCoord[1],
+                                        gloCoord[2])));
+        }
+        //----------------------------------------------
+
+        cout << "Located points:     " << plan.GetNumLocated() << " of "
+             << npts << endl;
+        cout << "Mismatched points:  " << nMismatch << endl;
+        cout << "L infinity error (variable coord): " << coordErr << endl;
+        cout << "L infinity error (variable diff): "  << diff     << endl;
+        cout << "L infinity error (variable u): "     << err      << endl;
+    }
+    catch (const std::runtime_error&)
+    {
+        cout << "Caught an error" << endl;
+        return 1;
+    }
+
+    vSession->Finalise();
+
+    return 0;
+}
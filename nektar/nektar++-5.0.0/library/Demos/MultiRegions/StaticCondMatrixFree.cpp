@@ -0,0 +1,131 @@
+#include <cstdio>
+#include <cstdlib>
+
+#include <LibUtilities/Memory/NekMemoryManager.hpp>
+#include <LibUtilities/BasicUtils/SessionReader.h>
+#include <LibUtilities/Communication/Comm.h>
+#include <MultiRegions/ContField2D.h>
+#include <MultiRegions/ContField3D.h>
+#include <SpatialDomains/MeshGraph.h>
+
+using namespace std;
+using namespace Nektar;
+
+// Solves a Helmholtz problem with iterative static condensation, first
+// using the assembled elemental Schur complements of the session's
+// LocalMatrixStorageStrategy and then with the matrix-free condensed
+// operator, and reports the largest difference between the two solutions.
+int main(int argc, char *argv[])
+{
+    LibUtilities::SessionReaderSharedPtr vSession
+            = LibUtilities::SessionReader::CreateInstance(argc, argv);
+
+    MultiRegions::ExpListSharedPtr Exp;
+    Array<OneD,NekDouble>  fce, sol, xc0, xc1, xc2;
+    StdRegions::ConstFactorMap factors;
+    FlagList flags;
+    int nq;
+
+    if(argc < 2)
+    {
+        fprintf(stderr,"Usage: StaticCondMatrixFree meshfile\n");
+        exit(1);
+    }
+
+    try
+    {
+        ASSERTL0(vSession->DefinesSolverInfo("LocalMatrixStorageStrategy"),
+                 "LocalMatrixStorageStrategy must be defined.");
+
+        //----------------------------------------------
+        // Read in mesh from input file
+        SpatialDomains::MeshGraphSharedPtr graph =
+            SpatialDomains::MeshGraph::Read(vSession);
+        //----------------------------------------------
+
+        factors[StdRegions::eFactorLambda] = vSession->GetParameter("Lambda");
+
+        if (vSession->GetComm()->GetRank() == 0)
+        {
+            cout << "Comparing matrix-free static condensation: " << endl;
+            cout << "         Storage      : "
+                 << vSession->GetSolverInfo("LocalMatrixStorageStrategy")
+                 << endl;
+            cout << endl;
+        }
+
+        //----------------------------------------------
+        // Define Expansion
+        switch (graph->GetMeshDimension())
+        {
+            case 2:
+                Exp = MemoryManager<MultiRegions::ContField2D>::
+                    AllocateSharedPtr(vSession, graph,
+                                      vSession->GetVariable(0));
+                break;
+            case 3:
+                Exp = MemoryManager<MultiRegions::ContField3D>::
+                    AllocateSharedPtr(vSession, graph,
+                                      vSession->GetVariable(0));
+                break;
+            default:
+                ASSERTL0(false, "Mesh dimension must be 2 or 3.");
+                break;
+        }
+        //----------------------------------------------
+
+        nq  = Exp->GetTotPoints();
+        xc0 = Array<OneD,NekDouble>(nq,0.0);
+        xc1 = Array<OneD,NekDouble>(nq,0.0);
+        xc2 = Array<OneD,NekDouble>(nq,0.0);
+        Exp->GetCoords(xc0,xc1,xc2);
+
+        fce = Array<OneD,NekDouble>(nq);
+        vSession->GetFunction("Forcing",0)->Evaluate(xc0, xc1, xc2, fce);
+
+        //----------------------------------------------
+        // Solve with the assembled Schur complement
+        sol = Array<OneD,NekDouble>(Exp->GetNcoeffs(), 0.0);
+        Exp->HelmSolve(fce, sol, flags, factors);
+        Exp->BwdTrans(sol, Exp->UpdatePhys());
+        Array<OneD,NekDouble> assembled(nq);
+        Vmath::Vcopy(nq, Exp->GetPhys(), 1, assembled, 1);
+        //----------------------------------------------
+
+        //----------------------------------------------
+        // Solve with the matrix-free condensed operator
+        vSession->SetSolverInfo("LocalMatrixStorageStrategy", "MatrixFree");
+        Exp->ClearGlobalLinSysManager();
+
+        Vmath::Zero(Exp->GetNcoeffs(), sol, 1);
+        Exp->HelmSolve(fce, sol, flags, factors);
+        Exp->BwdTrans(sol, Exp->UpdatePhys());
+        //----------------------------------------------
+
+        //----------------------------------------------
+        // Compare against each other and the exact solution
+        NekDouble vDiff = Exp->Linf(Exp->GetPhys(), assembled);
+
+        vSession->GetFunction("ExactSolution",0)->Evaluate(
+            xc0, xc1, xc2, fce);
+        NekDouble vLinfError = Exp->Linf(Exp->GetPhys(), fce);
+        NekDouble vL2Error   = Exp->L2  (Exp->GetPhys(), fce);
+
+        if (vSession->GetComm()->GetRank() == 0)
+        {
+            cout << "L infinity error (variable u): " << vLinfError << endl;
+            cout << "L 2 error (variable u):        " << vL2Error << endl;
+            cout << "L infinity error (variable diff): " << vDiff << endl;
+        }
+        //----------------------------------------------
+    }
+    catch (const std::runtime_error&)
+    {
+        cout << "Caught an error" << endl;
+        return 1;
+    }
+
+    vSession->Finalise();
+
+    return 0;
+}
@@ -0,0 +1,29 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Cached evaluation of time-dependent Dirichlet conditions, 2D mixed mesh</description>
+    <executable>BndCondExpression</executable>
+    <parameters>BndCondExpression.xml</parameters>
+    <files>
+        <file description="Session File">BndCondExpression.xml</file>
+    </files>
+
+    <metrics>
+        <metric type="Linf" id="1">
+            <value variable="sep" tolerance="1e-12">0</value>
+            <value variable="nonsep" tolerance="1e-12">0</value>
+        </metric>
+        <metric type="regex" id="2">
+            <regex>^(Separable|Non-separable) conditions:\s*(\d+)</regex>
+            <matches>
+                <match>
+                    <field id="0">Separable</field>
+                    <field id="1">5</field>
+                </match>
+                <match>
+                    <field id="0">Non-separable</field>
+                    <field id="1">5</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
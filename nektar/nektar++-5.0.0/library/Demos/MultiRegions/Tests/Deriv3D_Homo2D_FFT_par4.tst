@@ -0,0 +1,23 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Testing 3D homogeneous 2D derivatives on 2x2 pencils</description>
+    <executable>Deriv3DHomo2D</executable>
+    <parameters>--npy 2 --npz 2 Deriv3D_Homo2D_FFT.xml</parameters>
+    <processes>4</processes>
+    <files>
+        <file description="Session File">Deriv3D_Homo2D_FFT.xml</file>
+    </files>
+
+    <metrics>
+        <metric type="L2" id="1">
+            <value variable="dudx" tolerance="1e-7">0</value>
+            <value variable="dvdy" tolerance="1e-7">0</value>
+            <value variable="dwdz" tolerance="1e-7">0</value>
+        </metric>
+        <metric type="Linf" id="2">
+            <value variable="dudx" tolerance="1e-7">0</value>
+            <value variable="dvdy" tolerance="1e-7">0</value>
+            <value variable="dwdz" tolerance="1e-7">0</value>
+        </metric>
+    </metrics>
+</test>
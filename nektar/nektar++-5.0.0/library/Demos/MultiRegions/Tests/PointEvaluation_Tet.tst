@@ -0,0 +1,25 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Batched point location and evaluation plan, 3D Tet mesh</description>
+    <executable>PointEvaluation</executable>
+    <parameters>Helmholtz3D_Tet.xml</parameters>
+    <files>
+        <file description="Session File">Helmholtz3D_Tet.xml</file>
+    </files>
+
+    <metrics>
+        <metric type="Linf" id="1">
+            <value variable="u" tolerance="1e-8">0</value>
+            <value variable="diff" tolerance="1e-10">0</value>
+            <value variable="coord" tolerance="1e-8">0</value>
+        </metric>
+        <metric type="regex" id="2">
+            <regex>^Mismatched points:\s*(\d+)</regex>
+            <matches>
+                <match>
+                    <field id="0">0</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
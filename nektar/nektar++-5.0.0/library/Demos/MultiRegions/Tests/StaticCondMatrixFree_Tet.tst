@@ -0,0 +1,20 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Matrix-free against assembled Schur complement, 3D tet</description>
+    <executable>StaticCondMatrixFree</executable>
+    <parameters>-I GlobalSysSoln=IterativeStaticCond -I LocalMatrixStorageStrategy=Contiguous Helmholtz3D_Tet.xml</parameters>
+    <files>
+        <file description="Session File">Helmholtz3D_Tet.xml</file>
+    </files>
+
+    <metrics>
+        <metric type="L2" id="1">
+            <value variable="u" tolerance="1e-6">0.000126773</value>
+        </metric>
+        <metric type="Linf" id="2">
+            <value variable="u" tolerance="1e-6">0.00087551</value>
+            <value variable="diff" tolerance="1e-7">0</value>
+        </metric>
+    </metrics>
+</test>
+
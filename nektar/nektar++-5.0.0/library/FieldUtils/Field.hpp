@@ -64,7 +64,8 @@ struct Field
         : m_verbose(false), m_declareExpansionAsContField(false),
           m_declareExpansionAsDisContField(false),
           m_requireBoundaryExpansion(false), m_writeBndFld(false),
-          m_addNormals(false), m_fieldPts(LibUtilities::NullPtsField)
+          m_addNormals(false), m_fieldPts(LibUtilities::NullPtsField),
+          m_nThreads(1)
     {
     }
 
@@ -103,6 +104,9 @@ struct Field
 
     LibUtilities::FieldMetaDataMap m_fieldMetaDataMap;
 
+    /// Number of threads used by the modules for their element-wise work.
+    int m_nThreads;
+
     FIELD_UTILS_EXPORT MultiRegions::ExpListSharedPtr SetUpFirstExpList(
         int NumHomogeneousDir, bool fldfilegiven = false)
     {
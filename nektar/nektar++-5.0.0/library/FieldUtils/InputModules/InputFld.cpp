@@ -80,6 +80,59 @@ InputFld::~InputFld()
 {
 }
 
+/**
+ * @brief Global IDs of the elements of the mesh, or an empty array if
+ * there is no mesh and all of the data are to be loaded.
+ */
+Array<OneD, int> InputFld::GetElementGIDs()
+{
+    if (!m_f->m_graph)
+    {
+        return NullInt1DArray;
+    }
+
+    // Determine IDs of elements in the domain
+    vector<int> IDs;
+    auto domain = m_f->m_graph->GetDomain();
+    for(int d = 0; d < domain.size(); ++d)
+    {
+        for (auto &compIter : domain[d])
+        {
+            for (auto &x : compIter.second->m_geomVec)
+            {
+                IDs.push_back(x->GetGlobalID());
+            }
+        }
+    }
+
+    // Move to an array to match FieldIO interface
+    return Array<OneD, int>(IDs.size(), IDs.data());
+}
+
+/**
+ * @brief Start reading @p fileName on a background thread. The data are
+ * handed over to the field by the next call to Process with this file.
+ */
+void InputFld::Prefetch(const std::string &fileName)
+{
+    Array<OneD, int> ElementGIDs = GetElementGIDs();
+    if (m_f->m_graph && !ElementGIDs.num_elements())
+    {
+        return;
+    }
+
+    LibUtilities::FieldIOSharedPtr fld = m_f->FieldIOForFile(fileName);
+
+    m_prefetchFile = fileName;
+    m_prefetch = std::async(std::launch::async,
+        [this, fld, fileName, ElementGIDs]()
+        {
+            std::lock_guard<std::mutex> lock(GetIOMutex());
+            fld->Import(fileName, m_prefetchDef, m_prefetchData,
+                        m_prefetchMetaData, ElementGIDs);
+        });
+}
+
 /**
  *
  */
@@ -90,44 +143,41 @@ void InputFld::Process(po::variables_map &vm)
     int i;
     string fileName = m_config["infile"].as<string>();
 
-    LibUtilities::FieldIOSharedPtr fld =
-                m_f->FieldIOForFile(fileName);
-
     int oldSize = m_f->m_fielddef.size();
-    if(m_f->m_graph)
+    if (m_prefetch.valid() && m_prefetchFile == fileName)
     {
-        // Determine IDs of elements in the domain
-        vector<int> IDs;
-        auto domain = m_f->m_graph->GetDomain();
-        for(int d = 0; d < domain.size(); ++d)
+        // Rethrows any error raised while reading.
+        m_prefetch.get();
+
+        m_f->m_fielddef.insert(m_f->m_fielddef.end(),
+                               m_prefetchDef.begin(), m_prefetchDef.end());
+        for (auto &data : m_prefetchData)
         {
-            for (auto &compIter : domain[d])
-            {
-                for (auto &x : compIter.second->m_geomVec)
-                {
-                    IDs.push_back(x->GetGlobalID());
-                }
-            }
+            m_f->m_data.push_back(std::move(data));
         }
+        m_f->m_fieldMetaDataMap.insert(m_prefetchMetaData.begin(),
+                                       m_prefetchMetaData.end());
 
-        if (!IDs.size())
+        m_prefetchDef.clear();
+        m_prefetchData.clear();
+        m_prefetchMetaData.clear();
+    }
+    else
+    {
+        Array<OneD, int> ElementGIDs = GetElementGIDs();
+        if (m_f->m_graph && !ElementGIDs.num_elements())
         {
             return;
         }
 
-        // Move to an array to match FieldIO interface
-        Array<OneD, int> ElementGIDs(IDs.size(), IDs.data());
+        LibUtilities::FieldIOSharedPtr fld =
+                    m_f->FieldIOForFile(fileName);
 
+        std::lock_guard<std::mutex> lock(GetIOMutex());
         fld->Import(
             fileName, m_f->m_fielddef, m_f->m_data,
             m_f->m_fieldMetaDataMap, ElementGIDs);
     }
-    else // load all data.
-    {
-        fld->Import(
-            fileName, m_f->m_fielddef, m_f->m_data,
-            m_f->m_fieldMetaDataMap);
-    }
 
     // save field names
     for(i = 0; i < m_f->m_fielddef[oldSize]->m_fields.size(); ++i)
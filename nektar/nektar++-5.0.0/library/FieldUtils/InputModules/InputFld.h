@@ -35,6 +35,8 @@
 #ifndef FIELDUTILS_INPUTFLD
 #define FIELDUTILS_INPUTFLD
 
+#include <future>
+
 #include "../Module.h"
 
 namespace Nektar
@@ -51,6 +53,7 @@ public:
     InputFld(FieldSharedPtr f);
     virtual ~InputFld();
     virtual void Process(po::variables_map &vm);
+    virtual void Prefetch(const std::string &fileName);
 
     /// Creates an instance of this class
     static ModuleSharedPtr create(FieldSharedPtr f)
@@ -76,6 +79,16 @@ public:
     }
 
 private:
+    /// File being read in the background by Prefetch.
+    std::string m_prefetchFile;
+    /// Completion of the background read.
+    std::future<void> m_prefetch;
+    /// Field definitions, data and metadata read by Prefetch.
+    std::vector<LibUtilities::FieldDefinitionsSharedPtr> m_prefetchDef;
+    std::vector<std::vector<NekDouble> > m_prefetchData;
+    LibUtilities::FieldMetaDataMap m_prefetchMetaData;
+
+    Array<OneD, int> GetElementGIDs();
 };
 }
 }
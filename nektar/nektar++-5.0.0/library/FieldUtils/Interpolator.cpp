@@ -33,8 +33,15 @@
 //
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <limits>
+
 #include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
 #include <FieldUtils/Interpolator.h>
+#include <MultiRegions/PointEvaluationPlan.h>
 
 using namespace std;
 
@@ -46,6 +53,89 @@ namespace Nektar
 namespace FieldUtils
 {
 
+/**
+ * @brief Check that the values evaluated at the located points of @p plan
+ * are numbers.
+ */
+static void CheckValues(const MultiRegions::PointEvaluationPlan &plan,
+                        const Array<OneD, const NekDouble>      &values)
+{
+    const Array<OneD, const int> &elmtIds = plan.GetElmtIds();
+    for (int i = 0; i < elmtIds.num_elements(); ++i)
+    {
+        ASSERTL0(elmtIds[i] < 0 || !(boost::math::isnan)(values[i]),
+                 "new value is not a number");
+    }
+}
+
+/// Number of points located between two progress reports.
+static const int kLocateChunkSize = 10000;
+
+/**
+ * @brief Locate the points @p coords in @p exp and set up their evaluation
+ * plan, reporting the progress after each chunk of points.
+ *
+ * The points are located chunk by chunk with ExpList::GetExpIndices and the
+ * plan is then set up from their elements and local coordinates. Without a
+ * progress callback, all points are located at once.
+ */
+static MultiRegions::PointEvaluationPlanSharedPtr CreatePlan(
+    const MultiRegions::ExpListSharedPtr             &exp,
+    const Array<OneD, const Array<OneD, NekDouble> > &coords,
+    const bool                                        nearest,
+    const std::function<void(const int, const int)> &progress)
+{
+    int dim  = coords.num_elements();
+    int npts = coords[0].num_elements();
+
+    if (!progress || npts <= kLocateChunkSize)
+    {
+        MultiRegions::PointEvaluationPlanSharedPtr plan =
+            MemoryManager<MultiRegions::PointEvaluationPlan>::
+                AllocateSharedPtr(exp, coords, NekConstants::kGeomFactorsTol,
+                                  nearest);
+        if (progress)
+        {
+            progress(npts, npts);
+        }
+        return plan;
+    }
+
+    Array<OneD, int> elmtIds(npts);
+    Array<OneD, Array<OneD, NekDouble> > locCoords(dim);
+    for (int d = 0; d < dim; ++d)
+    {
+        locCoords[d] = Array<OneD, NekDouble>(npts);
+    }
+
+    Array<OneD, Array<OneD, NekDouble> > chunk(dim);
+    for (int start = 0; start < npts; start += kLocateChunkSize)
+    {
+        int n = min(kLocateChunkSize, npts - start);
+        for (int d = 0; d < dim; ++d)
+        {
+            chunk[d] = Array<OneD, NekDouble>(n);
+            Vmath::Vcopy(n, &coords[d][start], 1, &chunk[d][0], 1);
+        }
+
+        Array<OneD, int> chunkIds;
+        Array<OneD, Array<OneD, NekDouble> > chunkLoc;
+        exp->GetExpIndices(chunk, chunkIds, chunkLoc,
+                           NekConstants::kGeomFactorsTol, nearest);
+
+        Vmath::Vcopy(n, &chunkIds[0], 1, &elmtIds[start], 1);
+        for (int d = 0; d < dim; ++d)
+        {
+            Vmath::Vcopy(n, &chunkLoc[d][0], 1, &locCoords[d][start], 1);
+        }
+
+        progress(start + n, npts);
+    }
+
+    return MemoryManager<MultiRegions::PointEvaluationPlan>::
+        AllocateSharedPtr(exp, elmtIds, locCoords);
+}
+
 /**
  * @brief Interpolate from one expansion to an other
  *
@@ -54,9 +144,10 @@ namespace FieldUtils
  *
  *
  * In and output fields must have the same dimension and number of fields.
- * Weights are currently not stored for later use.
  * The interpolation is performed by evaluating the expInField at the quadrature
- * points of expOutField, so only eNoMethod is supported.
+ * points of expOutField, so only eNoMethod is supported. The points are
+ * located once and all fields are evaluated with the same
+ * MultiRegions::PointEvaluationPlan.
  * If both expansions use the same mesh, use LibUtilities/Foundations/Interp.h
  * instead.
  */
@@ -77,13 +168,9 @@ void Interpolator::Interpolate(
     m_expInField  = expInField;
     m_expOutField = expOutField;
 
-    int nInDim   = expInField[0]->GetCoordim(0);
     int nOutPts  = m_expOutField[0]->GetTotPoints();
     int nOutDim  = m_expOutField[0]->GetCoordim(0);
-    int lastProg = 0;
 
-    Array<OneD, NekDouble> Lcoords(nInDim, 0.0);
-    Array<OneD, NekDouble> Scoords(nOutDim, 0.0);
     Array<OneD, Array<OneD, NekDouble> > coords(nOutDim);
     for (int i = 0; i < nOutDim; ++i)
     {
@@ -102,62 +189,325 @@ void Interpolator::Interpolate(
         m_expOutField[0]->GetCoords(coords[0], coords[1], coords[2]);
     }
 
-    for (int i = 0; i < nOutPts; ++i)
+    // Locate the points and evaluate the fields with the resulting
+    // weights. We use kGeomFactorsTol as tolerance, the local coordinates
+    // are clamped to the standard region by the plan.
+    MultiRegions::PointEvaluationPlanSharedPtr plan =
+        CreatePlan(m_expInField[0], coords, true, m_progressCallback);
+
+    for (int f = 0; f < m_expInField.size(); ++f)
     {
-        for (int j = 0; j < nOutDim; ++j)
+        Array<OneD, NekDouble> &outPhys = m_expOutField[f]->UpdatePhys();
+        Vmath::Fill(nOutPts, def_value, outPhys, 1);
+        plan->Evaluate(m_expInField[f]->GetPhys(), outPhys);
+
+        CheckValues(*plan, outPhys);
+    }
+}
+
+/**
+ * @brief Evaluate fields at points located on other ranks
+ *
+ * @param comm          communicator over which expInField is partitioned
+ * @param expInField    local partition of the input field
+ * @param coords        coordinates of the local output points
+ * @param route         indices of the output points sent to each rank
+ * @param nearest       attach points to their nearest element
+ * @param found         flag of the output points which have been evaluated
+ * @param values        values of the fields at the output points
+ *
+ * The coordinates of the points are exchanged with AlltoAllv, each rank
+ * evaluates its partition at the points it receives and sends back the
+ * values together with a flag telling whether the point was located. Points
+ * which have already been evaluated by another rank are not overwritten.
+ */
+static void EvaluateRemote(
+    const LibUtilities::CommSharedPtr                 &comm,
+    const vector<MultiRegions::ExpListSharedPtr>      &expInField,
+    const Array<OneD, const Array<OneD, NekDouble> >  &coords,
+    const vector<vector<int> >                        &route,
+    const bool                                         nearest,
+    Array<OneD, int>                                  &found,
+    Array<OneD, Array<OneD, NekDouble> >              &values)
+{
+    int nRanks  = comm->GetSize();
+    int dim     = coords.num_elements();
+    int nFields = values.num_elements();
+    int nVals   = nFields + 1;
+
+    // Exchange the number of points sent to each rank.
+    Array<OneD, int> sendCnt(nRanks), recvCnt(nRanks, 0);
+    for (int r = 0; r < nRanks; ++r)
+    {
+        sendCnt[r] = route[r].size();
+    }
+    comm->AlltoAll(sendCnt, recvCnt);
+
+    int nSend = 0, nRecv = 0;
+    Array<OneD, int> sendSize(nRanks), sendOff(nRanks, 0);
+    Array<OneD, int> recvSize(nRanks), recvOff(nRanks, 0);
+    for (int r = 0; r < nRanks; ++r)
+    {
+        sendSize[r] = dim * sendCnt[r];
+        recvSize[r] = dim * recvCnt[r];
+        if (r > 0)
         {
-            Scoords[j] = coords[j][i];
+            sendOff[r] = sendOff[r - 1] + sendSize[r - 1];
+            recvOff[r] = recvOff[r - 1] + recvSize[r - 1];
         }
+        nSend += sendCnt[r];
+        nRecv += recvCnt[r];
+    }
 
-        // Obtain Element and LocalCoordinate to interpolate
-        int elmtid = m_expInField[0]->GetExpIndex(Scoords, Lcoords,
-                                                  NekConstants::kGeomFactorsTol,
-                                                  true);
+    // Send the coordinates of the points.
+    Array<OneD, NekDouble> sendBuf(dim * nSend), recvBuf(dim * nRecv);
+    for (int r = 0, cnt = 0; r < nRanks; ++r)
+    {
+        for (auto &i : route[r])
+        {
+            for (int d = 0; d < dim; ++d)
+            {
+                sendBuf[cnt++] = coords[d][i];
+            }
+        }
+    }
+    comm->AlltoAllv(sendBuf, sendSize, sendOff, recvBuf, recvSize, recvOff);
 
-        // we use kGeomFactorsTol as tolerance, while StdPhysEvaluate has
-        // kNekZeroTol hardcoded, so we need to limit Lcoords to not produce
-        // a ton of warnings
-        for(int j = 0; j < nInDim; ++j)
+    // Evaluate the local partition at the received points.
+    Array<OneD, Array<OneD, NekDouble> > recvCoords(dim);
+    for (int d = 0; d < dim; ++d)
+    {
+        recvCoords[d] = Array<OneD, NekDouble>(nRecv);
+        for (int i = 0; i < nRecv; ++i)
         {
-            Lcoords[j] = std::max(Lcoords[j], -1.0);
-            Lcoords[j] = std::min(Lcoords[j], 1.0);
+            recvCoords[d][i] = recvBuf[i * dim + d];
         }
+    }
 
-        if (elmtid >= 0)
+    Array<OneD, NekDouble> replyBuf(nVals * nRecv, 0.0);
+    if (nRecv > 0 && expInField[0]->GetExpSize() > 0)
+    {
+        MultiRegions::PointEvaluationPlan plan(expInField[0], recvCoords,
+                                               NekConstants::kGeomFactorsTol,
+                                               nearest);
+
+        Array<OneD, NekDouble> tmp(nRecv);
+        for (int f = 0; f < nFields; ++f)
         {
-            int offset = m_expInField[0]->GetPhys_Offset(elmtid);
+            plan.Evaluate(expInField[f]->GetPhys(), tmp);
+            Vmath::Vcopy(nRecv, &tmp[0], 1, &replyBuf[f + 1], nVals);
+        }
 
-            for (int f = 0; f < m_expInField.size(); ++f)
-            {
-                NekDouble value =
-                    m_expInField[f]->GetExp(elmtid)->StdPhysEvaluate(
-                        Lcoords, m_expInField[f]->GetPhys() + offset);
+        const Array<OneD, const int> &elmtIds = plan.GetElmtIds();
+        for (int i = 0; i < nRecv; ++i)
+        {
+            replyBuf[i * nVals] = elmtIds[i] >= 0 ? 1.0 : 0.0;
+        }
+    }
 
-                if ((boost::math::isnan)(value))
-                {
-                    ASSERTL0(false, "new value is not a number");
-                }
-                else
+    // Return the values to the ranks which own the points.
+    for (int r = 0; r < nRanks; ++r)
+    {
+        sendSize[r] = nVals * recvCnt[r];
+        recvSize[r] = nVals * sendCnt[r];
+        if (r > 0)
+        {
+            sendOff[r] = sendOff[r - 1] + sendSize[r - 1];
+            recvOff[r] = recvOff[r - 1] + recvSize[r - 1];
+        }
+    }
+    Array<OneD, NekDouble> valueBuf(nVals * nSend);
+    comm->AlltoAllv(replyBuf, sendSize, sendOff, valueBuf, recvSize, recvOff);
+
+    for (int r = 0, cnt = 0; r < nRanks; ++r)
+    {
+        for (auto &i : route[r])
+        {
+            if (!found[i] && valueBuf[cnt] > 0.5)
+            {
+                found[i] = 1;
+                for (int f = 0; f < nFields; ++f)
                 {
-                    m_expOutField[f]->UpdatePhys()[i] = value;
+                    values[f][i] = valueBuf[cnt + f + 1];
                 }
             }
+            cnt += nVals;
         }
-        else
+    }
+}
+
+/**
+ * @brief Interpolate from an expansion partitioned over several ranks to an
+ * other expansion
+ *
+ * @param expInField    local partition of the input field
+ * @param expOutField   output field
+ * @param comm          communicator over which expInField is partitioned
+ *
+ * Unlike the serial version, the input field does not need to cover the
+ * output points of this rank. The bounding boxes of the input partitions are
+ * gathered on all ranks and indexed in an R-tree. Each output point is sent
+ * to the ranks whose box contains it, which evaluate it and return the
+ * values. Points which are not located in any element are then sent to the
+ * rank with the nearest box, which attaches them to its nearest element.
+ * Values of points which remain unlocated are set to def_value.
+ */
+void Interpolator::Interpolate(
+    const vector<MultiRegions::ExpListSharedPtr> expInField,
+    vector<MultiRegions::ExpListSharedPtr> &expOutField,
+    const LibUtilities::CommSharedPtr &comm,
+    NekDouble def_value)
+{
+    if (comm->GetSize() == 1)
+    {
+        Interpolate(expInField, expOutField, def_value);
+        return;
+    }
+
+    ASSERTL0(expInField.size() == expOutField.size(),
+             "number of fields does not match");
+    ASSERTL0(expOutField[0]->GetCoordim(0) <= GetDim(),
+             "too many dimesions in outField");
+    ASSERTL0(GetInterpMethod() == LibUtilities::eNoMethod,
+             "only direct evaluation supported for this interpolation");
+
+    m_expInField  = expInField;
+    m_expOutField = expOutField;
+
+    int nRanks  = comm->GetSize();
+    int nFields = m_expOutField.size();
+    int nOutPts = m_expOutField[0]->GetTotPoints();
+    int nOutDim = m_expOutField[0]->GetCoordim(0);
+
+    // Bounding box of the local partition of the input field.
+    Array<OneD, NekDouble> box(6), boxes;
+    for (int d = 0; d < 3; ++d)
+    {
+        box[d]     =  numeric_limits<NekDouble>::max();
+        box[d + 3] = -numeric_limits<NekDouble>::max();
+    }
+    for (int e = 0; e < m_expInField[0]->GetExpSize(); ++e)
+    {
+        std::array<NekDouble, 6> elmtBox =
+            m_expInField[0]->GetExp(e)->GetGeom()->GetBoundingBox();
+        for (int d = 0; d < 3; ++d)
+        {
+            box[d]     = min(box[d],     elmtBox[d]);
+            box[d + 3] = max(box[d + 3], elmtBox[d + 3]);
+        }
+    }
+    comm->AllGather(box, boxes);
+
+    // Index the bounding boxes of the ranks holding elements, so that the
+    // ranks which may contain a point are found without testing every box.
+    typedef bg::model::point<NekDouble, 3, bg::cs::cartesian> BgPoint;
+    typedef bg::model::box<BgPoint> BgBox;
+    typedef std::pair<BgBox, int> BgRankBox;
+
+    vector<BgRankBox> rankBoxes;
+    for (int r = 0; r < nRanks; ++r)
+    {
+        const NekDouble *b = &boxes[6 * r];
+        if (b[0] <= b[3])
+        {
+            rankBoxes.push_back(
+                BgRankBox(BgBox(BgPoint(b[0], b[1], b[2]),
+                                BgPoint(b[3], b[4], b[5])), r));
+        }
+    }
+    bgi::rtree<BgRankBox, bgi::rstar<16> > rankTree(rankBoxes);
+    vector<BgRankBox> hits;
+
+    Array<OneD, Array<OneD, NekDouble> > coords(3);
+    for (int d = 0; d < 3; ++d)
+    {
+        coords[d] = Array<OneD, NekDouble>(nOutPts, 0.0);
+    }
+    if (nOutDim == 1)
+    {
+        m_expOutField[0]->GetCoords(coords[0]);
+    }
+    else if (nOutDim == 2)
+    {
+        m_expOutField[0]->GetCoords(coords[0], coords[1]);
+    }
+    else if (nOutDim == 3)
+    {
+        m_expOutField[0]->GetCoords(coords[0], coords[1], coords[2]);
+    }
+
+    Array<OneD, Array<OneD, NekDouble> > outCoords(nOutDim);
+    Array<OneD, Array<OneD, NekDouble> > values(nFields);
+    for (int d = 0; d < nOutDim; ++d)
+    {
+        outCoords[d] = coords[d];
+    }
+    for (int f = 0; f < nFields; ++f)
+    {
+        values[f] = m_expOutField[f]->UpdatePhys();
+        Vmath::Fill(nOutPts, def_value, values[f], 1);
+    }
+
+    // Send each point to every rank whose partition may contain it. The
+    // points are exchanged in chunks, so that the progress can be reported
+    // after each of them. All ranks take part in the same number of
+    // exchanges.
+    int nChunks = (nOutPts + kLocateChunkSize - 1) / kLocateChunkSize;
+    comm->AllReduce(nChunks, LibUtilities::ReduceMax);
+
+    Array<OneD, int> found(nOutPts, 0);
+    vector<vector<int> > route(nRanks);
+    for (int c = 0; c < nChunks; ++c)
+    {
+        int start = min(c * kLocateChunkSize, nOutPts);
+        int end   = min(start + kLocateChunkSize, nOutPts);
+
+        for (int r = 0; r < nRanks; ++r)
+        {
+            route[r].clear();
+        }
+        for (int i = start; i < end; ++i)
         {
-            for (int f = 0; f < m_expInField.size(); ++f)
+            BgPoint pt(coords[0][i], coords[1][i], coords[2][i]);
+            hits.clear();
+            rankTree.query(bgi::intersects(pt), back_inserter(hits));
+            for (auto &hit : hits)
             {
-                m_expOutField[f]->UpdatePhys()[i] = def_value;
+                route[hit.second].push_back(i);
             }
         }
+        EvaluateRemote(comm, m_expInField, outCoords, route, false, found,
+                       values);
 
-        int progress = int(100 * i / nOutPts);
-        if (m_progressCallback && progress > lastProg)
+        if (m_progressCallback && end > start)
         {
-            m_progressCallback(i, nOutPts);
-            lastProg = progress;
+            m_progressCallback(end, nOutPts);
         }
     }
+
+    // Attach the remaining points to the nearest element of the rank with
+    // the nearest bounding box.
+    for (int r = 0; r < nRanks; ++r)
+    {
+        route[r].clear();
+    }
+    for (int i = 0; i < nOutPts; ++i)
+    {
+        if (found[i])
+        {
+            continue;
+        }
+
+        BgPoint pt(coords[0][i], coords[1][i], coords[2][i]);
+        hits.clear();
+        rankTree.query(bgi::nearest(pt, 1), back_inserter(hits));
+        if (hits.size() > 0)
+        {
+            route[hits[0].second].push_back(i);
+        }
+    }
+    EvaluateRemote(comm, m_expInField, outCoords, route, true, found,
+                   values);
 }
 
 /**
@@ -167,9 +517,9 @@ void Interpolator::Interpolate(
  * @param ptsOutField   output field
  *
  * In and output fields must have the same dimension and number of fields.
- * Weights are currently not stored for later use.
  * The interpolation is performed by evaluating the expInField at the points
- * of ptsOutField, so only eNoMethod is supported.
+ * of ptsOutField, so only eNoMethod is supported. The points are located once
+ * and all fields are evaluated with the same MultiRegions::PointEvaluationPlan.
  */
 void Interpolator::Interpolate(
     const vector<MultiRegions::ExpListSharedPtr> expInField,
@@ -190,69 +540,70 @@ void Interpolator::Interpolate(
     m_expInField  = expInField;
     m_ptsOutField = ptsOutField;
 
-    int nInDim   = expInField[0]->GetCoordim(0);
-    int nOutPts  = m_ptsOutField->GetNpoints();
-    int lastProg = 0;
+    int nOutPts = m_ptsOutField->GetNpoints();
+    int nOutDim = m_ptsOutField->GetDim();
 
-    for (int i = 0; i < nOutPts; ++i)
+    Array<OneD, Array<OneD, NekDouble> > coords(nOutDim);
+    for (int j = 0; j < nOutDim; ++j)
     {
-        Array<OneD, NekDouble> Lcoords(nInDim, 0.0);
-        Array<OneD, NekDouble> coords(m_ptsOutField->GetDim(), 0.0);
-        for (int j = 0; j < m_ptsOutField->GetDim(); ++j)
-        {
-            coords[j] = m_ptsOutField->GetPointVal(j, i);
-        }
-
-        // Obtain Element and LocalCoordinate to interpolate
-        int elmtid = m_expInField[0]->GetExpIndex(coords, Lcoords,
-                                                  NekConstants::kGeomFactorsTol);
+        coords[j] = m_ptsOutField->GetPts(j);
+    }
 
-        // we use kGeomFactorsTol as tolerance, while StdPhysEvaluate has
-        // kNekZeroTol hardcoded, so we need to limit Lcoords to not produce
-        // a ton of warnings
-        for(int j = 0; j < nInDim; ++j)
+    // Locate the points and evaluate the fields with the resulting
+    // weights. We use kGeomFactorsTol as tolerance, the local coordinates
+    // are clamped to the standard region by the plan. The plan is kept for
+    // the next interpolation of the same expansion to the same points.
+    if (!MatchesPlan(m_expInField[0], coords))
+    {
+        m_plan = CreatePlan(m_expInField[0], coords, false,
+                            m_progressCallback);
+        m_planExp    = m_expInField[0]->GetExp();
+        m_planCoords = Array<OneD, Array<OneD, NekDouble> >(nOutDim);
+        for (int j = 0; j < nOutDim; ++j)
         {
-            Lcoords[j] = std::max(Lcoords[j], -1.0);
-            Lcoords[j] = std::min(Lcoords[j], 1.0);
+            m_planCoords[j] = Array<OneD, NekDouble>(nOutPts);
+            Vmath::Vcopy(nOutPts, coords[j], 1, m_planCoords[j], 1);
         }
+    }
+    else if (m_progressCallback)
+    {
+        m_progressCallback(nOutPts, nOutPts);
+    }
 
-        if (elmtid >= 0)
-        {
-            int offset = m_expInField[0]->GetPhys_Offset(elmtid);
+    for (int f = 0; f < m_expInField.size(); ++f)
+    {
+        Array<OneD, NekDouble> outPts = m_ptsOutField->GetPts(nOutDim + f);
+        Vmath::Fill(nOutPts, def_value, outPts, 1);
+        m_plan->Evaluate(m_expInField[f]->GetPhys(), outPts);
 
-            for (int f = 0; f < m_expInField.size(); ++f)
-            {
-                NekDouble value =
-                    m_expInField[f]->GetExp(elmtid)->StdPhysEvaluate(
-                        Lcoords, m_expInField[f]->GetPhys() + offset);
+        CheckValues(*m_plan, outPts);
+    }
+}
 
-                if ((boost::math::isnan)(value))
-                {
-                    ASSERTL0(false, "new value is not a number");
-                }
-                else
-                {
-                    m_ptsOutField->SetPointVal(m_ptsOutField->GetDim() + f, i,
-                                               value);
-                }
-            }
-        }
-        else
-        {
-            for (int f = 0; f < m_expInField.size(); ++f)
-            {
-                m_ptsOutField->SetPointVal(m_ptsOutField->GetDim() + f, i,
-                                           def_value);
-            }
-        }
+/**
+ * @brief Check whether #m_plan was computed for the expansions of @p exp and
+ * the points @p coords.
+ */
+bool Interpolator::MatchesPlan(
+    const MultiRegions::ExpListSharedPtr         &exp,
+    const Array<OneD, Array<OneD, NekDouble> > &coords) const
+{
+    if (!m_plan || m_planExp.lock() != exp->GetExp() ||
+        m_planCoords.num_elements() != coords.num_elements())
+    {
+        return false;
+    }
 
-        int progress = int(100 * i / nOutPts);
-        if (m_progressCallback && progress > lastProg)
+    for (int j = 0; j < coords.num_elements(); ++j)
+    {
+        if (m_planCoords[j].num_elements() != coords[j].num_elements() ||
+            !std::equal(coords[j].begin(), coords[j].end(),
+                        m_planCoords[j].begin()))
         {
-            m_progressCallback(i, nOutPts);
-            lastProg = progress;
+            return false;
         }
     }
+    return true;
 }
 
 /**
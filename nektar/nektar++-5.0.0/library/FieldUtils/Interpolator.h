@@ -38,6 +38,7 @@
 
 #include <LibUtilities/BasicUtils/Interpolator.h>
 #include <MultiRegions/ExpList.h>
+#include <MultiRegions/PointEvaluationPlan.h>
 #include <FieldUtils/FieldUtilsDeclspec.h>
 
 namespace Nektar
@@ -82,6 +83,14 @@ public:
         std::vector<MultiRegions::ExpListSharedPtr> &expOutField,
         NekDouble def_value = 0.0);
 
+    /// Interpolate from an expansion partitioned over the ranks of a
+    /// communicator to an expansion
+    FIELD_UTILS_EXPORT void Interpolate(
+        const std::vector<MultiRegions::ExpListSharedPtr> expInField,
+        std::vector<MultiRegions::ExpListSharedPtr> &expOutField,
+        const LibUtilities::CommSharedPtr &comm,
+        NekDouble def_value = 0.0);
+
     /// Interpolate from an expansion to a pts field
     FIELD_UTILS_EXPORT void Interpolate(
         const std::vector<MultiRegions::ExpListSharedPtr> expInField,
@@ -103,6 +112,15 @@ protected:
     std::vector<MultiRegions::ExpListSharedPtr> m_expInField;
     /// output field
     std::vector<MultiRegions::ExpListSharedPtr> m_expOutField;
+    /// Evaluation plan of the last interpolation to a pts field
+    MultiRegions::PointEvaluationPlanSharedPtr m_plan;
+    /// Expansions and points for which m_plan was computed
+    std::weak_ptr<LocalRegions::ExpansionVector> m_planExp;
+    Array<OneD, Array<OneD, NekDouble> > m_planCoords;
+
+    bool MatchesPlan(
+        const MultiRegions::ExpListSharedPtr         &exp,
+        const Array<OneD, Array<OneD, NekDouble> > &coords) const;
 };
 
 typedef std::shared_ptr<Interpolator> InterpolatorSharedPtr;
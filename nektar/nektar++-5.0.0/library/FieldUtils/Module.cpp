@@ -34,6 +34,10 @@
 
 #include <iomanip>
 
+#include <boost/core/ignore_unused.hpp>
+
+#include <LocalRegions/Expansion.h>
+
 #include "Module.h"
 
 using namespace std;
@@ -42,6 +46,26 @@ namespace Nektar
 {
 namespace FieldUtils
 {
+
+namespace
+{
+/// Job running a range of the items of a module on a worker thread.
+class ModuleJob : public Thread::ThreadJob
+{
+public:
+    ModuleJob(const std::function<void()> &func) : m_func(func)
+    {
+    }
+
+    virtual void Run()
+    {
+        m_func();
+    }
+
+private:
+    std::function<void()> m_func;
+};
+}
 /**
  * Returns an instance of the module factory, held as a singleton.
  */
@@ -150,6 +174,143 @@ void Module::SetDefaults()
     }
 }
 
+/**
+ * @brief Mutex serialising the field file I/O of modules which may run
+ * concurrently when a time series is pipelined.
+ */
+std::mutex &Module::GetIOMutex()
+{
+    static std::mutex ioMutex;
+    return ioMutex;
+}
+
+/**
+ * @brief Mutex guarding the mesh graph and session, which are shared by the
+ * output modules writing a snapshot of a pipelined time series and the
+ * modules processing the next one.
+ *
+ * The output modules only hold it while they set up expansions from the
+ * graph, so that the writing itself still overlaps with the processing.
+ */
+std::mutex &Module::GetGraphMutex()
+{
+    static std::mutex graphMutex;
+    return graphMutex;
+}
+
+/**
+ * @brief Call @p func on contiguous ranges [start, end) covering @p nItems
+ * items, concurrently on Field::m_nThreads threads when more than one has
+ * been requested.
+ *
+ * The ranges are processed in an arbitrary order, so @p func must only
+ * write to data associated with its own range.
+ */
+void Module::ForEachChunk(int nItems, const std::function<void(int, int)> &func)
+{
+    int nThreads = std::min(m_f->m_nThreads, nItems);
+    Thread::ThreadManagerSharedPtr tm;
+    if (nThreads > 1)
+    {
+        tm = GetThreadManager();
+    }
+
+    if (tm)
+    {
+        // Use a few ranges per thread to balance uneven elements.
+        int nChunks = std::min(nItems, 4 * nThreads);
+        std::vector<Thread::ThreadJob*> jobs;
+        for (int c = 0; c < nChunks; ++c)
+        {
+            int start = static_cast<long>(nItems) * c / nChunks;
+            int end   = static_cast<long>(nItems) * (c + 1) / nChunks;
+            jobs.push_back(new ModuleJob([=, &func]() { func(start, end); }));
+        }
+
+        tm->SetNumWorkers(0);
+        tm->QueueJobs(jobs);
+        tm->SetNumWorkers(nThreads);
+        tm->Wait();
+        return;
+    }
+
+    func(0, nItems);
+}
+
+/**
+ * @brief Thread pool of the calling thread, created on first use with
+ * Field::m_nThreads workers.
+ *
+ * Each calling thread has its own pool, so that an output module running in
+ * the background does not wait for the jobs of the modules processing the
+ * next snapshot of a time series. Returns an empty pointer when Nektar++ is
+ * built without thread safety or no thread manager is available.
+ */
+Thread::ThreadManagerSharedPtr Module::GetThreadManager()
+{
+#ifdef NEKTAR_USE_THREAD_SAFETY
+    static thread_local Thread::ThreadManagerSharedPtr tm;
+    if (!tm && Thread::GetThreadManagerFactory().ModuleExists(
+                   "ThreadManagerBoost"))
+    {
+        tm = Thread::GetThreadManagerFactory().CreateInstance(
+            "ThreadManagerBoost", m_f->m_nThreads);
+    }
+    return tm;
+#else
+    return Thread::ThreadManagerSharedPtr();
+#endif
+}
+
+/**
+ * @brief Compute the derivatives of @p inarray, element by element on
+ * Field::m_nThreads threads.
+ *
+ * A single thread, a homogeneous expansion or the lack of a thread manager
+ * uses ExpList::PhysDeriv, which evaluates the derivatives through the
+ * collections.
+ */
+void Module::ThreadedPhysDeriv(
+    const MultiRegions::ExpListSharedPtr &exp,
+    const Array<OneD, const NekDouble> &inarray,
+    Array<OneD, NekDouble> &out_d0,
+    Array<OneD, NekDouble> &out_d1,
+    Array<OneD, NekDouble> &out_d2)
+{
+    int nElmts = exp->GetExpSize();
+    if (m_f->m_nThreads <= 1 || m_f->m_numHomogeneousDir != 0 ||
+        nElmts < 2 || !GetThreadManager())
+    {
+        exp->PhysDeriv(inarray, out_d0, out_d1, out_d2);
+        return;
+    }
+
+    // The derivative factors are cached on first use by the geometric
+    // factors, which may be shared between elements: fill the cache before
+    // the elements are processed concurrently.
+    for (int e = 0; e < nElmts; ++e)
+    {
+        LocalRegions::ExpansionSharedPtr elmt =
+            exp->GetExp(e)->as<LocalRegions::Expansion>();
+        elmt->GetMetricInfo()->GetDerivFactors(elmt->GetPointsKeys());
+    }
+
+    ForEachChunk(nElmts, [&](int start, int end) {
+        Array<OneD, NekDouble> e_out_d0, e_out_d1, e_out_d2;
+        for (int e = start; e < end; ++e)
+        {
+            int offset = exp->GetPhys_Offset(e);
+            e_out_d0 = out_d0 + offset;
+            e_out_d1 = out_d1.num_elements() ? out_d1 + offset
+                                             : NullNekDouble1DArray;
+            e_out_d2 = out_d2.num_elements() ? out_d2 + offset
+                                             : NullNekDouble1DArray;
+            exp->GetExp(e)->PhysDeriv(inarray + offset,
+                                      e_out_d0, e_out_d1, e_out_d2);
+        }
+    });
+}
+
 /**
  * @brief Tries to guess the format of the input file.
  */
@@ -182,6 +343,15 @@ string InputModule::GuessFormat(string filename)
     return "";
 }
 
+/**
+ * @brief Start reading @p fileName ahead of the Process call which will
+ * use it. Modules which cannot read in the background ignore the request.
+ */
+void InputModule::Prefetch(const std::string &fileName)
+{
+    boost::ignore_unused(fileName);
+}
+
 /**
  * @brief Print a brief summary of information.
  */
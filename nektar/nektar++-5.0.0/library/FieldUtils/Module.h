@@ -36,14 +36,17 @@
 #define FIELDUTILS_MODULE
 
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
 #include <vector>
 
 #include <LibUtilities/BasicUtils/NekFactory.hpp>
+#include <LibUtilities/BasicUtils/Thread.h>
 #include <LibUtilities/Communication/CommSerial.h>
 #include <StdRegions/StdNodalTriExp.h>
 
@@ -195,6 +198,13 @@ public:
 
     virtual ModulePriority GetModulePriority() = 0;
 
+    /// Whether the module modifies the coefficients or physical values of
+    /// the expansions it is given, rather than only appending new ones.
+    virtual bool ModifiesInput()
+    {
+        return false;
+    }
+
     FIELD_UTILS_EXPORT void RegisterConfig(std::string key,
                                            std::string value = "");
     FIELD_UTILS_EXPORT void PrintConfig();
@@ -205,9 +215,22 @@ public:
         const Array<OneD, const NekDouble> &infield,
         Array<OneD, NekDouble> &outfield);
 
+    FIELD_UTILS_EXPORT static std::mutex &GetIOMutex();
+    FIELD_UTILS_EXPORT static std::mutex &GetGraphMutex();
+
 protected:
     Module(){};
 
+    FIELD_UTILS_EXPORT void ForEachChunk(
+        int nItems, const std::function<void(int, int)> &func);
+    FIELD_UTILS_EXPORT Thread::ThreadManagerSharedPtr GetThreadManager();
+    FIELD_UTILS_EXPORT void ThreadedPhysDeriv(
+        const MultiRegions::ExpListSharedPtr &exp,
+        const Array<OneD, const NekDouble> &inarray,
+        Array<OneD, NekDouble> &out_d0,
+        Array<OneD, NekDouble> &out_d1,
+        Array<OneD, NekDouble> &out_d2 = NullNekDouble1DArray);
+
     /// Field object
     FieldSharedPtr m_f;
     /// List of configuration values.
@@ -229,6 +252,7 @@ public:
     InputModule(FieldSharedPtr p_m);
     FIELD_UTILS_EXPORT void AddFile(std::string fileType, std::string fileName);
     FIELD_UTILS_EXPORT static std::string GuessFormat(std::string fileName);
+    FIELD_UTILS_EXPORT virtual void Prefetch(const std::string &fileName);
 
 protected:
     /// Print summary of elements.
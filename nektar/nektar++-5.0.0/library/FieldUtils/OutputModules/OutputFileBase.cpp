@@ -81,11 +81,16 @@ void OutputFileBase::Process(po::variables_map &vm)
         if (m_requireEquiSpaced && (vm.count("noequispaced") == 0) &&
             m_f->m_exp[0]->GetNumElmts() != 0)
         {
+            std::lock_guard<std::mutex> lock(GetGraphMutex());
             ConvertExpToEquispaced(vm);
         }
 
         if (m_f->m_writeBndFld)
         {
+            // The boundary expansions and regions come from the graph and
+            // session, which may be in use by the next snapshot of a series.
+            std::lock_guard<std::mutex> lock(GetGraphMutex());
+
             if (m_f->m_verbose && m_f->m_comm->TreatAsRankZero())
             {
                 cout << "\t" << GetModuleName()
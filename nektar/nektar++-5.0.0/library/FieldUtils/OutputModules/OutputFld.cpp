@@ -112,6 +112,7 @@ void OutputFld::OutputFromExp(po::variables_map &vm)
                 }
             }
         }
+        std::lock_guard<std::mutex> lock(GetIOMutex());
         fld->Write(filename, FieldDef, FieldData, m_f->m_fieldMetaDataMap,
                    false);
     }
@@ -121,6 +122,7 @@ void OutputFld::OutputFromExp(po::variables_map &vm)
             std::vector<LibUtilities::FieldDefinitionsSharedPtr>();
         std::vector<std::vector<NekDouble> > FieldData =
             std::vector<std::vector<NekDouble> >();
+        std::lock_guard<std::mutex> lock(GetIOMutex());
         fld->Write(filename, FieldDef, FieldData, m_f->m_fieldMetaDataMap);
     }
 }
@@ -136,6 +138,7 @@ void OutputFld::OutputFromData(po::variables_map &vm)
         LibUtilities::GetFieldIOFactory().CreateInstance(
             GetIOFormat(), m_f->m_comm, true);
 
+    std::lock_guard<std::mutex> lock(GetIOMutex());
     fld->Write(filename, m_f->m_fielddef, m_f->m_data,
                    m_f->m_fieldMetaDataMap);
 }
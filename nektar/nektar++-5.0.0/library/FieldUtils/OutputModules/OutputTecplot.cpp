@@ -34,6 +34,7 @@
 
 #include <iomanip>
 #include <set>
+#include <sstream>
 #include <string>
 using namespace std;
 
@@ -537,6 +538,40 @@ void OutputTecplot::WriteTecplotZone(std::ofstream &outfile)
             // and then its data.
             for (int j = 0; j < m_fields.num_elements(); ++j)
             {
+                if (m_f->m_nThreads > 1)
+                {
+                    // Format the lines of 1000 values concurrently.
+                    int nPts   = m_fields[j].num_elements();
+                    int nLines = (nPts + 999) / 1000;
+                    vector<string> lines(nLines);
+                    ForEachChunk(nLines, [&](int start, int end)
+                    {
+                        ostringstream line;
+                        for (int l = start; l < end; ++l)
+                        {
+                            line.str("");
+                            line.copyfmt(outfile);
+                            for (int i = 1000 * l;
+                                 i < min(1000 * (l + 1), nPts); ++i)
+                            {
+                                line << m_fields[j][i] << " ";
+                            }
+                            lines[l] = line.str();
+                        }
+                    });
+
+                    for (int l = 0; l < nLines; ++l)
+                    {
+                        if (l)
+                        {
+                            outfile << std::endl;
+                        }
+                        outfile << lines[l];
+                    }
+                    outfile << std::endl;
+                    continue;
+                }
+
                 for (int i = 0; i < m_fields[j].num_elements(); ++i)
                 {
                     if ((!(i % 1000)) && i)
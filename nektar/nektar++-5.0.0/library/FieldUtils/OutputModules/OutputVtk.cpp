@@ -33,6 +33,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <set>
+#include <sstream>
 #include <string>
 #include <iomanip>
 using namespace std;
@@ -241,25 +242,61 @@ void OutputVtk::OutputFromExp(po::variables_map &vm)
     int nstrips;
     m_f->m_session->LoadParameter("Strip_Z", nstrips, 1);
 
+    int nElmts = m_f->m_exp[0]->GetNumElmts();
+
     // Homogeneous strip variant
     for (int s = 0; s < nstrips; ++s)
     {
-        // For each field write out field data for each expansion.
-        for (i = 0; i < m_f->m_exp[0]->GetNumElmts(); ++i)
+        auto writePiece = [&](ostream &os, int elmt)
         {
-            m_f->m_exp[0]->WriteVtkPieceHeader(outfile, i, s);
+            m_f->m_exp[0]->WriteVtkPieceHeader(os, elmt, s);
 
             // For this expansion write out each field.
-            for (j = 0; j < nfields; ++j)
+            for (int f = 0; f < nfields; ++f)
+            {
+                m_f->m_exp[s * nfields + f]->WriteVtkPieceData(
+                    os, elmt, m_f->m_variables[f]);
+            }
+            m_f->m_exp[0]->WriteVtkPieceFooter(os, elmt);
+        };
+
+        if (m_f->m_nThreads <= 1 || m_f->m_numHomogeneousDir != 0)
+        {
+            // For each field write out field data for each expansion.
+            for (i = 0; i < nElmts; ++i)
+            {
+                writePiece(outfile, i);
+            }
+            continue;
+        }
+
+        // Format the pieces of a batch of elements concurrently, then
+        // write them in order.
+        const int batchSize = 256 * m_f->m_nThreads;
+        vector<string> pieces(batchSize);
+        for (i = 0; i < nElmts; i += batchSize)
+        {
+            int nBatch = min(batchSize, nElmts - i);
+            ForEachChunk(nBatch, [&](int start, int end)
+            {
+                ostringstream piece;
+                for (int k = start; k < end; ++k)
+                {
+                    piece.str("");
+                    piece.copyfmt(outfile);
+                    writePiece(piece, i + k);
+                    pieces[k] = piece.str();
+                }
+            });
+
+            for (j = 0; j < nBatch; ++j)
             {
-                m_f->m_exp[s * nfields + j]->WriteVtkPieceData(
-                    outfile, i, m_f->m_variables[j]);
+                outfile << pieces[j];
             }
-            m_f->m_exp[0]->WriteVtkPieceFooter(outfile, i);
         }
     }
 
-    if (m_f->m_exp[0]->GetNumElmts() == 0)
+    if (nElmts == 0)
     {
         WriteEmptyVtkPiece(outfile);
     }
@@ -109,12 +109,14 @@ void ProcessAddFld::Process(po::variables_map &vm)
         {
             ElementGIDs[i++] = expIt.second->m_geomShPtr->GetGlobalID();
         }
+        std::lock_guard<std::mutex> lock(GetIOMutex());
         m_f->FieldIOForFile(fromfld)->Import(
             fromfld, fromFieldDef, fromFieldData,
             LibUtilities::NullFieldMetaDataMap, ElementGIDs);
     }
     else
     {
+        std::lock_guard<std::mutex> lock(GetIOMutex());
         m_f->FieldIOForFile(fromfld)->Import(
             fromfld, fromFieldDef, fromFieldData,
             LibUtilities::NullFieldMetaDataMap);
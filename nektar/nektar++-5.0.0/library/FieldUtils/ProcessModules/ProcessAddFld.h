@@ -77,6 +77,11 @@ public:
         return m_priority;
     }
 
+    virtual bool ModifiesInput()
+    {
+        return true;
+    }
+
 private:
     ModulePriority  m_priority;
 
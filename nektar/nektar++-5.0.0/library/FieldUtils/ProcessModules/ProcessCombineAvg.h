@@ -78,6 +78,11 @@ public:
         return eModifyExp;
     }
 
+    virtual bool ModifiesInput()
+    {
+        return true;
+    }
+
 private:
 };
 }
@@ -73,6 +73,11 @@ public:
         return eModifyExp;
     }
 
+    virtual bool ModifiesInput()
+    {
+        return true;
+    }
+
 };
 }
 }
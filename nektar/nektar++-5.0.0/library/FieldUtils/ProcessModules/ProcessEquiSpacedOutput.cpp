@@ -99,8 +99,6 @@ void ProcessEquiSpacedOutput::Process(po::variables_map &vm)
 
     int coordim  = m_f->m_exp[0]->GetCoordim(0);
     int shapedim = m_f->m_exp[0]->GetExp(0)->GetShapeDimension();
-    int npts     = m_f->m_exp[0]->GetTotPoints();
-    Array<OneD, Array<OneD, NekDouble> > coords(3);
 
     // Check if we have a homogeneous expansion
     bool homogeneous1D = false;
@@ -115,6 +113,96 @@ void ProcessEquiSpacedOutput::Process(po::variables_map &vm)
         ASSERTL0(false, "Homegeneous2D case not supported");
     }
 
+    // The connectivity and the equispaced coordinates only depend on the
+    // expansion, so they are kept while the module is run on the same one,
+    // as by the in-situ mode of the FieldConvert filter.
+    if (m_expansions.lock() != m_f->m_exp[0]->GetExp())
+    {
+        SetupEquiSpaced(coordim);
+        m_expansions = m_f->m_exp[0]->GetExp();
+    }
+
+    int nfields = m_f->m_variables.size();
+    int cnt;
+
+    Array<OneD, Array<OneD, NekDouble> > pts(nfields + coordim);
+
+    for (int i = 0; i < coordim; ++i)
+    {
+        pts[i] = Array<OneD, NekDouble>(m_totPoints);
+        Vmath::Vcopy(m_totPoints, m_coords[i], 1, pts[i], 1);
+    }
+
+    for (int i = coordim; i < nfields + coordim; ++i)
+    {
+        pts[i] = Array<OneD, NekDouble>(m_totPoints);
+    }
+
+    Array<OneD, NekDouble> tmp;
+
+    for (int n = 0; n < m_f->m_variables.size(); ++n)
+    {
+        cnt      = 0;
+        int cnt1 = 0;
+
+        if (m_config["modalenergy"].as<bool>())
+        {
+            Array<OneD, const NekDouble> phys = m_f->m_exp[n]->GetPhys();
+            for (int i = 0; i < nel; ++i)
+            {
+                GenOrthoModes(i, phys + cnt, tmp = pts[coordim + n] + cnt1);
+                cnt1 += m_ppe[i];
+                cnt += m_f->m_exp[0]->GetExp(i)->GetTotPoints();
+            }
+        }
+        else
+        {
+            Array<OneD, const NekDouble> phys = m_f->m_exp[n]->GetPhys();
+            for (int i = 0; i < nel; ++i)
+            {
+                m_f->m_exp[0]->GetExp(i)->PhysInterpToSimplexEquiSpaced(
+                    phys + cnt, tmp = pts[coordim + n] + cnt1);
+                cnt1 += m_ppe[i];
+                cnt += m_f->m_exp[0]->GetExp(i)->GetTotPoints();
+            }
+        }
+    }
+
+    m_f->m_fieldPts = MemoryManager<LibUtilities::PtsField>::AllocateSharedPtr(
+        coordim, m_f->m_variables, pts);
+    if (shapedim == 1)
+    {
+        m_f->m_fieldPts->SetPtsType(LibUtilities::ePtsSegBlock);
+    }
+
+    if (shapedim == 2)
+    {
+        m_f->m_fieldPts->SetPtsType(LibUtilities::ePtsTriBlock);
+    }
+    else if (shapedim == 3)
+    {
+        m_f->m_fieldPts->SetPtsType(LibUtilities::ePtsTetBlock);
+    }
+    m_f->m_fieldPts->SetConnectivity(m_ptsConn);
+    if (homogeneous1D)
+    {
+        SetHomogeneousConnectivity();
+    }
+
+    // Clear m_exp
+    m_f->m_exp = vector<MultiRegions::ExpListSharedPtr>();
+}
+
+/**
+ * @brief Set up the number of equispaced points of each element, their
+ * connectivity and their coordinates.
+ */
+void ProcessEquiSpacedOutput::SetupEquiSpaced(int coordim)
+{
+    int nel  = m_f->m_exp[0]->GetExpSize();
+    int npts = m_f->m_exp[0]->GetTotPoints();
+    Array<OneD, Array<OneD, NekDouble> > coords(3);
+
     // set up the number of points in each element
     int newpoints    = 0;
     int newtotpoints = 0;
@@ -130,9 +218,8 @@ void ProcessEquiSpacedOutput::Process(po::variables_map &vm)
     LocalRegions::ExpansionSharedPtr e;
 
     // prepare PtsField
-    vector<int> ppe;
-    vector<Array<OneD, int> > ptsConn;
-    int nfields;
+    m_ppe.clear();
+    m_ptsConn.clear();
 
     for (int i = 0; i < nel; ++i)
     {
@@ -290,7 +377,7 @@ void ProcessEquiSpacedOutput::Process(po::variables_map &vm)
             }
         }
 
-        ppe.push_back(newpoints);
+        m_ppe.push_back(newpoints);
         newtotpoints += newpoints;
 
         if (e->DetShapeType() == LibUtilities::ePrism)
@@ -322,18 +409,11 @@ void ProcessEquiSpacedOutput::Process(po::variables_map &vm)
             newconn[j] = conn[j] + cnt;
         }
 
-        ptsConn.push_back(newconn);
+        m_ptsConn.push_back(newconn);
         cnt += newpoints;
     }
 
-    nfields = m_f->m_variables.size();
-
-    Array<OneD, Array<OneD, NekDouble> > pts(nfields + coordim);
-
-    for (int i = 0; i < nfields + coordim; ++i)
-    {
-        pts[i] = Array<OneD, NekDouble>(newtotpoints);
-    }
+    m_totPoints = newtotpoints;
 
     // Interpolate coordinates
     for (int i = 0; i < coordim; ++i)
@@ -348,6 +428,12 @@ void ProcessEquiSpacedOutput::Process(po::variables_map &vm)
 
     m_f->m_exp[0]->GetCoords(coords[0], coords[1], coords[2]);
 
+    m_coords = Array<OneD, Array<OneD, NekDouble> >(coordim);
+    for (int i = 0; i < coordim; ++i)
+    {
+        m_coords[i] = Array<OneD, NekDouble>(m_totPoints);
+    }
+
     Array<OneD, NekDouble> tmp;
 
     for (int n = 0; n < coordim; ++n)
@@ -357,63 +443,11 @@ void ProcessEquiSpacedOutput::Process(po::variables_map &vm)
         for (int i = 0; i < nel; ++i)
         {
             m_f->m_exp[0]->GetExp(i)->PhysInterpToSimplexEquiSpaced(
-                coords[n] + cnt, tmp = pts[n] + cnt1);
-            cnt1 += ppe[i];
+                coords[n] + cnt, tmp = m_coords[n] + cnt1);
+            cnt1 += m_ppe[i];
             cnt += m_f->m_exp[0]->GetExp(i)->GetTotPoints();
         }
     }
-
-    for (int n = 0; n < m_f->m_variables.size(); ++n)
-    {
-        cnt      = 0;
-        int cnt1 = 0;
-
-        if (m_config["modalenergy"].as<bool>())
-        {
-            Array<OneD, const NekDouble> phys = m_f->m_exp[n]->GetPhys();
-            for (int i = 0; i < nel; ++i)
-            {
-                GenOrthoModes(i, phys + cnt, tmp = pts[coordim + n] + cnt1);
-                cnt1 += ppe[i];
-                cnt += m_f->m_exp[0]->GetExp(i)->GetTotPoints();
-            }
-        }
-        else
-        {
-            Array<OneD, const NekDouble> phys = m_f->m_exp[n]->GetPhys();
-            for (int i = 0; i < nel; ++i)
-            {
-                m_f->m_exp[0]->GetExp(i)->PhysInterpToSimplexEquiSpaced(
-                    phys + cnt, tmp = pts[coordim + n] + cnt1);
-                cnt1 += ppe[i];
-                cnt += m_f->m_exp[0]->GetExp(i)->GetTotPoints();
-            }
-        }
-    }
-
-    m_f->m_fieldPts = MemoryManager<LibUtilities::PtsField>::AllocateSharedPtr(
-        coordim, m_f->m_variables, pts);
-    if (shapedim == 1)
-    {
-        m_f->m_fieldPts->SetPtsType(LibUtilities::ePtsSegBlock);
-    }
-
-    if (shapedim == 2)
-    {
-        m_f->m_fieldPts->SetPtsType(LibUtilities::ePtsTriBlock);
-    }
-    else if (shapedim == 3)
-    {
-        m_f->m_fieldPts->SetPtsType(LibUtilities::ePtsTetBlock);
-    }
-    m_f->m_fieldPts->SetConnectivity(ptsConn);
-    if (homogeneous1D)
-    {
-        SetHomogeneousConnectivity();
-    }
-
-    // Clear m_exp
-    m_f->m_exp = vector<MultiRegions::ExpListSharedPtr>();
 }
 
 void ProcessEquiSpacedOutput::SetHomogeneousConnectivity(void)
@@ -77,6 +77,8 @@ public:
     }
 
 protected:
+    void SetupEquiSpaced(int coordim);
+
     void SetHomogeneousConnectivity(void);
 
     void GenOrthoModes(int n,
@@ -84,6 +86,16 @@ protected:
                        Array<OneD, NekDouble> &coeffs);
 
 private:
+    /// Expansions for which the members below were set up
+    std::weak_ptr<LocalRegions::ExpansionVector> m_expansions;
+    /// Number of equispaced points of each element
+    std::vector<int>                     m_ppe;
+    /// Connectivity of the equispaced points of each element
+    std::vector<Array<OneD, int> >       m_ptsConn;
+    /// Total number of equispaced points
+    int                                  m_totPoints;
+    /// Coordinates of the equispaced points
+    Array<OneD, Array<OneD, NekDouble> > m_coords;
 };
 }
 }
@@ -77,6 +77,11 @@ public:
         return eModifyExp;
     }
 
+    virtual bool ModifiesInput()
+    {
+        return true;
+    }
+
 };
 }
 }
@@ -153,9 +153,12 @@ void ProcessInnerProduct::Process(po::variables_map &vm)
 
         for (int f = 0; f < fromfiles.size(); ++f)
         {
-            m_f->FieldIOForFile(fromfiles[f])->Import(
-                fromfiles[f], fromField->m_fielddef, fromField->m_data,
-                LibUtilities::NullFieldMetaDataMap, ElementGIDs);
+            {
+                std::lock_guard<std::mutex> lock(GetIOMutex());
+                m_f->FieldIOForFile(fromfiles[f])->Import(
+                    fromfiles[f], fromField->m_fielddef, fromField->m_data,
+                    LibUtilities::NullFieldMetaDataMap, ElementGIDs);
+            }
 
             totiprod = IProduct(processFields, fromField, SaveFld);
 
@@ -176,6 +179,7 @@ void ProcessInnerProduct::Process(po::variables_map &vm)
         {
             allFromField[i] = std::shared_ptr<Field>(new Field());
 
+            std::lock_guard<std::mutex> lock(GetIOMutex());
             m_f->FieldIOForFile(fromfiles[i])->Import(
                 fromfiles[i], allFromField[i]->m_fielddef,
                 allFromField[i]->m_data, LibUtilities::NullFieldMetaDataMap,
@@ -77,6 +77,11 @@ public:
         return eModifyExp;
     }
 
+    virtual bool ModifiesInput()
+    {
+        return true;
+    }
+
 private:
     NekDouble IProduct(vector<unsigned int> &processFields,
                        FieldSharedPtr &fromField,
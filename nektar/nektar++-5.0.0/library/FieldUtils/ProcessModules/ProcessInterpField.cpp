@@ -75,6 +75,10 @@ ProcessInterpField::ProcessInterpField(FieldSharedPtr f) : ProcessModule(f)
         ConfigOption(false, "10000000", "Upper bound for interpolation value");
     m_config["defaultvalue"] =
         ConfigOption(false, "0", "Default value if point is outside domain");
+    m_config["distributed"] =
+        ConfigOption(true, "0", "Partition the from field over the ranks "
+                                "instead of loading the part overlapping "
+                                "each rank");
 }
 
 ProcessInterpField::~ProcessInterpField()
@@ -89,72 +93,90 @@ void ProcessInterpField::Process(po::variables_map &vm)
 
     std::vector<std::string> files;
 
+    // In distributed mode the from mesh is partitioned over the ranks like
+    // the target mesh, and points are routed to the rank owning them.
+    bool distributed = m_config["distributed"].as<bool>() &&
+                       m_f->m_comm->GetSize() > 1;
+
     // set up session file for from field
     char *argv[] = { const_cast<char *>("FieldConvert"), nullptr };
     ParseUtils::GenerateVector(m_config["fromxml"].as<string>(), files);
     fromField->m_session =
         LibUtilities::SessionReader::CreateInstance(
             1, argv, files,
+            distributed ? m_f->m_comm :
             LibUtilities::GetCommFactory().CreateInstance("Serial", 0, 0));
 
-    // Set up range based on min and max of local parallel partition
-    SpatialDomains::DomainRangeShPtr rng =
-        MemoryManager<SpatialDomains::DomainRange>::AllocateSharedPtr();
-
-    int coordim = m_f->m_exp[0]->GetCoordim(0);
-    int npts    = m_f->m_exp[0]->GetTotPoints();
-    Array<OneD, Array<OneD, NekDouble> > coords(3);
-
-    for (int i = 0; i < coordim; ++i)
+    if (distributed)
     {
-        coords[i] = Array<OneD, NekDouble>(npts);
+        fromField->m_graph =
+            SpatialDomains::MeshGraph::Read(fromField->m_session);
     }
-
-    for (int i = coordim; i < 3; ++i)
+    else
     {
-        coords[i] = NullNekDouble1DArray;
-    }
+        // Set up range based on min and max of local parallel partition
+        SpatialDomains::DomainRangeShPtr rng =
+            MemoryManager<SpatialDomains::DomainRange>::AllocateSharedPtr();
 
-    m_f->m_exp[0]->GetCoords(coords[0], coords[1], coords[2]);
+        int coordim = m_f->m_exp[0]->GetCoordim(0);
+        int npts    = m_f->m_exp[0]->GetTotPoints();
+        Array<OneD, Array<OneD, NekDouble> > coords(3);
 
-    rng->m_checkShape = false;
-    switch (coordim)
-    {
-        case 3:
-            rng->m_doZrange = true;
-            rng->m_zmin     = Vmath::Vmin(npts, coords[2], 1);
-            rng->m_zmax     = Vmath::Vmax(npts, coords[2], 1);
-            /* Falls through. */
-        case 2:
-            rng->m_doYrange = true;
-            rng->m_ymin     = Vmath::Vmin(npts, coords[1], 1);
-            rng->m_ymax     = Vmath::Vmax(npts, coords[1], 1);
-            /* Falls through. */
-        case 1:
-            rng->m_doXrange = true;
-            rng->m_xmin     = Vmath::Vmin(npts, coords[0], 1);
-            rng->m_xmax     = Vmath::Vmax(npts, coords[0], 1);
-            break;
-        default:
-            NEKERROR(ErrorUtil::efatal, "coordim should be <= 3");
-    }
+        for (int i = 0; i < coordim; ++i)
+        {
+            coords[i] = Array<OneD, NekDouble>(npts);
+        }
+
+        for (int i = coordim; i < 3; ++i)
+        {
+            coords[i] = NullNekDouble1DArray;
+        }
 
-    // setup rng parameters.
-    fromField->m_graph =
-        SpatialDomains::MeshGraph::Read(fromField->m_session, rng);
+        m_f->m_exp[0]->GetCoords(coords[0], coords[1], coords[2]);
+
+        rng->m_checkShape = false;
+        switch (coordim)
+        {
+            case 3:
+                rng->m_doZrange = true;
+                rng->m_zmin     = Vmath::Vmin(npts, coords[2], 1);
+                rng->m_zmax     = Vmath::Vmax(npts, coords[2], 1);
+                /* Falls through. */
+            case 2:
+                rng->m_doYrange = true;
+                rng->m_ymin     = Vmath::Vmin(npts, coords[1], 1);
+                rng->m_ymax     = Vmath::Vmax(npts, coords[1], 1);
+                /* Falls through. */
+            case 1:
+                rng->m_doXrange = true;
+                rng->m_xmin     = Vmath::Vmin(npts, coords[0], 1);
+                rng->m_xmax     = Vmath::Vmax(npts, coords[0], 1);
+                break;
+            default:
+                NEKERROR(ErrorUtil::efatal, "coordim should be <= 3");
+        }
+
+        // setup rng parameters.
+        fromField->m_graph =
+            SpatialDomains::MeshGraph::Read(fromField->m_session, rng);
+    }
 
     // Read in local from field partitions
     const SpatialDomains::ExpansionMap &expansions =
         fromField->m_graph->GetExpansions();
 
     // check for case where no elements are specified on this
-    // parallel partition
-    if (!expansions.size())
+    // parallel partition. In distributed mode such a rank still takes part
+    // in the collective import and interpolation, with an empty from field.
+    bool hasElmts = expansions.size() > 0;
+    if (!hasElmts && !distributed)
     {
         return;
     }
 
-    Array<OneD, int> ElementGIDs(expansions.size());
+    // An empty list of IDs would import every element, so an empty
+    // partition asks for the element -1, which is never found.
+    Array<OneD, int> ElementGIDs(max(int(expansions.size()), 1), -1);
 
     int i = 0;
     for (auto &expIt : expansions)
@@ -163,43 +185,72 @@ void ProcessInterpField::Process(po::variables_map &vm)
     }
 
     string fromfld = m_config["fromfld"].as<string>();
-    m_f->FieldIOForFile(fromfld)->Import(
-        fromfld, fromField->m_fielddef, fromField->m_data,
-        LibUtilities::NullFieldMetaDataMap, ElementGIDs);
-
-    int NumHomogeneousDir = fromField->m_fielddef[0]->m_numHomogeneousDir;
+    {
+        std::lock_guard<std::mutex> lock(GetIOMutex());
+        m_f->FieldIOForFile(fromfld)->Import(
+            fromfld, fromField->m_fielddef, fromField->m_data,
+            LibUtilities::NullFieldMetaDataMap, ElementGIDs);
+    }
 
-    //----------------------------------------------
-    // Set up Expansion information to use mode order from field
-    fromField->m_graph->SetExpansions(fromField->m_fielddef);
+    int NumHomogeneousDir = 0;
+    vector<string> fieldNames;
+    if (hasElmts)
+    {
+        NumHomogeneousDir = fromField->m_fielddef[0]->m_numHomogeneousDir;
+        fieldNames        = fromField->m_fielddef[0]->m_fields;
+    }
+    if (distributed)
+    {
+        BcastFieldInfo(m_f->m_comm, hasElmts, NumHomogeneousDir, fieldNames);
+    }
 
-    int nfields = fromField->m_fielddef[0]->m_fields.size();
+    int nfields = fieldNames.size();
 
     fromField->m_exp.resize(nfields);
-    fromField->m_exp[0] =
-        fromField->SetUpFirstExpList(NumHomogeneousDir, true);
-
     m_f->m_exp.resize(nfields);
 
     // declare auxiliary fields.
     for (i = 1; i < nfields; ++i)
     {
-        m_f->m_exp[i]       = m_f->AppendExpList(NumHomogeneousDir);
-        fromField->m_exp[i] = fromField->AppendExpList(NumHomogeneousDir);
+        m_f->m_exp[i] = m_f->AppendExpList(NumHomogeneousDir);
     }
 
-    // load field into expansion in fromfield.
-    for (int j = 0; j < nfields; ++j)
+    if (hasElmts)
+    {
+        //----------------------------------------------
+        // Set up Expansion information to use mode order from field
+        fromField->m_graph->SetExpansions(fromField->m_fielddef);
+
+        fromField->m_exp[0] =
+            fromField->SetUpFirstExpList(NumHomogeneousDir, true);
+        for (i = 1; i < nfields; ++i)
+        {
+            fromField->m_exp[i] =
+                fromField->AppendExpList(NumHomogeneousDir);
+        }
+
+        // load field into expansion in fromfield.
+        for (int j = 0; j < nfields; ++j)
+        {
+            for (i = 0; i < fromField->m_fielddef.size(); i++)
+            {
+                fromField->m_exp[j]->ExtractDataToCoeffs(
+                    fromField->m_fielddef[i], fromField->m_data[i],
+                    fieldNames[j], fromField->m_exp[j]->UpdateCoeffs());
+            }
+            fromField->m_exp[j]->BwdTrans(fromField->m_exp[j]->GetCoeffs(),
+                                          fromField->m_exp[j]->UpdatePhys());
+        }
+    }
+    else
     {
-        for (i = 0; i < fromField->m_fielddef.size(); i++)
+        // Empty partition: the points of this rank are evaluated by the
+        // other ranks.
+        for (i = 0; i < nfields; ++i)
         {
-            fromField->m_exp[j]->ExtractDataToCoeffs(
-                fromField->m_fielddef[i], fromField->m_data[i],
-                fromField->m_fielddef[0]->m_fields[j],
-                fromField->m_exp[j]->UpdateCoeffs());
+            fromField->m_exp[i] =
+                MemoryManager<MultiRegions::ExpList>::AllocateSharedPtr();
         }
-        fromField->m_exp[j]->BwdTrans(fromField->m_exp[j]->GetCoeffs(),
-                                        fromField->m_exp[j]->UpdatePhys());
     }
 
     int nq1 = m_f->m_exp[0]->GetTotPoints();
@@ -221,7 +272,15 @@ void ProcessInterpField::Process(po::variables_map &vm)
     {
         interp.SetProgressCallback(&ProcessInterpField::PrintProgressbar, this);
     }
-    interp.Interpolate(fromField->m_exp, m_f->m_exp);
+    if (distributed)
+    {
+        interp.Interpolate(fromField->m_exp, m_f->m_exp, m_f->m_comm,
+                           def_value);
+    }
+    else
+    {
+        interp.Interpolate(fromField->m_exp, m_f->m_exp);
+    }
     if (m_f->m_verbose && m_f->m_comm->TreatAsRankZero())
     {
         cout << endl;
@@ -244,7 +303,44 @@ void ProcessInterpField::Process(po::variables_map &vm)
                     m_f->m_exp[i]->GetPhys(), m_f->m_exp[i]->UpdateCoeffs());
     }
     // save field names
-    m_f->m_variables = fromField->m_fielddef[0]->m_fields;
+    m_f->m_variables = fieldNames;
+}
+
+/**
+ * @brief Broadcast the number of homogeneous directions and the names of the
+ * fields of the from field to the ranks whose partition of the from mesh is
+ * empty.
+ *
+ * The information is sent by the lowest rank holding elements of the from
+ * mesh.
+ */
+void ProcessInterpField::BcastFieldInfo(
+    const LibUtilities::CommSharedPtr &comm,
+    const bool                         hasElmts,
+    int                               &nHomDir,
+    vector<string>                    &fieldNames)
+{
+    int root = hasElmts ? comm->GetRank() : comm->GetSize();
+    comm->AllReduce(root, LibUtilities::ReduceMin);
+    ASSERTL0(root < comm->GetSize(), "The from mesh has no elements.");
+
+    comm->Bcast(nHomDir, root);
+
+    // Convert the names to a vector of chars so that we can broadcast.
+    string names;
+    for (auto &name : fieldNames)
+    {
+        names += (names.empty() ? "" : ",") + name;
+    }
+    vector<char> v(names.begin(), names.end());
+
+    int length = v.size();
+    comm->Bcast(length, root);
+    v.resize(length);
+    comm->Bcast(v, root);
+
+    fieldNames.clear();
+    ParseUtils::GenerateVector(string(v.begin(), v.end()), fieldNames);
 }
 
 void ProcessInterpField::PrintProgressbar(const int position,
@@ -78,6 +78,16 @@ public:
         return eFillExp;
     }
 
+    virtual bool ModifiesInput()
+    {
+        return true;
+    }
+
+private:
+    static void BcastFieldInfo(const LibUtilities::CommSharedPtr &comm,
+                               const bool                hasElmts,
+                               int                      &nHomDir,
+                               std::vector<std::string> &fieldNames);
 };
 }
 }
@@ -78,6 +78,11 @@ public:
         return eFillExp;
     }
 
+    virtual bool ModifiesInput()
+    {
+        return true;
+    }
+
     void PrintProgressbar(const int position, const int goal) const
     {
         LibUtilities::PrintProgressbar(position, goal, "Interpolating");
@@ -178,9 +178,12 @@ void ProcessInterpPoints::Process(po::variables_map &vm)
     ASSERTL0(i > 0, "No elements are set. Are the interpolated points "
                     "wihtin the domain given by the xml files?");
     string fromfld = m_config["fromfld"].as<string>();
-    m_f->FieldIOForFile(fromfld)->Import(
-        fromfld, fromField->m_fielddef, fromField->m_data,
-        LibUtilities::NullFieldMetaDataMap, ElementGIDs);
+    {
+        std::lock_guard<std::mutex> lock(GetIOMutex());
+        m_f->FieldIOForFile(fromfld)->Import(
+            fromfld, fromField->m_fielddef, fromField->m_data,
+            LibUtilities::NullFieldMetaDataMap, ElementGIDs);
+    }
     int NumHomogeneousDir = fromField->m_fielddef[0]->m_numHomogeneousDir;
     //----------------------------------------------
     // Set up Expansion information to use mode order from field
@@ -470,13 +473,12 @@ void ProcessInterpPoints::InterpolateFieldToPts(
 
     int nfields = field0.size();
 
-    Interpolator interp;
     if (m_f->m_comm->GetRank() == 0)
     {
-        interp.SetProgressCallback(&ProcessInterpPoints::PrintProgressbar,
-                                   this);
+        m_interp.SetProgressCallback(&ProcessInterpPoints::PrintProgressbar,
+                                     this);
     }
-    interp.Interpolate(field0, pts);
+    m_interp.Interpolate(field0, pts);
     if (m_f->m_comm->GetRank() == 0)
     {
         cout << endl;
@@ -36,6 +36,7 @@
 #define FIELDUTILS_PROCESSINTERPPOINTS
 
 #include "../Module.h"
+#include "../Interpolator.h"
 
 #include <LibUtilities/BasicUtils/PtsField.h>
 
@@ -90,6 +91,10 @@ private:
                                NekDouble def_value);
 
     void calcCp0();
+
+    /// Interpolator kept between runs of the module, which reuses the
+    /// location of the points while the expansion does not change.
+    Interpolator m_interp;
 };
 }
 }
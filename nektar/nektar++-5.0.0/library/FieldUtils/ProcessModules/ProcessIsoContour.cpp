@@ -34,22 +34,21 @@
 #include <string>
 #include <iostream>
 
+#include <cmath>
+#include <cstdint>
+#include <set>
+#include <unordered_map>
+
 #include <boost/core/ignore_unused.hpp>
-#include <boost/geometry.hpp>
-#include <boost/geometry/geometries/point.hpp>
-#include <boost/geometry/geometries/box.hpp>
-#include <boost/geometry/index/rtree.hpp>
 
 #include "ProcessIsoContour.h"
 
+#include <LibUtilities/BasicUtils/HashUtils.hpp>
 #include <LibUtilities/BasicUtils/SharedArray.hpp>
 #include <LibUtilities/BasicUtils/Timer.h>
 #include <LibUtilities/BasicUtils/Progressbar.hpp>
 #include <boost/math/special_functions/fpclassify.hpp>
 
-namespace bg  = boost::geometry;
-namespace bgi = boost::geometry::index;
-
 using namespace std;
 
 namespace Nektar
@@ -57,6 +56,441 @@ namespace Nektar
 namespace FieldUtils
 {
 
+namespace
+{
+/// Distance below which two vertices are merged, as in IsoVertex::operator==.
+const NekDouble kMergeTol = sqrt(NekConstants::kNekZeroTol);
+
+/// Cell of a uniform grid used to hash the vertices.
+struct IsoCell
+{
+    std::int64_t m_i, m_j, m_k;
+
+    bool operator==(const IsoCell &rhs) const
+    {
+        return m_i == rhs.m_i && m_j == rhs.m_j && m_k == rhs.m_k;
+    }
+};
+
+struct IsoCellHash
+{
+    std::size_t operator()(const IsoCell &cell) const
+    {
+        std::size_t seed = 0;
+        hash_combine(seed, cell.m_i, cell.m_j, cell.m_k);
+        return seed;
+    }
+};
+
+/**
+ * @brief Uniform grid of cells used to merge the vertices of isocontours.
+ *
+ * Without decimation two vertices are the same if they are closer than
+ * kMergeTol. The cells are larger than the tolerance, so that a vertex only
+ * has to be compared with the vertices of the cells within the tolerance of
+ * it, which is usually its own cell. With decimation, all of the vertices
+ * lying in a cell of size @p decimate are merged.
+ */
+class IsoGrid
+{
+public:
+    IsoGrid(NekDouble decimate)
+        : m_decimate(decimate > 0.0),
+          m_size(decimate > 0.0 ? decimate : 8.0 * kMergeTol)
+    {
+    }
+
+    bool Decimates() const
+    {
+        return m_decimate;
+    }
+
+    /// Cell containing the point shifted by @p shift in each direction.
+    IsoCell GetCell(NekDouble x, NekDouble y, NekDouble z,
+                    NekDouble shift = 0.0) const
+    {
+        return IsoCell{
+            static_cast<std::int64_t>(std::floor((x + shift) / m_size)),
+            static_cast<std::int64_t>(std::floor((y + shift) / m_size)),
+            static_cast<std::int64_t>(std::floor((z + shift) / m_size))};
+    }
+
+    /// Cells in which a vertex matching the point may lie.
+    void GetCover(NekDouble x, NekDouble y, NekDouble z,
+                  std::vector<IsoCell> &cells) const
+    {
+        cells.clear();
+        if (m_decimate)
+        {
+            cells.push_back(GetCell(x, y, z));
+            return;
+        }
+
+        IsoCell lo = GetCell(x, y, z, -kMergeTol);
+        IsoCell hi = GetCell(x, y, z,  kMergeTol);
+        for (std::int64_t i = lo.m_i; i <= hi.m_i; ++i)
+        {
+            for (std::int64_t j = lo.m_j; j <= hi.m_j; ++j)
+            {
+                for (std::int64_t k = lo.m_k; k <= hi.m_k; ++k)
+                {
+                    cells.push_back(IsoCell{i, j, k});
+                }
+            }
+        }
+    }
+
+private:
+    bool      m_decimate;
+    NekDouble m_size;
+};
+
+/**
+ * @brief Spatial hash of the unique vertices of an isocontour.
+ */
+class IsoVertexHash
+{
+public:
+    IsoVertexHash(NekDouble decimate) : m_grid(decimate)
+    {
+    }
+
+    /// Return the id of the vertex matching the point, after inserting the
+    /// point with id @p id if there is none.
+    int FindOrInsert(NekDouble x, NekDouble y, NekDouble z, int id)
+    {
+        if (m_grid.Decimates())
+        {
+            IsoCell cell = m_grid.GetCell(x, y, z);
+            auto it = m_vertices.find(cell);
+            if (it != m_vertices.end())
+            {
+                return it->second.m_id;
+            }
+            m_vertices.emplace(cell, Vertex{id, x, y, z});
+            return id;
+        }
+
+        m_grid.GetCover(x, y, z, m_cover);
+        for (auto &cell : m_cover)
+        {
+            auto range = m_vertices.equal_range(cell);
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                const Vertex &v = it->second;
+                if ((v.m_x - x) * (v.m_x - x) + (v.m_y - y) * (v.m_y - y) +
+                    (v.m_z - z) * (v.m_z - z) < NekConstants::kNekZeroTol)
+                {
+                    return v.m_id;
+                }
+            }
+        }
+
+        m_vertices.emplace(m_grid.GetCell(x, y, z), Vertex{id, x, y, z});
+        return id;
+    }
+
+private:
+    struct Vertex
+    {
+        int       m_id;
+        NekDouble m_x, m_y, m_z;
+    };
+
+    IsoGrid                                                  m_grid;
+    std::unordered_multimap<IsoCell, Vertex, IsoCellHash>    m_vertices;
+    std::vector<IsoCell>                                     m_cover;
+};
+
+/// Exchange @p width values per item with the other ranks, @p sendCnt and
+/// @p recvCnt giving the number of items sent to and received from each.
+void ExchangeItems(const LibUtilities::CommSharedPtr &comm,
+                   const Array<OneD, int>            &sendCnt,
+                   const Array<OneD, int>            &recvCnt,
+                   const int                          width,
+                   Array<OneD, NekDouble>            &sendBuf,
+                   Array<OneD, NekDouble>            &recvBuf)
+{
+    int nRanks = comm->GetSize();
+    int nRecv  = 0;
+    Array<OneD, int> sendSize(nRanks), sendOff(nRanks, 0);
+    Array<OneD, int> recvSize(nRanks), recvOff(nRanks, 0);
+    for (int r = 0; r < nRanks; ++r)
+    {
+        sendSize[r] = width * sendCnt[r];
+        recvSize[r] = width * recvCnt[r];
+        if (r > 0)
+        {
+            sendOff[r] = sendOff[r - 1] + sendSize[r - 1];
+            recvOff[r] = recvOff[r - 1] + recvSize[r - 1];
+        }
+        nRecv += recvSize[r];
+    }
+
+    recvBuf = Array<OneD, NekDouble>(nRecv);
+    comm->AlltoAllv(sendBuf, sendSize, sendOff, recvBuf, recvSize, recvOff);
+}
+}
+
+/**
+ * @brief Vertices of an isocontour which coincide with vertices of the
+ * isocontours of other partitions.
+ *
+ * Each rank owns the cells of an IsoGrid chosen by a hash of the cell. A
+ * vertex is sent to the owners of the cells in which a matching vertex may
+ * lie, and the owner of its own cell gathers its matches: these are the
+ * vertices of other partitions which are averaged with it by Average.
+ */
+class IsoSharedVertices
+{
+public:
+    IsoSharedVertices(const LibUtilities::CommSharedPtr &comm,
+                      const std::vector<NekDouble>      &x,
+                      const std::vector<NekDouble>      &y,
+                      const std::vector<NekDouble>      &z,
+                      const int                          nvert,
+                      const NekDouble                    decimate);
+
+    int GetNumShared() const
+    {
+        return m_replyVid.size();
+    }
+
+    void Average(const std::vector<NekDouble*> &values);
+
+private:
+    LibUtilities::CommSharedPtr m_comm;
+    /// Local vertex of each value sent, ordered by owner.
+    std::vector<int>            m_sendVid;
+    /// Number of values sent to and received from each rank.
+    Array<OneD, int>            m_sendCnt, m_recvCnt;
+    /// Local vertex of each average received, ordered by owner.
+    std::vector<int>            m_replyVid;
+    /// Number of averages received from and sent to each rank.
+    Array<OneD, int>            m_replyCnt, m_avgCnt;
+    /// Received values averaged for each average sent.
+    std::vector<std::vector<int> > m_groups;
+};
+
+IsoSharedVertices::IsoSharedVertices(
+    const LibUtilities::CommSharedPtr &comm,
+    const std::vector<NekDouble>      &x,
+    const std::vector<NekDouble>      &y,
+    const std::vector<NekDouble>      &z,
+    const int                          nvert,
+    const NekDouble                    decimate)
+    : m_comm(comm)
+{
+    int nRanks = m_comm->GetSize();
+    IsoGrid grid(decimate);
+    IsoCellHash hasher;
+    std::vector<IsoCell> cover;
+
+    // Send each vertex to the owners of the cells it may match, flagging
+    // the owner of its own cell.
+    std::vector<std::vector<std::pair<int, bool> > > route(nRanks);
+    for (int i = 0; i < nvert; ++i)
+    {
+        int home = hasher(grid.GetCell(x[i], y[i], z[i])) % nRanks;
+        route[home].push_back(std::make_pair(i, true));
+
+        grid.GetCover(x[i], y[i], z[i], cover);
+        std::set<int> owners;
+        for (auto &cell : cover)
+        {
+            owners.insert(hasher(cell) % nRanks);
+        }
+        for (auto &r : owners)
+        {
+            if (r != home)
+            {
+                route[r].push_back(std::make_pair(i, false));
+            }
+        }
+    }
+
+    Array<OneD, int> sendCnt(nRanks), recvCnt(nRanks, 0);
+    int nSend = 0;
+    for (int r = 0; r < nRanks; ++r)
+    {
+        sendCnt[r] = route[r].size();
+        nSend     += sendCnt[r];
+    }
+    m_comm->AlltoAll(sendCnt, recvCnt);
+
+    Array<OneD, NekDouble> sendBuf(4 * nSend), recvBuf;
+    for (int r = 0, cnt = 0; r < nRanks; ++r)
+    {
+        for (auto &entry : route[r])
+        {
+            sendBuf[cnt++] = x[entry.first];
+            sendBuf[cnt++] = y[entry.first];
+            sendBuf[cnt++] = z[entry.first];
+            sendBuf[cnt++] = entry.second ? 1.0 : 0.0;
+        }
+    }
+    ExchangeItems(m_comm, sendCnt, recvCnt, 4, sendBuf, recvBuf);
+
+    // Hash the received vertices by their own cell.
+    int nRecv = recvBuf.num_elements() / 4;
+    Array<OneD, int> source(nRecv);
+    std::unordered_multimap<IsoCell, int, IsoCellHash> cells;
+    for (int r = 0, cnt = 0; r < nRanks; ++r)
+    {
+        for (int i = 0; i < recvCnt[r]; ++i, ++cnt)
+        {
+            source[cnt] = r;
+            cells.emplace(grid.GetCell(recvBuf[4 * cnt], recvBuf[4 * cnt + 1],
+                                       recvBuf[4 * cnt + 2]), cnt);
+        }
+    }
+
+    // Match the vertices of the owned cells with the vertices of other
+    // ranks. Flag 1 asks for the values of a vertex, flag 2 marks a vertex
+    // receiving an average.
+    Array<OneD, NekDouble> flags(nRecv, 0.0);
+    std::vector<std::vector<int> > groups;
+    std::vector<int> groupRank;
+    for (int p = 0; p < nRecv; ++p)
+    {
+        if (recvBuf[4 * p + 3] < 0.5)
+        {
+            continue;
+        }
+
+        NekDouble px = recvBuf[4 * p];
+        NekDouble py = recvBuf[4 * p + 1];
+        NekDouble pz = recvBuf[4 * p + 2];
+
+        std::vector<int> group;
+        bool shared = false;
+        grid.GetCover(px, py, pz, cover);
+        for (auto &cell : cover)
+        {
+            auto range = cells.equal_range(cell);
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                int q = it->second;
+                NekDouble dx = recvBuf[4 * q] - px;
+                NekDouble dy = recvBuf[4 * q + 1] - py;
+                NekDouble dz = recvBuf[4 * q + 2] - pz;
+                if (grid.Decimates() ||
+                    dx * dx + dy * dy + dz * dz < NekConstants::kNekZeroTol)
+                {
+                    group.push_back(q);
+                    shared = shared || source[q] != source[p];
+                }
+            }
+        }
+
+        if (shared)
+        {
+            for (auto &q : group)
+            {
+                flags[q] = std::max(flags[q], 1.0);
+            }
+            flags[p] = 3.0;
+            groups.push_back(group);
+            groupRank.push_back(source[p]);
+        }
+    }
+
+    Array<OneD, NekDouble> replyBuf;
+    ExchangeItems(m_comm, recvCnt, sendCnt, 1, flags, replyBuf);
+
+    // Set up the exchanges of the shared vertices.
+    m_sendCnt  = Array<OneD, int>(nRanks, 0);
+    m_recvCnt  = Array<OneD, int>(nRanks, 0);
+    m_replyCnt = Array<OneD, int>(nRanks, 0);
+    m_avgCnt   = Array<OneD, int>(nRanks, 0);
+    for (int r = 0, cnt = 0; r < nRanks; ++r)
+    {
+        for (auto &entry : route[r])
+        {
+            int flag = static_cast<int>(replyBuf[cnt++] + 0.5);
+            if (flag & 1)
+            {
+                m_sendVid.push_back(entry.first);
+                ++m_sendCnt[r];
+            }
+            if (flag & 2)
+            {
+                m_replyVid.push_back(entry.first);
+                ++m_replyCnt[r];
+            }
+        }
+    }
+
+    // Position of the needed vertices in the values received by Average.
+    Array<OneD, int> position(nRecv, -1);
+    for (int r = 0, cnt = 0, pos = 0; r < nRanks; ++r)
+    {
+        for (int i = 0; i < recvCnt[r]; ++i, ++cnt)
+        {
+            if (flags[cnt] > 0.5)
+            {
+                position[cnt] = pos++;
+                ++m_recvCnt[r];
+            }
+        }
+    }
+
+    for (int g = 0; g < groups.size(); ++g)
+    {
+        for (auto &q : groups[g])
+        {
+            q = position[q];
+        }
+        ++m_avgCnt[groupRank[g]];
+    }
+    m_groups = std::move(groups);
+}
+
+/**
+ * @brief Replace the values of the shared vertices by their average over
+ * the partitions. Each entry of @p values points to an array holding one
+ * value per vertex.
+ */
+void IsoSharedVertices::Average(const std::vector<NekDouble*> &values)
+{
+    int width = values.size();
+
+    Array<OneD, NekDouble> sendBuf(width * m_sendVid.size()), recvBuf;
+    for (int i = 0, cnt = 0; i < m_sendVid.size(); ++i)
+    {
+        for (int v = 0; v < width; ++v)
+        {
+            sendBuf[cnt++] = values[v][m_sendVid[i]];
+        }
+    }
+    ExchangeItems(m_comm, m_sendCnt, m_recvCnt, width, sendBuf, recvBuf);
+
+    Array<OneD, NekDouble> avgBuf(width * m_groups.size(), 0.0), replyBuf;
+    for (int g = 0; g < m_groups.size(); ++g)
+    {
+        for (auto &q : m_groups[g])
+        {
+            for (int v = 0; v < width; ++v)
+            {
+                avgBuf[width * g + v] += recvBuf[width * q + v];
+            }
+        }
+        for (int v = 0; v < width; ++v)
+        {
+            avgBuf[width * g + v] /= m_groups[g].size();
+        }
+    }
+    ExchangeItems(m_comm, m_avgCnt, m_replyCnt, width, avgBuf, replyBuf);
+
+    for (int i = 0, cnt = 0; i < m_replyVid.size(); ++i)
+    {
+        for (int v = 0; v < width; ++v)
+        {
+            values[v][m_replyVid[i]] = replyBuf[cnt++];
+        }
+    }
+}
+
 ModuleKey ProcessIsoContour::className =
     GetModuleFactory().RegisterCreatorFunction(
                         ModuleKey(eProcessModule, "isocontour"),
@@ -106,6 +540,9 @@ ProcessIsoContour::ProcessIsoContour(FieldSharedPtr f) :
                                         "Remove contours with less than specified number of triangles."
                                          "Only valid with GlobalCondense or Smooth options.");
 
+    m_config["decimate"]           = ConfigOption(false, "0",
+                                        "Merge the vertices lying in cells of "
+                                        "this size, default = 0 (disabled)");
 
 }
 
@@ -121,6 +558,14 @@ void ProcessIsoContour::Process(po::variables_map &vm)
 
     vector<IsoSharedPtr> iso;
 
+    bool      smoothing      = m_config["smooth"].as<bool>();
+    bool      globalcondense = m_config["globalcondense"].as<bool>();
+    NekDouble decimate       = m_config["decimate"].as<NekDouble>();
+
+    // The vertices shared with other partitions are found collectively, so
+    // every rank takes part in a parallel global condense.
+    bool parallelcondense = globalcondense && !m_f->m_comm->IsSerial();
+
     ASSERTL0(m_f->m_fieldPts.get(),
             "Should have m_fieldPts for IsoContour.");
 
@@ -142,7 +587,7 @@ void ProcessIsoContour::Process(po::variables_map &vm)
             m_f->m_variables.push_back(fieldName);
         }
 
-        if(m_f->m_fieldPts->GetNpoints() == 0)
+        if(m_f->m_fieldPts->GetNpoints() == 0 && !parallelcondense)
         {
             return;
         }
@@ -191,7 +636,7 @@ void ProcessIsoContour::Process(po::variables_map &vm)
         ASSERTL0(m_config["fieldvalue"].as<string>() != "NotSet", "fieldvalue must be specified");
         value   = m_config["fieldvalue"].as<NekDouble>();
 
-        iso = ExtractContour(fieldid,value);
+        iso = ExtractContour(fieldid,value,decimate);
     }
     else
     {
@@ -199,8 +644,6 @@ void ProcessIsoContour::Process(po::variables_map &vm)
     }
 
     // Process isocontour
-    bool smoothing      = m_config["smooth"].as<bool>();
-    bool globalcondense = m_config["globalcondense"].as<bool>();
     if(globalcondense)
     {
         if(verbose)
@@ -210,8 +653,12 @@ void ProcessIsoContour::Process(po::variables_map &vm)
         int nfields = m_f->m_fieldPts->GetNFields() + m_f->m_fieldPts->GetDim();
         IsoSharedPtr g_iso = MemoryManager<Iso>::AllocateSharedPtr(nfields-3);
 
-        g_iso->GlobalCondense(iso,verbose);
+        g_iso->GlobalCondense(iso,verbose,decimate);
 
+        if(parallelcondense)
+        {
+            g_iso->SetupSharedVertices(m_f->m_comm, decimate);
+        }
 
         iso.clear();
         iso.push_back(g_iso);
@@ -378,7 +825,8 @@ void ThreeSimilar (const int i, const int j, const int k,
 
 vector<IsoSharedPtr> ProcessIsoContour::ExtractContour(
         const int fieldid,
-        const NekDouble val)
+        const NekDouble val,
+        const NekDouble decimate)
 {
     vector<IsoSharedPtr> returnval;
 
@@ -394,155 +842,167 @@ vector<IsoSharedPtr> ProcessIsoContour::ExtractContour(
 
     Array<OneD, NekDouble> c = fields[coordim + fieldid];
 
-    int i, j, k, ii, jj, kk, r, s, n, counter, boolean;
-    Array<OneD, Array<OneD, NekDouble> > intfields(nfields);
-    intfields[0] = Array<OneD, NekDouble>(5*nfields);
-    for(i = 1; i < nfields; ++i)
-    {
-        intfields[i] = intfields[i-1] + 5;
-    }
-    Array<OneD, NekDouble> cx = intfields[0];
-    Array<OneD, NekDouble> cy = intfields[1];
-    Array<OneD, NekDouble> cz = intfields[2];
-
     vector<Array<OneD, int> > ptsConn;
     m_f->m_fieldPts->GetConnectivity(ptsConn);
     
-    for(int zone = 0; zone < ptsConn.size(); ++zone)
+    // The zones are independent, so they are extracted concurrently,
+    // each range of zones with its own interpolation scratch space.
+    vector<IsoSharedPtr> zoneIso(ptsConn.size());
+    ForEachChunk(ptsConn.size(), [&](int zoneStart, int zoneEnd)
     {
-        IsoSharedPtr iso;
+        int i, j, k, ii, jj, kk, r, s, n, counter, boolean;
+        Array<OneD, Array<OneD, NekDouble> > intfields(nfields);
+        intfields[0] = Array<OneD, NekDouble>(5*nfields);
+        for(i = 1; i < nfields; ++i)
+        {
+            intfields[i] = intfields[i-1] + 5;
+        }
+        Array<OneD, NekDouble> cx = intfields[0];
+        Array<OneD, NekDouble> cy = intfields[1];
+        Array<OneD, NekDouble> cz = intfields[2];
 
-        iso = MemoryManager<Iso>::AllocateSharedPtr(nfields-3);
+        for(int zone = zoneStart; zone < zoneEnd; ++zone)
+        {
+            IsoSharedPtr iso = MemoryManager<Iso>::AllocateSharedPtr(nfields-3);
 
-        int nelmt = ptsConn[zone].num_elements()
-            /(coordim+1);
+            int nelmt = ptsConn[zone].num_elements()
+                /(coordim+1);
 
-        Array<OneD, int> conn = ptsConn[zone];
+            Array<OneD, int> conn = ptsConn[zone];
 
-        for (n = 0, i = 0; i < nelmt; ++i)
-        {
-            // check to see if val is between vertex values
-            if(!(((c[conn[i*4]]  >val)&&(c[conn[i*4+1]]>val)&&
-                  (c[conn[i*4+2]]>val)&&(c[conn[i*4+3]]>val))||
-                 ((c[conn[i*4  ]]<val)&&(c[conn[i*4+1]]<val)&&
-                  (c[conn[i*4+2]]<val)&&(c[conn[i*4+3]]<val))))
+            for (n = 0, i = 0; i < nelmt; ++i)
             {
-
-                // loop over all edges and interpolate if
-                // contour is between vertex values
-                for (counter = 0, j=0; j<=2; j++)
+                // check to see if val is between vertex values
+                if(!(((c[conn[i*4]]  >val)&&(c[conn[i*4+1]]>val)&&
+                      (c[conn[i*4+2]]>val)&&(c[conn[i*4+3]]>val))||
+                     ((c[conn[i*4  ]]<val)&&(c[conn[i*4+1]]<val)&&
+                      (c[conn[i*4+2]]<val)&&(c[conn[i*4+3]]<val))))
                 {
-                    for (k=j+1; k<=3; k++)
+
+                    // loop over all edges and interpolate if
+                    // contour is between vertex values
+                    for (counter = 0, j=0; j<=2; j++)
                     {
-                        if (((c[conn[i*4+j]]>=val)&&
-                             (val>=c[conn[i*4+k]]))||
-                            ((c[conn[i*4+j]]<=val)&&
-                             (val<=c[conn[i*4+k]])))
+                        for (k=j+1; k<=3; k++)
                         {
-                            // linear interpolation of fields
-                            // (and coords).
-                            NekDouble cj = c[conn[i*4+j]];
-                            NekDouble ck = c[conn[i*4+k]];
-                            NekDouble factor =  (val-cj)/(ck-cj);
-
-                            if(fabs(cj-ck) > 1e-12)
+                            if (((c[conn[i*4+j]]>=val)&&
+                                 (val>=c[conn[i*4+k]]))||
+                                ((c[conn[i*4+j]]<=val)&&
+                                 (val<=c[conn[i*4+k]])))
                             {
-                                // interpolate coordinates and fields
-                                for(int f = 0; f < nfields; ++f)
+                                // linear interpolation of fields
+                                // (and coords).
+                                NekDouble cj = c[conn[i*4+j]];
+                                NekDouble ck = c[conn[i*4+k]];
+                                NekDouble factor =  (val-cj)/(ck-cj);
+
+                                if(fabs(cj-ck) > 1e-12)
                                 {
-                                    if(counter == 5)
+                                    // interpolate coordinates and fields
+                                    for(int f = 0; f < nfields; ++f)
                                     {
-                                        ASSERTL0(false,"Counter is 5");
+                                        if(counter == 5)
+                                        {
+                                            ASSERTL0(false,"Counter is 5");
+                                        }
+                                        intfields[f][counter] =
+                                            fields[f][conn[4*i+j]] +
+                                            factor*(fields[f][conn[4*i+k]] -
+                                                    fields[f][conn[4*i+j]]);
                                     }
-                                    intfields[f][counter] =
-                                        fields[f][conn[4*i+j]] +
-                                        factor*(fields[f][conn[4*i+k]] -
-                                                fields[f][conn[4*i+j]]);
+                                    ++counter;
                                 }
-                                ++counter;
                             }
                         }
                     }
-                }
-
-                switch(counter)
-                {
-                case 3:
-                    n+=1;
-                    iso->ResizeFields(3*n);
 
-                    for(j = 0; j < 3; ++j)
+                    switch(counter)
                     {
-                        iso->SetFields(3*(n-1)+j,intfields,j);
-                    }
-                    break;
-                case 4:
-                    n+=2;
-                    iso->ResizeFields(3*n);
+                    case 3:
+                        n+=1;
+                        iso->ResizeFields(3*n);
 
-                    for(j = 0; j < 3; ++j)
-                    {
-                        iso->SetFields(3*(n-2)+j,intfields,j);
-                        iso->SetFields(3*(n-1)+j,intfields,j+1);
-                    }
-                    break;
-                case 5:
-                    n+=1;
-                    iso->ResizeFields(3*n);
+                        for(j = 0; j < 3; ++j)
+                        {
+                            iso->SetFields(3*(n-1)+j,intfields,j);
+                        }
+                        break;
+                    case 4:
+                        n+=2;
+                        iso->ResizeFields(3*n);
 
-                    boolean=0;
-                    for (ii=0;ii<=2;ii++)
-                    {
-                        for (jj=ii+1;jj<=3;jj++)
+                        for(j = 0; j < 3; ++j)
                         {
-                            for (kk=jj+1;kk<=4;kk++)
+                            iso->SetFields(3*(n-2)+j,intfields,j);
+                            iso->SetFields(3*(n-1)+j,intfields,j+1);
+                        }
+                        break;
+                    case 5:
+                        n+=1;
+                        iso->ResizeFields(3*n);
+
+                        boolean=0;
+                        for (ii=0;ii<=2;ii++)
+                        {
+                            for (jj=ii+1;jj<=3;jj++)
                             {
-                                if((((cx[ii]-cx[jj])==0.0)&&
-                                    ((cy[ii]-cy[jj])==0.0)&&
-                                    ((cz[ii]-cz[jj])==0.0))&&
-                                   (((cx[ii]-cx[kk])==0.0)&&
-                                    ((cy[ii]-cy[kk])==0.0)&&
-                                    ((cz[ii]-cz[kk])==0.0)))
+                                for (kk=jj+1;kk<=4;kk++)
                                 {
-                                    boolean+=1;
-                                    ThreeSimilar (ii,jj,kk,r,s);
+                                    if((((cx[ii]-cx[jj])==0.0)&&
+                                        ((cy[ii]-cy[jj])==0.0)&&
+                                        ((cz[ii]-cz[jj])==0.0))&&
+                                       (((cx[ii]-cx[kk])==0.0)&&
+                                        ((cy[ii]-cy[kk])==0.0)&&
+                                        ((cz[ii]-cz[kk])==0.0)))
+                                    {
+                                        boolean+=1;
+                                        ThreeSimilar (ii,jj,kk,r,s);
 
-                                    iso->SetFields(3*(n-1)  ,intfields,ii);
-                                    iso->SetFields(3*(n-1)+1,intfields,r);
-                                    iso->SetFields(3*(n-1)+2,intfields,s);
-                                }
-                                else
-                                {
-                                    boolean+=0;
+                                        iso->SetFields(3*(n-1)  ,intfields,ii);
+                                        iso->SetFields(3*(n-1)+1,intfields,r);
+                                        iso->SetFields(3*(n-1)+2,intfields,s);
+                                    }
+                                    else
+                                    {
+                                        boolean+=0;
+                                    }
                                 }
                             }
                         }
-                    }
 
-                    if (boolean==0)
-                    {
-                        TwoPairs (cx,cy,cz,r);
+                        if (boolean==0)
+                        {
+                            TwoPairs (cx,cy,cz,r);
 
-                        iso->SetFields(3*(n-1)  ,intfields,0);
-                        iso->SetFields(3*(n-1)+1,intfields,2);
-                        iso->SetFields(3*(n-1)+2,intfields,r);
+                            iso->SetFields(3*(n-1)  ,intfields,0);
+                            iso->SetFields(3*(n-1)+1,intfields,2);
+                            iso->SetFields(3*(n-1)+2,intfields,r);
+                        }
+                        break;
                     }
-                    break;
                 }
             }
+
+            if(n)
+            {
+                iso->SetNTris(n);
+
+                // condense the information in this elemental extraction.
+                iso->Condense(decimate);
+
+                zoneIso[zone] = iso;
+            }
         }
-        
-        if(n)
-        {   
-            iso->SetNTris(n);
-
-            // condense the information in this elemental extraction.
-            iso->Condense();
-        
+    });
+
+    for(auto &iso : zoneIso)
+    {
+        if(iso)
+        {
             returnval.push_back(iso);
         }
     }
-    
+
     return returnval;
 }
 
@@ -669,237 +1129,152 @@ void ProcessIsoContour::SetupIsoFromFieldPts(vector<IsoSharedPtr> &isovec)
 }
 
 
-void Iso::Condense(void)
+/**
+ * @brief Merge the coincident vertices of the triangles, or all the vertices
+ * lying in a cell of size @p decimate, and remove the degenerate triangles.
+ */
+void Iso::Condense(NekDouble decimate)
 {
-    int i,j,cnt;
-    IsoVertex v;
-    vector<IsoVertex> vert;
+    int i, f;
 
     if(!m_ntris) return;
 
     if(m_condensed) return;
     m_condensed = true;
 
-    vert.reserve(m_ntris/6);
-
     m_vid = Array<OneD, int>(3*m_ntris);
 
-    // fill first 3 points and initialise fields
-    v.m_fields.resize(m_fields.size());
-    for(cnt =0, i = 0; i < 3; ++i)
+    // The unique vertices are moved to the front of the arrays, which is
+    // safe since a vertex is never moved past its original position.
+    IsoVertexHash hash(decimate);
+    vector<int>   count;
+    m_nvert = 0;
+    for(i = 0; i < 3*m_ntris; ++i)
     {
-        v.m_x = m_x[i];
-        v.m_y = m_y[i];
-        v.m_z = m_z[i];
-        for(int f = 0; f < m_fields.size(); ++f)
+        int id = hash.FindOrInsert(m_x[i], m_y[i], m_z[i], m_nvert);
+        if(id == m_nvert)
         {
-            v.m_fields[f] = m_fields[f][i];
+            m_x[id] = m_x[i];
+            m_y[id] = m_y[i];
+            m_z[id] = m_z[i];
+            for(f = 0; f < m_fields.size(); ++f)
+            {
+                m_fields[f][id] = m_fields[f][i];
+            }
+            count.push_back(1);
+            ++m_nvert;
         }
-        v.m_id = cnt;
-        vert.push_back(v);
-        m_vid[i] = v.m_id;
-        ++cnt;
-    }
-
-    for(i = 1; i < m_ntris; ++i)
-    {
-        for(j = 0; j < 3; ++j)
+        else if(decimate > 0.0)
         {
-            v.m_x = m_x[3*i+j];
-            v.m_y = m_y[3*i+j];
-            v.m_z = m_z[3*i+j];
-
-            auto pt = find(vert.begin(),vert.end(),v);
-            if(pt != vert.end())
+            m_x[id] += m_x[i];
+            m_y[id] += m_y[i];
+            m_z[id] += m_z[i];
+            for(f = 0; f < m_fields.size(); ++f)
             {
-                m_vid[3*i+j] = pt[0].m_id;
+                m_fields[f][id] += m_fields[f][i];
             }
-            else
-            {
-                v.m_id = cnt;
-
-                for(int f = 0; f < m_fields.size(); ++f)
-                {
-                    v.m_fields[f] = m_fields[f][3*i+j];
-                }
-
-                vert.push_back(v);
-
-                m_vid[3*i+j] = v.m_id;
-                ++cnt;
-           }
+            ++count[id];
         }
+        m_vid[i] = id;
     }
 
-    // remove elements with multiple vertices
-    for(i = 0,cnt=0; i < m_ntris;)
+    if(decimate > 0.0)
     {
-        if((m_vid[3*i]  ==m_vid[3*i+1])||
-           (m_vid[3*i]  ==m_vid[3*i+2])||
-           (m_vid[3*i+1]==m_vid[3*i+2]))
-        {
-            cnt++;
-            for(j = 3*i; j < 3*(m_ntris-1); ++j)
-            {
-                m_vid[j] = m_vid[j+3];
-            }
-            m_ntris--;
-        }
-        else
-        {
-            ++i;
-        }
+        AverageClusters(count);
     }
 
-    m_nvert  = vert.size();
+    RemoveDegenerateTris();
 
     m_x.resize(m_nvert);
     m_y.resize(m_nvert);
     m_z.resize(m_nvert);
 
-    for(int f = 0; f < m_fields.size(); ++f)
+    for(f = 0; f < m_fields.size(); ++f)
     {
         m_fields[f].resize(m_nvert);
     }
-
-    for(i = 0; i < m_nvert; ++i)
-    {
-        m_x[i] = vert[i].m_x;
-        m_y[i] = vert[i].m_y;
-        m_z[i] = vert[i].m_z;
-        for(int f = 0; f < m_fields.size(); ++f)
-        {
-            m_fields[f][i] = vert[i].m_fields[f];
-        }
-    }
 }
 
-
-void Iso::GlobalCondense(vector<IsoSharedPtr> &iso, bool verbose)
+/**
+ * @brief Merge the isocontours of the zones into this one, using a spatial
+ * hash of the vertices. Each zone is released once it has been merged.
+ */
+void Iso::GlobalCondense(vector<IsoSharedPtr> &iso, bool verbose,
+                         NekDouble decimate)
 {
-    typedef bg::model::point<NekDouble, 3, bg::cs::cartesian> BPoint;
-    typedef std::pair<BPoint, unsigned int> PointPair;
-
-    int    i,j,n;
-    int    nelmt;
-    int    niso=iso.size();
-    int    id1,id2;
-    Array<OneD, Array<OneD, int> > vidmap;
+    int i, n, f;
+    int niso = iso.size();
 
     if(m_condensed) return;
     m_condensed = true;
 
-    vidmap = Array<OneD, Array<OneD, int> > (niso);
-
     m_ntris = 0;
-    for(i = 0; i < niso; ++i)
+    for(n = 0; n < niso; ++n)
     {
-        if(iso[i]->m_ntris)
-        {
-            m_ntris += iso[i]->m_ntris;
-        }
+        m_ntris += iso[n]->m_ntris;
     }
 
     m_vid = Array<OneD, int>(3*m_ntris);
 
     m_nvert = 0;
-    for(i = 0; i < niso; ++i)
-    {
-        if(iso[i]->m_ntris)
-        {
-            m_nvert += iso[i]->m_nvert;
-        }
-    }
-
-    vector< vector<int> > isocon;
-    isocon.resize(niso);
-    vector<int> global_to_unique_map;
-    global_to_unique_map.resize(m_nvert);
-
-    vector< pair<int,int> > global_to_iso_map;
-    global_to_iso_map.resize(m_nvert);
-
-    //Fill vertex array into rtree format
-    id2 = 0;
-    std::vector<PointPair> inPoints;
-    for(i = 0; i < niso; ++i)
-    {
-        for(id1 = 0; id1 < iso[i]->m_nvert; ++id1)
-        {
-            inPoints.push_back(PointPair(BPoint( iso[i]->m_x[id1],
-                                                 iso[i]->m_y[id1],
-                                                 iso[i]->m_z[id1]), id2));
-            global_to_unique_map[id2]=id2;
-            global_to_iso_map[id2] = make_pair(i,id1);
-            id2++;
-        }
-    }
-
-
-    if(verbose)
+    m_x.clear();
+    m_y.clear();
+    m_z.clear();
+    for(f = 0; f < m_fields.size(); ++f)
     {
-        cout << "\t Process building tree ..." << endl;
+        m_fields[f].clear();
     }
 
-    //Build tree
-    bgi::rtree<PointPair, bgi::rstar<16> > rtree;
-    rtree.insert(inPoints.begin(), inPoints.end());
-
-    //Find neighbours
-    int      unique_index = 0;
-    int      prog=0;
-    for(i = 0; i < m_nvert; ++i)
+    IsoVertexHash hash(decimate);
+    vector<int>   count;
+    int           ntris = 0;
+    int           prog  = 0;
+    for(n = 0; n < niso; ++n)
     {
         if(verbose)
         {
-            prog = LibUtilities::PrintProgressbar(i,m_nvert,
-                                                  "Nearest verts",prog);
+            prog = LibUtilities::PrintProgressbar(n, niso,
+                                                  "Merging verts", prog);
         }
 
-        BPoint queryPoint = inPoints[i].first;
-
-
-        // check to see if point has been already reset to lower than
-        // unique value
-        if(global_to_unique_map[i] < unique_index) // do nothing
+        Iso        &zone = *iso[n];
+        vector<int> vmap(zone.m_nvert);
+        for(i = 0; i < zone.m_nvert; ++i)
         {
-        }
-        else
-        {
-            // find nearest 10 points within the distance box
-            std::vector<PointPair> result;
-            rtree.query(bgi::nearest(queryPoint, 10), std::back_inserter(result));
-
-            //see if any values have unique value  already
-            set<int> samept;
-            int new_index = -1;
-            for(id1 = 0; id1 < result.size(); ++id1)
+            int id = hash.FindOrInsert(zone.m_x[i], zone.m_y[i],
+                                       zone.m_z[i], m_nvert);
+            if(id == m_nvert)
             {
-                NekDouble dist = bg::distance(queryPoint, result[id1].first);
-                if(dist*dist < NekConstants::kNekZeroTol) // same point
+                m_x.push_back(zone.m_x[i]);
+                m_y.push_back(zone.m_y[i]);
+                m_z.push_back(zone.m_z[i]);
+                for(f = 0; f < m_fields.size(); ++f)
                 {
-                    id2 = result[id1].second;
-                    samept.insert(id2);
-
-                    if(global_to_unique_map[id2] <unique_index)
-                    {
-                        new_index = global_to_unique_map[id2];
-                    }
+                    m_fields[f].push_back(zone.m_fields[f][i]);
                 }
+                count.push_back(1);
+                ++m_nvert;
             }
-            if(new_index == -1)
+            else if(decimate > 0.0)
             {
-                new_index = unique_index;
-                unique_index++;
+                m_x[id] += zone.m_x[i];
+                m_y[id] += zone.m_y[i];
+                m_z[id] += zone.m_z[i];
+                for(f = 0; f < m_fields.size(); ++f)
+                {
+                    m_fields[f][id] += zone.m_fields[f][i];
+                }
+                ++count[id];
             }
+            vmap[i] = id;
+        }
 
-            // reset all same values to new_index
-            global_to_unique_map[i] = new_index;
-            for(auto &it : samept)
-            {
-                global_to_unique_map[it] = new_index;
-            }
+        for(i = 0; i < 3*zone.m_ntris; ++i, ++ntris)
+        {
+            m_vid[ntris] = vmap[zone.m_vid[i]];
         }
+
+        iso[n].reset();
     }
 
     if(verbose)
@@ -907,50 +1282,65 @@ void Iso::GlobalCondense(vector<IsoSharedPtr> &iso, bool verbose)
         cout << endl;
     }
 
-    m_nvert = unique_index;
-
-    nelmt = 0;
-    // reset m_vid;
-    int cnt = 0;
-    for(n = 0; n < niso; ++n)
+    if(decimate > 0.0)
     {
-        for(i = 0; i < iso[n]->m_ntris; ++i,nelmt++)
-        {
-            for(j=0; j < 3;++j)
-            {
-                m_vid[3*nelmt+j] = global_to_unique_map[iso[n]->m_vid[3*i+j]+cnt];
-            }
-        }
-        cnt += iso[n]->m_nvert;
+        AverageClusters(count);
     }
 
-    m_ntris = nelmt;
+    RemoveDegenerateTris();
+}
 
-    m_x.resize(m_nvert);
-    m_y.resize(m_nvert);
-    m_z.resize(m_nvert);
+/**
+ * @brief Find the vertices shared with the isocontours of the other
+ * partitions of @p comm and give them their average position and values.
+ * This is collective over @p comm.
+ */
+void Iso::SetupSharedVertices(const LibUtilities::CommSharedPtr &comm,
+                              NekDouble decimate)
+{
+    m_shared = MemoryManager<IsoSharedVertices>::AllocateSharedPtr(
+        comm, m_x, m_y, m_z, m_nvert, decimate);
 
-    m_fields.resize(iso[0]->m_fields.size());
-    for(i = 0; i < iso[0]->m_fields.size(); ++i)
+    vector<NekDouble*> values = {m_x.data(), m_y.data(), m_z.data()};
+    for(int f = 0; f < m_fields.size(); ++f)
     {
-        m_fields[i].resize(m_nvert);
+        values.push_back(m_fields[f].data());
     }
+    m_shared->Average(values);
+}
 
-    for(n = 0; n < global_to_unique_map.size(); ++n)
+// replace the accumulated vertices of each cluster by their mean
+void Iso::AverageClusters(const vector<int> &count)
+{
+    for(int i = 0; i < m_nvert; ++i)
     {
+        NekDouble scal = 1.0/count[i];
+        m_x[i] *= scal;
+        m_y[i] *= scal;
+        m_z[i] *= scal;
+        for(int f = 0; f < m_fields.size(); ++f)
+        {
+            m_fields[f][i] *= scal;
+        }
+    }
+}
 
-        m_x[global_to_unique_map[n]] = bg::get<0>(inPoints[n].first);
-        m_y[global_to_unique_map[n]] = bg::get<1>(inPoints[n].first);
-        m_z[global_to_unique_map[n]] = bg::get<2>(inPoints[n].first);
-
-        int isoid = global_to_iso_map[n].first;
-        int ptid  = global_to_iso_map[n].second;
-        for(j = 0; j < m_fields.size(); ++j)
+// remove the triangles with repeated vertices
+void Iso::RemoveDegenerateTris()
+{
+    int ntris = 0;
+    for(int i = 0; i < m_ntris; ++i)
+    {
+        int v0 = m_vid[3*i], v1 = m_vid[3*i+1], v2 = m_vid[3*i+2];
+        if(v0 != v1 && v0 != v2 && v1 != v2)
         {
-            m_fields[j][global_to_unique_map[n]] = iso[isoid]->
-                m_fields[j][ptid];
+            m_vid[3*ntris]   = v0;
+            m_vid[3*ntris+1] = v1;
+            m_vid[3*ntris+2] = v2;
+            ++ntris;
         }
     }
+    m_ntris = ntris;
 }
 
 
@@ -1053,6 +1443,12 @@ void Iso::Smooth(int n_iter, NekDouble lambda, NekDouble mu)
             ztemp[i] = m_z[i] + del_v[2] * lambda;
         }
 
+        // keep the vertices shared with other partitions together
+        if(m_shared)
+        {
+            m_shared->Average({xtemp.data(), ytemp.data(), ztemp.data()});
+        }
+
         // compute second weighted average
         for(i=0;i< m_nvert;++i)
         {
@@ -1068,6 +1464,11 @@ void Iso::Smooth(int n_iter, NekDouble lambda, NekDouble mu)
             m_y[i] = ytemp[i] + del_v[1] * mu;
             m_z[i] = ztemp[i] + del_v[2] * mu;
         }
+
+        if(m_shared)
+        {
+            m_shared->Average({m_x.data(), m_y.data(), m_z.data()});
+        }
     }
 }
 
@@ -43,11 +43,16 @@ namespace Nektar
 namespace FieldUtils
 {
 
+class IsoSharedVertices;
+
 class Iso
 {
     public:
-        void  Condense(void);
-        void  GlobalCondense(std::vector<std::shared_ptr<Iso> > &iso, bool verbose);
+        void  Condense(NekDouble decimate = 0.0);
+        void  GlobalCondense(std::vector<std::shared_ptr<Iso> > &iso,
+                             bool verbose, NekDouble decimate = 0.0);
+        void  SetupSharedVertices(const LibUtilities::CommSharedPtr &comm,
+                                  NekDouble decimate);
         void  SeparateRegions(std::vector<std::shared_ptr<Iso> > &iso, int minsize, bool verbose);
 
         void  Smooth(int n_iter, NekDouble lambda, NekDouble mu);
@@ -172,6 +177,9 @@ class Iso
         }
 
     private:
+        void AverageClusters(const std::vector<int> &count);
+        void RemoveDegenerateTris();
+
         bool                                 m_condensed;
         int                                  m_nvert;           // number of vertices
         int                                  m_ntris;           // number of triangles introduced.
@@ -180,6 +188,8 @@ class Iso
         std::vector<NekDouble>               m_z;
         std::vector<std::vector<NekDouble> > m_fields;
         Array<OneD, int>                     m_vid; // used when condensing field
+        // vertices shared with the isocontours of other partitions
+        std::shared_ptr<IsoSharedVertices>   m_shared;
 
 };
 
@@ -263,7 +273,8 @@ class ProcessIsoContour : public ProcessModule
 
         std::vector<IsoSharedPtr> ExtractContour(
             const int fieldid,
-            const NekDouble val);
+            const NekDouble val,
+            const NekDouble decimate);
 };
 
 }
@@ -78,6 +78,11 @@ public:
         return eModifyExp;
     }
 
+    virtual bool ModifiesInput()
+    {
+        return true;
+    }
+
     static GlobalMapping::MappingSharedPtr GetMapping(FieldSharedPtr f);
 
 };
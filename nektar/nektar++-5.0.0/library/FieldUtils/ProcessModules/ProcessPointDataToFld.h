@@ -78,6 +78,11 @@ public:
         return eFillExp;
     }
 
+    virtual bool ModifiesInput()
+    {
+        return true;
+    }
+
 private:
 };
 }
@@ -108,7 +108,7 @@ void ProcessQCriterion::Process(po::variables_map &vm)
     {
         for (i = 0; i < spacedim; ++i)
         {
-            m_f->m_exp[s * nfields + i]->PhysDeriv(
+            ThreadedPhysDeriv(m_f->m_exp[s * nfields + i],
                 m_f->m_exp[s * nfields + i]->GetPhys(), grad[i * spacedim],
                 grad[i * spacedim + 1], grad[i * spacedim + 2]);
         }
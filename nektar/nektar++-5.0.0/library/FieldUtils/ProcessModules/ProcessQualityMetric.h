@@ -74,6 +74,11 @@ public:
         return eModifyExp;
     }
 
+    virtual bool ModifiesInput()
+    {
+        return true;
+    }
+
 private:
     Array<OneD, NekDouble> GetQ(LocalRegions::ExpansionSharedPtr e, bool s);
 };
@@ -177,16 +177,16 @@ void ProcessWSS::Process(po::variables_map &vm)
             {
                 if (m_spacedim == 2)
                 {
-                    BndElmtExp[i]->PhysDeriv(velocity[i],
-                                             grad[i * m_spacedim + 0],
-                                             grad[i * m_spacedim + 1]);
+                    ThreadedPhysDeriv(BndElmtExp[i], velocity[i],
+                                      grad[i * m_spacedim + 0],
+                                      grad[i * m_spacedim + 1]);
                 }
                 else
                 {
-                    BndElmtExp[i]->PhysDeriv(velocity[i],
-                                             grad[i * m_spacedim + 0],
-                                             grad[i * m_spacedim + 1],
-                                             grad[i * m_spacedim + 2]);
+                    ThreadedPhysDeriv(BndElmtExp[i], velocity[i],
+                                      grad[i * m_spacedim + 0],
+                                      grad[i * m_spacedim + 1],
+                                      grad[i * m_spacedim + 2]);
                 }
                 // Add contribution to div(u)
                 Vmath::Vadd(nqe, grad[i * m_spacedim + i], 1, div, 1, div, 1);
@@ -34,6 +34,7 @@
 
 #include <LibUtilities/BasicUtils/Equation.h>
 #include <LibUtilities/Interpreter/Interpreter.h>
+#include <LibUtilities/Memory/NekMemoryManager.hpp>
 
 #include <boost/algorithm/string/trim.hpp>
 
@@ -204,6 +205,32 @@ void Equation::Evaluate(
     }
 }
 
+bool Equation::Separate(
+    const std::string& var,
+    EquationSharedPtr& varFactor,
+    EquationSharedPtr& restFactor) const
+{
+    int varId, restId;
+    if (m_expr_id == -1 ||
+        !m_evaluator->SeparateFunction(m_expr_id, var, varId, restId))
+    {
+        return false;
+    }
+
+    // The factors keep the expression and variables of this equation for
+    // the purpose of error messages.
+    varFactor.reset();
+    if (varId != -1)
+    {
+        varFactor = MemoryManager<Equation>::AllocateSharedPtr(*this);
+        varFactor->m_expr_id = varId;
+    }
+    restFactor = MemoryManager<Equation>::AllocateSharedPtr(*this);
+    restFactor->m_expr_id = restId;
+
+    return true;
+}
+
 void Equation::SetParameter(const std::string& name, NekDouble value)
 {
     m_evaluator->SetParameter(name, value);
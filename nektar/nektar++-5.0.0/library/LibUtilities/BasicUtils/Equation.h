@@ -49,6 +49,9 @@ namespace Nektar
 namespace LibUtilities
 {
 
+class Equation;
+typedef std::shared_ptr<Equation> EquationSharedPtr;
+
 /**
  * @class Equation
  *
@@ -109,6 +112,14 @@ public:
         const std::vector<Array<OneD, const NekDouble> > points,
         Array<OneD, NekDouble>& result) const;
 
+    /// Splits the expression into the product of a factor depending only on
+    /// @p var, null if the expression does not depend on it, and a factor
+    /// independent of @p var. Returns false if this is not possible.
+    LIB_UTILITIES_EXPORT bool Separate(
+        const std::string& var,
+        EquationSharedPtr& varFactor,
+        EquationSharedPtr& restFactor) const;
+
     LIB_UTILITIES_EXPORT void SetParameter(const std::string& name, NekDouble value);
 
     LIB_UTILITIES_EXPORT void SetConstants(const std::map<std::string, NekDouble> &constants);
@@ -128,8 +139,6 @@ private:
     InterpreterSharedPtr m_evaluator;
 };
 
-typedef std::shared_ptr<Equation> EquationSharedPtr;
-
 }
 }
 
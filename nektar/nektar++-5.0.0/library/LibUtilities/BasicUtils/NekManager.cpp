@@ -0,0 +1,214 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: NekManager.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Scientific Computing and Imaging Institute,
+// University of Utah (USA) and Department of Aeronautics, Imperial
+// College London (UK).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Memory accounting of NekManager pools.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <iomanip>
+
+#include <LibUtilities/BasicUtils/NekManager.hpp>
+
+namespace Nektar
+{
+namespace LibUtilities
+{
+
+/// Pools registered for reporting and budget enforcement.
+static std::vector<std::weak_ptr<NekManagerPoolUsage> > &GetPools()
+{
+    static std::vector<std::weak_ptr<NekManagerPoolUsage> > pools;
+    return pools;
+}
+
+/// Memory budgets of the pools in bytes, set before or after their creation.
+static std::map<std::string, size_t> &GetBudgets()
+{
+    static std::map<std::string, size_t> budgets;
+    return budgets;
+}
+
+NekManagerPoolUsage::NekManagerPoolUsage(const std::string &name)
+    : m_name(name), m_bytes(0), m_budget(GetNekManagerBudget(name))
+{
+}
+
+NekManagerPoolUsage::~NekManagerPoolUsage()
+{
+}
+
+void RegisterNekManagerPool(const NekManagerPoolUsageSharedPtr &pool)
+{
+    GetPools().push_back(pool);
+}
+
+/**
+ * The budget applies to the pool of this name as soon as it exists. It is
+ * only enforced by #EnforceNekManagerBudgets, which must be called at points
+ * where no reference to a managed object is held outside of a shared
+ * pointer, since evicting an object releases the reference of the pool.
+ *
+ * @param   whichPool   Name of the pool.
+ * @param   bytes       Budget in bytes, or zero for an unlimited pool.
+ */
+void SetNekManagerBudget(const std::string &whichPool, const size_t bytes)
+{
+    GetBudgets()[whichPool] = bytes;
+
+    for (auto &x : GetPools())
+    {
+        NekManagerPoolUsageSharedPtr pool = x.lock();
+        if (pool && pool->GetName() == whichPool)
+        {
+            pool->SetBudget(bytes);
+        }
+    }
+}
+
+size_t GetNekManagerBudget(const std::string &whichPool)
+{
+    auto x = GetBudgets().find(whichPool);
+    return x == GetBudgets().end() ? 0 : x->second;
+}
+
+size_t GetNekManagerBytes(const std::string &whichPool)
+{
+    for (auto &x : GetPools())
+    {
+        NekManagerPoolUsageSharedPtr pool = x.lock();
+        if (pool && pool->GetName() == whichPool)
+        {
+            return pool->GetBytes();
+        }
+    }
+    return 0;
+}
+
+void EnforceNekManagerBudgets()
+{
+    auto &pools = GetPools();
+    for (auto x = pools.begin(); x != pools.end();)
+    {
+        NekManagerPoolUsageSharedPtr pool = x->lock();
+        if (!pool)
+        {
+            x = pools.erase(x);
+            continue;
+        }
+
+        if (pool->GetBudget() > 0 && pool->GetBytes() > pool->GetBudget())
+        {
+            pool->EnforceBudget();
+        }
+        ++x;
+    }
+}
+
+/**
+ * Objects shared between pools, such as the standard matrices referenced by
+ * the scaled matrices of regular elements, are accounted in every pool
+ * holding them.
+ *
+ * @param   out         Output stream.
+ * @param   nLargest    Number of largest objects to list.
+ */
+void PrintNekManagerUsage(std::ostream &out, const unsigned int nLargest)
+{
+    const double mb = 1024.0 * 1024.0;
+
+    std::vector<std::pair<size_t, std::string> > largest;
+    size_t total = 0;
+
+    out << "Managed memory by pool:" << std::endl;
+    out << "  " << std::left << std::setw(32) << "Pool"
+        << std::right << std::setw(10) << "Objects"
+        << std::setw(12) << "MB"
+        << std::setw(12) << "Budget MB" << std::endl;
+
+    for (auto &x : GetPools())
+    {
+        NekManagerPoolUsageSharedPtr pool = x.lock();
+        if (!pool || pool->GetNumObjects() == 0)
+        {
+            continue;
+        }
+
+        out << "  " << std::left << std::setw(32) << pool->GetName()
+            << std::right << std::setw(10) << pool->GetNumObjects()
+            << std::setw(12) << std::fixed << std::setprecision(2)
+            << pool->GetBytes() / mb << std::setw(12);
+        if (pool->GetBudget() > 0)
+        {
+            out << pool->GetBudget() / mb;
+        }
+        else
+        {
+            out << "-";
+        }
+        out << std::endl;
+
+        total += pool->GetBytes();
+
+        std::vector<std::pair<size_t, std::string> > sizes;
+        pool->GetObjectSizes(sizes);
+        for (auto &s : sizes)
+        {
+            largest.push_back(
+                std::make_pair(s.first, pool->GetName() + ": " + s.second));
+        }
+    }
+
+    out << "  " << std::left << std::setw(32) << "Total" << std::right
+        << std::setw(22) << total / mb << std::endl;
+
+    size_t nShow = std::min<size_t>(nLargest, largest.size());
+    std::partial_sort(largest.begin(), largest.begin() + nShow, largest.end(),
+        [](const std::pair<size_t, std::string> &a,
+           const std::pair<size_t, std::string> &b)
+        {
+            return a.first > b.first;
+        });
+
+    if (nShow > 0)
+    {
+        out << "Largest managed objects (MB):" << std::endl;
+    }
+    for (size_t i = 0; i < nShow; ++i)
+    {
+        out << "  " << std::setw(10) << largest[i].first / mb << "  "
+            << largest[i].second << std::endl;
+    }
+
+    out.unsetf(std::ios_base::floatfield);
+    out << std::setprecision(6);
+}
+
+}
+}
@@ -35,10 +35,16 @@
 #ifndef NEKTAR_LIB_UTILITIES_BASIC_UTILS_NEK_MANAGER_HPP
 #define NEKTAR_LIB_UTILITIES_BASIC_UTILS_NEK_MANAGER_HPP
 
+#include <algorithm>
+#include <list>
 #include <map>
+#include <ostream>
 #include <sstream>
 #include <memory>
 #include <functional>
+#include <vector>
+
+#include <boost/core/ignore_unused.hpp>
 
 #ifdef NEKTAR_USE_THREAD_SAFETY
 #include <boost/thread/shared_mutex.hpp>
@@ -46,6 +52,7 @@
 #endif
 
 #include <LibUtilities/BasicUtils/ErrorUtil.hpp>
+#include <LibUtilities/LibUtilitiesDeclspec.h>
 
 namespace Nektar
 {
@@ -56,6 +63,123 @@ namespace Nektar
         typedef boost::shared_lock<boost::shared_mutex> ReadLock;
 #endif
 
+        /**
+         * @brief Estimate of the memory in bytes held by an object stored in
+         * a NekManager.
+         *
+         * The default only accounts for the object itself. Overloads for
+         * types owning further storage are declared alongside these types and
+         * are found by argument-dependent lookup.
+         */
+        template <typename ValueT>
+        size_t GetMemoryFootprint(const ValueT &obj)
+        {
+            boost::ignore_unused(obj);
+            return sizeof(ValueT);
+        }
+
+        /**
+         * @brief Release storage held on behalf of an object which is evicted
+         * from a NekManager pool to meet its budget.
+         *
+         * The default does nothing. Overloads are found by argument-dependent
+         * lookup in the same way as for GetMemoryFootprint.
+         */
+        template <typename ValueT>
+        void ReleaseEvictedObject(ValueT &obj)
+        {
+            boost::ignore_unused(obj);
+        }
+
+        /**
+         * @brief Memory accounting of a named pool of NekManager objects.
+         *
+         * Each pool registers itself on creation so that its memory use can
+         * be reported, and its budget enforced, independently of the key and
+         * value types of the managers sharing it.
+         */
+        class NekManagerPoolUsage
+        {
+        public:
+            LIB_UTILITIES_EXPORT NekManagerPoolUsage(const std::string &name);
+            LIB_UTILITIES_EXPORT virtual ~NekManagerPoolUsage();
+
+            /// Name of the pool.
+            const std::string &GetName() const
+            {
+                return m_name;
+            }
+
+            /// Bytes held by the objects of the pool.
+            size_t GetBytes() const
+            {
+                return m_bytes;
+            }
+
+            /// Memory budget of the pool in bytes, or zero if unlimited.
+            size_t GetBudget() const
+            {
+                return m_budget;
+            }
+
+            void SetBudget(const size_t budget)
+            {
+                m_budget = budget;
+            }
+
+            /// Number of objects held by the pool.
+            size_t GetNumObjects() const
+            {
+                return v_GetNumObjects();
+            }
+
+            /// Append the size and a description of each object to @p sizes.
+            void GetObjectSizes(
+                std::vector<std::pair<size_t, std::string> > &sizes) const
+            {
+                v_GetObjectSizes(sizes);
+            }
+
+            /// Remove the least recently used objects until the budget is
+            /// met.
+            void EnforceBudget()
+            {
+                v_EnforceBudget();
+            }
+
+        protected:
+            std::string m_name;
+            size_t      m_bytes;
+            size_t      m_budget;
+
+            virtual size_t v_GetNumObjects() const = 0;
+            virtual void   v_GetObjectSizes(
+                std::vector<std::pair<size_t, std::string> > &sizes) const = 0;
+            virtual void   v_EnforceBudget() = 0;
+        };
+
+        typedef std::shared_ptr<NekManagerPoolUsage>
+            NekManagerPoolUsageSharedPtr;
+
+        /// Register a pool for reporting and budget enforcement.
+        LIB_UTILITIES_EXPORT void RegisterNekManagerPool(
+            const NekManagerPoolUsageSharedPtr &pool);
+        /// Set the memory budget in bytes of the pool @p whichPool.
+        LIB_UTILITIES_EXPORT void SetNekManagerBudget(
+            const std::string &whichPool, const size_t bytes);
+        /// Memory budget in bytes of the pool @p whichPool.
+        LIB_UTILITIES_EXPORT size_t GetNekManagerBudget(
+            const std::string &whichPool);
+        /// Bytes held by the objects of the pool @p whichPool.
+        LIB_UTILITIES_EXPORT size_t GetNekManagerBytes(
+            const std::string &whichPool);
+        /// Evict least recently used objects from pools exceeding their
+        /// budget.
+        LIB_UTILITIES_EXPORT void EnforceNekManagerBudgets();
+        /// Print the memory use of each pool and the largest objects held.
+        LIB_UTILITIES_EXPORT void PrintNekManagerUsage(
+            std::ostream &out, const unsigned int nLargest = 10);
+
         template <typename KeyType>
         struct defOpLessCreator
         {
@@ -86,6 +210,9 @@ namespace Nektar
                 {
                     if (!whichPool.empty())
                     {
+#ifdef NEKTAR_USE_THREAD_SAFETY
+                        WriteLock v_wlock(m_mutex);
+#endif
                         auto iter = m_ValueContainerPool.find(whichPool);
                         if (iter != m_ValueContainerPool.end())
                         {
@@ -102,6 +229,7 @@ namespace Nektar
                             }
                             m_managementEnabled = m_managementEnabledContainerPool[whichPool];
                         }
+                        SetUpUsage(whichPool);
                     }
                     else
                     {
@@ -126,6 +254,11 @@ namespace Nektar
                         {
                             m_values = iter->second;
                             m_managementEnabled = m_managementEnabledContainerPool[whichPool];
+                            auto u = m_usageContainerPool.find(whichPool);
+                            if (u != m_usageContainerPool.end())
+                            {
+                                m_usage = u->second;
+                            }
                         }
                         else
                         {
@@ -140,15 +273,25 @@ namespace Nektar
                             // be rare.
                             WriteLock v_wlock(m_mutex);
 #endif
-                            m_values = ValueContainerShPtr(new ValueContainer);
-                            m_ValueContainerPool[whichPool] = m_values;
+                            // Another thread may have created the pool while
+                            // no lock was held.
+                            iter = m_ValueContainerPool.find(whichPool);
+                            if (iter != m_ValueContainerPool.end())
+                            {
+                                m_values = iter->second;
+                            }
+                            else
+                            {
+                                m_values = ValueContainerShPtr(new ValueContainer);
+                                m_ValueContainerPool[whichPool] = m_values;
+                            }
                             if (m_managementEnabledContainerPool.find(whichPool) == m_managementEnabledContainerPool.end())
                             {
                                 m_managementEnabledContainerPool[whichPool] = BoolSharedPtr(new bool(true));
                             }
                             m_managementEnabled = m_managementEnabledContainerPool[whichPool];
+                            SetUpUsage(whichPool);
                         }
-
                     }
                     else
                     {
@@ -182,6 +325,9 @@ namespace Nektar
 
                 bool AlreadyCreated(const KeyType &key)
                 {
+#ifdef NEKTAR_USE_THREAD_SAFETY
+                    ReadLock v_rlock(m_mutex);
+#endif
                     bool value = false;
                     auto found = m_values->find(key);
                     if( found != m_values->end() )
@@ -194,51 +340,89 @@ namespace Nektar
 
                 ValueType operator[](const KeyType &key)
                 {
-                    auto found = m_values->find(key);
-
-                    if( found != m_values->end() )
                     {
-                        return (*found).second;
-                    }
-                    else
-                    {
-                        // No object, create a new one.
-                        CreateFuncType f = m_globalCreateFunc;
-                        auto keyFound = m_keySpecificCreateFuncs.find(key);
-                        if( keyFound != m_keySpecificCreateFuncs.end() )
-                        {
-                            f = (*keyFound).second;
-                        }
+#ifdef NEKTAR_USE_THREAD_SAFETY
+                        ReadLock v_rlock(m_mutex);
+#endif
+                        auto found = m_values->find(key);
 
-                        if( f )
+                        if( found != m_values->end() )
                         {
-                            ValueType v = f(key);
-                            if (*m_managementEnabled)
+                            ValueType v = (*found).second;
+                            if (m_usage && m_usage->GetBudget() > 0)
                             {
-                                (*m_values)[key] = v;
+#ifdef NEKTAR_USE_THREAD_SAFETY
+                                // The read lock is dropped for the write
+                                // lock, as in the constructor.
+                                v_rlock.unlock();
+                                WriteLock v_wlock(m_mutex);
+#endif
+                                m_usage->Touch(key);
                             }
                             return v;
                         }
-                        else
+                    }
+
+                    // No object, create a new one.
+                    CreateFuncType f = m_globalCreateFunc;
+                    auto keyFound = m_keySpecificCreateFuncs.find(key);
+                    if( keyFound != m_keySpecificCreateFuncs.end() )
+                    {
+                        f = (*keyFound).second;
+                    }
+
+                    if( f )
+                    {
+                        // The object is created without holding the
+                        // lock, since its creation may itself use this
+                        // manager.
+                        ValueType v = f(key);
+                        if (*m_managementEnabled)
                         {
-                            std::stringstream ss;
-                            ss << key;
-                            std::string message = "No create func found for key " + ss.str();
-                            NEKERROR(ErrorUtil::efatal, message.c_str());
-                            static ValueType result;
-                            return result;
+                            size_t bytes = m_usage && v ?
+                                GetMemoryFootprint(*v) : 0;
+#ifdef NEKTAR_USE_THREAD_SAFETY
+                            WriteLock v_wlock(m_mutex);
+#endif
+                            (*m_values)[key] = v;
+                            if (m_usage)
+                            {
+                                m_usage->Insert(key, bytes);
+                            }
                         }
+                        return v;
+                    }
+                    else
+                    {
+                        std::stringstream ss;
+                        ss << key;
+                        std::string message = "No create func found for key " + ss.str();
+                        NEKERROR(ErrorUtil::efatal, message.c_str());
+                        static ValueType result;
+                        return result;
                     }
                 }
 
                 void DeleteObject(const KeyType &key)
                 {
+                    // Keep the object until the lock is released, in case
+                    // its destructor uses this manager.
+                    ValueType v;
+#ifdef NEKTAR_USE_THREAD_SAFETY
+                    WriteLock v_wlock(m_mutex);
+#endif
                     auto found = m_values->find(key);
 
                     if( found != m_values->end() )
                     {
+                        v = found->second;
                         m_values->erase(found);
                     }
+
+                    if (m_usage)
+                    {
+                        m_usage->Erase(key);
+                    }
                 }
 
                 static void ClearManager(std::string whichPool = "")
@@ -252,6 +436,12 @@ namespace Nektar
                         ASSERTL1(x != m_ValueContainerPool.end(),
                                 "Could not find pool " + whichPool);
                         x->second->clear();
+
+                        auto u = m_usageContainerPool.find(whichPool);
+                        if (u != m_usageContainerPool.end())
+                        {
+                            u->second->Clear();
+                        }
                     }
                     else
                     {
@@ -263,11 +453,19 @@ namespace Nektar
                         {
                             x.second->clear();
                         }
+
+                        for (auto &x : m_usageContainerPool)
+                        {
+                            x.second->Clear();
+                        }
                     }
                 }
 
                 static bool PoolCreated(std::string whichPool)
                 {
+#ifdef NEKTAR_USE_THREAD_SAFETY
+                    ReadLock v_rlock(m_mutex);
+#endif
                     bool value = false;
                     auto x = m_ValueContainerPool.find(whichPool);
                     if (x != m_ValueContainerPool.end())
@@ -317,6 +515,143 @@ namespace Nektar
                 }
 
             private:
+                /// Memory accounting of the objects of a pool, kept in least
+                /// recently used order.
+                class PoolUsage : public NekManagerPoolUsage
+                {
+                public:
+                    PoolUsage(const std::string         &name,
+                              const ValueContainerShPtr &values)
+                        : NekManagerPoolUsage(name),
+                          m_values(values)
+                    {
+                    }
+
+                    /// Account for a new object.
+                    void Insert(const KeyType &key, const size_t bytes)
+                    {
+                        Erase(key);
+                        m_order.push_front(key);
+                        m_entries[key] = std::make_pair(bytes,
+                                                        m_order.begin());
+                        m_bytes += bytes;
+                    }
+
+                    /// Mark an object as most recently used.
+                    void Touch(const KeyType &key)
+                    {
+                        auto x = m_entries.find(key);
+                        if (x != m_entries.end())
+                        {
+                            m_order.splice(m_order.begin(), m_order,
+                                           x->second.second);
+                        }
+                    }
+
+                    /// Remove an object from the accounting.
+                    void Erase(const KeyType &key)
+                    {
+                        auto x = m_entries.find(key);
+                        if (x != m_entries.end())
+                        {
+                            m_bytes -= x->second.first;
+                            m_order.erase(x->second.second);
+                            m_entries.erase(x);
+                        }
+                    }
+
+                    void Clear()
+                    {
+                        m_order.clear();
+                        m_entries.clear();
+                        m_bytes = 0;
+                    }
+
+                protected:
+                    typedef std::list<KeyType> OrderType;
+                    typedef std::map<KeyType,
+                        std::pair<size_t, typename OrderType::iterator> >
+                        EntryType;
+
+                    /// Objects of the pool.
+                    ValueContainerShPtr m_values;
+                    /// Keys of the objects, most recently used first.
+                    OrderType           m_order;
+                    /// Size and position in #m_order of each object.
+                    EntryType           m_entries;
+
+                    virtual size_t v_GetNumObjects() const
+                    {
+#ifdef NEKTAR_USE_THREAD_SAFETY
+                        ReadLock v_rlock(m_mutex);
+#endif
+                        return m_entries.size();
+                    }
+
+                    virtual void v_GetObjectSizes(
+                        std::vector<std::pair<size_t, std::string> > &sizes)
+                        const
+                    {
+#ifdef NEKTAR_USE_THREAD_SAFETY
+                        ReadLock v_rlock(m_mutex);
+#endif
+                        for (auto &x : m_entries)
+                        {
+                            std::stringstream ss;
+                            ss << x.first;
+                            std::string desc = ss.str();
+                            std::replace(desc.begin(), desc.end(), '\n', ' ');
+                            sizes.push_back(
+                                std::make_pair(x.second.first, desc));
+                        }
+                    }
+
+                    virtual void v_EnforceBudget()
+                    {
+                        // Evicted objects are destroyed once the lock is
+                        // released.
+                        std::vector<ValueType> evicted;
+#ifdef NEKTAR_USE_THREAD_SAFETY
+                        WriteLock v_wlock(m_mutex);
+#endif
+                        while (m_budget > 0 && m_bytes > m_budget &&
+                               !m_order.empty())
+                        {
+                            KeyType key = m_order.back();
+                            auto x = m_values->find(key);
+                            if (x != m_values->end())
+                            {
+                                if (x->second)
+                                {
+                                    ReleaseEvictedObject(*x->second);
+                                }
+                                evicted.push_back(x->second);
+                                m_values->erase(x);
+                            }
+                            Erase(key);
+                        }
+                    }
+                };
+
+                typedef std::map<std::string, std::shared_ptr<PoolUsage> >
+                    UsageContainerPool;
+
+                /// Share the accounting of the pool @p whichPool, creating
+                /// and registering it if necessary.
+                void SetUpUsage(const std::string &whichPool)
+                {
+                    auto x = m_usageContainerPool.find(whichPool);
+                    if (x != m_usageContainerPool.end())
+                    {
+                        m_usage = x->second;
+                        return;
+                    }
+
+                    m_usage = std::make_shared<PoolUsage>(whichPool, m_values);
+                    m_usageContainerPool[whichPool] = m_usage;
+                    RegisterNekManagerPool(m_usage);
+                }
+
                 NekManager<KeyType, ValueType, opLessCreator>& operator=(const NekManager<KeyType, ValueType, opLessCreator>& rhs);
                 NekManager(const NekManager<KeyType, ValueType, opLessCreator>& rhs);
 
@@ -324,6 +659,9 @@ namespace Nektar
                 BoolSharedPtr m_managementEnabled;
                 static ValueContainerPool m_ValueContainerPool;
                 static FlagContainerPool m_managementEnabledContainerPool;
+                /// Memory accounting of the pool, if any.
+                std::shared_ptr<PoolUsage> m_usage;
+                static UsageContainerPool m_usageContainerPool;
                 CreateFuncType m_globalCreateFunc;
                 CreateFuncContainer m_keySpecificCreateFuncs;
 #ifdef NEKTAR_USE_THREAD_SAFETY
@@ -332,6 +670,9 @@ namespace Nektar
         };
         template <typename KeyType, typename ValueT, typename opLessCreator> typename NekManager<KeyType, ValueT, opLessCreator>::ValueContainerPool NekManager<KeyType, ValueT, opLessCreator>::m_ValueContainerPool;
         template <typename KeyType, typename ValueT, typename opLessCreator> typename NekManager<KeyType, ValueT, opLessCreator>::FlagContainerPool NekManager<KeyType, ValueT, opLessCreator>::m_managementEnabledContainerPool;
+        template <typename KeyType, typename ValueT, typename opLessCreator>
+            typename NekManager<KeyType, ValueT, opLessCreator>::UsageContainerPool
+            NekManager<KeyType, ValueT, opLessCreator>::m_usageContainerPool;
 #ifdef NEKTAR_USE_THREAD_SAFETY
         template <typename KeyType, typename ValueT, typename opLessCreator>
             typename boost::shared_mutex NekManager<KeyType, ValueT, opLessCreator>::m_mutex;
@@ -54,6 +54,7 @@
 #include <LibUtilities/BasicUtils/Equation.h>
 #include <LibUtilities/Memory/NekMemoryManager.hpp>
 #include <LibUtilities/BasicUtils/ParseUtils.h>
+#include <LibUtilities/BasicUtils/NekManager.hpp>
 #include <LibUtilities/BasicUtils/FileSystem.h>
 #include <LibUtilities/Interpreter/Interpreter.h>
 
@@ -399,6 +400,9 @@ namespace Nektar
                 ("part-only-overlapping",    po::value<int>(),
                                  "only partition mesh into N overlapping partitions.")
                 ("part-info",    "Output partition information")
+                ("cache-budget", po::value<vector<std::string> >(),
+                                 "limit the memory of a matrix pool (pool=MB)")
+                ("cache-report", "report the memory of matrix pools at exit")
 #ifdef NEKTAR_USE_CWIPI
                 ("cwipi",        po::value<std::string>(),
                                  "set CWIPI name")
@@ -500,6 +504,22 @@ namespace Nektar
                 m_verbose = false;
             }
 
+            // Set memory budgets of NekManager pools
+            if (m_cmdLineOptions.count("cache-budget"))
+            {
+                for (auto &budget : m_cmdLineOptions["cache-budget"].as<
+                         std::vector<std::string> >())
+                {
+                    std::vector<std::string> tmp;
+                    boost::split(tmp, budget, boost::is_any_of("="));
+                    ASSERTL0(tmp.size() == 2,
+                             "Cache budgets must be given as pool=MB");
+
+                    SetNekManagerBudget(tmp[0], static_cast<size_t>(
+                        std::stod(tmp[1]) * 1024.0 * 1024.0));
+                }
+            }
+
             // Print a warning for unknown options
             for (auto &x : parsed.options)
             {
@@ -691,6 +711,12 @@ namespace Nektar
          */
         void SessionReader::Finalise()
         {
+            if (m_cmdLineOptions.count("cache-report") &&
+                m_comm->TreatAsRankZero())
+            {
+                PrintNekManagerUsage(cout);
+            }
+
             m_comm->Finalise();
         }
 
@@ -1648,11 +1674,24 @@ namespace Nektar
                 int nProcSem = m_comm->GetSize() / nProcSm;
 
                 m_comm->SplitComm(nProcSm,nProcSem);
-                m_comm->GetColumnComm()->SplitComm(nProcZ/nStripZ,nStripZ);
-                m_comm->GetColumnComm()->GetColumnComm()->SplitComm(
+
+                if (nProcY > 1 && nProcX == 1)
+                {
+                    // Pencil decomposition of two homogeneous directions:
+                    // rows of the homogeneous communicator span the y
+                    // direction and columns span the z direction.
+                    ASSERTL0(nStripZ == 1,
+                             "Strips are not supported with PROC_Y.");
+                    m_comm->GetColumnComm()->SplitComm(nProcZ,nProcY);
+                }
+                else
+                {
+                    m_comm->GetColumnComm()->SplitComm(nProcZ/nStripZ,nStripZ);
+                    m_comm->GetColumnComm()->GetColumnComm()->SplitComm(
                                             (nProcY*nProcX),nProcZ/nStripZ);
-                m_comm->GetColumnComm()->GetColumnComm()->GetColumnComm()
+                    m_comm->GetColumnComm()->GetColumnComm()->GetColumnComm()
                                             ->SplitComm(nProcX,nProcY);
+                }
             }
         }
 
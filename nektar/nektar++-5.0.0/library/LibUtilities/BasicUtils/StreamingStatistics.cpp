@@ -0,0 +1,494 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: StreamingStatistics.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: one-pass statistics of a stream of samples of several
+// variables at a set of points.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <LibUtilities/BasicUtils/StreamingStatistics.h>
+#include <LibUtilities/BasicUtils/ErrorUtil.hpp>
+#include <LibUtilities/BasicUtils/VmathArray.hpp>
+
+namespace Nektar
+{
+namespace LibUtilities
+{
+
+/**
+ * @param nPoints Number of points of each sample.
+ * @param nVars   Number of variables of each sample.
+ * @param order   Highest order of the central moments, from 1 (mean only)
+ *                to 4.
+ * @param pairs   Pairs of variables whose covariance is computed.
+ * @param alpha   Weight of a new sample in an exponentially weighted
+ *                average, or 0 for the statistics of all the samples.
+ */
+StreamingStatistics::StreamingStatistics(
+    const int                                 nPoints,
+    const int                                 nVars,
+    const int                                 order,
+    const std::vector<std::pair<int, int> > &pairs,
+    const NekDouble                           alpha)
+    : m_nPoints(nPoints), m_nVars(nVars), m_order(order), m_pairs(pairs),
+      m_alpha(alpha), m_count(0.0)
+{
+    ASSERTL0(m_order >= 1 && m_order <= 4,
+             "Statistics are only available up to the fourth order.");
+    ASSERTL0(m_alpha >= 0.0 && m_alpha < 1.0,
+             "The weight of the exponential average must be in [0,1).");
+    ASSERTL0(m_alpha == 0.0 || m_order <= 2,
+             "Exponential averages are only available up to the second "
+             "order.");
+    for (auto &p : m_pairs)
+    {
+        ASSERTL0(p.first >= 0 && p.first < m_nVars &&
+                 p.second >= 0 && p.second < m_nVars,
+                 "Invalid variable in a pair of variables.");
+    }
+
+    m_mean = Array<OneD, Array<OneD, NekDouble> >(m_nVars);
+    for (int v = 0; v < m_nVars; ++v)
+    {
+        m_mean[v] = Array<OneD, NekDouble>(m_nPoints, 0.0);
+    }
+
+    int nMoments = m_order > 1 ? (m_order - 1) * m_nVars : 0;
+    m_moments = Array<OneD, Array<OneD, NekDouble> >(nMoments);
+    for (int i = 0; i < nMoments; ++i)
+    {
+        m_moments[i] = Array<OneD, NekDouble>(m_nPoints, 0.0);
+    }
+
+    m_comoments = Array<OneD, Array<OneD, NekDouble> >(m_pairs.size());
+    for (int i = 0; i < m_pairs.size(); ++i)
+    {
+        m_comoments[i] = Array<OneD, NekDouble>(m_nPoints, 0.0);
+    }
+}
+
+/**
+ * @brief Add a sample, given by the values of each variable at the points.
+ *
+ * For the n-th sample, with @f$ \delta = x - \bar{x}_{n-1} @f$, the sums
+ * @f$ M_k @f$ of the k-th powers of the deviations are updated as
+ * \f[ M_2 \mathrel{+}= \frac{n-1}{n} \delta^2, \quad
+ *     M_3 \mathrel{+}= \frac{(n-1)(n-2)}{n^2} \delta^3
+ *         - \frac{3}{n} \delta M_2, \f]
+ * \f[ M_4 \mathrel{+}= \frac{(n-1)(n^2-3n+3)}{n^3} \delta^4
+ *         + \frac{6}{n^2} \delta^2 M_2 - \frac{4}{n} \delta M_3, \f]
+ * using the previous values of the sums, and the mean is then incremented
+ * by @f$ \delta / n @f$.
+ */
+void StreamingStatistics::Update(
+    const Array<OneD, const Array<OneD, NekDouble> > &sample)
+{
+    ASSERTL1(sample.num_elements() >= m_nVars,
+             "Sample does not have enough variables.");
+
+    // The first sample of an exponential average is its initial value.
+    const NekDouble n1    = m_count;
+    const NekDouble n     = m_count + 1.0;
+    const NekDouble alpha = m_count > 0.0 ? m_alpha : 1.0;
+    m_count = n;
+
+    // Covariances, using the means of the previous samples.
+    for (int p = 0; p < m_pairs.size(); ++p)
+    {
+        const NekDouble *x  = sample[m_pairs[p].first].get();
+        const NekDouble *y  = sample[m_pairs[p].second].get();
+        const NekDouble *mx = m_mean[m_pairs[p].first].get();
+        const NekDouble *my = m_mean[m_pairs[p].second].get();
+        NekDouble       *c  = m_comoments[p].get();
+
+        if (m_alpha > 0.0)
+        {
+            for (int i = 0; i < m_nPoints; ++i)
+            {
+                c[i] = (1.0 - alpha) *
+                    (c[i] + alpha * (x[i] - mx[i]) * (y[i] - my[i]));
+            }
+        }
+        else
+        {
+            const NekDouble fac = n1 / n;
+            for (int i = 0; i < m_nPoints; ++i)
+            {
+                c[i] += fac * (x[i] - mx[i]) * (y[i] - my[i]);
+            }
+        }
+    }
+
+    for (int v = 0; v < m_nVars; ++v)
+    {
+        const NekDouble *x = sample[v].get();
+        NekDouble       *m = m_mean[v].get();
+
+        if (m_alpha > 0.0)
+        {
+            if (m_order == 1)
+            {
+                for (int i = 0; i < m_nPoints; ++i)
+                {
+                    m[i] += alpha * (x[i] - m[i]);
+                }
+                continue;
+            }
+
+            NekDouble *m2 = Moment(2, v).get();
+            for (int i = 0; i < m_nPoints; ++i)
+            {
+                NekDouble d = x[i] - m[i];
+                m2[i] = (1.0 - alpha) * (m2[i] + alpha * d * d);
+                m[i] += alpha * d;
+            }
+            continue;
+        }
+
+        // The moments of a point are all updated in the same loop, one loop
+        // per order so that the loops vectorise.
+        const NekDouble rn = 1.0 / n;
+        switch (m_order)
+        {
+            case 1:
+            {
+                for (int i = 0; i < m_nPoints; ++i)
+                {
+                    m[i] += (x[i] - m[i]) * rn;
+                }
+                break;
+            }
+            case 2:
+            {
+                NekDouble *m2 = Moment(2, v).get();
+                for (int i = 0; i < m_nPoints; ++i)
+                {
+                    NekDouble d  = x[i] - m[i];
+                    NekDouble dn = d * rn;
+                    m2[i] += d * dn * n1;
+                    m[i]  += dn;
+                }
+                break;
+            }
+            case 3:
+            {
+                NekDouble *m2 = Moment(2, v).get();
+                NekDouble *m3 = Moment(3, v).get();
+                for (int i = 0; i < m_nPoints; ++i)
+                {
+                    NekDouble d  = x[i] - m[i];
+                    NekDouble dn = d * rn;
+                    NekDouble t1 = d * dn * n1;
+                    m3[i] += t1 * dn * (n - 2.0) - 3.0 * dn * m2[i];
+                    m2[i] += t1;
+                    m[i]  += dn;
+                }
+                break;
+            }
+            case 4:
+            {
+                NekDouble *m2 = Moment(2, v).get();
+                NekDouble *m3 = Moment(3, v).get();
+                NekDouble *m4 = Moment(4, v).get();
+                const NekDouble c4 = n * n - 3.0 * n + 3.0;
+                for (int i = 0; i < m_nPoints; ++i)
+                {
+                    NekDouble d   = x[i] - m[i];
+                    NekDouble dn  = d * rn;
+                    NekDouble dn2 = dn * dn;
+                    NekDouble t1  = d * dn * n1;
+                    m4[i] += t1 * dn2 * c4 + 6.0 * dn2 * m2[i]
+                        - 4.0 * dn * m3[i];
+                    m3[i] += t1 * dn * (n - 2.0) - 3.0 * dn * m2[i];
+                    m2[i] += t1;
+                    m[i]  += dn;
+                }
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Add the samples of @p other, which holds the statistics of a
+ * disjoint set of samples of the same points.
+ *
+ * With @f$ \delta = \bar{x}_B - \bar{x}_A @f$, the sums of the union of the
+ * sets A and B are given by
+ * \f[ M_2 = M_{2,A} + M_{2,B} + \delta^2 \frac{n_A n_B}{n}, \f]
+ * \f[ M_3 = M_{3,A} + M_{3,B} + \delta^3 \frac{n_A n_B (n_A - n_B)}{n^2}
+ *     + 3 \delta \frac{n_A M_{2,B} - n_B M_{2,A}}{n}, \f]
+ * \f[ M_4 = M_{4,A} + M_{4,B}
+ *     + \delta^4 \frac{n_A n_B (n_A^2 - n_A n_B + n_B^2)}{n^3}
+ *     + 6 \delta^2 \frac{n_A^2 M_{2,B} + n_B^2 M_{2,A}}{n^2}
+ *     + 4 \delta \frac{n_A M_{3,B} - n_B M_{3,A}}{n}. \f]
+ */
+void StreamingStatistics::Merge(const StreamingStatistics &other)
+{
+    ASSERTL0(m_alpha == 0.0 && other.m_alpha == 0.0,
+             "Exponential averages cannot be merged.");
+    ASSERTL0(m_nPoints == other.m_nPoints && m_nVars == other.m_nVars &&
+             m_order == other.m_order && m_pairs == other.m_pairs,
+             "Statistics to merge do not have the same layout.");
+
+    const NekDouble na = m_count;
+    const NekDouble nb = other.m_count;
+    const NekDouble n  = na + nb;
+    if (nb == 0.0)
+    {
+        return;
+    }
+
+    const NekDouble fab = na * nb / n;
+    for (int p = 0; p < m_pairs.size(); ++p)
+    {
+        const NekDouble *mxa = m_mean[m_pairs[p].first].get();
+        const NekDouble *mya = m_mean[m_pairs[p].second].get();
+        const NekDouble *mxb = other.m_mean[m_pairs[p].first].get();
+        const NekDouble *myb = other.m_mean[m_pairs[p].second].get();
+        const NekDouble *cb  = other.m_comoments[p].get();
+        NekDouble       *c   = m_comoments[p].get();
+        for (int i = 0; i < m_nPoints; ++i)
+        {
+            c[i] += cb[i] + (mxb[i] - mxa[i]) * (myb[i] - mya[i]) * fab;
+        }
+    }
+
+    for (int v = 0; v < m_nVars; ++v)
+    {
+        const NekDouble *mb = other.m_mean[v].get();
+        NekDouble       *m  = m_mean[v].get();
+
+        for (int i = 0; i < m_nPoints; ++i)
+        {
+            NekDouble d = mb[i] - m[i];
+
+            if (m_order >= 4)
+            {
+                NekDouble m2a = Moment(2, v)[i], m2b = other.Moment(2, v)[i];
+                NekDouble m3a = Moment(3, v)[i], m3b = other.Moment(3, v)[i];
+                Moment(4, v)[i] += other.Moment(4, v)[i]
+                    + d * d * d * d * fab * (na * na - na * nb + nb * nb)
+                        / (n * n)
+                    + 6.0 * d * d * (na * na * m2b + nb * nb * m2a) / (n * n)
+                    + 4.0 * d * (na * m3b - nb * m3a) / n;
+            }
+            if (m_order >= 3)
+            {
+                NekDouble m2a = Moment(2, v)[i], m2b = other.Moment(2, v)[i];
+                Moment(3, v)[i] += other.Moment(3, v)[i]
+                    + d * d * d * fab * (na - nb) / n
+                    + 3.0 * d * (na * m2b - nb * m2a) / n;
+            }
+            if (m_order >= 2)
+            {
+                Moment(2, v)[i] += other.Moment(2, v)[i] + d * d * fab;
+            }
+            m[i] += d * nb / n;
+        }
+    }
+
+    m_count = n;
+}
+
+/**
+ * @brief Merge the statistics of the same points held by all the ranks of
+ * @p comm, each rank having processed its own samples.
+ *
+ * The sums of each rank are shifted to the mean of all the samples,
+ * e.g. @f$ M_2 + n_r d^2 @f$ with @f$ d = \bar{x}_r - \bar{x} @f$, and the
+ * shifted sums are added up.
+ */
+void StreamingStatistics::AllReduce(const CommSharedPtr &comm)
+{
+    ASSERTL0(m_alpha == 0.0, "Exponential averages cannot be merged.");
+
+    if (comm->GetSize() == 1)
+    {
+        return;
+    }
+
+    const NekDouble nr = m_count;
+    NekDouble n = m_count;
+    comm->AllReduce(n, ReduceSum);
+    if (n == 0.0)
+    {
+        return;
+    }
+
+    // Deviation of the mean of this rank from the global mean.
+    Array<OneD, Array<OneD, NekDouble> > dev(m_nVars);
+    for (int v = 0; v < m_nVars; ++v)
+    {
+        Array<OneD, NekDouble> mean(m_nPoints);
+        Vmath::Smul(m_nPoints, nr / n, m_mean[v], 1, mean, 1);
+        comm->AllReduce(mean, ReduceSum);
+
+        dev[v] = Array<OneD, NekDouble>(m_nPoints);
+        Vmath::Vsub(m_nPoints, m_mean[v], 1, mean, 1, dev[v], 1);
+        m_mean[v] = mean;
+    }
+
+    for (int p = 0; p < m_pairs.size(); ++p)
+    {
+        const NekDouble *dx = dev[m_pairs[p].first].get();
+        const NekDouble *dy = dev[m_pairs[p].second].get();
+        NekDouble       *c  = m_comoments[p].get();
+        for (int i = 0; i < m_nPoints; ++i)
+        {
+            c[i] += nr * dx[i] * dy[i];
+        }
+        comm->AllReduce(m_comoments[p], ReduceSum);
+    }
+
+    for (int v = 0; v < m_nVars && m_order >= 2; ++v)
+    {
+        const NekDouble *d = dev[v].get();
+        for (int i = 0; i < m_nPoints; ++i)
+        {
+            NekDouble d2 = d[i] * d[i];
+            if (m_order >= 4)
+            {
+                Moment(4, v)[i] += 4.0 * d[i] * Moment(3, v)[i]
+                    + 6.0 * d2 * Moment(2, v)[i] + nr * d2 * d2;
+            }
+            if (m_order >= 3)
+            {
+                Moment(3, v)[i] += 3.0 * d[i] * Moment(2, v)[i]
+                    + nr * d2 * d[i];
+            }
+            Moment(2, v)[i] += nr * d2;
+        }
+
+        for (int k = 2; k <= m_order; ++k)
+        {
+            comm->AllReduce(Moment(k, v), ReduceSum);
+        }
+    }
+
+    m_count = n;
+}
+
+/// Discard all the samples.
+void StreamingStatistics::Reset()
+{
+    m_count = 0.0;
+    for (int v = 0; v < m_nVars; ++v)
+    {
+        Vmath::Zero(m_nPoints, m_mean[v], 1);
+    }
+    for (int i = 0; i < m_moments.num_elements(); ++i)
+    {
+        Vmath::Zero(m_nPoints, m_moments[i], 1);
+    }
+    for (int i = 0; i < m_comoments.num_elements(); ++i)
+    {
+        Vmath::Zero(m_nPoints, m_comoments[i], 1);
+    }
+}
+
+/**
+ * @brief Get the statistics at each point: the means of the variables,
+ * followed by their central moments of each order from the second one, and
+ * by the covariances of the pairs.
+ */
+void StreamingStatistics::GetStatistics(
+    Array<OneD, Array<OneD, NekDouble> > &stats) const
+{
+    if (stats.num_elements() != GetNumStatistics())
+    {
+        stats = Array<OneD, Array<OneD, NekDouble> >(GetNumStatistics());
+    }
+
+    // Exponential averages are stored normalised.
+    const NekDouble scale =
+        (m_alpha > 0.0 || m_count == 0.0) ? 1.0 : 1.0 / m_count;
+
+    int cnt = 0;
+    for (int v = 0; v < m_nVars; ++v, ++cnt)
+    {
+        if (stats[cnt].num_elements() != m_nPoints)
+        {
+            stats[cnt] = Array<OneD, NekDouble>(m_nPoints);
+        }
+        Vmath::Vcopy(m_nPoints, m_mean[v], 1, stats[cnt], 1);
+    }
+
+    for (int i = 0; i < m_moments.num_elements(); ++i, ++cnt)
+    {
+        if (stats[cnt].num_elements() != m_nPoints)
+        {
+            stats[cnt] = Array<OneD, NekDouble>(m_nPoints);
+        }
+        Vmath::Smul(m_nPoints, scale, m_moments[i], 1, stats[cnt], 1);
+    }
+
+    for (int p = 0; p < m_comoments.num_elements(); ++p, ++cnt)
+    {
+        if (stats[cnt].num_elements() != m_nPoints)
+        {
+            stats[cnt] = Array<OneD, NekDouble>(m_nPoints);
+        }
+        Vmath::Smul(m_nPoints, scale, m_comoments[p], 1, stats[cnt], 1);
+    }
+}
+
+/**
+ * @brief Set the statistics of @p count samples, ordered as returned by
+ * GetStatistics. Further samples are then accumulated as if these samples
+ * had been added one by one, which allows a run to be restarted.
+ */
+void StreamingStatistics::SetStatistics(
+    const NekDouble                                   count,
+    const Array<OneD, const Array<OneD, NekDouble> > &stats)
+{
+    ASSERTL0(stats.num_elements() == GetNumStatistics(),
+             "Wrong number of statistics.");
+
+    m_count = count;
+    const NekDouble scale = m_alpha > 0.0 ? 1.0 : count;
+
+    int cnt = 0;
+    for (int v = 0; v < m_nVars; ++v, ++cnt)
+    {
+        Vmath::Vcopy(m_nPoints, stats[cnt], 1, m_mean[v], 1);
+    }
+    for (int i = 0; i < m_moments.num_elements(); ++i, ++cnt)
+    {
+        Vmath::Smul(m_nPoints, scale, stats[cnt], 1, m_moments[i], 1);
+    }
+    for (int p = 0; p < m_comoments.num_elements(); ++p, ++cnt)
+    {
+        Vmath::Smul(m_nPoints, scale, stats[cnt], 1, m_comoments[p], 1);
+    }
+}
+
+}
+}
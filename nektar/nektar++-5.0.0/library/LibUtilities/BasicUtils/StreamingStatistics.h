@@ -0,0 +1,139 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: StreamingStatistics.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: one-pass statistics of a stream of samples of several
+// variables at a set of points.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_UTILITIES_BASIC_UTILS_STREAMINGSTATISTICS_H
+#define NEKTAR_LIB_UTILITIES_BASIC_UTILS_STREAMINGSTATISTICS_H
+
+#include <utility>
+#include <vector>
+
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+#include <LibUtilities/Communication/Comm.h>
+#include <LibUtilities/LibUtilitiesDeclspec.h>
+
+namespace Nektar
+{
+namespace LibUtilities
+{
+
+/**
+ * @brief One-pass statistics of a stream of samples.
+ *
+ * Each sample gives the values of @a nVars variables at @a nPoints points.
+ * The mean and the central moments up to the fourth order of each variable
+ * are updated with the recurrences of Welford and Pébay, which are stable
+ * without storing the samples, together with the covariances of chosen
+ * pairs of variables. Each sample is processed in one sweep per variable,
+ * all the moments of a point being updated together.
+ *
+ * The accumulators of two sets of samples of the same points can be merged,
+ * for instance those of a restarted run or those held by several ranks.
+ *
+ * With a non-zero @a alpha the statistics are exponentially weighted
+ * moving averages instead, the weight of a sample decaying by a factor
+ * @f$ 1 - \alpha @f$ with each new sample. Only the mean and the second
+ * order moments are available in this case.
+ */
+class StreamingStatistics
+{
+public:
+    LIB_UTILITIES_EXPORT StreamingStatistics(
+        const int                                 nPoints,
+        const int                                 nVars,
+        const int                                 order,
+        const std::vector<std::pair<int, int> > &pairs = {},
+        const NekDouble                           alpha = 0.0);
+
+    /// Number of samples.
+    NekDouble GetCount() const
+    {
+        return m_count;
+    }
+
+    /// Number of statistics returned by GetStatistics.
+    int GetNumStatistics() const
+    {
+        return m_nVars * (m_order > 1 ? m_order : 1) + m_pairs.size();
+    }
+
+    LIB_UTILITIES_EXPORT void Update(
+        const Array<OneD, const Array<OneD, NekDouble> > &sample);
+
+    LIB_UTILITIES_EXPORT void Merge(const StreamingStatistics &other);
+
+    LIB_UTILITIES_EXPORT void AllReduce(const CommSharedPtr &comm);
+
+    LIB_UTILITIES_EXPORT void Reset();
+
+    LIB_UTILITIES_EXPORT void GetStatistics(
+        Array<OneD, Array<OneD, NekDouble> > &stats) const;
+
+    LIB_UTILITIES_EXPORT void SetStatistics(
+        const NekDouble                                   count,
+        const Array<OneD, const Array<OneD, NekDouble> > &stats);
+
+private:
+    int                               m_nPoints;
+    int                               m_nVars;
+    int                               m_order;
+    std::vector<std::pair<int, int> > m_pairs;
+    NekDouble                         m_alpha;
+    /// Number of samples.
+    NekDouble                         m_count;
+    /// Mean of each variable.
+    Array<OneD, Array<OneD, NekDouble> > m_mean;
+    /// Sums of the powers of the deviations from the mean, stored by order
+    /// then variable.
+    Array<OneD, Array<OneD, NekDouble> > m_moments;
+    /// Sums of the products of the deviations of each pair.
+    Array<OneD, Array<OneD, NekDouble> > m_comoments;
+
+    Array<OneD, NekDouble> &Moment(int order, int var)
+    {
+        return m_moments[(order - 2) * m_nVars + var];
+    }
+
+    const Array<OneD, NekDouble> &Moment(int order, int var) const
+    {
+        return m_moments[(order - 2) * m_nVars + var];
+    }
+};
+
+typedef std::shared_ptr<StreamingStatistics> StreamingStatisticsSharedPtr;
+
+}
+}
+
+#endif
@@ -136,6 +136,13 @@ Transposition::Transposition(const LibUtilities::BasisKey &HomoBasis0,
     m_num_points_per_proc[0] = m_num_homogeneous_points[0] / m_num_processes[0];
     m_num_points_per_proc[1] = m_num_homogeneous_points[1] / m_num_processes[1];
 
+    // The y pencils are redistributed over the z processes when switching
+    // to z pencils, so both directions must divide evenly.
+    ASSERTL0(m_num_homogeneous_points[0] % m_num_processes[0] == 0 &&
+             m_num_homogeneous_points[0] % m_num_processes[1] == 0 &&
+             m_num_homogeneous_points[1] % m_num_processes[1] == 0,
+             "Homogeneous points must be a multiple of npy and npz.");
+
     //================================================================
     // TODO: Need set up for 2D lines IDs and Ks if Fourier
     //================================================================
@@ -199,6 +206,23 @@ unsigned int Transposition::GetStripID(void)
     return m_strip_ID;
 }
 
+/**
+ * Return the length of the arrays holding the y or z pencils of a 2D
+ * homogeneous expansion with @a ptsPerLine points in each local line. This
+ * includes the padding used when the points do not divide evenly amongst
+ * the y processes.
+ */
+int Transposition::GetPencilSize(int ptsPerLine)
+{
+    ASSERTL1(m_num_homogeneous_directions == 2,
+             "Pencils are only defined for 2D homogeneous expansions.");
+
+    int npy  = m_num_processes[0];
+    int ptsY = ptsPerLine / npy + (ptsPerLine % npy > 0);
+
+    return ptsY * m_num_points_per_proc[1] * m_num_homogeneous_points[0];
+}
+
 /**
  * Main method: General transposition, the dir parameters define if
  * 1D,2D,3D and which transposition is required at the same time
@@ -472,6 +496,12 @@ void Transposition::TransposeZtoXY(const Array<OneD, const NekDouble> &inarray,
 
 /**
  * Homogeneous 2D transposition from SEM to Homogeneous(YZ) ordering.
+ *
+ * In parallel the homogeneous processes form a pencil decomposition: the
+ * rows of the homogeneous communicator span the y direction and its
+ * columns the z direction. Each process starts with the lines of its
+ * local y and z planes and finishes with complete y pencils for a chunk of
+ * the points of each line and its local z planes.
  */
 void Transposition::TransposeXtoYZ(const Array<OneD, const NekDouble> &inarray,
                                    Array<OneD, NekDouble> &outarray,
@@ -479,8 +509,55 @@ void Transposition::TransposeXtoYZ(const Array<OneD, const NekDouble> &inarray,
 {
     if (m_num_processes[0] > 1 || m_num_processes[1] > 1)
     {
-        ASSERTL0(false, "Parallel transposition not implemented yet for "
-                        "3D-Homo-2D approach.");
+        ASSERTL0(!UseNumMode, "Parallel 3D-Homo-2D transposition is only "
+                              "available in physical space.");
+
+        int i, j, k;
+        int ny   = m_num_homogeneous_points[0];
+        int nyl  = m_num_points_per_proc[0];
+        int nzl  = m_num_points_per_proc[1];
+        int npy  = m_num_processes[0];
+        int pts  = inarray.num_elements() / (nyl * nzl);
+        int ptsY = pts / npy + (pts % npy > 0);
+        int blk  = ptsY * nzl * nyl;
+
+        m_SizeMap   = Array<OneD, int>(npy, blk);
+        m_OffsetMap = Array<OneD, int>(npy, 0);
+        for (i = 0; i < npy; ++i)
+        {
+            m_OffsetMap[i] = i * blk;
+        }
+
+        Array<OneD, NekDouble> sendBuf(npy * blk, 0.0);
+        Array<OneD, NekDouble> recvBuf(npy * blk, 0.0);
+
+        // Each process of the y row receives a chunk of ptsY points of
+        // every local line, ordered as [point][z][y].
+        for (i = 0; i < npy; ++i)
+        {
+            for (j = 0; j < ptsY && i * ptsY + j < pts; ++j)
+            {
+                for (k = 0; k < nzl; ++k)
+                {
+                    Vmath::Vcopy(nyl, &(inarray[k * nyl * pts + i * ptsY + j]),
+                                 pts, &(sendBuf[i * blk + (j * nzl + k) * nyl]),
+                                 1);
+                }
+            }
+        }
+
+        m_hcomm->GetRowComm()->AlltoAllv(sendBuf, m_SizeMap, m_OffsetMap,
+                                         recvBuf, m_SizeMap, m_OffsetMap);
+
+        // Assemble complete y pencils from the chunks of each process.
+        for (i = 0; i < npy; ++i)
+        {
+            for (j = 0; j < ptsY * nzl; ++j)
+            {
+                Vmath::Vcopy(nyl, &(recvBuf[i * blk + j * nyl]), 1,
+                             &(outarray[j * ny + i * nyl]), 1);
+            }
+        }
     }
     else
     {
@@ -522,8 +599,53 @@ void Transposition::TransposeYZtoX(const Array<OneD, const NekDouble> &inarray,
 {
     if (m_num_processes[0] > 1 || m_num_processes[1] > 1)
     {
-        ASSERTL0(false, "Parallel transposition not implemented yet for "
-                        "3D-Homo-2D approach.");
+        ASSERTL0(!UseNumMode, "Parallel 3D-Homo-2D transposition is only "
+                              "available in physical space.");
+
+        int i, j, k;
+        int ny   = m_num_homogeneous_points[0];
+        int nyl  = m_num_points_per_proc[0];
+        int nzl  = m_num_points_per_proc[1];
+        int npy  = m_num_processes[0];
+        int pts  = outarray.num_elements() / (nyl * nzl);
+        int ptsY = pts / npy + (pts % npy > 0);
+        int blk  = ptsY * nzl * nyl;
+
+        m_SizeMap   = Array<OneD, int>(npy, blk);
+        m_OffsetMap = Array<OneD, int>(npy, 0);
+        for (i = 0; i < npy; ++i)
+        {
+            m_OffsetMap[i] = i * blk;
+        }
+
+        Array<OneD, NekDouble> sendBuf(npy * blk, 0.0);
+        Array<OneD, NekDouble> recvBuf(npy * blk, 0.0);
+
+        // Return to each process of the y row its own part of the pencils.
+        for (i = 0; i < npy; ++i)
+        {
+            for (j = 0; j < ptsY * nzl; ++j)
+            {
+                Vmath::Vcopy(nyl, &(inarray[j * ny + i * nyl]), 1,
+                             &(sendBuf[i * blk + j * nyl]), 1);
+            }
+        }
+
+        m_hcomm->GetRowComm()->AlltoAllv(sendBuf, m_SizeMap, m_OffsetMap,
+                                         recvBuf, m_SizeMap, m_OffsetMap);
+
+        for (i = 0; i < npy; ++i)
+        {
+            for (j = 0; j < ptsY && i * ptsY + j < pts; ++j)
+            {
+                for (k = 0; k < nzl; ++k)
+                {
+                    Vmath::Vcopy(nyl, &(recvBuf[i * blk + (j * nzl + k) * nyl]),
+                                 1, &(outarray[k * nyl * pts + i * ptsY + j]),
+                                 pts);
+                }
+            }
+        }
     }
     else
     {
@@ -558,17 +680,65 @@ void Transposition::TransposeYZtoX(const Array<OneD, const NekDouble> &inarray,
 
 /**
  * Homogeneous 2D transposition from Y ordering to Z.
+ *
+ * In parallel the y pencils are exchanged within the z column so that each
+ * process holds complete z pencils for a subset of the y indices.
  */
 void Transposition::TransposeYZtoZY(const Array<OneD, const NekDouble> &inarray,
                                     Array<OneD, NekDouble> &outarray,
                                     bool UseNumMode)
 {
-    boost::ignore_unused(UseNumMode);
-
     if (m_num_processes[0] > 1 || m_num_processes[1] > 1)
     {
-        ASSERTL0(false, "Parallel transposition not implemented yet for "
-                        "3D-Homo-2D approach.");
+        ASSERTL0(!UseNumMode, "Parallel 3D-Homo-2D transposition is only "
+                              "available in physical space.");
+
+        int i, j, k;
+        int ny   = m_num_homogeneous_points[0];
+        int nz   = m_num_homogeneous_points[1];
+        int nzl  = m_num_points_per_proc[1];
+        int npz  = m_num_processes[1];
+        int nyz  = ny / npz;
+        int ptsY = inarray.num_elements() / (nzl * ny);
+        int blk  = nyz * ptsY * nzl;
+
+        m_SizeMap   = Array<OneD, int>(npz, blk);
+        m_OffsetMap = Array<OneD, int>(npz, 0);
+        for (i = 0; i < npz; ++i)
+        {
+            m_OffsetMap[i] = i * blk;
+        }
+
+        Array<OneD, NekDouble> sendBuf(npz * blk, 0.0);
+        Array<OneD, NekDouble> recvBuf(npz * blk, 0.0);
+
+        // Each process of the z column receives nyz of the y indices,
+        // ordered as [y][point][z].
+        for (i = 0; i < npz; ++i)
+        {
+            for (j = 0; j < nyz; ++j)
+            {
+                for (k = 0; k < ptsY; ++k)
+                {
+                    Vmath::Vcopy(nzl, &(inarray[k * nzl * ny + i * nyz + j]),
+                                 ny, &(sendBuf[i * blk + (j * ptsY + k) * nzl]),
+                                 1);
+                }
+            }
+        }
+
+        m_hcomm->GetColumnComm()->AlltoAllv(sendBuf, m_SizeMap, m_OffsetMap,
+                                            recvBuf, m_SizeMap, m_OffsetMap);
+
+        // Assemble complete z pencils from the chunks of each process.
+        for (i = 0; i < npz; ++i)
+        {
+            for (j = 0; j < nyz * ptsY; ++j)
+            {
+                Vmath::Vcopy(nzl, &(recvBuf[i * blk + j * nzl]), 1,
+                             &(outarray[j * nz + i * nzl]), 1);
+            }
+        }
     }
     else
     {
@@ -594,12 +764,55 @@ void Transposition::TransposeZYtoYZ(const Array<OneD, const NekDouble> &inarray,
                                     Array<OneD, NekDouble> &outarray,
                                     bool UseNumMode)
 {
-    boost::ignore_unused(UseNumMode);
-
     if (m_num_processes[0] > 1 || m_num_processes[1] > 1)
     {
-        ASSERTL0(false, "Parallel transposition not implemented yet for "
-                        "3D-Homo-2D approach.");
+        ASSERTL0(!UseNumMode, "Parallel 3D-Homo-2D transposition is only "
+                              "available in physical space.");
+
+        int i, j, k;
+        int ny   = m_num_homogeneous_points[0];
+        int nz   = m_num_homogeneous_points[1];
+        int nzl  = m_num_points_per_proc[1];
+        int npz  = m_num_processes[1];
+        int nyz  = ny / npz;
+        int ptsY = inarray.num_elements() / (nyz * nz);
+        int blk  = nyz * ptsY * nzl;
+
+        m_SizeMap   = Array<OneD, int>(npz, blk);
+        m_OffsetMap = Array<OneD, int>(npz, 0);
+        for (i = 0; i < npz; ++i)
+        {
+            m_OffsetMap[i] = i * blk;
+        }
+
+        Array<OneD, NekDouble> sendBuf(npz * blk, 0.0);
+        Array<OneD, NekDouble> recvBuf(npz * blk, 0.0);
+
+        // Return to each process of the z column its own z planes.
+        for (i = 0; i < npz; ++i)
+        {
+            for (j = 0; j < nyz * ptsY; ++j)
+            {
+                Vmath::Vcopy(nzl, &(inarray[j * nz + i * nzl]), 1,
+                             &(sendBuf[i * blk + j * nzl]), 1);
+            }
+        }
+
+        m_hcomm->GetColumnComm()->AlltoAllv(sendBuf, m_SizeMap, m_OffsetMap,
+                                            recvBuf, m_SizeMap, m_OffsetMap);
+
+        for (i = 0; i < npz; ++i)
+        {
+            for (j = 0; j < nyz; ++j)
+            {
+                for (k = 0; k < ptsY; ++k)
+                {
+                    Vmath::Vcopy(nzl,
+                                 &(recvBuf[i * blk + (j * ptsY + k) * nzl]), 1,
+                                 &(outarray[k * nzl * ny + i * nyz + j]), ny);
+                }
+            }
+        }
     }
     else
     {
@@ -93,6 +93,8 @@ public:
 
     LIB_UTILITIES_EXPORT Array<OneD, unsigned int> GetPlanesIDs(void);
 
+    LIB_UTILITIES_EXPORT int GetPencilSize(int ptsPerLine);
+
     LIB_UTILITIES_EXPORT void Transpose(
         const Array<OneD, const NekDouble> &inarray,
         Array<OneD, NekDouble> &outarray, bool UseNumMode = false,
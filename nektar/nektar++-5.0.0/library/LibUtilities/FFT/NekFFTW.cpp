@@ -32,6 +32,8 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <cstdio>
+
 #include <LibUtilities/FFT/NekFFTW.h>
 #include <LibUtilities/BasicUtils/VmathArray.hpp>
 #include <LibUtilities/BasicUtils/SharedArray.hpp>
@@ -44,6 +46,8 @@ namespace Nektar
             = GetNektarFFTFactory().RegisterCreatorFunction("NekFFTW",
                                                             NekFFTW::create);
 
+        std::string NekFFTW::m_importedWisdom;
+
         NekFFTW::NekFFTW(int N)
                 : NektarFFT(N)
         {
@@ -75,7 +79,158 @@ namespace Nektar
         // Distructor
         NekFFTW::~NekFFTW()
         {
+            for (auto &it : m_batchPlans)
+            {
+                fftw_destroy_plan(it.second.first);
+                fftw_destroy_plan(it.second.second);
+            }
+        }
+
+        /**
+         * Batched plans transform nTrans lines of m_N points stored one after
+         * the other with a single FFTW call. They are created out-of-place on
+         * scratch storage and applied to the caller's arrays through the new
+         * array execute interface, hence the FFTW_UNALIGNED flag.
+         */
+        const std::pair<fftw_plan, fftw_plan> &NekFFTW::GetBatchPlans(
+            int nTrans)
+        {
+            auto it = m_batchPlans.find(nTrans);
+            if (it != m_batchPlans.end())
+            {
+                return it->second;
+            }
+
+            // Wisdom is accumulated, so a missing file is not an error.
+            if (!m_wisdomFile.empty() && m_wisdomFile != m_importedWisdom)
+            {
+                FILE *fp = fopen(m_wisdomFile.c_str(), "r");
+                if (fp)
+                {
+                    fftw_import_wisdom_from_file(fp);
+                    fclose(fp);
+                }
+                m_importedWisdom = m_wisdomFile;
+            }
+
+            int n = m_N;
+            unsigned int flags = FFTW_UNALIGNED |
+                (m_wisdomFile.empty() ? FFTW_ESTIMATE : FFTW_MEASURE);
+            fftw_r2r_kind fwdKind = FFTW_R2HC;
+            fftw_r2r_kind bwdKind = FFTW_HC2R;
+
+            // Measuring overwrites the arrays, so never plan on user data.
+            Array<OneD,NekDouble> in(nTrans*m_N), out(nTrans*m_N);
+
+            std::pair<fftw_plan, fftw_plan> plans;
+            plans.first  = fftw_plan_many_r2r(1, &n, nTrans,
+                                              &in[0],  NULL, 1, m_N,
+                                              &out[0], NULL, 1, m_N,
+                                              &fwdKind, flags);
+            plans.second = fftw_plan_many_r2r(1, &n, nTrans,
+                                              &out[0], NULL, 1, m_N,
+                                              &in[0],  NULL, 1, m_N,
+                                              &bwdKind, flags);
+
+            if (m_wisdomWrite)
+            {
+                FILE *fp = fopen(m_wisdomFile.c_str(), "w");
+                if (fp)
+                {
+                    fftw_export_wisdom_to_file(fp);
+                    fclose(fp);
+                }
+            }
+
+            return m_batchPlans[nTrans] = plans;
+        }
+
+        /**
+         * Batched forward transformation. The reshuffle from the FFTW
+         * half-complex ordering to the Nektar++ ordering and the scaling by
+         * the quadrature weights are applied while copying each line out of
+         * the workspace.
+         */
+        void NekFFTW::v_FFTFwdTransBatch(
+                int nTrans,
+                const Array<OneD,const NekDouble> &inarray,
+                Array<OneD,NekDouble> &outarray)
+        {
+            if (nTrans == 0)
+            {
+                return;
+            }
+
+            const std::pair<fftw_plan, fftw_plan> &plans =
+                GetBatchPlans(nTrans);
+
+            if (m_batchWsp.num_elements() < nTrans*m_N)
+            {
+                m_batchWsp = Array<OneD,NekDouble>(nTrans*m_N);
+            }
+
+            // R2HC plans preserve their input.
+            fftw_execute_r2r(plans.first,
+                             const_cast<NekDouble *>(&inarray[0]),
+                             &m_batchWsp[0]);
+
+            int halfN = m_N/2;
+            for (int i = 0; i < nTrans; ++i)
+            {
+                const NekDouble *src = &m_batchWsp[0] + i*m_N;
+                NekDouble       *dst = &outarray[0]   + i*m_N;
+
+                dst[0] = src[0]     * m_FFTW_w[0];
+                dst[1] = src[halfN] * m_FFTW_w[1];
+                for (int k = 1; k < halfN; ++k)
+                {
+                    dst[2*k]   = src[k]       * m_FFTW_w[2*k];
+                    dst[2*k+1] = src[m_N - k] * m_FFTW_w[2*k+1];
+                }
+            }
+        }
+
+        /**
+         * Batched backward transformation. The input is reshuffled into the
+         * FFTW half-complex ordering directly into the workspace, which is
+         * then transformed into the output.
+         */
+        void NekFFTW::v_FFTBwdTransBatch(
+                int nTrans,
+                const Array<OneD,const NekDouble> &inarray,
+                Array<OneD,NekDouble> &outarray)
+        {
+            if (nTrans == 0)
+            {
+                return;
+            }
+
+            const std::pair<fftw_plan, fftw_plan> &plans =
+                GetBatchPlans(nTrans);
+
+            if (m_batchWsp.num_elements() < nTrans*m_N)
+            {
+                m_batchWsp = Array<OneD,NekDouble>(nTrans*m_N);
+            }
+
+            int halfN = m_N/2;
+            NekDouble invN = 1.0/m_N;
+            for (int i = 0; i < nTrans; ++i)
+            {
+                const NekDouble *src = &inarray[0]    + i*m_N;
+                NekDouble       *dst = &m_batchWsp[0] + i*m_N;
+
+                dst[0]     = src[0] * m_FFTW_w_inv[0] * invN;
+                dst[halfN] = src[1] * m_FFTW_w_inv[1] * invN;
+                for (int k = 1; k < halfN; ++k)
+                {
+                    dst[k]       = src[2*k]   * m_FFTW_w_inv[2*k]   * invN;
+                    dst[m_N - k] = src[2*k+1] * m_FFTW_w_inv[2*k+1] * invN;
+                }
+            }
 
+            // HC2R plans may overwrite the workspace.
+            fftw_execute_r2r(plans.second, &m_batchWsp[0], &outarray[0]);
         }
 
         // Forward transformation
@@ -45,6 +45,8 @@
 
 #include <fftw3.h>
 
+#include <map>
+
 namespace Nektar
 {
     template <typename Dim, typename DataType>
@@ -82,7 +84,9 @@ namespace Nektar
 			
 			virtual void v_FFTBwdTrans(Array<OneD,NekDouble> &inarray, Array<OneD,NekDouble> &outarray);
 			
+			virtual void v_FFTFwdTransBatch(int nTrans, const Array<OneD,const NekDouble> &inarray, Array<OneD,NekDouble> &outarray);
 			
+			virtual void v_FFTBwdTransBatch(int nTrans, const Array<OneD,const NekDouble> &inarray, Array<OneD,NekDouble> &outarray);
 			
 		protected:
 			
@@ -106,9 +110,18 @@ namespace Nektar
 			
 			void Reshuffle_Nek2FFTW(Array<OneD,NekDouble> &coef);
 			
+			/// Batched forward/backward plans indexed by number of transforms
+			std::map<int, std::pair<fftw_plan, fftw_plan> > m_batchPlans;
+			
+			/// Workspace holding FFTW ordered coefficients of a batch
+			Array<OneD,NekDouble> m_batchWsp;
 			
+			/// Return (creating if required) the batched plans for nTrans lines
+			const std::pair<fftw_plan, fftw_plan> &GetBatchPlans(int nTrans);
 
 		private:
+			/// Wisdom file most recently imported into FFTW
+			static std::string m_importedWisdom;
 		};
 
 	}//end namespace LibUtilities
@@ -35,6 +35,9 @@
 #include <boost/core/ignore_unused.hpp>
 
 #include <LibUtilities/FFT/NektarFFT.h>
+#include <LibUtilities/BasicUtils/SessionReader.h>
+#include <LibUtilities/BasicUtils/VmathArray.hpp>
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
 
 namespace Nektar
 {
@@ -66,6 +69,20 @@ namespace Nektar
 			
 		}
 		
+		std::string NektarFFT::wisdomCmdSwitch =
+			SessionReader::RegisterCmdLineArgument(
+				"fftw-wisdom", "",
+				"File used to cache measured FFT plans between runs.");
+		
+		std::string NektarFFT::m_wisdomFile;
+		bool        NektarFFT::m_wisdomWrite = false;
+		
+		void NektarFFT::SetWisdomFile(const std::string &file, bool writeAccess)
+		{
+			m_wisdomFile  = file;
+			m_wisdomWrite = writeAccess;
+		}
+		
 		NektarFFTFactory& GetNektarFFTFactory()
 		{
                     static NektarFFTFactory instance;
@@ -89,6 +106,16 @@ namespace Nektar
 			v_FFTBwdTrans(coef,phys);
 		}
 		
+		void NektarFFT::FFTFwdTransBatch(int nTrans, const Array<OneD,const NekDouble> &phys, Array<OneD,NekDouble> &coef)
+		{
+			v_FFTFwdTransBatch(nTrans,phys,coef);
+		}
+		
+		void NektarFFT::FFTBwdTransBatch(int nTrans, const Array<OneD,const NekDouble> &coef, Array<OneD,NekDouble> &phys)
+		{
+			v_FFTBwdTransBatch(nTrans,coef,phys);
+		}
+		
 		void NektarFFT::v_FFTFwdTrans(Array<OneD,NekDouble> &phys, Array<OneD,NekDouble> &coef)
 		{
             boost::ignore_unused(phys, coef);
@@ -99,5 +126,35 @@ namespace Nektar
             boost::ignore_unused(coef, phys);
 		}
 		
+		/**
+		 * Default batched implementation which performs one transform per
+		 * line through v_FFTFwdTrans.
+		 */
+		void NektarFFT::v_FFTFwdTransBatch(int nTrans, const Array<OneD,const NekDouble> &phys, Array<OneD,NekDouble> &coef)
+		{
+			Array<OneD,NekDouble> in(m_N), out(m_N), tmp;
+			for (int i = 0; i < nTrans; ++i)
+			{
+				Vmath::Vcopy(m_N, &phys[0] + i*m_N, 1, &in[0], 1);
+				v_FFTFwdTrans(in, out);
+				Vmath::Vcopy(m_N, out, 1, tmp = coef + i*m_N, 1);
+			}
+		}
+		
+		/**
+		 * Default batched implementation which performs one transform per
+		 * line through v_FFTBwdTrans.
+		 */
+		void NektarFFT::v_FFTBwdTransBatch(int nTrans, const Array<OneD,const NekDouble> &coef, Array<OneD,NekDouble> &phys)
+		{
+			Array<OneD,NekDouble> in(m_N), out(m_N), tmp;
+			for (int i = 0; i < nTrans; ++i)
+			{
+				Vmath::Vcopy(m_N, &coef[0] + i*m_N, 1, &in[0], 1);
+				v_FFTBwdTrans(in, out);
+				Vmath::Vcopy(m_N, out, 1, tmp = phys + i*m_N, 1);
+			}
+		}
+		
 	}//end namespace LibUtilities
 }//end of namespace Nektar
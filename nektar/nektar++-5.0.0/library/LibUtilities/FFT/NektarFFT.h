@@ -102,13 +102,53 @@ namespace Nektar
 			 */
 			LIB_UTILITIES_EXPORT void FFTBwdTrans(Array<OneD,NekDouble> &coef, Array<OneD,NekDouble> &phys);
 			
+			/**
+			 * Forward transformation of nTrans contiguous lines of m_N points
+			 * stored one after the other (line i starts at i*m_N).
+			 * input:
+			 * nTrans    = number of transforms
+			 * phys      = lines in physical space (length nTrans*N)
+			 * output:
+			 * coef      = lines in coefficient space (length nTrans*N)
+			 */
+			LIB_UTILITIES_EXPORT void FFTFwdTransBatch(int nTrans, const Array<OneD,const NekDouble> &phys, Array<OneD,NekDouble> &coef);
+			
+			/**
+			 * Backward transformation of nTrans contiguous lines of m_N
+			 * coefficients stored one after the other.
+			 * input:
+			 * nTrans    = number of transforms
+			 * coef      = lines in coefficient space (length nTrans*N)
+			 * output:
+			 * phys      = lines in physical space (length nTrans*N)
+			 */
+			LIB_UTILITIES_EXPORT void FFTBwdTransBatch(int nTrans, const Array<OneD,const NekDouble> &coef, Array<OneD,NekDouble> &phys);
+			
+			/// Command-line switch for the file caching measured FFT plans
+			static std::string wisdomCmdSwitch;
+			
+			/**
+			 * Set the file from which implementations read previously
+			 * measured plans and, if writeAccess is set, to which newly
+			 * measured plans are written. Setting a file enables measured
+			 * rather than estimated planning of batched transforms.
+			 */
+			LIB_UTILITIES_EXPORT static void SetWisdomFile(const std::string &file, bool writeAccess);
+			
 		protected:
 			
+			static std::string m_wisdomFile;
+			static bool        m_wisdomWrite;
+			
 			
 			virtual void v_FFTFwdTrans(Array<OneD,NekDouble> &phys, Array<OneD,NekDouble> &coef);
 						
 			virtual void v_FFTBwdTrans(Array<OneD,NekDouble> &coef, Array<OneD,NekDouble> &phys);
 			
+			virtual void v_FFTFwdTransBatch(int nTrans, const Array<OneD,const NekDouble> &phys, Array<OneD,NekDouble> &coef);
+			
+			virtual void v_FFTBwdTransBatch(int nTrans, const Array<OneD,const NekDouble> &coef, Array<OneD,NekDouble> &phys);
+			
 		private:
 			
 		};
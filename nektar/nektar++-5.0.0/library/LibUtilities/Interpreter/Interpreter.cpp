@@ -52,7 +52,10 @@
 
 namespace bsp = boost::spirit::classic;
 
+#include <algorithm>
 #include <map>
+#include <mutex>
+#include <set>
 #include <string>
 #include <vector>
 #if defined(__INTEL_COMPILER)
@@ -161,6 +164,7 @@ class Interpreter::ExpressionEvaluator
 {
 private:
     struct EvaluationStep;
+    struct EvaluationContext;
 
 public:
     typedef std::map<std::string, int> VariableMap;
@@ -188,7 +192,7 @@ public:
      * This routine will initialize the evaluator with some basic default
      * constants,
      */
-    ExpressionEvaluator() : m_timer(), m_total_eval_time(0)
+    ExpressionEvaluator() : m_parameterRevision(0), m_total_eval_time(0)
     {
         m_state_size = 1;
 
@@ -360,14 +364,24 @@ public:
         {
             m_parameterMapNameToId[name] = m_parameter.size();
             m_parameter.push_back(value);
+            ++m_parameterRevision;
         }
-        else
+        else if (m_parameter[it->second] != value)
         {
             // If parameter is known, change its value.
             m_parameter[it->second] = value;
+            ++m_parameterRevision;
         }
     }
 
+    /**
+     * @copydoc Interpreter::GetParameterRevision
+     */
+    int GetParameterRevision() const
+    {
+        return m_parameterRevision;
+    }
+
     /**
      * @copydoc Interpreter::GetParameter
      */
@@ -384,6 +398,7 @@ public:
      */
     NekDouble GetTime() const
     {
+        std::lock_guard<std::mutex> lock(m_timeMutex);
         return m_total_eval_time;
     }
 
@@ -404,38 +419,8 @@ public:
         // Otherwise, prepare an iterator that allows to walk along the string
         // representing an analytic expression in the order that respects its
         // recursive structure (thanks to boost::spirit).
-
-        // Parse the vlist input and separate the variables into ordered entries
-        // in a vector<string> object. These need to be ordered because this is
-        // the order the variables will get assigned to in the Map when
-        // Evaluate(...)  is called.
         std::vector<std::string> variableNames;
-        bsp::parse((char *)vlist.c_str(),
-                   (*bsp::space_p >>
-                    *(+(+bsp::graph_p)[bsp::push_back_a(variableNames)] >>
-                      +bsp::space_p)));
-
-        // Set up our grammar.
-        AnalyticExpression myGrammar(&m_constantsParser, variableNames);
-
-        // Do the actual parsing with boost::spirit and alert the user if there
-        // was an error with an exception.
-        ParsedTreeInfo parseInfo =
-            bsp::ast_parse<bsp::node_val_data_factory<NekDouble>,
-                           std::string::const_iterator, AnalyticExpression,
-                           bsp::space_parser>(expr.begin(), expr.end(),
-                                              myGrammar, bsp::space_p);
-
-        ASSERTL1(parseInfo.full != false,
-                 "Unable to fully parse function. Stopped just before: " +
-                     std::string(parseInfo.stop, parseInfo.stop + 15));
-
-        if (!parseInfo.full)
-        {
-            throw std::runtime_error(
-                "Unable to fully parse function at: " +
-                std::string(parseInfo.stop, parseInfo.stop + 15));
-        }
+        ParsedTreeInfo parseInfo = ParseFunction(vlist, expr, variableNames);
 
         // ----------------------------------------------
         // Data parsed, start setting up internal data structures.
@@ -453,10 +438,22 @@ public:
             variableMap[variableNames[i]] = i;
         }
 
+        // Find the subexpressions occurring more than once, which are
+        // evaluated once and kept in dedicated slots of the state placed
+        // after those used by the evaluation steps.
+        std::string key;
+        int nBinary = 0;
+        m_subexprKey.clear();
+        m_subexprCount.clear();
+        m_subexprSlotMap.clear();
+        AnalyseSubexpressions(parseInfo.trees.begin(), key, nBinary);
+        m_subexprSlot = 1 + nBinary;
+
         // Then prepare an execution stack. This method also calculates a
         // length of internal state storage (m_state_size) for this function.
         PrecomputedValue v = PrepareExecutionAsYouParse(parseInfo.trees.begin(),
                                                         stack, variableMap, 0);
+        m_state_size = (std::max)(m_state_size, m_subexprSlot);
 
         // Constant expression, fully evaluated already.
         if (true == v.first)
@@ -478,33 +475,60 @@ public:
         m_executionStack.push_back(stack);
         m_stackVariableMap.push_back(variableMap);
         m_state_sizes.push_back(m_state_size);
+        m_stackDefinition.push_back(std::make_pair(vlist, expr));
 
         return stackId;
     }
 
+    /**
+     * @copydoc Interpreter::SeparateFunction
+     */
+    bool SeparateFunction(const int id, const std::string &var, int &varId,
+                          int &restId)
+    {
+        ASSERTL1(m_executionStack.size() > id,
+                 "unknown analytic expression, it must first be defined "
+                 "with DefineFunction(...)");
+
+        auto key = std::make_pair(id, var);
+        auto it  = m_separatedFunctions.find(key);
+        if (it == m_separatedFunctions.end())
+        {
+            it = m_separatedFunctions
+                     .insert(std::make_pair(key, SplitFunction(id, var)))
+                     .first;
+        }
+
+        varId  = it->second.first;
+        restId = it->second.second;
+        return restId >= 0;
+    }
+
     /**
      * @copydoc Interpreter::Evaluate
      */
     NekDouble Evaluate(const int id)
     {
-        m_timer.Start();
+        Timer timer;
+        timer.Start();
 
         ASSERTL1(m_executionStack.size() > id,
                  "unknown analytic expression, it must first be defined "
                  "with DefineFunction(...)");
 
-        ExecutionStack &stack = m_executionStack[id];
+        ExecutionStack &stack  = m_executionStack[id];
+        EvaluationContext &ctx = GetContext();
 
-        m_state.resize(m_state_sizes[id]);
+        ctx.state.resize(m_state_sizes[id]);
         for (int i = 0; i < stack.size(); i++)
         {
-            (*stack[i]).run_once();
+            (*stack[i]).run_once(ctx);
         }
 
-        m_timer.Stop();
-        m_total_eval_time += m_timer.TimePerTest(1);
+        timer.Stop();
+        AddTime(timer.TimePerTest(1));
 
-        return m_state[0];
+        return ctx.state[0];
     }
 
     /**
@@ -513,40 +537,42 @@ public:
     NekDouble Evaluate(const int id, const NekDouble x, const NekDouble y,
                        const NekDouble z, const NekDouble t)
     {
-        m_timer.Start();
+        Timer timer;
+        timer.Start();
 
         ASSERTL1(m_executionStack.size() > id,
                  "unknown analytic expression, it must first be defined with "
                  "DefineFunction(...)");
 
-        ExecutionStack &stack = m_executionStack[id];
+        ExecutionStack &stack  = m_executionStack[id];
+        EvaluationContext &ctx = GetContext();
 
         // initialise internal vector of variable values
-        m_state.resize(m_state_sizes[id]);
+        ctx.state.resize(m_state_sizes[id]);
 
-        if (m_variable.size() < 4)
+        if (ctx.variable.size() < 4)
         {
-            m_variable.resize(4);
+            ctx.variable.resize(4);
         }
 
-        // no flexibility, no change of variable ordering in m_variable
+        // no flexibility, no change of variable ordering in the variable
         // container depending on their names ordering in the input vlist
         // argument of DefineFunction. Ordering convention (x,y,z,t) is assumed.
-        m_variable[0] = x;
-        m_variable[1] = y;
-        m_variable[2] = z;
-        m_variable[3] = t;
+        ctx.variable[0] = x;
+        ctx.variable[1] = y;
+        ctx.variable[2] = z;
+        ctx.variable[3] = t;
 
         // main execution cycle is hidden here
         for (int i = 0; i < stack.size(); i++)
         {
-            (*stack[i]).run_once();
+            (*stack[i]).run_once(ctx);
         }
 
-        m_timer.Stop();
-        m_total_eval_time += m_timer.TimePerTest(1);
+        timer.Stop();
+        AddTime(timer.TimePerTest(1));
 
-        return m_state[0];
+        return ctx.state[0];
     }
 
     /**
@@ -554,7 +580,8 @@ public:
      */
     NekDouble EvaluateAtPoint(const int id, const std::vector<NekDouble> point)
     {
-        m_timer.Start();
+        Timer timer;
+        timer.Start();
 
         ASSERTL1(m_executionStack.size() > id,
                  "unknown analytic expression, it must first be defined with "
@@ -562,31 +589,32 @@ public:
 
         ExecutionStack &stack    = m_executionStack[id];
         VariableMap &variableMap = m_stackVariableMap[id];
+        EvaluationContext &ctx   = GetContext();
 
         ASSERTL1(point.size() == variableMap.size(),
                  "The number of variables used to define this expression should"
                  " match the point dimensionality.");
 
         // initialise internal vector of variable values
-        m_state.resize(m_state_sizes[id]);
-        m_variable.resize(point.size());
+        ctx.state.resize(m_state_sizes[id]);
+        ctx.variable.resize(point.size());
         VariableMap::const_iterator it;
 
         for (it = variableMap.begin(); it != variableMap.end(); ++it)
         {
-            m_variable[it->second] = point[it->second];
+            ctx.variable[it->second] = point[it->second];
         }
 
         // main execution cycle is hidden here
         for (int i = 0; i < stack.size(); i++)
         {
-            (*stack[i]).run_once();
+            (*stack[i]).run_once(ctx);
         }
 
-        m_timer.Stop();
-        m_total_eval_time += m_timer.TimePerTest(1);
+        timer.Stop();
+        AddTime(timer.TimePerTest(1));
 
-        return m_state[0];
+        return ctx.state[0];
     }
 
     /**
@@ -598,11 +626,12 @@ public:
                   const Array<OneD, const NekDouble> &t,
                   Array<OneD, NekDouble> &result)
     {
-        m_timer.Start();
+        Timer timer;
+        timer.Start();
         std::vector<Array<OneD, const NekDouble>> points = {x, y, z, t};
         Evaluate(id, points, result);
-        m_timer.Stop();
-        m_total_eval_time += m_timer.TimePerTest(1);
+        timer.Stop();
+        AddTime(timer.TimePerTest(1));
     }
 
     /**
@@ -612,7 +641,8 @@ public:
                   const std::vector<Array<OneD, const NekDouble>> &points,
                   Array<OneD, NekDouble> &result)
     {
-        m_timer.Start();
+        Timer timer;
+        timer.Start();
 
         const int num_points = points[0].num_elements();
         ASSERTL1(m_executionStack.size() > id,
@@ -622,22 +652,23 @@ public:
                  "destination array must have enough capacity to store "
                  "expression values at each given point");
 
-        ExecutionStack &stack = m_executionStack[id];
+        ExecutionStack &stack  = m_executionStack[id];
+        EvaluationContext &ctx = GetContext();
 
         /// If number of points tends to 10^6, one may end up with up to ~0.5Gb
-        /// data allocated for m_state only.  Lets split the work into
+        /// data allocated for the state only.  Lets split the work into
         /// cache-sized chunks.  Ahtung, magic constant!
         const int max_chunk_size = 1024;
         const int nvals          = points.size();
         const int chunk_size     = (std::min)(max_chunk_size, num_points);
 
-        if (m_state.size() < chunk_size * m_state_sizes[id])
+        if (ctx.state.size() < chunk_size * m_state_sizes[id])
         {
-            m_state.resize(m_state_sizes[id] * chunk_size, 0.0);
+            ctx.state.resize(m_state_sizes[id] * chunk_size, 0.0);
         }
-        if (m_variable.size() < nvals * chunk_size)
+        if (ctx.variable.size() < nvals * chunk_size)
         {
-            m_variable.resize(nvals * chunk_size, 0.0);
+            ctx.variable.resize(nvals * chunk_size, 0.0);
         }
         if (result.num_elements() < num_points)
         {
@@ -649,32 +680,302 @@ public:
         while (work_left > 0)
         {
             const int this_chunk_size = (std::min)(work_left, 1024);
-            for (int i = 0; i < this_chunk_size; i++)
+            for (int j = 0; j < nvals; ++j)
             {
-                for (int j = 0; j < nvals; ++j)
+                const NekDouble *src = points[j].get() + offset;
+                NekDouble *dst = ctx.variable.data() + this_chunk_size * j;
+                for (int i = 0; i < this_chunk_size; i++)
                 {
-                    m_variable[i + this_chunk_size * j] = points[j][offset + i];
+                    dst[i] = src[i];
                 }
             }
             for (int i = 0; i < stack.size(); i++)
             {
-                (*stack[i]).run_many(this_chunk_size);
+                (*stack[i]).run_many(ctx, this_chunk_size);
             }
             for (int i = 0; i < this_chunk_size; i++)
             {
-                result[offset + i] = m_state[i];
+                result[offset + i] = ctx.state[i];
             }
             work_left -= this_chunk_size;
             offset += this_chunk_size;
         }
-        m_timer.Stop();
-        m_total_eval_time += m_timer.TimePerTest(1);
+        timer.Stop();
+        AddTime(timer.TimePerTest(1));
+    }
+
+    /**
+     * @brief Adds the duration of an evaluation to the total returned by
+     * GetTime.
+     */
+    void AddTime(const NekDouble time)
+    {
+        std::lock_guard<std::mutex> lock(m_timeMutex);
+        m_total_eval_time += time;
     }
 
     // ======================================================
     //  Private parsing and partial evaluation method
     // ======================================================
 
+    /**
+     * @brief Parses the expression of a function with boost::spirit.
+     *
+     * @param vlist          List of variable names separated with spaces.
+     * @param expr           Expression to parse, which must outlive the
+     *                       returned tree.
+     * @param variableNames  Set to the ordered variable names.
+     */
+    ParsedTreeInfo ParseFunction(const std::string &vlist,
+                                 const std::string &expr,
+                                 std::vector<std::string> &variableNames)
+    {
+        // Parse the vlist input and separate the variables into ordered entries
+        // in a vector<string> object. These need to be ordered because this is
+        // the order the variables will get assigned to in the Map when
+        // Evaluate(...)  is called.
+        bsp::parse((char *)vlist.c_str(),
+                   (*bsp::space_p >>
+                    *(+(+bsp::graph_p)[bsp::push_back_a(variableNames)] >>
+                      +bsp::space_p)));
+
+        // Set up our grammar.
+        AnalyticExpression myGrammar(&m_constantsParser, variableNames);
+
+        // Do the actual parsing with boost::spirit and alert the user if there
+        // was an error with an exception.
+        ParsedTreeInfo parseInfo =
+            bsp::ast_parse<bsp::node_val_data_factory<NekDouble>,
+                           std::string::const_iterator, AnalyticExpression,
+                           bsp::space_parser>(expr.begin(), expr.end(),
+                                              myGrammar, bsp::space_p);
+
+        ASSERTL1(parseInfo.full != false,
+                 "Unable to fully parse function. Stopped just before: " +
+                     std::string(parseInfo.stop, parseInfo.stop + 15));
+
+        if (!parseInfo.full)
+        {
+            throw std::runtime_error(
+                "Unable to fully parse function at: " +
+                std::string(parseInfo.stop, parseInfo.stop + 15));
+        }
+
+        return parseInfo;
+    }
+
+    /// A factor of a product and whether it divides the product.
+    typedef std::pair<ParsedTreeIterator, bool> Factor;
+
+    /**
+     * @brief Splits a function into a factor depending only on @p var and a
+     * factor independent of it, see SeparateFunction.
+     *
+     * @return The IDs of both factors, (-1, @p id) if the function does not
+     *         depend on @p var or (-1, -1) if it is not separable.
+     */
+    std::pair<int, int> SplitFunction(const int id, const std::string &var)
+    {
+        // Copies, since defining the factors extends m_stackDefinition.
+        const std::string vlist = m_stackDefinition[id].first;
+        const std::string expr  = m_stackDefinition[id].second;
+        if (expr.empty())
+        {
+            return std::make_pair(-1, -1);
+        }
+
+        std::vector<std::string> variableNames;
+        ParsedTreeInfo parseInfo = ParseFunction(vlist, expr, variableNames);
+
+        // Sort the factors of the product at the root of the tree by their
+        // dependence on var.
+        std::vector<Factor> factors, varFactors, restFactors;
+        bool negate = false;
+        FlattenProduct(parseInfo.trees.begin(), false, factors, negate);
+
+        for (auto &factor : factors)
+        {
+            std::set<std::string> dependencies;
+            GetDependencies(factor.first, dependencies);
+
+            if (dependencies.count("awgn()") ||
+                (dependencies.count(var) && dependencies.size() > 1))
+            {
+                return std::make_pair(-1, -1);
+            }
+
+            if (dependencies.count(var))
+            {
+                varFactors.push_back(factor);
+            }
+            else
+            {
+                restFactors.push_back(factor);
+            }
+        }
+
+        if (varFactors.size() == 0)
+        {
+            return std::make_pair(-1, id);
+        }
+
+        VariableMap variableMap;
+        for (int i = 0; i < variableNames.size(); i++)
+        {
+            variableMap[variableNames[i]] = i;
+        }
+
+        int varId  = DefineProduct(varFactors, false, variableMap);
+        int restId = DefineProduct(restFactors, negate, variableMap);
+        return std::make_pair(varId, restId);
+    }
+
+    /**
+     * @brief Collects the factors of the products and quotients at the root
+     * of a parsed tree, a negation being recorded in @p negate.
+     */
+    void FlattenProduct(const ParsedTreeIterator &location, const bool divide,
+                        std::vector<Factor> &factors, bool &negate)
+    {
+        std::string valueStr(location->value.begin(), location->value.end());
+        boost::algorithm::trim(valueStr);
+
+        const bsp::parser_id parserID = location->value.id();
+
+        if (parserID == AnalyticExpression::operatorID &&
+            location->children.size() == 2 &&
+            (valueStr == "*" || valueStr == "/"))
+        {
+            FlattenProduct(location->children.begin(), divide, factors,
+                           negate);
+            FlattenProduct(location->children.begin() + 1,
+                           valueStr == "/" ? !divide : divide, factors, negate);
+        }
+        else if (parserID == AnalyticExpression::unaryID)
+        {
+            negate = !negate;
+            FlattenProduct(location->children.begin(), divide, factors,
+                           negate);
+        }
+        else
+        {
+            factors.push_back(std::make_pair(location, divide));
+        }
+    }
+
+    /**
+     * @brief Collects the variables a parsed tree depends on, a call to awgn
+     * being recorded as `awgn()`.
+     */
+    void GetDependencies(const ParsedTreeIterator &location,
+                         std::set<std::string> &dependencies)
+    {
+        std::string valueStr(location->value.begin(), location->value.end());
+        boost::algorithm::trim(valueStr);
+
+        const bsp::parser_id parserID = location->value.id();
+
+        if (parserID == AnalyticExpression::variableID)
+        {
+            dependencies.insert(valueStr);
+        }
+        else if (parserID == AnalyticExpression::functionID &&
+                 valueStr == "awgn")
+        {
+            dependencies.insert("awgn()");
+        }
+
+        for (int i = 0; i < location->children.size(); ++i)
+        {
+            GetDependencies(location->children.begin() + i, dependencies);
+        }
+    }
+
+    /**
+     * @brief Defines a function as the product of the factors of a parsed
+     * tree.
+     *
+     * The product is accumulated at index 0 of the state, each subsequent
+     * factor being evaluated at index 1. Constant factors are folded into a
+     * single scaling.
+     *
+     * @return The ID of the new function.
+     */
+    int DefineProduct(const std::vector<Factor> &factors, const bool negate,
+                      VariableMap &variableMap)
+    {
+        ExecutionStack stack;
+
+        int stackId  = m_executionStack.size();
+        m_state_size = 2;
+
+        std::string key;
+        int nBinary = 0;
+        m_subexprKey.clear();
+        m_subexprCount.clear();
+        m_subexprSlotMap.clear();
+        for (auto &factor : factors)
+        {
+            AnalyseSubexpressions(factor.first, key, nBinary);
+        }
+        m_subexprSlot = 2 + nBinary;
+
+        NekDouble scale = negate ? -1.0 : 1.0;
+        bool first      = true;
+        for (auto &factor : factors)
+        {
+            PrecomputedValue v = PrepareExecutionAsYouParse(
+                factor.first, stack, variableMap, first ? 0 : 1);
+
+            if (true == v.first)
+            {
+                scale = factor.second ? scale / v.second : scale * v.second;
+            }
+            else if (first)
+            {
+                if (factor.second)
+                {
+                    int const_index =
+                        AddConstant(std::string("SUB_EXPR_") +
+                                        std::to_string(m_constant.size()),
+                                    1.0);
+                    stack.push_back(makeStep<StoreConst>(1, const_index));
+                    stack.push_back(makeStep<EvalDiv>(0, 1, 0));
+                }
+                first = false;
+            }
+            else if (factor.second)
+            {
+                stack.push_back(makeStep<EvalDiv>(0, 0, 1));
+            }
+            else
+            {
+                stack.push_back(makeStep<EvalMul>(0, 0, 1));
+            }
+        }
+
+        if (first || scale != 1.0)
+        {
+            int const_index = AddConstant(
+                std::string("SUB_EXPR_") + std::to_string(m_constant.size()),
+                scale);
+            stack.push_back(makeStep<StoreConst>(first ? 0 : 1, const_index));
+            if (!first)
+            {
+                stack.push_back(makeStep<EvalMul>(0, 0, 1));
+            }
+        }
+        m_state_size = (std::max)(m_state_size, m_subexprSlot);
+
+        m_executionStack.push_back(stack);
+        m_stackVariableMap.push_back(variableMap);
+        m_state_sizes.push_back(m_state_size);
+        m_stackDefinition.push_back(std::make_pair("", ""));
+
+        return stackId;
+    }
+
+
     /**
      * @brief Prepares an execution stack for the evaluation of a function.
      *
@@ -711,6 +1012,203 @@ public:
     LIB_UTILITIES_EXPORT PrecomputedValue PrepareExecutionAsYouParse(
         const ParsedTreeIterator &location, ExecutionStack &stack,
         VariableMap &variableMap, int stateIndex)
+    {
+        auto keyIt = m_subexprKey.find(&*location);
+        if (keyIt == m_subexprKey.end() || m_subexprCount[keyIt->second] < 2)
+        {
+            return PrepareNode(location, stack, variableMap, stateIndex);
+        }
+
+        // A repeated subexpression is copied from its slot if it has already
+        // been evaluated, otherwise its value is kept for later uses.
+        auto slotIt = m_subexprSlotMap.find(keyIt->second);
+        if (slotIt != m_subexprSlotMap.end())
+        {
+            stack.push_back(makeStep<CopyState>(stateIndex, slotIt->second));
+            return std::make_pair(false, 0);
+        }
+
+        PrecomputedValue v =
+            PrepareNode(location, stack, variableMap, stateIndex);
+        m_subexprSlotMap[keyIt->second] = m_subexprSlot;
+        stack.push_back(makeStep<CopyState>(m_subexprSlot++, stateIndex));
+        return v;
+    }
+
+    /**
+     * @brief Computes the canonical form of the nodes of a parsed tree and
+     * counts the occurrences of each one, so that PrepareExecutionAsYouParse
+     * evaluates repeated subexpressions only once.
+     *
+     * Only the non-constant operators and functions are recorded, constant
+     * subtrees being folded anyway. Subtrees calling the awgn function are
+     * left out since each call draws new values.
+     *
+     * @param location  Iterator generated by boost::spirit.
+     * @param key       Canonical form of the subtree.
+     * @param nBinary   Incremented by the number of binary operators and
+     *                  functions of the subtree.
+     *
+     * @return Whether the subtree depends on variables or parameters.
+     */
+    bool AnalyseSubexpressions(const ParsedTreeIterator &location,
+                               std::string &key, int &nBinary)
+    {
+        std::string valueStr(location->value.begin(), location->value.end());
+        boost::algorithm::trim(valueStr);
+
+        const bsp::parser_id parserID = location->value.id();
+
+        if (parserID == AnalyticExpression::constantID ||
+            parserID == AnalyticExpression::numberID)
+        {
+            key = valueStr;
+            return false;
+        }
+        else if (parserID == AnalyticExpression::variableID)
+        {
+            key = "$v" + valueStr;
+            return true;
+        }
+        else if (parserID == AnalyticExpression::parameterID)
+        {
+            key = "$p" + valueStr;
+            return true;
+        }
+
+        bool varying = false;
+        std::vector<std::string> keys(location->children.size());
+        for (int i = 0; i < keys.size(); ++i)
+        {
+            varying |= AnalyseSubexpressions(location->children.begin() + i,
+                                             keys[i], nBinary);
+        }
+        if (keys.size() == 2)
+        {
+            ++nBinary;
+        }
+
+        if (parserID == AnalyticExpression::functionID)
+        {
+            key = valueStr + "(" + keys[0];
+            for (int i = 1; i < keys.size(); ++i)
+            {
+                key += "," + keys[i];
+            }
+            key += ")";
+
+            if (valueStr == "awgn")
+            {
+                key += "#" + std::to_string(m_subexprKey.size());
+                return true;
+            }
+        }
+        else if (parserID == AnalyticExpression::unaryID)
+        {
+            key = "-(" + keys[0] + ")";
+            return varying;
+        }
+        else
+        {
+            // sums and products are commutative
+            if (valueStr == "+" || valueStr == "*")
+            {
+                std::sort(keys.begin(), keys.end());
+            }
+            key = "(" + keys[0] + valueStr + keys[1] + ")";
+        }
+
+        if (varying && key.find("awgn(") == std::string::npos)
+        {
+            m_subexprKey[&*location] = key;
+            m_subexprCount[key]++;
+        }
+        return varying;
+    }
+
+    /**
+     * @brief Returns whether a node is a non-constant product which is not
+     * a repeated subexpression, and may then be fused with an addition.
+     */
+    bool IsFusableProduct(const ParsedTreeIterator &location)
+    {
+        if (location->value.id() != AnalyticExpression::operatorID ||
+            location->children.size() != 2)
+        {
+            return false;
+        }
+
+        std::string valueStr(location->value.begin(), location->value.end());
+        boost::algorithm::trim(valueStr);
+
+        auto keyIt = m_subexprKey.find(&*location);
+        return valueStr == "*" && keyIt != m_subexprKey.end() &&
+               m_subexprCount[keyIt->second] < 2;
+    }
+
+    /**
+     * @brief Prepares the evaluation of a sum or difference of which the
+     * operand @p side is a product, as a single fused step.
+     *
+     * The other operand is stored at @p stateIndex and the factors of the
+     * product in the two following slots.
+     */
+    PrecomputedValue PrepareMulAdd(const ParsedTreeIterator &location,
+                                   const int side, ExecutionStack &stack,
+                                   VariableMap &variableMap, int stateIndex)
+    {
+        const ParsedTreeIterator prod  = location->children.begin() + side;
+        const ParsedTreeIterator other = location->children.begin() + 1 - side;
+
+        PrecomputedValue v[3] = {
+            PrepareExecutionAsYouParse(other, stack, variableMap, stateIndex),
+            PrepareExecutionAsYouParse(prod->children.begin(), stack,
+                                       variableMap, stateIndex + 1),
+            PrepareExecutionAsYouParse(prod->children.begin() + 1, stack,
+                                       variableMap, stateIndex + 2)};
+        m_state_size += 2;
+
+        for (int i = 0; i < 3; ++i)
+        {
+            if (true == v[i].first)
+            {
+                int const_index =
+                    AddConstant(std::string("SUB_EXPR_") +
+                                    std::to_string(m_constant.size()),
+                                v[i].second);
+                stack.push_back(
+                    makeStep<StoreConst>(stateIndex + i, const_index));
+            }
+        }
+
+        std::string valueStr(location->value.begin(), location->value.end());
+        boost::algorithm::trim(valueStr);
+
+        if (valueStr == "+")
+        {
+            stack.push_back(makeStep<EvalMulAdd>(stateIndex, stateIndex + 1,
+                                                 stateIndex + 2));
+        }
+        else if (side == 0)
+        {
+            stack.push_back(makeStep<EvalMulSub>(stateIndex, stateIndex + 1,
+                                                 stateIndex + 2));
+        }
+        else
+        {
+            stack.push_back(makeStep<EvalNegMulAdd>(
+                stateIndex, stateIndex + 1, stateIndex + 2));
+        }
+        return std::make_pair(false, 0);
+    }
+
+    /**
+     * @brief Prepares the execution steps of a single node of the parsed
+     * tree, see PrepareExecutionAsYouParse.
+     */
+    PrecomputedValue PrepareNode(const ParsedTreeIterator &location,
+                                 ExecutionStack &stack,
+                                 VariableMap &variableMap, int stateIndex)
     {
         std::string valueStr(location->value.begin(), location->value.end());
         boost::algorithm::trim(valueStr);
@@ -923,6 +1421,21 @@ public:
                 num_children == 2,
                 "Too few or too many arguments for mathematical operator: " +
                     valueStr);
+
+            // a*b + c, c + a*b, a*b - c and c - a*b are evaluated by a single
+            // step rather than two.
+            if (*valueStr.begin() == '+' || *valueStr.begin() == '-')
+            {
+                for (int side = 0; side < 2; ++side)
+                {
+                    if (IsFusableProduct(location->children.begin() + side))
+                    {
+                        return PrepareMulAdd(location, side, stack,
+                                             variableMap, stateIndex);
+                    }
+                }
+            }
+
             PrecomputedValue left = PrepareExecutionAsYouParse(
                 location->children.begin() + 0, stack, variableMap, stateIndex);
             PrecomputedValue right =
@@ -980,6 +1493,35 @@ public:
                 return std::make_pair(false, 0);
             }
 
+            // small integer powers are expanded into products
+            if (*valueStr.begin() == '^' && true == right.first &&
+                right.second == std::floor(right.second) &&
+                right.second != 0.0 && std::abs(right.second) <= 4.0)
+            {
+                stack.push_back(makeStep<EvalIntPow>(
+                    stateIndex, stateIndex, static_cast<int>(right.second)));
+                return std::make_pair(false, 0);
+            }
+
+            // multiplications and divisions by one, additions and
+            // subtractions of zero are skipped
+            if (true == right.first &&
+                ((right.second == 1.0 &&
+                  (*valueStr.begin() == '*' || *valueStr.begin() == '/')) ||
+                 (right.second == 0.0 &&
+                  (*valueStr.begin() == '+' || *valueStr.begin() == '-'))))
+            {
+                return std::make_pair(false, 0);
+            }
+            if (true == left.first &&
+                ((left.second == 1.0 && *valueStr.begin() == '*') ||
+                 (left.second == 0.0 && *valueStr.begin() == '+')))
+            {
+                stack.push_back(
+                    makeStep<CopyState>(stateIndex, stateIndex + 1));
+                return std::make_pair(false, 0);
+            }
+
             // either operator argument is not fully evaluated
             // add pre-evaluated value to the contaner of constants
             if (true == left.first)
@@ -1267,22 +1809,55 @@ private:
 
     std::vector<NekDouble> m_parameter;
     std::vector<NekDouble> m_constant;
+
+    ///  Incremented each time the value of a parameter changes.
+    int m_parameterRevision;
     std::vector<NekDouble> m_variable;
 
-    ///  This vector stores the execution state (memory) used by the
-    ///  sequential execution process.
-    std::vector<NekDouble> m_state;
+    ///  The execution state (memory) used by the sequential execution
+    ///  process and the values of the variables are held by an
+    ///  EvaluationContext, one per thread, so that a function may be
+    ///  evaluated concurrently once it has been defined.
+    struct EvaluationContext
+    {
+        std::vector<NekDouble> state;
+        std::vector<NekDouble> variable;
+    };
+
+    ///  Returns the evaluation context of the calling thread.
+    static EvaluationContext &GetContext()
+    {
+        static thread_local EvaluationContext context;
+        return context;
+    }
 
     ///  Vector of state sizes per each
     std::vector<int> m_state_sizes;
 
+    ///  Variable list and expression of each function, empty for the
+    ///  factors defined by SeparateFunction, and the factors of the
+    ///  functions already separated, keyed by function and variable.
+    std::vector<std::pair<std::string, std::string>> m_stackDefinition;
+    std::map<std::pair<int, std::string>, std::pair<int, int>>
+        m_separatedFunctions;
+
     ///  This counter is used by PrepareExecutionAsYouParse for finding
     ///  the minimal state size necessary for evaluation of function parsed.
     int m_state_size;
 
-    ///  Timer and sum of evaluation times
-    Timer m_timer;
+    ///  The following are used by PrepareExecutionAsYouParse to evaluate
+    ///  repeated subexpressions only once: the canonical form of the
+    ///  non-constant nodes of the expression being parsed, the number of
+    ///  occurences of each form and the state slot holding the value of
+    ///  those already evaluated, starting from m_subexprSlot.
+    std::map<const void *, std::string> m_subexprKey;
+    std::map<std::string, int> m_subexprCount;
+    std::map<std::string, int> m_subexprSlotMap;
+    int m_subexprSlot;
+
+    ///  Sum of evaluation times
     NekDouble m_total_eval_time;
+    mutable std::mutex m_timeMutex;
 
     boost::mt19937 m_generator;
 
@@ -1304,13 +1879,14 @@ private:
     typedef const std::vector<NekDouble> &cvr;
     typedef const int ci;
     typedef boost::mt19937 &rgt;
+    typedef EvaluationContext &ctx_t;
 
     ///  Factory method which makes code little less messy
     template <typename StepType>
     EvaluationStep *makeStep(ci dest, ci src_left = 0, ci src_right = 0)
     {
-        return (new StepType(m_generator, m_state, m_constant, m_parameter,
-                             m_variable, dest, src_left, src_right));
+        return (new StepType(m_generator, m_constant, m_parameter, dest,
+                             src_left, src_right));
     }
 
     enum EvaluationStepType
@@ -1347,11 +1923,11 @@ private:
         ///  reference to random number generator
         rgt rng;
 
-        ///  references to arrays holding the common state
-        vr state;
+        ///  references to arrays holding the constants and parameters; the
+        ///  state and the variables are held by the EvaluationContext passed
+        ///  to each call, so that several threads may evaluate concurrently
         cvr consts;
         cvr params;
-        cvr vars;
 
         ///  indices in the above arrays uniquely defining actual command
         ///  arguments
@@ -1359,9 +1935,9 @@ private:
         ci argIdx1;
         ci argIdx2;
 
-        EvaluationStep(rgt rn, ci i, ci l, ci r, vr s, cvr c, cvr p, cvr v)
-            : rng(rn), state(s), consts(c), params(p), vars(v), storeIdx(i),
-              argIdx1(l), argIdx2(r){};
+        EvaluationStep(rgt rn, ci i, ci l, ci r, cvr c, cvr p)
+            : rng(rn), consts(c), params(p), storeIdx(i), argIdx1(l),
+              argIdx2(r){};
 
         virtual ~EvaluationStep()
         {
@@ -1369,625 +1945,825 @@ private:
 
         ///  declaring this guy pure virtual shortens virtual table. It saves
         ///  some execution time.
-        virtual void run_many(ci n) = 0;
-        virtual void run_once()     = 0;
+        virtual void run_many(ctx_t ctx, ci n) = 0;
+        virtual void run_once(ctx_t ctx)       = 0;
     };
     struct CopyState : public EvaluationStep
     {
-        CopyState(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        CopyState(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
-                state[storeIdx * n + i] = state[argIdx1];
+                state[storeIdx * n + i] = state[argIdx1 * n + i];
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = state[argIdx1];
         }
     };
     struct StoreConst : public EvaluationStep
     {
-        StoreConst(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        StoreConst(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state    = ctx.state.data();
+            const NekDouble val = consts[argIdx1];
             for (int i = 0; i < n; i++)
-                state[storeIdx * n + i] = consts[argIdx1];
+                state[storeIdx * n + i] = val;
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = consts[argIdx1];
         }
     };
     struct StoreVar : public EvaluationStep
     {
-        StoreVar(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        StoreVar(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state      = ctx.state.data();
+            const NekDouble *vars = ctx.variable.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] = vars[argIdx1 * n + i];
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
-            state[storeIdx] = vars[argIdx1];
+            NekDouble *state = ctx.state.data();
+            state[storeIdx] = ctx.variable[argIdx1];
         }
     };
     struct StorePrm : public EvaluationStep
     {
-        StorePrm(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        StorePrm(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state    = ctx.state.data();
+            const NekDouble val = params[argIdx1];
             for (int i = 0; i < n; i++)
-                state[storeIdx * n + i] = params[argIdx1];
+                state[storeIdx * n + i] = val;
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = params[argIdx1];
         }
     };
     struct EvalSum : public EvaluationStep
     {
-        EvalSum(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalSum(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] =
                     state[argIdx1 * n + i] + state[argIdx2 * n + i];
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = state[argIdx1] + state[argIdx2];
         }
     };
     struct EvalSub : public EvaluationStep
     {
-        EvalSub(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalSub(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] =
                     state[argIdx1 * n + i] - state[argIdx2 * n + i];
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = state[argIdx1] - state[argIdx2];
         }
     };
     struct EvalMul : public EvaluationStep
     {
-        EvalMul(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalMul(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] =
                     state[argIdx1 * n + i] * state[argIdx2 * n + i];
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = state[argIdx1] * state[argIdx2];
         }
     };
     struct EvalDiv : public EvaluationStep
     {
-        EvalDiv(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalDiv(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] =
                     state[argIdx1 * n + i] / state[argIdx2 * n + i];
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = state[argIdx1] / state[argIdx2];
         }
     };
     struct EvalPow : public EvaluationStep
     {
-        EvalPow(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalPow(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] =
                     std::pow(state[argIdx1 * n + i], state[argIdx2 * n + i]);
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = std::pow(state[argIdx1], state[argIdx2]);
         }
     };
+    ///  x^k for a small non-zero integer k, stored in place of argIdx2
+    struct EvalIntPow : public EvaluationStep
+    {
+        EvalIntPow(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
+        {
+        }
+        virtual void run_many(ctx_t ctx, ci n)
+        {
+            NekDouble *res       = ctx.state.data() + storeIdx * n;
+            const NekDouble *arg = ctx.state.data() + argIdx1 * n;
+            switch (std::abs(argIdx2))
+            {
+                case 1:
+                    for (int i = 0; i < n; i++)
+                        res[i] = arg[i];
+                    break;
+                case 2:
+                    for (int i = 0; i < n; i++)
+                        res[i] = arg[i] * arg[i];
+                    break;
+                case 3:
+                    for (int i = 0; i < n; i++)
+                        res[i] = arg[i] * arg[i] * arg[i];
+                    break;
+                default:
+                    for (int i = 0; i < n; i++)
+                    {
+                        NekDouble sq = arg[i] * arg[i];
+                        res[i]       = sq * sq;
+                    }
+                    break;
+            }
+            if (argIdx2 < 0)
+            {
+                for (int i = 0; i < n; i++)
+                    res[i] = 1.0 / res[i];
+            }
+        }
+        virtual void run_once(ctx_t ctx)
+        {
+            NekDouble *state = ctx.state.data();
+            NekDouble x      = state[argIdx1];
+            NekDouble res    = x;
+            for (int k = 1; k < std::abs(argIdx2); k++)
+                res *= x;
+            state[storeIdx] = argIdx2 < 0 ? 1.0 / res : res;
+        }
+    };
+    ///  fused a*b + c, where c is read from storeIdx
+    struct EvalMulAdd : public EvaluationStep
+    {
+        EvalMulAdd(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
+        {
+        }
+        virtual void run_many(ctx_t ctx, ci n)
+        {
+            NekDouble *state = ctx.state.data();
+            for (int i = 0; i < n; i++)
+                state[storeIdx * n + i] =
+                    state[argIdx1 * n + i] * state[argIdx2 * n + i] +
+                    state[storeIdx * n + i];
+        }
+        virtual void run_once(ctx_t ctx)
+        {
+            NekDouble *state = ctx.state.data();
+            state[storeIdx] =
+                state[argIdx1] * state[argIdx2] + state[storeIdx];
+        }
+    };
+    ///  fused a*b - c, where c is read from storeIdx
+    struct EvalMulSub : public EvaluationStep
+    {
+        EvalMulSub(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
+        {
+        }
+        virtual void run_many(ctx_t ctx, ci n)
+        {
+            NekDouble *state = ctx.state.data();
+            for (int i = 0; i < n; i++)
+                state[storeIdx * n + i] =
+                    state[argIdx1 * n + i] * state[argIdx2 * n + i] -
+                    state[storeIdx * n + i];
+        }
+        virtual void run_once(ctx_t ctx)
+        {
+            NekDouble *state = ctx.state.data();
+            state[storeIdx] =
+                state[argIdx1] * state[argIdx2] - state[storeIdx];
+        }
+    };
+    ///  fused c - a*b, where c is read from storeIdx
+    struct EvalNegMulAdd : public EvaluationStep
+    {
+        EvalNegMulAdd(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
+        {
+        }
+        virtual void run_many(ctx_t ctx, ci n)
+        {
+            NekDouble *state = ctx.state.data();
+            for (int i = 0; i < n; i++)
+                state[storeIdx * n + i] =
+                    state[storeIdx * n + i] -
+                    state[argIdx1 * n + i] * state[argIdx2 * n + i];
+        }
+        virtual void run_once(ctx_t ctx)
+        {
+            NekDouble *state = ctx.state.data();
+            state[storeIdx] =
+                state[storeIdx] - state[argIdx1] * state[argIdx2];
+        }
+    };
     struct EvalNeg : public EvaluationStep
     {
-        EvalNeg(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalNeg(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] = -state[argIdx1 * n + i];
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = -state[argIdx1];
         }
     };
     struct EvalLogicalEqual : public EvaluationStep
     {
-        EvalLogicalEqual(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalLogicalEqual(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] =
                     (state[argIdx1 * n + i] == state[argIdx2 * n + i]);
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = (state[argIdx1] == state[argIdx2]);
         }
     };
     struct EvalLogicalLeq : public EvaluationStep
     {
-        EvalLogicalLeq(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalLogicalLeq(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] =
                     (state[argIdx1 * n + i] <= state[argIdx2 * n + i]);
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = (state[argIdx1] <= state[argIdx2]);
         }
     };
     struct EvalLogicalLess : public EvaluationStep
     {
-        EvalLogicalLess(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalLogicalLess(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] =
                     (state[argIdx1 * n + i] < state[argIdx2 * n + i]);
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = (state[argIdx1] < state[argIdx2]);
         }
     };
     struct EvalLogicalGeq : public EvaluationStep
     {
-        EvalLogicalGeq(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalLogicalGeq(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] =
                     (state[argIdx1 * n + i] >= state[argIdx2 * n + i]);
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = (state[argIdx1] >= state[argIdx2]);
         }
     };
     struct EvalLogicalGreater : public EvaluationStep
     {
-        EvalLogicalGreater(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalLogicalGreater(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] =
                     (state[argIdx1 * n + i] > state[argIdx2 * n + i]);
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = (state[argIdx1] > state[argIdx2]);
         }
     };
     struct EvalAbs : public EvaluationStep
     {
-        EvalAbs(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalAbs(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] = std::abs(state[argIdx1 * n + i]);
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = std::abs(state[argIdx1]);
         }
     };
     struct EvalSign : public EvaluationStep
     {
-        EvalSign(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalSign(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] = ((state[argIdx1 * n + i] > 0.0) -
                                            (state[argIdx1 * n + i] < 0.0));
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = ((state[argIdx1] > 0.0) - (state[argIdx1] < 0.0));
         }
     };
     struct EvalAsin : public EvaluationStep
     {
-        EvalAsin(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalAsin(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] = std::asin(state[argIdx1 * n + i]);
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = std::asin(state[argIdx1]);
         }
     };
     struct EvalAcos : public EvaluationStep
     {
-        EvalAcos(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalAcos(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] = std::acos(state[argIdx1 * n + i]);
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = std::acos(state[argIdx1]);
         }
     };
     struct EvalAtan : public EvaluationStep
     {
-        EvalAtan(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalAtan(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] = std::atan(state[argIdx1 * n + i]);
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = std::atan(state[argIdx1]);
         }
     };
     struct EvalAtan2 : public EvaluationStep
     {
-        EvalAtan2(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalAtan2(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] =
                     std::atan2(state[argIdx1 * n + i], state[argIdx2 * n + i]);
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = std::atan2(state[argIdx1], state[argIdx2]);
         }
     };
     struct EvalAng : public EvaluationStep
     {
-        EvalAng(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalAng(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] =
                     ang(state[argIdx1 * n + i], state[argIdx2 * n + i]);
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = ang(state[argIdx1], state[argIdx2]);
         }
     };
     struct EvalBessel : public EvaluationStep
     {
-        EvalBessel(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalBessel(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] = boost::math::cyl_bessel_j(
                     state[argIdx1 * n + i], state[argIdx2 * n + i]);
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] =
                 boost::math::cyl_bessel_j(state[argIdx1], state[argIdx2]);
         }
     };
     struct EvalCeil : public EvaluationStep
     {
-        EvalCeil(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalCeil(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] = std::ceil(state[argIdx1 * n + i]);
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = std::ceil(state[argIdx1]);
         }
     };
     struct EvalCos : public EvaluationStep
     {
-        EvalCos(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalCos(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] = std::cos(state[argIdx1 * n + i]);
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = std::cos(state[argIdx1]);
         }
     };
     struct EvalCosh : public EvaluationStep
     {
-        EvalCosh(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalCosh(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] = std::cosh(state[argIdx1 * n + i]);
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = std::cosh(state[argIdx1]);
         }
     };
     struct EvalExp : public EvaluationStep
     {
-        EvalExp(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalExp(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] = std::exp(state[argIdx1 * n + i]);
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = std::exp(state[argIdx1]);
         }
     };
     struct EvalFabs : public EvaluationStep
     {
-        EvalFabs(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalFabs(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] = std::fabs(state[argIdx1 * n + i]);
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = std::fabs(state[argIdx1]);
         }
     };
     struct EvalFloor : public EvaluationStep
     {
-        EvalFloor(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalFloor(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] = std::floor(state[argIdx1 * n + i]);
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = std::floor(state[argIdx1]);
         }
     };
     struct EvalLog : public EvaluationStep
     {
-        EvalLog(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalLog(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] = std::log(state[argIdx1 * n + i]);
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = std::log(state[argIdx1]);
         }
     };
     struct EvalLog10 : public EvaluationStep
     {
-        EvalLog10(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalLog10(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] = std::log10(state[argIdx1 * n + i]);
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = std::log10(state[argIdx1]);
         }
     };
     struct EvalRad : public EvaluationStep
     {
-        EvalRad(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalRad(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] =
                     rad(state[argIdx1 * n + i], state[argIdx2 * n + i]);
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = rad(state[argIdx1], state[argIdx2]);
         }
     };
     struct EvalSin : public EvaluationStep
     {
-        EvalSin(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalSin(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] = std::sin(state[argIdx1 * n + i]);
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = std::sin(state[argIdx1]);
         }
     };
     struct EvalSinh : public EvaluationStep
     {
-        EvalSinh(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalSinh(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] = std::sinh(state[argIdx1 * n + i]);
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = std::sinh(state[argIdx1]);
         }
     };
     struct EvalSqrt : public EvaluationStep
     {
-        EvalSqrt(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalSqrt(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] = std::sqrt(state[argIdx1 * n + i]);
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = std::sqrt(state[argIdx1]);
         }
     };
     struct EvalTan : public EvaluationStep
     {
-        EvalTan(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalTan(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] = std::tan(state[argIdx1 * n + i]);
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = std::tan(state[argIdx1]);
         }
     };
     struct EvalTanh : public EvaluationStep
     {
-        EvalTanh(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalTanh(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
         {
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
             for (int i = 0; i < n; i++)
                 state[storeIdx * n + i] = std::tanh(state[argIdx1 * n + i]);
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
             state[storeIdx] = std::tanh(state[argIdx1]);
         }
     };
     struct EvalAWGN : public EvaluationStep
     {
-        EvalAWGN(rgt rn, vr s, cvr c, cvr p, cvr v, ci i, ci l, ci r)
-            : EvaluationStep(rn, i, l, r, s, c, p, v)
+        EvalAWGN(rgt rn, cvr c, cvr p, ci i, ci l, ci r)
+            : EvaluationStep(rn, i, l, r, c, p)
+        {
+        }
+        ///  the generator is shared by all the evaluating threads
+        static std::mutex &RngMutex()
         {
+            static std::mutex rngMutex;
+            return rngMutex;
         }
-        virtual void run_many(ci n)
+        virtual void run_many(ctx_t ctx, ci n)
         {
+            NekDouble *state = ctx.state.data();
+            std::lock_guard<std::mutex> lock(RngMutex());
             // assuming the argument to AWGN does not depend on spatial
             // variables =>
             boost::variate_generator<boost::mt19937 &,
@@ -1999,8 +2775,10 @@ private:
                 state[storeIdx * n + i] = _normal();
             }
         }
-        virtual void run_once()
+        virtual void run_once(ctx_t ctx)
         {
+            NekDouble *state = ctx.state.data();
+            std::lock_guard<std::mutex> lock(RngMutex());
             boost::variate_generator<boost::mt19937 &,
                                      boost::normal_distribution<>>
                 _normal(rng, boost::normal_distribution<>(0, state[storeIdx]));
@@ -2064,6 +2842,11 @@ NekDouble Interpreter::GetParameter(std::string const &name)
     return m_impl->GetParameter(name);
 }
 
+int Interpreter::GetParameterRevision() const
+{
+    return m_impl->GetParameterRevision();
+}
+
 NekDouble Interpreter::GetTime() const
 {
     return m_impl->GetTime();
@@ -2075,6 +2858,12 @@ int Interpreter::DefineFunction(const std::string &vlist,
     return m_impl->DefineFunction(vlist, function);
 }
 
+bool Interpreter::SeparateFunction(const int id, const std::string &var,
+                                   int &varId, int &restId)
+{
+    return m_impl->SeparateFunction(id, var, varId, restId);
+}
+
 NekDouble Interpreter::Evaluate(const int AnalyticExpression_id)
 {
     return m_impl->Evaluate(AnalyticExpression_id);
@@ -70,6 +70,13 @@ namespace LibUtilities
  * - support for either single-value or multiple-value variables, in order to
  *   e.g. support the evaluation of spatially-variable expressions.
  *
+ * When a function is defined, constant subexpressions are folded, repeated
+ * subexpressions are evaluated only once, and products followed by a sum or a
+ * difference, as well as small integer powers, are evaluated by single
+ * steps. Defined functions may be evaluated concurrently from several
+ * threads, each using its own evaluation state. Functions and parameters
+ * should however not be defined or changed while evaluating.
+ *
  * Note that this class exposes the interface of the Interpreter class only in
  * order to reduce compile-time includes. The implementation itself can be found
  * in Interpreter::ExpressionEvaluator.
@@ -192,6 +199,15 @@ public:
      */
     LIB_UTILITIES_EXPORT NekDouble GetParameter(std::string const& name);
 
+    /**
+     * @brief Returns a counter which is incremented each time the value of a
+     * parameter changes.
+     *
+     * This allows callers keeping values of functions which depend on
+     * parameters to detect when these values need to be recomputed.
+     */
+    LIB_UTILITIES_EXPORT int GetParameterRevision() const;
+
     /**
      * @brief Returns the total walltime spent in evaluation procedures in
      * seconds.
@@ -221,6 +237,30 @@ public:
     LIB_UTILITIES_EXPORT int DefineFunction(
         const std::string& vlist, const std::string& expr);
 
+    /**
+     * @brief Splits a function into the product of a factor depending only
+     * on the variable @p var and a factor independent of it.
+     *
+     * The function is separable if it is a product or quotient of terms
+     * (possibly negated) each of which either depends on @p var and no other
+     * variable, or does not depend on @p var, e.g. `sin(x)*cos(y)*exp(-t)`
+     * with respect to `t`. Both factors are defined as new functions of the
+     * same variables as @p id, so that, for instance, a function of time
+     * times a function of space only needs the spatial factor to be
+     * evaluated once at the quadrature points. Functions calling `awgn` are
+     * never separable.
+     *
+     * @param id      The ID returned from #DefineFunction.
+     * @param var     Name of the variable to separate.
+     * @param varId   Set to the ID of the factor depending on @p var, or to -1
+     *                if the function does not depend on @p var.
+     * @param restId  Set to the ID of the factor independent of @p var.
+     *
+     * @return Whether the function is separable with respect to @p var.
+     */
+    LIB_UTILITIES_EXPORT bool SeparateFunction(
+        const int id, const std::string& var, int& varId, int& restId);
+
     /**
      * @brief Evaluate a function which depends only on constants and/or
      * parameters.
@@ -97,6 +97,11 @@ namespace Blas
                  const double* a,     const int& lda,
                  const double* b,     const int& ldb,
                  const double& beta,  double* c, const int& ldc);
+        void F77NAME(dtrsm) (const char& side,    const char& uplo,
+                 const char& transa,  const char& diag,
+                 const int& m,        const int& n,
+                 const double& alpha, const double* a,
+                 const int& lda,      double* b, const int& ldb);
     }
 
     /// \brief BLAS level 1: Copy \a x to \a y
@@ -219,6 +224,16 @@ namespace Blas
         F77NAME(dgemm) (transa,transb,m,n,k,alpha,a,lda,b,ldb,beta,c,ldc);
     }
 
+    /// \brief BLAS level 3: Triangular solve with multiple right-hand sides,
+    /// op(A) X = alpha B or X op(A) = alpha B, overwriting B with X
+    static inline void Dtrsm (const char& side,    const char& uplo,
+          const char& transa,  const char& diag,   const int& m,
+          const int& n,        const double& alpha, const double* a,
+          const int& lda,            double* b,     const int& ldb)
+    {
+        F77NAME(dtrsm) (side,uplo,transa,diag,m,n,alpha,a,lda,b,ldb);
+    }
+
     // \brief Wrapper to mutliply two (row major) matrices together C =
     // a*A*B + b*C
     static inline void Cdgemm(const int M, const int N, const int K, const double a,
@@ -220,6 +220,27 @@ namespace Nektar
         result.Transpose();
         return result;
     }
+
+    /// Memory in bytes held by a block matrix, including its blocks.
+    template<typename DataType, typename InnerMatrixType>
+    size_t GetMemoryFootprint(
+        const NekMatrix<NekMatrix<DataType, InnerMatrixType>,
+                        BlockMatrixTag>& m)
+    {
+        size_t bytes = sizeof(m);
+        for (unsigned int i = 0; i < m.GetNumberOfBlockRows(); ++i)
+        {
+            for (unsigned int j = 0; j < m.GetNumberOfBlockColumns(); ++j)
+            {
+                auto block = m.GetBlockPtr(i, j);
+                if (block)
+                {
+                    bytes += GetMemoryFootprint(*block);
+                }
+            }
+        }
+        return bytes;
+    }
 }
 
 
@@ -62,6 +62,8 @@ namespace Lapack
         void F77NAME(dpptrs) (const char& uplo, const int& n,
                   const int& nrhs, const double* ap,
                   double* b, const int& ldb, int& info);
+        void F77NAME(dpotrf) (const char& uplo, const int& n,
+                  double* a, const int& lda, int& info);
         void F77NAME(dpbtrf) (const char& uplo, const int& n, const int& kd,
                   double* ab, const int& ldab, int& info);
         void F77NAME(dpbtrs) (const char& uplo, const int& n,
@@ -143,6 +145,14 @@ namespace Lapack
         F77NAME(dpptrs) (uplo,n,nrhs,ap,b,ldb,info);
     }
 
+    /// \brief Cholesky factor a real Positive Definite full-storage
+    /// symmetric matrix.
+    static inline void Dpotrf (const char& uplo, const int& n,
+              double *a, const int& lda, int& info)
+    {
+        F77NAME(dpotrf) (uplo,n,a,lda,info);
+    }
+
     /// \brief Cholesky factorize a real positive-definite
     /// banded-symmetric matrix
     static inline void Dpbtrf (const char& uplo, const int& n, const int& kd,
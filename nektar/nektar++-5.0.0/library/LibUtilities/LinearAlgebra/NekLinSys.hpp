@@ -203,6 +203,72 @@ namespace Nektar
             
         }
 
+        /// Solve for \a nrhs right-hand sides stored column-major in \a x,
+        /// which is overwritten with the solutions. The factorised matrix
+        /// is traversed once by Lapack for all right-hand sides.
+        static void SolveMultiple(unsigned int nrhs, double *x,
+                   MatrixStorage m_matrixType,
+                   const Array<OneD, const int>& m_ipivot, unsigned int n,
+                   const Array<OneD, const double>& A,
+                   char m_transposeFlag, unsigned int m_numberOfSubDiagonals,
+                   unsigned int m_numberOfSuperDiagonals)
+        {
+            int info = 0;
+            switch(m_matrixType)
+            {
+                case eFULL:
+                    Lapack::Dgetrs('N',n,nrhs,A.get(),n,(int *)m_ipivot.get(),x,n,info);
+                    break;
+                case eDIAGONAL:
+                    for(unsigned int j = 0; j < nrhs; ++j)
+                    {
+                        for(unsigned int i = 0; i < n; ++i)
+                        {
+                            x[j*n+i] *= A[i];
+                        }
+                    }
+                    break;
+                case eUPPER_TRIANGULAR:
+                    Lapack::Dtptrs('U', m_transposeFlag, 'N', n, nrhs, A.get(), x, n, info);
+                    break;
+                case eLOWER_TRIANGULAR:
+                    Lapack::Dtptrs('L', m_transposeFlag, 'N', n, nrhs, A.get(), x, n, info);
+                    break;
+                case eSYMMETRIC:
+                    Lapack::Dsptrs('U', n, nrhs, A.get(), m_ipivot.get(), x, n, info);
+                    break;
+                case ePOSITIVE_DEFINITE_SYMMETRIC:
+                    Lapack::Dpptrs('U', n, nrhs, A.get(), x, n, info);
+                    break;
+                case eBANDED:
+                    {
+                        int KL = m_numberOfSubDiagonals;
+                        int KU = m_numberOfSuperDiagonals;
+                        Lapack::Dgbtrs(m_transposeFlag, n, KL, KU, nrhs, A.get(), 2*KL+KU+1, m_ipivot.get(), x, n, info);
+                    }
+                    break;
+                case ePOSITIVE_DEFINITE_SYMMETRIC_BANDED:
+                    {
+                        int KU = m_numberOfSuperDiagonals;
+                        Lapack::Dpbtrs('U', n, KU, nrhs, A.get(), KU+1, x, n, info);
+                    }
+                    break;
+                default:
+                    NEKERROR(ErrorUtil::efatal, "Unhandled matrix type");
+            }
+
+            if( info < 0 )
+            {
+                std::string message = "ERROR: The " + std::to_string(-info) + "th parameter had an illegal parameter in multiple right-hand side solve";
+                ASSERTL0(false, message.c_str());
+            }
+            else if( info > 0 )
+            {
+                std::string message = "ERROR: The " + std::to_string(info) + "th diagonal element of A is 0 in multiple right-hand side solve";
+                ASSERTL0(false, message.c_str());
+            }
+        }
+
         template<typename BVectorType, typename XVectorType>
         static void SolveTranspose(const BVectorType& b, XVectorType& x, MatrixStorage m_matrixType,
                             const Array<OneD, const int>& m_ipivot, unsigned int n,
@@ -413,6 +479,17 @@ namespace Nektar
                       m_ipivot, n, A, m_transposeFlag, m_numberOfSubDiagonals, m_numberOfSuperDiagonals);
             }
 
+            /// Solve for \a nrhs right-hand sides stored consecutively in
+            /// \a x (column-major, leading dimension GetRows()). On exit
+            /// \a x holds the corresponding solutions.
+            void SolveMultiple(unsigned int nrhs, Array<OneD, double> &x) const
+            {
+                ASSERTL1(x.num_elements() >= nrhs*n,
+                         "Insufficient storage for right-hand sides");
+                LinearSystemSolver::SolveMultiple(nrhs, x.get(), m_matrixType,
+                      m_ipivot, n, A, m_transposeFlag, m_numberOfSubDiagonals, m_numberOfSuperDiagonals);
+            }
+
             // Transpose variant of solve
             template<typename VectorType>
             RawType_t<VectorType> SolveTranspose(const VectorType& b)
@@ -433,6 +510,13 @@ namespace Nektar
         
             unsigned int GetRows() const { return n; }
             unsigned int GetColumns() const { return n; }
+
+            /// Memory in bytes held by the factorised matrix.
+            size_t GetMemoryFootprint() const
+            {
+                return sizeof(*this) + A.num_elements() * sizeof(double) +
+                    m_ipivot.num_elements() * sizeof(int);
+            }
             
         private:
             template<typename MatrixType>
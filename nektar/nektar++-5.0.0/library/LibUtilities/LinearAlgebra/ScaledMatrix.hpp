@@ -157,6 +157,16 @@ namespace Nektar
     LIB_UTILITIES_EXPORT NekMatrix<DataType, ScaledMatrixTag>
     Transpose(NekMatrix<DataType, ScaledMatrixTag>& rhs);
 
+    /// Memory in bytes held by a scaled matrix, including the matrix it
+    /// scales, which may be shared with other matrices.
+    template<typename DataType, typename InnerMatrixType>
+    size_t GetMemoryFootprint(
+        const NekMatrix<NekMatrix<DataType, InnerMatrixType>,
+                        ScaledMatrixTag>& m)
+    {
+        return sizeof(m) + GetMemoryFootprint(*m.GetOwnedMatrix());
+    }
+
 }
 
 
@@ -0,0 +1,461 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: SparseCholesky.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: supernodal sparse Cholesky factorisation
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <string>
+
+#include <LibUtilities/BasicUtils/ErrorUtil.hpp>
+#include <LibUtilities/BasicUtils/VmathArray.hpp>
+#include <LibUtilities/LinearAlgebra/Blas.hpp>
+#include <LibUtilities/LinearAlgebra/Lapack.hpp>
+#include <LibUtilities/LinearAlgebra/SparseCholesky.h>
+
+namespace Nektar
+{
+    /**
+     * The analysis proceeds in four passes over the pattern:
+     *
+     * - the elimination tree is built using path compression;
+     * - the column counts of @f$ L @f$ are accumulated from the row
+     *   subtrees of the elimination tree, each of which gives the pattern
+     *   of one row of @f$ L @f$;
+     * - consecutive columns \f$ j-1, j \f$ are merged into a supernode when
+     *   \f$ j \f$ is the parent of \f$ j-1 \f$ and their column counts
+     *   differ by one, in which case they share the same row structure;
+     * - the row structure of the first column of each supernode is
+     *   collected by a second traversal of the row subtrees.
+     *
+     * @param n      Number of rows of the matrix.
+     * @param lower  Lower triangle of the matrix pattern.
+     */
+    SparseCholeskySymbolic::SparseCholeskySymbolic(
+        const unsigned int  n,
+        const COOMatType   &lower)
+        : m_n(n)
+    {
+        int i, j, k, p, s, len;
+        const int nRows = n;
+        const int nnz   = lower.size();
+
+        // Store the pattern in compressed row form. The COO map is ordered
+        // by row and then column, so that each row lists the entries to the
+        // left of the diagonal in increasing order.
+        m_aRowPtr = Array<OneD, int>(nRows + 1, 0);
+        m_aColInd = Array<OneD, int>(nnz);
+
+        p = 0;
+        for (auto &entry : lower)
+        {
+            ASSERTL0(entry.first.first < n &&
+                     entry.first.second <= entry.first.first,
+                     "Sparse Cholesky pattern must be lower triangular.");
+            m_aRowPtr[entry.first.first + 1]++;
+            m_aColInd[p++] = entry.first.second;
+        }
+
+        for (i = 0; i < nRows; ++i)
+        {
+            m_aRowPtr[i + 1] += m_aRowPtr[i];
+        }
+
+        // Elimination tree.
+        Array<OneD, int> parent  (nRows, -1);
+        Array<OneD, int> ancestor(nRows, -1);
+
+        for (k = 0; k < nRows; ++k)
+        {
+            for (p = m_aRowPtr[k]; p < m_aRowPtr[k + 1]; ++p)
+            {
+                for (i = m_aColInd[p]; i != -1 && i < k; i = j)
+                {
+                    j           = ancestor[i];
+                    ancestor[i] = k;
+
+                    if (j == -1)
+                    {
+                        parent[i] = k;
+                    }
+                }
+            }
+        }
+
+        // Column counts, including the diagonal.
+        Array<OneD, int> colCount(nRows, 1);
+        Array<OneD, int> flag    (nRows, -1);
+        Array<OneD, int> stack   (nRows);
+
+        for (k = 0; k < nRows; ++k)
+        {
+            Reach(k, parent, flag, stack, len);
+
+            for (i = 0; i < len; ++i)
+            {
+                colCount[stack[i]]++;
+            }
+        }
+
+        // Fundamental supernodes.
+        std::vector<int> superStart;
+        m_colToSuper = Array<OneD, int>(nRows);
+
+        for (j = 0; j < nRows; ++j)
+        {
+            if (j == 0 || parent[j - 1] != j ||
+                colCount[j - 1] != colCount[j] + 1)
+            {
+                superStart.push_back(j);
+            }
+            m_colToSuper[j] = superStart.size() - 1;
+        }
+
+        m_nSuper     = superStart.size();
+        m_superStart = Array<OneD, int>(m_nSuper + 1, nRows);
+        m_rowPtr     = Array<OneD, int>(m_nSuper + 1, 0);
+        m_valPtr.resize(m_nSuper + 1, 0);
+        m_maxRows    = 0;
+        m_maxBlock   = 0;
+
+        for (s = 0; s < m_nSuper; ++s)
+        {
+            m_superStart[s] = superStart[s];
+        }
+
+        for (s = 0; s < m_nSuper; ++s)
+        {
+            const int sRows  = colCount[m_superStart[s]];
+            const int sWidth = m_superStart[s + 1] - m_superStart[s];
+
+            m_rowPtr[s + 1] = m_rowPtr[s] + sRows;
+            m_valPtr[s + 1] = m_valPtr[s] + size_t(sRows) * sWidth;
+            m_maxRows       = std::max(m_maxRows,  sRows);
+            m_maxBlock      = std::max(m_maxBlock, sRows * sWidth);
+        }
+
+        // Row structure of each supernode, which is that of its first
+        // column. Rows are visited in increasing order so that each
+        // structure is sorted.
+        Array<OneD, int> next(m_nSuper);
+        m_rowInd = Array<OneD, int>(m_rowPtr[m_nSuper]);
+
+        for (s = 0; s < m_nSuper; ++s)
+        {
+            next[s] = m_rowPtr[s];
+            m_rowInd[next[s]++] = m_superStart[s];
+        }
+
+        flag = Array<OneD, int>(nRows, -1);
+
+        for (k = 0; k < nRows; ++k)
+        {
+            Reach(k, parent, flag, stack, len);
+
+            for (i = 0; i < len; ++i)
+            {
+                j = stack[i];
+                s = m_colToSuper[j];
+
+                if (j == m_superStart[s])
+                {
+                    m_rowInd[next[s]++] = k;
+                }
+            }
+        }
+
+        // Position of each entry of the pattern in the supernodal blocks.
+        m_aToL.resize(nnz);
+
+        for (k = 0; k < nRows; ++k)
+        {
+            for (p = m_aRowPtr[k]; p < m_aRowPtr[k + 1]; ++p)
+            {
+                j = m_aColInd[p];
+                s = m_colToSuper[j];
+
+                const int *begin = m_rowInd.get() + m_rowPtr[s];
+                const int *end   = m_rowInd.get() + m_rowPtr[s + 1];
+                const int  row   = std::lower_bound(begin, end, k) - begin;
+
+                ASSERTL1(begin + row != end && begin[row] == k,
+                         "Entry missing from Cholesky factor structure.");
+
+                m_aToL[p] = m_valPtr[s] + row +
+                    size_t(j - m_superStart[s]) * (end - begin);
+            }
+        }
+    }
+
+    /**
+     * Determine the pattern of row @p k of @f$ L @f$, excluding the
+     * diagonal, as the union of the paths in the elimination tree from the
+     * nonzero entries of row @p k of @f$ A @f$ towards @p k.
+     *
+     * @param k       Row to compute.
+     * @param parent  Elimination tree.
+     * @param flag    Marker array, entries equal to @p k are visited.
+     * @param stack   On output, the column indices of row @p k of
+     *                @f$ L @f$ in its first @p len entries.
+     * @param len     On output, number of entries in row @p k.
+     */
+    void SparseCholeskySymbolic::Reach(
+        const int               k,
+        const Array<OneD, int> &parent,
+              Array<OneD, int> &flag,
+              Array<OneD, int> &stack,
+              int              &len) const
+    {
+        len     = 0;
+        flag[k] = k;
+
+        for (int p = m_aRowPtr[k]; p < m_aRowPtr[k + 1]; ++p)
+        {
+            for (int i = m_aColInd[p]; flag[i] != k; i = parent[i])
+            {
+                stack[len++] = i;
+                flag[i]      = k;
+            }
+        }
+    }
+
+    bool SparseCholeskySymbolic::MatchesPattern(
+        const unsigned int  n,
+        const COOMatType   &lower) const
+    {
+        if (n != m_n || lower.size() != m_aColInd.num_elements())
+        {
+            return false;
+        }
+
+        int p = 0;
+        for (auto &entry : lower)
+        {
+            const unsigned int row = entry.first.first;
+
+            if (row >= n || p <  m_aRowPtr[row] || p >= m_aRowPtr[row + 1] ||
+                m_aColInd[p] != int(entry.first.second))
+            {
+                return false;
+            }
+            ++p;
+        }
+
+        return true;
+    }
+
+    SparseCholesky::SparseCholesky(
+        const SparseCholeskySymbolicSharedPtr &symbolic)
+        : m_symbolic(symbolic),
+          m_val     (symbolic->GetFactorNnz(), 0.0)
+    {
+    }
+
+    /**
+     * Supernodes are processed in increasing order. Each supernode which
+     * still has rows to update is kept in a linked list attached to the
+     * supernode containing the first of these rows, so that the
+     * descendants contributing to a supernode are known when it is reached
+     * without searching the factor.
+     *
+     * @param lower  Lower triangle of the matrix, whose pattern must match
+     *               that of the symbolic analysis.
+     */
+    void SparseCholesky::Factorise(const COOMatType &lower)
+    {
+        const SparseCholeskySymbolic &sym = *m_symbolic;
+
+        ASSERTL1(sym.MatchesPattern(sym.m_n, lower),
+                 "Matrix pattern does not match the symbolic analysis.");
+
+        Vmath::Zero(m_val.num_elements(), m_val, 1);
+
+        size_t p = 0;
+        for (auto &entry : lower)
+        {
+            m_val[sym.m_aToL[p++]] = entry.second;
+        }
+
+        const int  nSuper = sym.m_nSuper;
+        const int *rowInd = sym.m_rowInd.get();
+        NekDouble *val    = m_val.get();
+
+        Array<OneD, int>       relMap (sym.m_n);
+        Array<OneD, int>       head   (nSuper, -1);
+        Array<OneD, int>       link   (nSuper, -1);
+        Array<OneD, int>       nextRow(nSuper, 0);
+        Array<OneD, NekDouble> update (sym.m_maxBlock);
+
+        for (int s = 0; s < nSuper; ++s)
+        {
+            const int  first  = sym.m_superStart[s];
+            const int  last   = sym.m_superStart[s + 1];
+            const int  width  = last - first;
+            const int  nRows  = sym.m_rowPtr[s + 1] - sym.m_rowPtr[s];
+            const int *rows   = rowInd + sym.m_rowPtr[s];
+            NekDouble *blk    = val + sym.m_valPtr[s];
+
+            for (int i = 0; i < nRows; ++i)
+            {
+                relMap[rows[i]] = i;
+            }
+
+            // Subtract the contributions of all descendants with rows in
+            // this supernode.
+            int d = head[s];
+            while (d != -1)
+            {
+                const int        dNext  = link[d];
+                const int        dWidth = sym.m_superStart[d + 1]
+                                        - sym.m_superStart[d];
+                const int        dRows  = sym.m_rowPtr[d + 1]
+                                        - sym.m_rowPtr[d];
+                const int       *dRow   = rowInd + sym.m_rowPtr[d];
+                const NekDouble *dBlk   = val + sym.m_valPtr[d];
+
+                const int p1 = nextRow[d];
+                int       p2 = p1;
+                while (p2 < dRows && dRow[p2] < last)
+                {
+                    ++p2;
+                }
+
+                const int m  = dRows - p1;
+                const int nc = p2 - p1;
+
+                Blas::Dgemm('N', 'T', m, nc, dWidth, 1.0, dBlk + p1, dRows,
+                            dBlk + p1, dRows, 0.0, update.get(), m);
+
+                for (int jj = 0; jj < nc; ++jj)
+                {
+                    NekDouble *col = blk + (dRow[p1 + jj] - first) * nRows;
+
+                    for (int ii = jj; ii < m; ++ii)
+                    {
+                        col[relMap[dRow[p1 + ii]]] -= update[ii + jj * m];
+                    }
+                }
+
+                // Attach the descendant to the next supernode it updates.
+                nextRow[d] = p2;
+                if (p2 < dRows)
+                {
+                    const int t = sym.m_colToSuper[dRow[p2]];
+                    link[d] = head[t];
+                    head[t] = d;
+                }
+
+                d = dNext;
+            }
+
+            int info = 0;
+            Lapack::Dpotrf('L', width, blk, nRows, info);
+            ASSERTL0(info == 0, "Sparse Cholesky factorisation failed in "
+                     "supernode " + std::to_string(s) + ": matrix is not "
+                     "positive definite.");
+
+            if (nRows > width)
+            {
+                Blas::Dtrsm('R', 'L', 'T', 'N', nRows - width, width, 1.0,
+                            blk, nRows, blk + width, nRows);
+
+                nextRow[s] = width;
+
+                const int t = sym.m_colToSuper[rows[width]];
+                link[s] = head[t];
+                head[t] = s;
+            }
+        }
+    }
+
+    /**
+     * @param x  On input the right-hand side, on output the solution.
+     */
+    void SparseCholesky::Solve(Array<OneD, NekDouble> &x) const
+    {
+        const SparseCholeskySymbolic &sym = *m_symbolic;
+
+        const int        nSuper = sym.m_nSuper;
+        const int       *rowInd = sym.m_rowInd.get();
+        const NekDouble *val    = m_val.get();
+
+        Array<OneD, NekDouble> tmp(sym.m_maxRows);
+        int s, i, info;
+
+        // Forward substitution with L.
+        for (s = 0; s < nSuper; ++s)
+        {
+            const int        first = sym.m_superStart[s];
+            const int        width = sym.m_superStart[s + 1] - first;
+            const int        nRows = sym.m_rowPtr[s + 1] - sym.m_rowPtr[s];
+            const int       *rows  = rowInd + sym.m_rowPtr[s];
+            const NekDouble *blk   = val + sym.m_valPtr[s];
+
+            Lapack::Dtrtrs('L', 'N', 'N', width, 1, blk, nRows,
+                           &x[first], width, info);
+
+            if (nRows > width)
+            {
+                Blas::Dgemv('N', nRows - width, width, 1.0, blk + width,
+                            nRows, &x[first], 1, 0.0, tmp.get(), 1);
+
+                for (i = 0; i < nRows - width; ++i)
+                {
+                    x[rows[width + i]] -= tmp[i];
+                }
+            }
+        }
+
+        // Backward substitution with L^T.
+        for (s = nSuper - 1; s >= 0; --s)
+        {
+            const int        first = sym.m_superStart[s];
+            const int        width = sym.m_superStart[s + 1] - first;
+            const int        nRows = sym.m_rowPtr[s + 1] - sym.m_rowPtr[s];
+            const int       *rows  = rowInd + sym.m_rowPtr[s];
+            const NekDouble *blk   = val + sym.m_valPtr[s];
+
+            if (nRows > width)
+            {
+                for (i = 0; i < nRows - width; ++i)
+                {
+                    tmp[i] = x[rows[width + i]];
+                }
+
+                Blas::Dgemv('T', nRows - width, width, -1.0, blk + width,
+                            nRows, tmp.get(), 1, 1.0, &x[first], 1);
+            }
+
+            Lapack::Dtrtrs('L', 'T', 'N', width, 1, blk, nRows,
+                           &x[first], width, info);
+        }
+    }
+}
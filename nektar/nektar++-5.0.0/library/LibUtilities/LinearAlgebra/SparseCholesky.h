@@ -0,0 +1,168 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: SparseCholesky.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: supernodal sparse Cholesky factorisation of symmetric
+// positive-definite matrices, split into a reusable symbolic analysis and a
+// numeric factorisation.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_UTILITIES_LINEAR_ALGEBRA_SPARSE_CHOLESKY_H
+#define NEKTAR_LIB_UTILITIES_LINEAR_ALGEBRA_SPARSE_CHOLESKY_H
+
+#include <LibUtilities/LibUtilitiesDeclspec.h>
+#include <LibUtilities/LinearAlgebra/SparseMatrixFwd.hpp>
+
+namespace Nektar
+{
+    class SparseCholeskySymbolic;
+    class SparseCholesky;
+
+    typedef std::shared_ptr<SparseCholeskySymbolic>
+        SparseCholeskySymbolicSharedPtr;
+    typedef std::shared_ptr<SparseCholesky> SparseCholeskySharedPtr;
+
+    /**
+     * @brief Symbolic analysis of the sparse Cholesky factorisation
+     * \f$ A = LL^T \f$ of a symmetric positive-definite matrix.
+     *
+     * The pattern of @f$ A @f$ is given by the entries of its lower
+     * triangle (row >= column) stored in a COO map. No fill-reducing
+     * permutation is applied: the caller is expected to number the unknowns
+     * appropriately, e.g. by nested dissection. The analysis determines the
+     * elimination tree, the column counts of @f$ L @f$ and its partition
+     * into fundamental supernodes, i.e. runs of consecutive columns sharing
+     * the same row structure, which are stored as dense blocks.
+     *
+     * The analysis depends only on the pattern, so that a single instance
+     * can be shared by any number of SparseCholesky factorisations of
+     * matrices with the same pattern but different values.
+     */
+    class SparseCholeskySymbolic
+    {
+    public:
+        friend class SparseCholesky;
+
+        LIB_UTILITIES_EXPORT SparseCholeskySymbolic(
+            const unsigned int  n,
+            const COOMatType   &lower);
+
+        /// Returns true if @p lower has exactly the analysed pattern.
+        LIB_UTILITIES_EXPORT bool MatchesPattern(
+            const unsigned int  n,
+            const COOMatType   &lower) const;
+
+        /// Number of rows of the matrix.
+        unsigned int GetRows() const
+        {
+            return m_n;
+        }
+
+        /// Number of stored entries of the Cholesky factor.
+        size_t GetFactorNnz() const
+        {
+            return m_valPtr[m_nSuper];
+        }
+
+        /// Number of supernodes of the Cholesky factor.
+        int GetNumSupernodes() const
+        {
+            return m_nSuper;
+        }
+
+    protected:
+        /// Number of rows of the matrix.
+        unsigned int        m_n;
+        /// Number of supernodes.
+        int                 m_nSuper;
+        /// Row pointers of the lower triangle of the pattern.
+        Array<OneD, int>    m_aRowPtr;
+        /// Column indices of the lower triangle of the pattern.
+        Array<OneD, int>    m_aColInd;
+        /// Position in the factor of each entry of the pattern.
+        std::vector<size_t> m_aToL;
+        /// First column of each supernode.
+        Array<OneD, int>    m_superStart;
+        /// Supernode containing each column.
+        Array<OneD, int>    m_colToSuper;
+        /// Offsets of the row structure of each supernode in #m_rowInd.
+        Array<OneD, int>    m_rowPtr;
+        /// Row structures of the supernodes.
+        Array<OneD, int>    m_rowInd;
+        /// Offsets of the dense block of each supernode in the factor.
+        std::vector<size_t> m_valPtr;
+        /// Largest row structure of any supernode.
+        int                 m_maxRows;
+        /// Largest dense block of any supernode.
+        int                 m_maxBlock;
+
+        void Reach(
+            const int               k,
+            const Array<OneD, int> &parent,
+                  Array<OneD, int> &flag,
+                  Array<OneD, int> &stack,
+                  int              &len) const;
+    };
+
+    /**
+     * @brief Numeric supernodal Cholesky factorisation sharing a
+     * SparseCholeskySymbolic analysis.
+     *
+     * The factorisation is left-looking: each supernode gathers the
+     * updates of its descendants with a dense matrix-matrix product before
+     * its diagonal block is factorised and the off-diagonal block is
+     * obtained by a triangular solve, so that the bulk of the work is
+     * carried out by BLAS level 3 kernels.
+     */
+    class SparseCholesky
+    {
+    public:
+        LIB_UTILITIES_EXPORT SparseCholesky(
+            const SparseCholeskySymbolicSharedPtr &symbolic);
+
+        /// Compute the factor of a matrix with the analysed pattern.
+        LIB_UTILITIES_EXPORT void Factorise(const COOMatType &lower);
+
+        /// Solve @f$ LL^T x = b @f$ in place.
+        LIB_UTILITIES_EXPORT void Solve(Array<OneD, NekDouble> &x) const;
+
+        const SparseCholeskySymbolicSharedPtr &GetSymbolic() const
+        {
+            return m_symbolic;
+        }
+
+    protected:
+        SparseCholeskySymbolicSharedPtr m_symbolic;
+        /// Dense supernodal blocks of the factor, stored column-major.
+        Array<OneD, NekDouble>          m_val;
+    };
+}
+
+#endif
@@ -512,6 +512,13 @@ namespace Nektar
 
     template<typename DataType>
     LIB_UTILITIES_EXPORT void NegateInPlace(NekMatrix<DataType, StandardMatrixTag>& v);
+
+    /// Memory in bytes held by a matrix, including its storage.
+    template<typename DataType>
+    size_t GetMemoryFootprint(const NekMatrix<DataType, StandardMatrixTag>& m)
+    {
+        return sizeof(m) + m.GetStorageSize() * sizeof(DataType);
+    }
 }
     
 #endif //NEKTAR_LIB_UTILITIES_LINEAR_ALGEBRA_STANDARD_MATRIX_HPP
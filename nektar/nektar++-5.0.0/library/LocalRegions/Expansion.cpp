@@ -35,8 +35,11 @@
 #include <boost/core/ignore_unused.hpp>
 
 #include <LibUtilities/Foundations/Interp.h>
+#include <LibUtilities/BasicUtils/NekManager.hpp>
+#include <LibUtilities/LinearAlgebra/Lapack.hpp>
 #include <LocalRegions/Expansion.h>
 #include <LocalRegions/MatrixKey.h>
+#include <StdRegions/StdSegExp.h>
 
 using namespace std;
 
@@ -44,6 +47,111 @@ namespace Nektar
 {
     namespace LocalRegions 
     {
+        /**
+         * One-dimensional data for the fast diagonalisation of interior
+         * problems: the generalised eigenvectors and eigenvalues of the
+         * interior stiffness and mass matrices of a basis, with the
+         * eigenvectors normalised so that \f$ V^T M V = I \f$.
+         */
+        struct FastDiag1D
+        {
+            Array<OneD, NekDouble> m_eigVecs;
+            Array<OneD, NekDouble> m_eigVals;
+        };
+
+        static std::shared_ptr<FastDiag1D> CreateFastDiag1D(
+            const LibUtilities::BasisKey &bkey)
+        {
+            StdRegions::StdSegExp seg(bkey);
+            StdRegions::StdMatrixKey massKey(StdRegions::eMass,
+                                             LibUtilities::eSegment, seg);
+            StdRegions::StdMatrixKey lapKey (StdRegions::eLaplacian,
+                                             LibUtilities::eSegment, seg);
+            DNekMatSharedPtr mass = seg.GetStdMatrix(massKey);
+            DNekMatSharedPtr lap  = seg.GetStdMatrix(lapKey);
+
+            Array<OneD, unsigned int> imap;
+            seg.GetInteriorMap(imap);
+
+            int i, j, k, info = 0;
+            int n = imap.num_elements();
+
+            std::shared_ptr<FastDiag1D> data =
+                MemoryManager<FastDiag1D>::AllocateSharedPtr();
+            data->m_eigVecs = Array<OneD, NekDouble>(n*n, 0.0);
+            data->m_eigVals = Array<OneD, NekDouble>(n,   0.0);
+
+            if (n == 0)
+            {
+                return data;
+            }
+
+            Array<OneD, NekDouble> packed(n*(n+1)/2);
+            Array<OneD, NekDouble> eigVal(n);
+            Array<OneD, NekDouble> eigVec(n*n);
+            Array<OneD, NekDouble> work  (3*n);
+            Array<OneD, NekDouble> sqrtInv(n*n, 0.0);
+            Array<OneD, NekDouble> tmp   (n*n);
+            Array<OneD, NekDouble> lapInt(n*n);
+
+            // Form M_ii^{-1/2} from the eigendecomposition of M_ii
+            for (j = 0; j < n; ++j)
+            {
+                for (i = 0; i <= j; ++i)
+                {
+                    packed[i + j*(j+1)/2] = (*mass)(imap[i], imap[j]);
+                }
+            }
+            Lapack::Dspev('V', 'U', n, packed.get(), eigVal.get(),
+                          eigVec.get(), n, work.get(), info);
+            ASSERTL0(info == 0, "Failed to diagonalise interior mass matrix");
+
+            for (k = 0; k < n; ++k)
+            {
+                NekDouble fac = 1.0 / sqrt(eigVal[k]);
+                for (j = 0; j < n; ++j)
+                {
+                    for (i = 0; i < n; ++i)
+                    {
+                        sqrtInv[i + j*n] +=
+                            fac * eigVec[i + k*n] * eigVec[j + k*n];
+                    }
+                }
+            }
+
+            // Diagonalise M_ii^{-1/2} L_ii M_ii^{-1/2}
+            for (j = 0; j < n; ++j)
+            {
+                for (i = 0; i < n; ++i)
+                {
+                    lapInt[i + j*n] = (*lap)(imap[i], imap[j]);
+                }
+            }
+            Blas::Dgemm('N', 'N', n, n, n, 1.0, sqrtInv.get(), n,
+                        lapInt.get(), n, 0.0, tmp.get(), n);
+            Blas::Dgemm('N', 'N', n, n, n, 1.0, tmp.get(), n,
+                        sqrtInv.get(), n, 0.0, lapInt.get(), n);
+
+            for (j = 0; j < n; ++j)
+            {
+                for (i = 0; i <= j; ++i)
+                {
+                    packed[i + j*(j+1)/2] = lapInt[i + j*n];
+                }
+            }
+            Lapack::Dspev('V', 'U', n, packed.get(), data->m_eigVals.get(),
+                          eigVec.get(), n, work.get(), info);
+            ASSERTL0(info == 0,
+                     "Failed to diagonalise interior stiffness matrix");
+
+            // V = M_ii^{-1/2} W, so that V^T M_ii V = I and V^T L_ii V is
+            // diagonal.
+            Blas::Dgemm('N', 'N', n, n, n, 1.0, sqrtInv.get(), n,
+                        eigVec.get(), n, 0.0, data->m_eigVecs.get(), n);
+
+            return data;
+        }
+
         Expansion::Expansion(SpatialDomains::GeometrySharedPtr pGeom) :
                     m_geom(pGeom),
                     m_metricinfo(m_geom->GetGeomFactors())
@@ -551,6 +659,170 @@ namespace Nektar
             NEKERROR(ErrorUtil::efatal, "This function is only valid for LocalRegions");
             return 0.0;
         }
+
+        /**
+         * Returns true if the interior-interior block of the matrix
+         * described by @a mkey can be inverted by fast diagonalisation
+         * using FastDiagInteriorSolve.
+         */
+        bool Expansion::HasFastDiagInteriorSolve(
+            const LocalRegions::MatrixKey &mkey)
+        {
+            return v_HasFastDiagInteriorSolve(mkey);
+        }
+
+        /**
+         * Solve @f$ A_{ii} x = b @f$, where @f$ A_{ii} @f$ is the
+         * interior-interior block of the matrix described by @a mkey, without
+         * forming the matrix. @a inarray and @a outarray are ordered as
+         * returned by GetInteriorMap.
+         */
+        void Expansion::FastDiagInteriorSolve(
+            const LocalRegions::MatrixKey      &mkey,
+            const Array<OneD, const NekDouble> &inarray,
+                  Array<OneD,       NekDouble> &outarray)
+        {
+            v_FastDiagInteriorSolve(mkey, inarray, outarray);
+        }
+
+        /**
+         * For a tensor-product element with constant geometric factors and
+         * mutually orthogonal coordinate directions, the mass, Laplacian and
+         * Helmholtz matrices are the sum of Kronecker products of the 1D
+         * mass and stiffness matrices,
+         * @f[ A = c_0 \bigotimes_d M_d + \sum_d c_{d+1} L_d \bigotimes_{e
+         * \neq d} M_e. @f]
+         * This routine checks whether @a mkey admits such a decomposition
+         * and if so returns the coefficients @f$ c @f$ in @a factors.
+         */
+        bool Expansion::GetFastDiagFactors(
+            const LocalRegions::MatrixKey &mkey,
+            Array<OneD, NekDouble>        &factors)
+        {
+            StdRegions::MatrixType mtype = mkey.GetMatrixType();
+            if (mtype != StdRegions::eMass      &&
+                mtype != StdRegions::eLaplacian &&
+                mtype != StdRegions::eHelmholtz)
+            {
+                return false;
+            }
+
+            if (mkey.GetNVarCoeff() > 0 || !m_metricinfo ||
+                m_metricinfo->GetGtype() != SpatialDomains::eRegular)
+            {
+                return false;
+            }
+
+            for (auto &x : mkey.GetConstFactors())
+            {
+                if (x.first != StdRegions::eFactorLambda)
+                {
+                    return false;
+                }
+            }
+
+            int i, j, k;
+            int nDim     = GetShapeDimension();
+            int coordim  = GetCoordim();
+
+            for (i = 0; i < nDim; ++i)
+            {
+                if (m_base[i]->GetBasisType() != LibUtilities::eModified_A &&
+                    m_base[i]->GetBasisType() != LibUtilities::eGLL_Lagrange)
+                {
+                    return false;
+                }
+            }
+
+            const Array<TwoD, const NekDouble> &df =
+                m_metricinfo->GetDerivFactors(GetPointsKeys());
+            NekDouble jac = m_metricinfo->GetJac(GetPointsKeys())[0];
+
+            // Metric g^{ij} = sum_k dxi_i/dx_k dxi_j/dx_k, which has to be
+            // diagonal.
+            Array<OneD, NekDouble> g(nDim*nDim, 0.0);
+            for (i = 0; i < nDim; ++i)
+            {
+                for (j = 0; j < nDim; ++j)
+                {
+                    for (k = 0; k < coordim; ++k)
+                    {
+                        g[i*nDim+j] += df[k*nDim+i][0] * df[k*nDim+j][0];
+                    }
+                }
+            }
+
+            for (i = 0; i < nDim; ++i)
+            {
+                for (j = 0; j < i; ++j)
+                {
+                    if (fabs(g[i*nDim+j]) > NekConstants::kNekZeroTol *
+                            sqrt(g[i*nDim+i] * g[j*nDim+j]))
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            factors = Array<OneD, NekDouble>(nDim+1, 0.0);
+            switch (mtype)
+            {
+                case StdRegions::eMass:
+                    factors[0] = jac;
+                    break;
+                case StdRegions::eHelmholtz:
+                    factors[0] = jac *
+                        mkey.GetConstFactor(StdRegions::eFactorLambda);
+                    // Fall through
+                case StdRegions::eLaplacian:
+                    for (i = 0; i < nDim; ++i)
+                    {
+                        factors[i+1] = jac * g[i*nDim+i];
+                    }
+                    break;
+                default:
+                    break;
+            }
+
+            return true;
+        }
+
+        /**
+         * Returns the 1D fast diagonalisation data for the basis in
+         * direction @a dir. The data is shared between all expansions using
+         * the same basis.
+         */
+        void Expansion::GetFastDiag1D(
+            const int                      dir,
+            Array<OneD, const NekDouble>  &eigVecs,
+            Array<OneD, const NekDouble>  &eigVals)
+        {
+            static LibUtilities::NekManager<LibUtilities::BasisKey,
+                FastDiag1D, LibUtilities::BasisKey::opLess>
+                    fastDiagManager(CreateFastDiag1D, "ExpansionFastDiag1D");
+
+            std::shared_ptr<FastDiag1D> data =
+                fastDiagManager[m_base[dir]->GetBasisKey()];
+            eigVecs = data->m_eigVecs;
+            eigVals = data->m_eigVals;
+        }
+
+        bool Expansion::v_HasFastDiagInteriorSolve(
+            const LocalRegions::MatrixKey &mkey)
+        {
+            boost::ignore_unused(mkey);
+            return false;
+        }
+
+        void Expansion::v_FastDiagInteriorSolve(
+            const LocalRegions::MatrixKey      &mkey,
+            const Array<OneD, const NekDouble> &inarray,
+                  Array<OneD,       NekDouble> &outarray)
+        {
+            boost::ignore_unused(mkey, inarray, outarray);
+            NEKERROR(ErrorUtil::efatal, "Fast diagonalisation is not "
+                     "available for this expansion");
+        }
     } //end of namespace
 } //end of namespace
 
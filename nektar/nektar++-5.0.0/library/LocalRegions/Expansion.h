@@ -123,6 +123,13 @@ namespace Nektar
                 LOCAL_REGIONS_EXPORT NekDouble VectorFlux(
                     const Array<OneD, Array<OneD, NekDouble > > &vec);
 
+                LOCAL_REGIONS_EXPORT bool HasFastDiagInteriorSolve(
+                    const LocalRegions::MatrixKey &mkey);
+                LOCAL_REGIONS_EXPORT void FastDiagInteriorSolve(
+                    const LocalRegions::MatrixKey      &mkey,
+                    const Array<OneD, const NekDouble> &inarray,
+                          Array<OneD,       NekDouble> &outarray);
+
             protected:
                 SpatialDomains::GeometrySharedPtr  m_geom;
                 SpatialDomains::GeomFactorsSharedPtr m_metricinfo;
@@ -130,6 +137,14 @@ namespace Nektar
 
                 void ComputeLaplacianMetric();
                 void ComputeQuadratureMetric();
+
+                bool GetFastDiagFactors(
+                    const LocalRegions::MatrixKey &mkey,
+                    Array<OneD, NekDouble>        &factors);
+                void GetFastDiag1D(
+                    const int                      dir,
+                    Array<OneD, const NekDouble>  &eigVecs,
+                    Array<OneD, const NekDouble>  &eigVals);
                 void ComputeGmatcdotMF(
                     const Array<TwoD, const NekDouble> &df,
                     const Array<OneD, const NekDouble> &direction,
@@ -199,6 +214,12 @@ namespace Nektar
                           Array<OneD,             NekDouble>   &outarray);
                 virtual NekDouble v_VectorFlux(
                     const Array<OneD, Array<OneD, NekDouble > > &vec);
+                virtual bool v_HasFastDiagInteriorSolve(
+                    const LocalRegions::MatrixKey &mkey);
+                virtual void v_FastDiagInteriorSolve(
+                    const LocalRegions::MatrixKey      &mkey,
+                    const Array<OneD, const NekDouble> &inarray,
+                          Array<OneD,       NekDouble> &outarray);
 
             private:
 
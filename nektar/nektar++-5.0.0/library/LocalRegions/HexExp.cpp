@@ -33,6 +33,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 
+#include <boost/core/ignore_unused.hpp>
+
 #include <LocalRegions/HexExp.h>
 #include <LibUtilities/Foundations/Interp.h>
 #include <LibUtilities/Foundations/InterpCoeff.h>
@@ -1912,6 +1914,84 @@ namespace Nektar
             m_staticCondMatrixManager.DeleteObject(mkey);
         }
 
+        bool HexExp::v_HasFastDiagInteriorSolve(const MatrixKey &mkey)
+        {
+            Array<OneD, NekDouble> factors;
+            return GetFastDiagFactors(mkey, factors);
+        }
+
+        /**
+         * The interior solve applies @f$ (V_2 \otimes V_1 \otimes V_0)
+         * \Lambda^{-1} (V_2 \otimes V_1 \otimes V_0)^T @f$ one direction at
+         * a time, as in the sum-factorised transforms.
+         */
+        void HexExp::v_FastDiagInteriorSolve(
+            const MatrixKey                    &mkey,
+            const Array<OneD, const NekDouble> &inarray,
+                  Array<OneD,       NekDouble> &outarray)
+        {
+            Array<OneD, NekDouble> factors;
+            bool separable = GetFastDiagFactors(mkey, factors);
+            ASSERTL1(separable, "Fast diagonalisation is not applicable to "
+                     "this matrix");
+            boost::ignore_unused(separable);
+
+            const int n0 = m_base[0]->GetNumModes() - 2;
+            const int n1 = m_base[1]->GetNumModes() - 2;
+            const int n2 = m_base[2]->GetNumModes() - 2;
+
+            if (n0 <= 0 || n1 <= 0 || n2 <= 0)
+            {
+                return;
+            }
+
+            int i, j, k;
+            Array<OneD, const NekDouble> v0, mu0, v1, mu1, v2, mu2;
+            GetFastDiag1D(0, v0, mu0);
+            GetFastDiag1D(1, v1, mu1);
+            GetFastDiag1D(2, v2, mu2);
+
+            Array<OneD, NekDouble> tmp0(n0*n1*n2);
+            Array<OneD, NekDouble> tmp1(n0*n1*n2);
+
+            // Forward transform into the eigenbasis
+            Blas::Dgemm('T', 'N', n0, n1*n2, n0, 1.0, v0.get(), n0,
+                        inarray.get(), n0, 0.0, tmp0.get(), n0);
+            for (k = 0; k < n2; ++k)
+            {
+                Blas::Dgemm('N', 'N', n0, n1, n1, 1.0,
+                            tmp0.get() + k*n0*n1, n0, v1.get(), n1,
+                            0.0, tmp1.get() + k*n0*n1, n0);
+            }
+            Blas::Dgemm('N', 'N', n0*n1, n2, n2, 1.0, tmp1.get(), n0*n1,
+                        v2.get(), n2, 0.0, outarray.get(), n0*n1);
+
+            for (k = 0; k < n2; ++k)
+            {
+                for (j = 0; j < n1; ++j)
+                {
+                    for (i = 0; i < n0; ++i)
+                    {
+                        outarray[i + n0*(j + n1*k)] /= factors[0]
+                            + factors[1]*mu0[i] + factors[2]*mu1[j]
+                            + factors[3]*mu2[k];
+                    }
+                }
+            }
+
+            // Backward transform
+            Blas::Dgemm('N', 'N', n0, n1*n2, n0, 1.0, v0.get(), n0,
+                        outarray.get(), n0, 0.0, tmp0.get(), n0);
+            for (k = 0; k < n2; ++k)
+            {
+                Blas::Dgemm('N', 'T', n0, n1, n1, 1.0,
+                            tmp0.get() + k*n0*n1, n0, v1.get(), n1,
+                            0.0, tmp1.get() + k*n0*n1, n0);
+            }
+            Blas::Dgemm('N', 'T', n0*n1, n2, n2, 1.0, tmp1.get(), n0*n1,
+                        v2.get(), n2, 0.0, outarray.get(), n0*n1);
+        }
+
         void HexExp::v_LaplacianMatrixOp_MatFree_Kernel(
                 const Array<OneD, const NekDouble> &inarray,
                       Array<OneD,       NekDouble> &outarray,
@@ -2111,6 +2111,65 @@ namespace Nektar
         }
 
 
+        bool QuadExp::v_HasFastDiagInteriorSolve(const MatrixKey &mkey)
+        {
+            Array<OneD, NekDouble> factors;
+            return GetFastDiagFactors(mkey, factors);
+        }
+
+
+        /**
+         * With @f$ A_{ii} = (V_1 \otimes V_0)^{-T} \Lambda (V_1 \otimes
+         * V_0)^{-1} @f$, the interior solve is @f$ x = V_0 (\Lambda^{-1}
+         * \circ (V_0^T B V_1)) V_1^T @f$ with @f$ B @f$ the right-hand side
+         * arranged as an @f$ n_0 \times n_1 @f$ matrix.
+         */
+        void QuadExp::v_FastDiagInteriorSolve(
+            const MatrixKey                    &mkey,
+            const Array<OneD, const NekDouble> &inarray,
+                  Array<OneD,       NekDouble> &outarray)
+        {
+            Array<OneD, NekDouble> factors;
+            bool separable = GetFastDiagFactors(mkey, factors);
+            ASSERTL1(separable, "Fast diagonalisation is not applicable to "
+                     "this matrix");
+            boost::ignore_unused(separable);
+
+            const int n0 = m_base[0]->GetNumModes() - 2;
+            const int n1 = m_base[1]->GetNumModes() - 2;
+
+            if (n0 <= 0 || n1 <= 0)
+            {
+                return;
+            }
+
+            Array<OneD, const NekDouble> v0, mu0, v1, mu1;
+            GetFastDiag1D(0, v0, mu0);
+            GetFastDiag1D(1, v1, mu1);
+
+            Array<OneD, NekDouble> tmp(n0*n1);
+
+            Blas::Dgemm('T', 'N', n0, n1, n0, 1.0, v0.get(), n0,
+                        inarray.get(), n0, 0.0, tmp.get(), n0);
+            Blas::Dgemm('N', 'N', n0, n1, n1, 1.0, tmp.get(), n0,
+                        v1.get(), n1, 0.0, outarray.get(), n0);
+
+            for (int j = 0; j < n1; ++j)
+            {
+                for (int i = 0; i < n0; ++i)
+                {
+                    outarray[i + j*n0] /= factors[0] + factors[1]*mu0[i]
+                                                     + factors[2]*mu1[j];
+                }
+            }
+
+            Blas::Dgemm('N', 'N', n0, n1, n0, 1.0, v0.get(), n0,
+                        outarray.get(), n0, 0.0, tmp.get(), n0);
+            Blas::Dgemm('N', 'T', n0, n1, n1, 1.0, tmp.get(), n0,
+                        v1.get(), n1, 0.0, outarray.get(), n0);
+        }
+
+
         void QuadExp::v_MassMatrixOp(
             const Array<OneD, const NekDouble> &inarray,
                   Array<OneD,NekDouble> &outarray,
@@ -229,6 +229,13 @@ namespace Nektar
             LOCAL_REGIONS_EXPORT void v_DropLocStaticCondMatrix(
                         const MatrixKey &mkey);
 
+            LOCAL_REGIONS_EXPORT virtual bool v_HasFastDiagInteriorSolve(
+                        const MatrixKey &mkey);
+            LOCAL_REGIONS_EXPORT virtual void v_FastDiagInteriorSolve(
+                        const MatrixKey                    &mkey,
+                        const Array<OneD, const NekDouble> &inarray,
+                              Array<OneD,       NekDouble> &outarray);
+
 
             //---------------------------------------
             // Operators
@@ -88,6 +88,7 @@ namespace Nektar
             m_solnType(eNoSolnType),
             m_bndSystemBandWidth(0),
             m_successiveRHS(0),
+            m_successiveRHSType(eSuccessiveRHSProjection),
             m_gsh(0),
             m_bndGsh(0)
         {
@@ -105,6 +106,7 @@ namespace Nektar
             m_numGlobalDirBndCoeffs(0),
             m_bndSystemBandWidth(0),
             m_successiveRHS(0),
+            m_successiveRHSType(eSuccessiveRHSProjection),
             m_gsh(0),
             m_bndGsh(0)
         {
@@ -173,6 +175,20 @@ namespace Nektar
                                         m_successiveRHS,0);
             }
 
+            m_successiveRHSType =
+                pSession->GetSolverInfoAsEnum<SuccessiveRHSType>(
+                                                    "SuccessiveRHSType");
+
+            if(pSession->DefinesGlobalSysSolnInfo(variable,
+                                                  "SuccessiveRHSType"))
+            {
+                std::string type = pSession->GetGlobalSysSolnInfo(variable,
+                                                        "SuccessiveRHSType");
+                m_successiveRHSType =
+                    pSession->GetValueAsEnum<SuccessiveRHSType>(
+                                                "SuccessiveRHSType", type);
+            }
+
         }
         
         /** 
@@ -190,6 +206,7 @@ namespace Nektar
             m_maxIterations(oldLevelMap->m_maxIterations),
             m_iterativeTolerance(oldLevelMap->m_iterativeTolerance),
             m_successiveRHS(oldLevelMap->m_successiveRHS),
+            m_successiveRHSType(oldLevelMap->m_successiveRHSType),
             m_gsh(oldLevelMap->m_gsh),
             m_bndGsh(oldLevelMap->m_bndGsh),
             m_lowestStaticCondLevel(oldLevelMap->m_lowestStaticCondLevel)
@@ -1264,6 +1281,11 @@ namespace Nektar
             return m_successiveRHS;
         }
 
+        SuccessiveRHSType AssemblyMap::GetSuccessiveRHSType() const
+        {
+            return m_successiveRHSType;
+        }
+
         void AssemblyMap::GlobalToLocalBndWithoutSign(
                     const Array<OneD, const NekDouble>& global,
                     Array<OneD,NekDouble>& loc)
@@ -293,6 +293,8 @@ namespace Nektar
             MULTI_REGIONS_EXPORT NekDouble GetIterativeTolerance() const;
             MULTI_REGIONS_EXPORT int GetMaxIterations() const;
             MULTI_REGIONS_EXPORT int GetSuccessiveRHS() const;
+            MULTI_REGIONS_EXPORT SuccessiveRHSType
+                GetSuccessiveRHSType() const;
 
             MULTI_REGIONS_EXPORT int GetLowestStaticCondLevel() const
             {
@@ -377,6 +379,9 @@ namespace Nektar
             /// sucessive RHS  for iterative solver
             int  m_successiveRHS;
 
+            /// Method used to reuse the successive RHS solutions
+            SuccessiveRHSType m_successiveRHSType;
+
             Gs::gs_data * m_gsh;
             Gs::gs_data * m_bndGsh;
 
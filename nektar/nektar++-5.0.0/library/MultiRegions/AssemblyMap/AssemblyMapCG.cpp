@@ -1241,6 +1241,20 @@ namespace Nektar
                         break;
                     }
 
+                    case eDirectSparseStaticCond:
+                    {
+                        // Nested dissection limits the fill-in of the sparse
+                        // Cholesky factor.
+#ifdef NEKTAR_USE_SCOTCH
+                        MultiLevelBisectionReordering(
+                            boostGraphObj, perm, iperm, bottomUpGraph,
+                            partVerts, mdswitch);
+#else
+                        CuthillMckeeReordering(boostGraphObj,perm,iperm);
+#endif
+                        break;
+                    }
+
                     case ePETScMultiLevelStaticCond:
                     case eDirectMultiLevelStaticCond:
                     case eIterativeMultiLevelStaticCond:
@@ -294,6 +294,16 @@ namespace Nektar
                         CuthillMckeeReordering(boostGraphObj,perm,iperm);
                         break;
                     }
+                    case eDirectSparseStaticCond:
+                    {
+#ifdef NEKTAR_USE_SCOTCH
+                        MultiLevelBisectionReordering(boostGraphObj,perm,iperm,
+                                                      bottomUpGraph);
+#else
+                        CuthillMckeeReordering(boostGraphObj,perm,iperm);
+#endif
+                        break;
+                    }
                     case eDirectMultiLevelStaticCond:
                     case eIterativeMultiLevelStaticCond:
                     case eXxtMultiLevelStaticCond:
@@ -366,7 +366,7 @@ namespace Nektar
         GlobalLinSysSharedPtr ContField1D::GetGlobalLinSys(
                                 const GlobalLinSysKey &mkey)
         {
-            return m_globalLinSysManager[mkey];
+            return GetCachedGlobalLinSys(m_globalLinSysManager, mkey);
         }
 
         GlobalLinSysSharedPtr ContField1D::GenGlobalLinSys(
@@ -157,6 +157,13 @@ namespace Nektar
 
             inline int GetGlobalMatrixNnz(const GlobalMatrixKey &gkey);
 
+            /// Creates the Helmholtz linear system with the given constants,
+            /// unless it already exists.
+            MULTI_REGIONS_EXPORT void SetUpHelmholtzLinSys(
+                    const StdRegions::ConstFactorMap &factors,
+                    const StdRegions::VarCoeffMap &varcoeff,
+                    const MultiRegions::VarFactorsMap &varfactors);
+
         protected:
 
         private:
@@ -250,6 +257,24 @@ namespace Nektar
                     const Array<OneD, const NekDouble> &dirForcing,
                     const bool PhysSpaceForcing);
 
+            /// Solves the Helmholtz equation for several fields sharing
+            /// the same global linear system.
+            MULTI_REGIONS_EXPORT virtual void v_HelmSolveMultiple(
+                    const Array<OneD, ExpListSharedPtr> &fields,
+                    const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                          Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                    const FlagList &flags,
+                    const StdRegions::ConstFactorMap &factors,
+                    const StdRegions::VarCoeffMap &varcoeff,
+                    const MultiRegions::VarFactorsMap &varfactors,
+                    const bool PhysSpaceForcing);
+
+            /// Global right-hand side of the Helmholtz equation.
+            void HelmholtzForcing(
+                    const Array<OneD, const NekDouble> &inarray,
+                          Array<OneD,       NekDouble> &wsp,
+                    const bool PhysSpaceForcing);
+
             /// Calculates the result of the multiplication of a global
             /// matrix of type specified by \a mkey with a vector given by \a
             /// inarray.
@@ -384,7 +384,7 @@ namespace Nektar
       
       GlobalLinSysSharedPtr ContField3D::GetGlobalLinSys(const GlobalLinSysKey &mkey)
       {
-          return m_globalLinSysManager[mkey];
+          return GetCachedGlobalLinSys(m_globalLinSysManager, mkey);
       }
       
       
@@ -598,9 +598,122 @@ namespace Nektar
                                     const Array<OneD, const NekDouble> &dirForcing,
                                     const bool PhysSpaceForcing)
       {
-          // Inner product of forcing
           int contNcoeffs = m_locToGloMap->GetNumGlobalCoeffs();
           Array<OneD,NekDouble> wsp(contNcoeffs);
+          HelmholtzForcing(inarray, wsp, PhysSpaceForcing);
+          
+          // Solve the system
+          GlobalLinSysKey key(StdRegions::eHelmholtz, m_locToGloMap, factors,varcoeff,varfactors);
+          
+          if(flags.isSet(eUseGlobal))
+          {
+              GlobalSolve(key,wsp,outarray,dirForcing);
+          }
+          else
+          {
+              Array<OneD,NekDouble> tmp(contNcoeffs);
+              LocalToGlobal(outarray,tmp);
+              GlobalSolve(key,wsp,tmp,dirForcing);
+              GlobalToLocal(tmp,outarray);
+          }
+      }
+
+      /**
+       * Fields which share the assembly map of this field (and hence its
+       * global linear system) are solved together with a single call to
+       * GlobalLinSys::SolveMultiple. Any other fields, or all fields when
+       * Robin conditions make the system depend on the boundary values of
+       * this field, are solved one at a time.
+       */
+      void ContField3D::v_HelmSolveMultiple(
+                                    const Array<OneD, ExpListSharedPtr> &fields,
+                                    const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                                          Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                                    const FlagList &flags,
+                                    const StdRegions::ConstFactorMap &factors,
+                                    const StdRegions::VarCoeffMap &varcoeff,
+                                    const MultiRegions::VarFactorsMap &varfactors,
+                                    const bool PhysSpaceForcing)
+      {
+          int i, n = 0;
+          int nFields     = fields.num_elements();
+          int contNcoeffs = m_locToGloMap->GetNumGlobalCoeffs();
+          int nDirBcs     = m_locToGloMap->GetNumGlobalDirBndCoeffs();
+          bool shareSys   = GetRobinBCInfo().size() == 0;
+
+          Array<OneD, ContField3DSharedPtr> shared(nFields);
+          Array<OneD, int> sharedId(nFields);
+
+          for (i = 0; i < nFields; ++i)
+          {
+              ContField3DSharedPtr f =
+                  std::dynamic_pointer_cast<ContField3D>(fields[i]);
+
+              if (shareSys && f && f->m_locToGloMap == m_locToGloMap)
+              {
+                  shared  [n]   = f;
+                  sharedId[n++] = i;
+              }
+              else
+              {
+                  fields[i]->HelmSolve(inarray[i], outarray[i], flags,
+                                       factors, varcoeff, varfactors,
+                                       NullNekDouble1DArray,
+                                       PhysSpaceForcing);
+              }
+          }
+
+          if (n == 0)
+          {
+              return;
+          }
+
+          Array<OneD, Array<OneD, NekDouble> > rhs(n), sol(n);
+          for (i = 0; i < n; ++i)
+          {
+              rhs[i] = Array<OneD, NekDouble>(contNcoeffs);
+              shared[i]->HelmholtzForcing(inarray[sharedId[i]], rhs[i],
+                                          PhysSpaceForcing);
+
+              if (flags.isSet(eUseGlobal))
+              {
+                  sol[i] = outarray[sharedId[i]];
+              }
+              else
+              {
+                  sol[i] = Array<OneD, NekDouble>(contNcoeffs);
+                  shared[i]->LocalToGlobal(outarray[sharedId[i]], sol[i]);
+              }
+              shared[i]->v_ImposeDirichletConditions(sol[i]);
+          }
+
+          if (contNcoeffs - nDirBcs > 0)
+          {
+              GlobalLinSysKey key(StdRegions::eHelmholtz, m_locToGloMap,
+                                  factors, varcoeff, varfactors);
+              GetGlobalLinSys(key)->SolveMultiple(rhs, sol, m_locToGloMap);
+          }
+
+          if (!flags.isSet(eUseGlobal))
+          {
+              for (i = 0; i < n; ++i)
+              {
+                  shared[i]->GlobalToLocal(sol[i], outarray[sharedId[i]]);
+              }
+          }
+      }
+
+      /**
+       * Form the global right-hand side of the Helmholtz problem, including
+       * the weak Neumann and Robin boundary contributions.
+       */
+      void ContField3D::HelmholtzForcing(
+                                    const Array<OneD, const NekDouble> &inarray,
+                                          Array<OneD,       NekDouble> &wsp,
+                                    const bool PhysSpaceForcing)
+      {
+          // Inner product of forcing
+          int contNcoeffs = m_locToGloMap->GetNumGlobalCoeffs();
           if(PhysSpaceForcing)
           {
               IProductWRTBase(inarray,wsp,eGlobal);
@@ -640,21 +753,6 @@ namespace Nektar
           
           // Add weak boundary conditions to forcing
           Vmath::Vadd(contNcoeffs, wsp, 1, gamma, 1, wsp, 1);
-          
-          // Solve the system
-          GlobalLinSysKey key(StdRegions::eHelmholtz, m_locToGloMap, factors,varcoeff,varfactors);
-          
-          if(flags.isSet(eUseGlobal))
-          {
-              GlobalSolve(key,wsp,outarray,dirForcing);
-          }
-          else
-          {
-              Array<OneD,NekDouble> tmp(contNcoeffs);
-              LocalToGlobal(outarray,tmp);
-              GlobalSolve(key,wsp,tmp,dirForcing);
-              GlobalToLocal(tmp,outarray);
-          }
       }
       
       void ContField3D::v_GeneralMatrixOp(
@@ -35,11 +35,53 @@
 
 #include <MultiRegions/ContField3DHomogeneous1D.h>
 #include <MultiRegions/ContField2D.h>
+#include <LibUtilities/BasicUtils/Thread.h>
+
+#include <functional>
 
 namespace Nektar
 {
     namespace MultiRegions
     {
+        std::string ContField3DHomogeneous1D::threadsCmdSwitch =
+            LibUtilities::SessionReader::RegisterCmdLineArgument(
+                "homo-threads", "",
+                "Number of threads solving Fourier modes concurrently.");
+
+        namespace
+        {
+            /// Job running one group of plane solves on a worker thread.
+            class HelmSolveJob : public Thread::ThreadJob
+            {
+            public:
+                HelmSolveJob(const std::function<void()> &func)
+                    : m_func(func)
+                {
+                }
+
+                virtual void Run()
+                {
+                    m_func();
+                }
+
+            private:
+                std::function<void()> m_func;
+            };
+
+            /// Thread pool shared by all fields, created on first use and
+            /// recreated when more threads are requested.
+            Thread::ThreadManagerSharedPtr GetHelmThreadManager(
+                const unsigned int nThreads)
+            {
+                static Thread::ThreadManagerSharedPtr manager;
+                if (!manager || manager->GetMaxNumWorkers() < nThreads)
+                {
+                    manager = Thread::GetThreadManagerFactory().CreateInstance(
+                        "ThreadManagerBoost", nThreads);
+                }
+                return manager;
+            }
+        }
 
         ContField3DHomogeneous1D::ContField3DHomogeneous1D(void):
             DisContField3DHomogeneous1D()
@@ -257,26 +299,103 @@ namespace Nektar
                 const Array<OneD, const NekDouble> &dirForcing,
                 const bool PhysSpaceForcing)
         {
+            std::vector<ContField3DHomogeneous1D*> fields(1, this);
+            Array<OneD, Array<OneD, const NekDouble> > in (1, inarray);
+            Array<OneD, Array<OneD,       NekDouble> > out(1, outarray);
+
+            HelmSolveFields(fields, in, out, flags, factors, varcoeff,
+                            varfactors, dirForcing, PhysSpaceForcing);
+        }
+
+        /**
+         * Fields with the same homogeneous discretisation as this one are
+         * solved together, so that the planes of every field with the same
+         * wavenumber are passed to a single GlobalLinSys::SolveMultiple call.
+         */
+        void ContField3DHomogeneous1D::v_HelmSolveMultiple(
+                const Array<OneD, ExpListSharedPtr> &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                const FlagList &flags,
+                const StdRegions::ConstFactorMap &factors,
+                const StdRegions::VarCoeffMap &varcoeff,
+                const MultiRegions::VarFactorsMap &varfactors,
+                const bool PhysSpaceForcing)
+        {
+            std::vector<ContField3DHomogeneous1D*> homFields;
+            std::vector<int> homId;
+
+            for (int i = 0; i < fields.num_elements(); ++i)
+            {
+                ContField3DHomogeneous1D *f =
+                    dynamic_cast<ContField3DHomogeneous1D*>(fields[i].get());
+
+                if (f && f->m_planes.num_elements() == m_planes.num_elements())
+                {
+                    homFields.push_back(f);
+                    homId.push_back(i);
+                }
+                else
+                {
+                    fields[i]->HelmSolve(inarray[i], outarray[i], flags,
+                                         factors, varcoeff, varfactors,
+                                         NullNekDouble1DArray,
+                                         PhysSpaceForcing);
+                }
+            }
+
+            if (homFields.size() == 0)
+            {
+                return;
+            }
+
+            Array<OneD, Array<OneD, const NekDouble> > in (homFields.size());
+            Array<OneD, Array<OneD,       NekDouble> > out(homFields.size());
+            for (int i = 0; i < homFields.size(); ++i)
+            {
+                in [i] = inarray [homId[i]];
+                out[i] = outarray[homId[i]];
+            }
+
+            HelmSolveFields(homFields, in, out, flags, factors, varcoeff,
+                            varfactors, NullNekDouble1DArray,
+                            PhysSpaceForcing);
+        }
+
+        void ContField3DHomogeneous1D::HelmSolveFields(
+                const std::vector<ContField3DHomogeneous1D*> &fields,
+                const Array<OneD, Array<OneD, const NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                const FlagList &flags,
+                const StdRegions::ConstFactorMap &factors,
+                const StdRegions::VarCoeffMap &varcoeff,
+                const MultiRegions::VarFactorsMap &varfactors,
+                const Array<OneD, const NekDouble> &dirForcing,
+                const bool PhysSpaceForcing)
+        {
 			
-            int n;
+            int n, f;
             int cnt = 0;
             int cnt1 = 0;
-            NekDouble beta;
-            StdRegions::ConstFactorMap new_factors;
-			
-            Array<OneD, NekDouble> e_out;
-            Array<OneD, NekDouble> fce(inarray.num_elements());
-            Array<OneD, const NekDouble> wfce;
-            
-            // Fourier transform forcing function
-            if(m_WaveSpace)
-            {
-                fce = inarray;
-            }
-            else 
+            int nplanes = m_planes.num_elements();
+            int nFields = fields.size();
+
+            Array<OneD, Array<OneD, NekDouble> > fce(nFields);
+
+            // Fourier transform forcing functions
+            for (f = 0; f < nFields; ++f)
             {
-                HomogeneousFwdTrans(inarray, fce,
+                fce[f] = Array<OneD, NekDouble>(inarray[f].num_elements());
+                if(fields[f]->m_WaveSpace)
+                {
+                    Vmath::Vcopy(inarray[f].num_elements(), inarray[f], 1,
+                                 fce[f], 1);
+                }
+                else
+                {
+                    fields[f]->HomogeneousFwdTrans(inarray[f], fce[f],
                                     (flags.isSet(eUseGlobal))?eGlobal:eLocal);
+                }
             }
 			
             bool smode = false;
@@ -289,27 +408,211 @@ namespace Nektar
                 smode = true;
             }
             
-            for(n = 0; n < m_planes.num_elements(); ++n)
+            Array<OneD, int> physOffset (nplanes);
+            Array<OneD, int> coeffOffset(nplanes);
+            for(n = 0; n < nplanes; ++n)
+            {
+                physOffset [n] = cnt;
+                coeffOffset[n] = cnt1;
+                cnt  += m_planes[n]->GetTotPoints();
+                cnt1 += m_planes[n]->GetNcoeffs();
+            }
+
+            // The modes are independent 2D problems. They may be solved
+            // concurrently when the planes are not partitioned, so that no
+            // communication takes place in the solves, and the number of
+            // cached global systems is not bounded, since an eviction would
+            // release the matrices of a system another thread solves with.
+            unsigned int nThreads = 1;
+            if (m_session->DefinesCmdLineArgument("homo-threads"))
+            {
+                nThreads = m_session->GetCmdLineArgument<int>("homo-threads");
+            }
+
+#ifdef NEKTAR_USE_THREAD_SAFETY
+            int cacheSize;
+            m_session->LoadParameter("GlobalSysCacheSize", cacheSize, 0);
+            bool threaded = nThreads > 1 && cacheSize <= 0 &&
+                            m_comm->GetRowComm()->GetSize() == 1;
+#else
+            bool threaded = false;
+#endif
+
+            if (!threaded)
+            {
+                HelmSolvePlanes(0, nplanes, fields, fce, outarray,
+                                physOffset, coeffOffset, flags, factors,
+                                varcoeff, varfactors, dirForcing,
+                                PhysSpaceForcing, smode);
+                return;
+            }
+
+            // The linear systems are created here, one after the other, so
+            // that the threads only look them up.
+            SetUpPlaneSystems(fields, factors, varcoeff, varfactors, smode);
+
+            // Planes of the same wavenumber share their linear system, so
+            // they are solved one after the other by the same job.
+            std::vector<Thread::ThreadJob*> jobs;
+            for(n = 0; n < nplanes; )
+            {
+                int first = n;
+                while (n < nplanes && m_transposition->GetK(n) ==
+                                      m_transposition->GetK(first))
+                {
+                    ++n;
+                }
+                int last = n;
+
+                jobs.push_back(new HelmSolveJob([=, &fields, &fce,
+                                                 &outarray, &flags,
+                                                 &factors, &varcoeff,
+                                                 &varfactors,
+                                                 &dirForcing]() {
+                    HelmSolvePlanes(first, last, fields, fce, outarray,
+                                    physOffset, coeffOffset, flags,
+                                    factors, varcoeff, varfactors,
+                                    dirForcing, PhysSpaceForcing, smode);
+                }));
+            }
+
+            Thread::ThreadManagerSharedPtr tm = GetHelmThreadManager(nThreads);
+            tm->SetNumWorkers(0);
+            tm->QueueJobs(jobs);
+            tm->SetNumWorkers(nThreads);
+            tm->Wait();
+        }
+
+        void ContField3DHomogeneous1D::SetUpPlaneSystems(
+                const std::vector<ContField3DHomogeneous1D*> &fields,
+                const StdRegions::ConstFactorMap &factors,
+                const StdRegions::VarCoeffMap &varcoeff,
+                const MultiRegions::VarFactorsMap &varfactors,
+                const bool smode)
+        {
+            StdRegions::ConstFactorMap new_factors;
+
+            for (int p = 0; p < m_planes.num_elements(); ++p)
             {
-                if(n != 1 || m_transposition->GetK(n) != 0 || smode)
+                int k = m_transposition->GetK(p);
+                if (p == 1 && k == 0 && !smode)
+                {
+                    continue;
+                }
+
+                NekDouble beta = 2*M_PI*k/m_lhom;
+                for (int f = 0; f < fields.size(); ++f)
                 {
-                    
-                    beta = 2*M_PI*(m_transposition->GetK(n))/m_lhom;
                     new_factors = factors;
-                    // add in Homogeneous Fourier direction and SVV if turned on
                     new_factors[StdRegions::eFactorLambda] +=
-                                                beta*beta*(1+GetSpecVanVisc(n));
-                    
-                    wfce = (PhysSpaceForcing)? fce+cnt:fce+cnt1;
-                    m_planes[n]->HelmSolve(wfce,
-                                           e_out = outarray + cnt1,
-                                           flags, new_factors, varcoeff,
-                                           varfactors, dirForcing,
-                                           PhysSpaceForcing);
+                        beta*beta*(1+fields[f]->GetSpecVanVisc(p));
+
+                    std::dynamic_pointer_cast<ContField2D>(
+                        fields[f]->m_planes[p])->SetUpHelmholtzLinSys(
+                            new_factors, varcoeff, varfactors);
                 }
-                
-                cnt  += m_planes[n]->GetTotPoints();
-                cnt1 += m_planes[n]->GetNcoeffs();
+            }
+        }
+
+        /**
+         * The planes of the same wavenumber in all fields have the same
+         * Helmholtz operator. When they also share their assembly map they
+         * are solved with a single call to ContField2D::HelmSolveMultiple.
+         */
+        void ContField3DHomogeneous1D::HelmSolvePlanes(
+                const int first,
+                const int last,
+                const std::vector<ContField3DHomogeneous1D*> &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &fce,
+                      Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                const Array<OneD, const int> &physOffset,
+                const Array<OneD, const int> &coeffOffset,
+                const FlagList &flags,
+                const StdRegions::ConstFactorMap &factors,
+                const StdRegions::VarCoeffMap &varcoeff,
+                const MultiRegions::VarFactorsMap &varfactors,
+                const Array<OneD, const NekDouble> &dirForcing,
+                const bool PhysSpaceForcing,
+                const bool smode)
+        {
+            NekDouble beta;
+            StdRegions::ConstFactorMap new_factors;
+            int nFields = fields.size();
+
+            for(int n = first; n < last; )
+            {
+                int k   = m_transposition->GetK(n);
+                int end = n;
+                while (end < last && m_transposition->GetK(end) == k)
+                {
+                    ++end;
+                }
+
+                std::vector<ExpListSharedPtr>               planes;
+                std::vector<Array<OneD, NekDouble> >        ins, outs;
+                std::vector<StdRegions::ConstFactorMap>     planeFactors;
+
+                for (int p = n; p < end; ++p)
+                {
+                    if (p == 1 && k == 0 && !smode)
+                    {
+                        continue;
+                    }
+
+                    beta = 2*M_PI*k/m_lhom;
+                    for (int f = 0; f < nFields; ++f)
+                    {
+                        new_factors = factors;
+                        // add in Homogeneous Fourier direction and SVV if
+                        // turned on
+                        new_factors[StdRegions::eFactorLambda] +=
+                            beta*beta*(1+fields[f]->GetSpecVanVisc(p));
+
+                        planes.push_back(fields[f]->m_planes[p]);
+                        ins.push_back((PhysSpaceForcing)
+                                      ? fce[f] + physOffset[p]
+                                      : fce[f] + coeffOffset[p]);
+                        outs.push_back(outarray[f] + coeffOffset[p]);
+                        planeFactors.push_back(new_factors);
+                    }
+                }
+
+                bool together = planes.size() > 1 &&
+                                dirForcing.num_elements() == 0;
+                for (int i = 1; together && i < planeFactors.size(); ++i)
+                {
+                    together = planeFactors[i] == planeFactors[0];
+                }
+
+                if (together)
+                {
+                    int nPlanes = planes.size();
+                    Array<OneD, ExpListSharedPtr> pl (nPlanes);
+                    Array<OneD, Array<OneD, NekDouble> > in (nPlanes);
+                    Array<OneD, Array<OneD, NekDouble> > out(nPlanes);
+                    for (int i = 0; i < nPlanes; ++i)
+                    {
+                        pl [i] = planes[i];
+                        in [i] = ins   [i];
+                        out[i] = outs  [i];
+                    }
+
+                    planes[0]->HelmSolveMultiple(pl, in, out, flags,
+                                                 planeFactors[0], varcoeff,
+                                                 varfactors, PhysSpaceForcing);
+                }
+                else
+                {
+                    for (int i = 0; i < planes.size(); ++i)
+                    {
+                        planes[i]->HelmSolve(ins[i], outs[i], flags,
+                                             planeFactors[i], varcoeff,
+                                             varfactors, dirForcing,
+                                             PhysSpaceForcing);
+                    }
+                }
+
+                n = end;
             }
         }
         
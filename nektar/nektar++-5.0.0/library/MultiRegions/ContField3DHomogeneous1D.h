@@ -39,6 +39,8 @@
 #include <MultiRegions/MultiRegionsDeclspec.h>
 #include <MultiRegions/DisContField3DHomogeneous1D.h>
 
+#include <vector>
+
 namespace Nektar
 {
     namespace MultiRegions
@@ -74,9 +76,51 @@ namespace Nektar
             MULTI_REGIONS_EXPORT virtual void v_SmoothField(
                             Array<OneD,NekDouble> &field);
 
+            /// Command-line switch for the number of threads used to solve
+            /// the Helmholtz problems of the Fourier modes concurrently.
+            static std::string threadsCmdSwitch;
+
         protected:
 
         private:
+            /// Solve the Helmholtz problem for one or more fields sharing
+            /// the plane discretisation of this field.
+            void HelmSolveFields(
+                    const std::vector<ContField3DHomogeneous1D*> &fields,
+                    const Array<OneD, Array<OneD, const NekDouble> > &inarray,
+                          Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                    const FlagList &flags,
+                    const StdRegions::ConstFactorMap &factors,
+                    const StdRegions::VarCoeffMap &varcoeff,
+                    const MultiRegions::VarFactorsMap &varfactors,
+                    const Array<OneD, const NekDouble> &dirForcing,
+                    const bool PhysSpaceForcing);
+
+            /// Create the linear systems of every plane of each field.
+            void SetUpPlaneSystems(
+                    const std::vector<ContField3DHomogeneous1D*> &fields,
+                    const StdRegions::ConstFactorMap &factors,
+                    const StdRegions::VarCoeffMap &varcoeff,
+                    const MultiRegions::VarFactorsMap &varfactors,
+                    const bool smode);
+
+            /// Solve the Helmholtz problems of planes [first, last) of
+            /// each field.
+            void HelmSolvePlanes(
+                    const int first,
+                    const int last,
+                    const std::vector<ContField3DHomogeneous1D*> &fields,
+                    const Array<OneD, const Array<OneD, NekDouble> > &fce,
+                          Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                    const Array<OneD, const int> &physOffset,
+                    const Array<OneD, const int> &coeffOffset,
+                    const FlagList &flags,
+                    const StdRegions::ConstFactorMap &factors,
+                    const StdRegions::VarCoeffMap &varcoeff,
+                    const MultiRegions::VarFactorsMap &varfactors,
+                    const Array<OneD, const NekDouble> &dirForcing,
+                    const bool PhysSpaceForcing,
+                    const bool smode);
 
             virtual void v_ImposeDirichletConditions(Array<OneD,NekDouble>& outarray);
 
@@ -99,6 +143,16 @@ namespace Nektar
                     const MultiRegions::VarFactorsMap &varfactors,
                     const Array<OneD, const NekDouble> &dirForcing,
                     const bool PhysSpaceForcing);
+
+            virtual void v_HelmSolveMultiple(
+                    const Array<OneD, ExpListSharedPtr> &fields,
+                    const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                          Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                    const FlagList &flags,
+                    const StdRegions::ConstFactorMap &factors,
+                    const StdRegions::VarCoeffMap &varcoeff,
+                    const MultiRegions::VarFactorsMap &varfactors,
+                    const bool PhysSpaceForcing);
                     
             
             virtual void v_ClearGlobalLinSysManager(void);
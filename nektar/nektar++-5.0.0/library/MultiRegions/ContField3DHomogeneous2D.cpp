@@ -92,10 +92,7 @@ namespace Nektar
                 (*m_exp).push_back(m_lines[0]->GetExp(i));
             }
 
-            int nylines = m_homogeneousBasis_y->GetNumPoints();
-            int nzlines = m_homogeneousBasis_z->GetNumPoints();
-
-            for(n = 1; n < nylines*nzlines; ++n)
+            for(n = 1; n < m_lines.num_elements(); ++n)
             {
                 m_lines[n] = MemoryManager<ContField1D>::AllocateSharedPtr(pSession,graph1D,variable,ImpType);
                 
@@ -167,8 +164,8 @@ namespace Nektar
             int n,m;
             int cnt = 0;
             int cnt1 = 0;
-            int nhom_modes_y = m_homogeneousBasis_y->GetNumModes();
-            int nhom_modes_z = m_homogeneousBasis_z->GetNumModes();
+            int yoffset = m_Ycomm->GetRank()*m_ny;
+            int zoffset = m_Zcomm->GetRank()*m_nz;
             NekDouble beta_y;
             NekDouble beta_z;
             NekDouble beta;
@@ -188,13 +185,15 @@ namespace Nektar
                 HomogeneousFwdTrans(inarray,fce,(flags.isSet(eUseGlobal))?eGlobal:eLocal);
             }
 
+            // Each process solves for its own lines, whose wavenumbers
+            // follow the global mode index.
             int l =0;
-            for(n = 0; n < nhom_modes_z; ++n)
+            for(n = 0; n < m_nz; ++n)
             {
-                for(m = 0; m < nhom_modes_y; ++m, l++)
+                for(m = 0; m < m_ny; ++m, l++)
                 {
-                    beta_z = 2*M_PI*(n/2)/m_lhom_z;
-                    beta_y = 2*M_PI*(m/2)/m_lhom_y;
+                    beta_z = 2*M_PI*((zoffset+n)/2)/m_lhom_z;
+                    beta_y = 2*M_PI*((yoffset+m)/2)/m_lhom_y;
                     beta = beta_y*beta_y + beta_z*beta_z;
                     new_factors = factors;
                     new_factors[StdRegions::eFactorLambda] += beta;
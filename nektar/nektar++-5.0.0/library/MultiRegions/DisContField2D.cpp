@@ -2261,7 +2261,6 @@ namespace Nektar
             boost::ignore_unused(x3_in);
 
             int i;
-            int npoints;
             int nbnd = m_bndCondExpansions.num_elements();
 
             MultiRegions::ExpListSharedPtr locExpList;
@@ -2272,21 +2271,6 @@ namespace Nektar
                     m_bndConditions[i]->IsTimeDependent())
                 {
                     locExpList = m_bndCondExpansions[i];
-                    npoints    = locExpList->GetNpoints();
-                    Array<OneD, NekDouble> x0(npoints, 0.0);
-                    Array<OneD, NekDouble> x1(npoints, 0.0);
-                    Array<OneD, NekDouble> x2(npoints, 0.0);
-
-                    // Homogeneous input case for x2.
-                    if (x2_in == NekConstants::kNekUnsetDouble)
-                    {
-                        locExpList->GetCoords(x0, x1, x2);
-                    }
-                    else
-                    {
-                        locExpList->GetCoords(x0, x1, x2);
-                        Vmath::Fill(npoints, x2_in, x2, 1);
-                    }
 
                     if (m_bndConditions[i]->GetBoundaryConditionType()
                         == SpatialDomains::eDirichlet)
@@ -2300,22 +2284,16 @@ namespace Nektar
                         if (filebcs != "")
                         {
                             ExtractFileBCs(filebcs, bcPtr->GetComm(), varName, locExpList);
+                            locExpList->FwdTrans_BndConstrained(
+                                locExpList->GetPhys(),
+                                locExpList->UpdateCoeffs());
                         }
                         else
                         {
-                            LibUtilities::Equation condition = 
-                                std::static_pointer_cast<
-                                    SpatialDomains::DirichletBoundaryCondition>
-                                        (m_bndConditions[i])->
-                                            m_dirichletCondition;
-                            
-                            condition.Evaluate(x0, x1, x2, time, 
-                                               locExpList->UpdatePhys());
+                            EvaluateBndCondExpression(
+                                i, bcPtr->m_dirichletCondition, time,
+                                x2_in, true, locExpList);
                         }
-
-                        locExpList->FwdTrans_BndConstrained(
-                            locExpList->GetPhys(),
-                            locExpList->UpdateCoeffs());
                     }
                     else if (m_bndConditions[i]->GetBoundaryConditionType()
                              == SpatialDomains::eNeumann)
@@ -2327,21 +2305,16 @@ namespace Nektar
                         if (filebcs != "")
                         {
                             ExtractFileBCs(filebcs, bcPtr->GetComm(), varName, locExpList);
+                            locExpList->IProductWRTBase(
+                                locExpList->GetPhys(),
+                                locExpList->UpdateCoeffs());
                         }
                         else
                         {
-                            LibUtilities::Equation condition =
-                                std::static_pointer_cast<
-                                    SpatialDomains::NeumannBoundaryCondition>
-                                        (m_bndConditions[i])->
-                                            m_neumannCondition;
-                            condition.Evaluate(x0, x1, x2, time, 
-                                               locExpList->UpdatePhys());
+                            EvaluateBndCondExpression(
+                                i, bcPtr->m_neumannCondition, time,
+                                x2_in, false, locExpList);
                         }
-
-                        locExpList->IProductWRTBase(
-                            locExpList->GetPhys(),
-                            locExpList->UpdateCoeffs());
                     }
                     else if (m_bndConditions[i]->GetBoundaryConditionType()
                              == SpatialDomains::eRobin)
@@ -2354,21 +2327,16 @@ namespace Nektar
                         if (filebcs != "")
                         {
                             ExtractFileBCs(filebcs, bcPtr->GetComm(), varName, locExpList);
+                            locExpList->IProductWRTBase(
+                                locExpList->GetPhys(),
+                                locExpList->UpdateCoeffs());
                         }
                         else
                         {
-                            LibUtilities::Equation condition = 
-                                std::static_pointer_cast<
-                                    SpatialDomains::RobinBoundaryCondition>
-                                        (m_bndConditions[i])->
-                                            m_robinFunction;
-                            condition.Evaluate(x0, x1, x2, time,
-                                               locExpList->UpdatePhys());
+                            EvaluateBndCondExpression(
+                                i, bcPtr->m_robinFunction, time,
+                                x2_in, false, locExpList);
                         }
-
-                        locExpList->IProductWRTBase(
-                            locExpList->GetPhys(),
-                            locExpList->UpdateCoeffs());
                     }
                     else if (m_bndConditions[i]->GetBoundaryConditionType()
                              == SpatialDomains::ePeriodic)
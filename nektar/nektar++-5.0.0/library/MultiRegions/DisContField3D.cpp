@@ -2687,14 +2687,6 @@ using namespace std;
                 if (time == 0.0 || m_bndConditions[i]->IsTimeDependent())
                 {
                     locExpList = m_bndCondExpansions[i];
-                    npoints    = locExpList->GetNpoints();
-                    
-                    Array<OneD, NekDouble> x0(npoints, 0.0);
-                    Array<OneD, NekDouble> x1(npoints, 0.0);
-                    Array<OneD, NekDouble> x2(npoints, 0.0);
-                    Array<OneD, NekDouble> valuesFile(npoints, 1.0), valuesExp(npoints, 1.0);
-  
-                    locExpList->GetCoords(x0, x1, x2);
                     
                     if (m_bndConditions[i]->GetBoundaryConditionType()
                         == SpatialDomains::eDirichlet)
@@ -2705,6 +2697,19 @@ using namespace std;
                         string filebcs = bcPtr->m_filename;
                         string exprbcs = bcPtr->m_expr;
 
+                        if (filebcs == "" && exprbcs != "")
+                        {
+                            EvaluateBndCondExpression(
+                                i, bcPtr->m_dirichletCondition, time,
+                                NekConstants::kNekUnsetDouble, true,
+                                locExpList);
+                            continue;
+                        }
+
+                        npoints = locExpList->GetNpoints();
+                        Array<OneD, NekDouble> valuesFile(npoints, 1.0);
+                        Array<OneD, NekDouble> valuesExp (npoints, 1.0);
+
                         if (filebcs != "")
                         {
                             ExtractFileBCs(filebcs, bcPtr->GetComm(), varName, locExpList);
@@ -2713,11 +2718,13 @@ using namespace std;
                         
                         if (exprbcs != "")
                         {
-                            LibUtilities::Equation  condition = std::static_pointer_cast<SpatialDomains::
-                                    DirichletBoundaryCondition >(
-                                    m_bndConditions[i])->m_dirichletCondition;
-                            
-                            condition.Evaluate(x0, x1, x2, time, valuesExp);
+                            Array<OneD, NekDouble> x0(npoints, 0.0);
+                            Array<OneD, NekDouble> x1(npoints, 0.0);
+                            Array<OneD, NekDouble> x2(npoints, 0.0);
+                            locExpList->GetCoords(x0, x1, x2);
+
+                            bcPtr->m_dirichletCondition.Evaluate(
+                                x0, x1, x2, time, valuesExp);
                         }
 
                         Vmath::Vmul(npoints, valuesExp, 1, valuesFile, 1, locExpList->UpdatePhys(), 1);
@@ -2740,17 +2747,10 @@ using namespace std;
                         }
                         else
                         {
-                            
-                            LibUtilities::Equation condition = std::
-                                static_pointer_cast<SpatialDomains::
-                                                    NeumannBoundaryCondition>(
-                                    m_bndConditions[i])->m_neumannCondition;
-                        
-                            condition.Evaluate(x0, x1, x2, time, 
-                                               locExpList->UpdatePhys());
-                            
-                            locExpList->IProductWRTBase(locExpList->GetPhys(),
-                                                        locExpList->UpdateCoeffs());
+                            EvaluateBndCondExpression(
+                                i, bcPtr->m_neumannCondition, time,
+                                NekConstants::kNekUnsetDouble, false,
+                                locExpList);
                         }
                     }
                     else if (m_bndConditions[i]->GetBoundaryConditionType()
@@ -2764,22 +2764,16 @@ using namespace std;
                         if (filebcs != "")
                         {
                             ExtractFileBCs(filebcs, bcPtr->GetComm(), varName, locExpList);
+                            locExpList->IProductWRTBase(locExpList->GetPhys(),
+                                                        locExpList->UpdateCoeffs());
                         }
                         else
                         {
-                            LibUtilities::Equation condition = std::
-                                static_pointer_cast<SpatialDomains::
-                                                    RobinBoundaryCondition>(
-                                    m_bndConditions[i])->m_robinFunction;
-
-                            condition.Evaluate(x0, x1, x2, time, 
-                                               locExpList->UpdatePhys());
-
+                            EvaluateBndCondExpression(
+                                i, bcPtr->m_robinFunction, time,
+                                NekConstants::kNekUnsetDouble, false,
+                                locExpList);
                         }
-
-                        locExpList->IProductWRTBase(locExpList->GetPhys(),
-                                                    locExpList->UpdateCoeffs());
-                        
                     }
                     else if (m_bndConditions[i]->GetBoundaryConditionType()
                              == SpatialDomains::ePeriodic)
@@ -291,14 +291,6 @@ namespace Nektar
                 if (time == 0.0 || m_bndConditions[i]->IsTimeDependent())
                 {
                     locExpList = m_bndCondExpansions[i];
-                    npoints    = locExpList->GetNpoints();
-                    
-                    Array<OneD, NekDouble> x0(npoints, 0.0);
-                    Array<OneD, NekDouble> x1(npoints, 0.0);
-                    Array<OneD, NekDouble> x2(npoints, 0.0);
-                    Array<OneD, NekDouble> valuesFile(npoints, 1.0), valuesExp(npoints, 1.0);
-  
-                    locExpList->GetCoords(x0, x1, x2);
                     
                     if (m_bndConditions[i]->GetBoundaryConditionType()
                         == SpatialDomains::eDirichlet)
@@ -309,6 +301,23 @@ namespace Nektar
 			std::string filebcs = bcPtr->m_filename;
 			std::string exprbcs = bcPtr->m_expr;
 
+                        if (filebcs == "" && exprbcs != "")
+                        {
+                            // set wave space to false since the values are
+                            // set up in physical space
+                            locExpList->SetWaveSpace(false);
+
+                            EvaluateBndCondExpression(
+                                i, bcPtr->m_dirichletCondition, time,
+                                NekConstants::kNekUnsetDouble, true,
+                                locExpList);
+                            continue;
+                        }
+
+                        npoints = locExpList->GetNpoints();
+                        Array<OneD, NekDouble> valuesFile(npoints, 1.0);
+                        Array<OneD, NekDouble> valuesExp (npoints, 1.0);
+
                         if (filebcs != "")
                         {
                             ExtractFileBCs(filebcs, bcPtr->GetComm(), varName, locExpList);
@@ -317,12 +326,13 @@ namespace Nektar
                         
                         if (exprbcs != "")
                         {
-                            LibUtilities::Equation  condition =
-                                std::static_pointer_cast<SpatialDomains::
-                                    DirichletBoundaryCondition >(
-                                    m_bndConditions[i])->m_dirichletCondition;
-                            
-                            condition.Evaluate(x0, x1, x2, time, valuesExp);
+                            Array<OneD, NekDouble> x0(npoints, 0.0);
+                            Array<OneD, NekDouble> x1(npoints, 0.0);
+                            Array<OneD, NekDouble> x2(npoints, 0.0);
+                            locExpList->GetCoords(x0, x1, x2);
+
+                            bcPtr->m_dirichletCondition.Evaluate(
+                                x0, x1, x2, time, valuesExp);
                         }
 
                         Vmath::Vmul(npoints, valuesExp, 1, valuesFile, 1,
@@ -350,16 +360,10 @@ namespace Nektar
                         }
                         else
                         {
-                            LibUtilities::Equation condition = std::
-                                static_pointer_cast<SpatialDomains::
-                                                    NeumannBoundaryCondition>(
-                                    m_bndConditions[i])->m_neumannCondition;
-                        
-                            condition.Evaluate(x0, x1, x2, time, 
-                                               locExpList->UpdatePhys());
-                            
-                            locExpList->IProductWRTBase(locExpList->GetPhys(),
-                                                        locExpList->UpdateCoeffs());
+                            EvaluateBndCondExpression(
+                                i, bcPtr->m_neumannCondition, time,
+                                NekConstants::kNekUnsetDouble, false,
+                                locExpList);
                         }
                     }
                     else if (m_bndConditions[i]->GetBoundaryConditionType()
@@ -373,22 +377,16 @@ namespace Nektar
                         if (filebcs != "")
                         {
                             ExtractFileBCs(filebcs, bcPtr->GetComm(), varName, locExpList);
+                            locExpList->IProductWRTBase(locExpList->GetPhys(),
+                                                        locExpList->UpdateCoeffs());
                         }
                         else
                         {
-                            LibUtilities::Equation condition = std::
-                                static_pointer_cast<SpatialDomains::
-                                                    RobinBoundaryCondition>(
-                                    m_bndConditions[i])->m_robinFunction;
-
-                            condition.Evaluate(x0, x1, x2, time, 
-                                               locExpList->UpdatePhys());
-
+                            EvaluateBndCondExpression(
+                                i, bcPtr->m_robinFunction, time,
+                                NekConstants::kNekUnsetDouble, false,
+                                locExpList);
                         }
-
-                        locExpList->IProductWRTBase(locExpList->GetPhys(),
-                                                    locExpList->UpdateCoeffs());
-                        
                     }
                     else if (m_bndConditions[i]->GetBoundaryConditionType()
                              == SpatialDomains::ePeriodic)
@@ -114,10 +114,7 @@ namespace Nektar
                 (*m_exp).push_back(m_lines[0]->GetExp(i));
             }
             
-            int nylines = m_homogeneousBasis_y->GetNumPoints();
-            int nzlines = m_homogeneousBasis_z->GetNumPoints();
-            
-            for(n = 1; n < nylines*nzlines; ++n)
+            for(n = 1; n < m_lines.num_elements(); ++n)
             {
                 m_lines[n] = MemoryManager<DisContField1D>::AllocateSharedPtr(pSession,graph1D,variable,ImpType);
                 for(i = 0; i < nel; ++i)
@@ -185,16 +182,17 @@ namespace Nektar
             const std::string varName)
         {
             int n, m;
-            const Array<OneD, const NekDouble> y = m_homogeneousBasis_y->GetZ();
-            const Array<OneD, const NekDouble> z = m_homogeneousBasis_z->GetZ();
+            Array<OneD, NekDouble> y;
+            Array<OneD, NekDouble> z;
+
+            GetHomogeneousCoords(y, z);
 
             for (n = 0; n < m_nz; ++n)
             {
                 for (m = 0; m < m_ny; ++m)
                 {
                     m_lines[m+(n*m_ny)]->EvaluateBoundaryConditions(
-                        time, varName, 0.5*m_lhom_y*(1.0+y[m]), 
-                        0.5*m_lhom_z*(1.0+z[n]));
+                        time, varName, y[m], z[n]);
                 }
             }
             
@@ -223,8 +221,8 @@ namespace Nektar
             int n,m;
             int cnt = 0;
             int cnt1 = 0;
-            int nhom_modes_y = m_homogeneousBasis_y->GetNumModes();
-			int nhom_modes_z = m_homogeneousBasis_z->GetNumModes();
+            int yoffset = m_Ycomm->GetRank()*m_ny;
+            int zoffset = m_Zcomm->GetRank()*m_nz;
             NekDouble beta_y;
 			NekDouble beta_z;
 			StdRegions::ConstFactorMap new_factors;
@@ -243,25 +241,26 @@ namespace Nektar
                 HomogeneousFwdTrans(inarray,fce);
             }
 
-            for(n = 0; n < nhom_modes_z; ++n)
+            int l = 0;
+            for(n = 0; n < m_nz; ++n)
             {
-                for(m = 0; m < nhom_modes_y; ++m)
+                for(m = 0; m < m_ny; ++m, ++l)
                 {
-                    beta_z = 2*M_PI*(n/2)/m_lhom_z;
-                    beta_y = 2*M_PI*(m/2)/m_lhom_y;
+                    beta_z = 2*M_PI*((zoffset+n)/2)/m_lhom_z;
+                    beta_y = 2*M_PI*((yoffset+m)/2)/m_lhom_y;
                     new_factors = factors;
                     new_factors[StdRegions::eFactorLambda] +=
                         beta_y*beta_y + beta_z*beta_z;
                     
                     wfce = (PhysSpaceForcing)? fce+cnt:fce+cnt1;
-                    m_lines[n]->HelmSolve(wfce,
+                    m_lines[l]->HelmSolve(wfce,
                                           e_out = outarray + cnt1,
                                           flags, new_factors,
                                           varcoeff, varfactors,dirForcing,
                                           PhysSpaceForcing);
                     
-                    cnt  += m_lines[n]->GetTotPoints();
-                    cnt1 += m_lines[n]->GetNcoeffs();
+                    cnt  += m_lines[l]->GetTotPoints();
+                    cnt1 += m_lines[l]->GetNcoeffs();
                 }
             }
         }
@@ -32,7 +32,16 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <cstdint>
+
+#include <list>
+
 #include <boost/core/ignore_unused.hpp>
+#ifdef NEKTAR_USE_THREAD_SAFETY
+#include <boost/thread/recursive_mutex.hpp>
+#include <boost/thread/lock_guard.hpp>
+#endif
 
 #include <MultiRegions/ExpList.h>
 #include <LibUtilities/Communication/Comm.h>
@@ -107,7 +116,8 @@ namespace Nektar
             m_coeff_offset(),
             m_phys_offset(),
             m_blockMat(MemoryManager<BlockMatrixMap>::AllocateSharedPtr()),
-            m_WaveSpace(false)
+            m_WaveSpace(false),
+            m_globalSysCacheSize(-1)
         {
             SetExpType(eNoType);
         }
@@ -133,7 +143,8 @@ namespace Nektar
             m_coeff_offset(),
             m_phys_offset(),
             m_blockMat(MemoryManager<BlockMatrixMap>::AllocateSharedPtr()),
-            m_WaveSpace(false)
+            m_WaveSpace(false),
+            m_globalSysCacheSize(-1)
         {
             SetExpType(eNoType);
         }
@@ -160,7 +171,8 @@ namespace Nektar
             m_coeff_offset(),
             m_phys_offset(),
             m_blockMat(MemoryManager<BlockMatrixMap>::AllocateSharedPtr()),
-            m_WaveSpace(false)
+            m_WaveSpace(false),
+            m_globalSysCacheSize(-1)
         {
             SetExpType(eNoType);
         }
@@ -186,7 +198,8 @@ namespace Nektar
             m_coeff_offset(),
             m_phys_offset(),
             m_blockMat(MemoryManager<BlockMatrixMap>::AllocateSharedPtr()),
-            m_WaveSpace(false)
+            m_WaveSpace(false),
+            m_globalSysCacheSize(-1)
         {
             SetExpType(eNoType);
 
@@ -225,7 +238,8 @@ namespace Nektar
             m_phys_offset(in.m_phys_offset),
             m_globalOptParam(in.m_globalOptParam),
             m_blockMat(in.m_blockMat),
-            m_WaveSpace(false)
+            m_WaveSpace(false),
+            m_globalSysCacheSize(in.m_globalSysCacheSize)
         {
             SetExpType(eNoType);
 
@@ -1378,6 +1392,70 @@ namespace Nektar
                                                         vExpList,  locToGloMap);
         }
 
+        /**
+         * Global linear systems are held in a pool which is shared by all
+         * fields. Each new value of the constants of an operator, e.g. the
+         * Helmholtz constant after a change of time-step, adds a system to
+         * this pool. When the session parameter GlobalSysCacheSize is
+         * positive, at most that many systems are kept in the pool: once the
+         * limit is exceeded, the least recently used system of any field is
+         * removed from the pool together with the elemental static
+         * condensation matrices it was assembled from. Otherwise, systems are
+         * kept until the pool is cleared.
+         *
+         * @param   manager     Manager of the global linear systems.
+         * @param   mkey        Key of the requested linear system.
+         * @return  (A shared pointer to) the global linear system.
+         */
+        GlobalLinSysSharedPtr ExpList::GetCachedGlobalLinSys(
+            LibUtilities::NekManager<GlobalLinSysKey, GlobalLinSys> &manager,
+            const GlobalLinSysKey &mkey)
+        {
+            if (m_globalSysCacheSize < 0)
+            {
+                m_session->LoadParameter(
+                    "GlobalSysCacheSize", m_globalSysCacheSize, 0);
+            }
+
+            if (m_globalSysCacheSize <= 0)
+            {
+                return manager[mkey];
+            }
+
+            // Keys of the systems of the shared "GlobalLinSys" pool, most
+            // recently used first.
+            static std::list<GlobalLinSysKey> usage;
+#ifdef NEKTAR_USE_THREAD_SAFETY
+            static boost::recursive_mutex usageMutex;
+            boost::lock_guard<boost::recursive_mutex> lock(usageMutex);
+#endif
+
+            for (auto it = usage.begin(); it != usage.end(); ++it)
+            {
+                if (!(*it < mkey) && !(mkey < *it))
+                {
+                    usage.erase(it);
+                    break;
+                }
+            }
+
+            GlobalLinSysSharedPtr linSys = manager[mkey];
+            usage.push_front(mkey);
+
+            while (usage.size() > static_cast<size_t>(m_globalSysCacheSize))
+            {
+                const GlobalLinSysKey &key = usage.back();
+                if (manager.AlreadyCreated(key))
+                {
+                    manager[key]->ReleaseLocalMatrices();
+                    manager.DeleteObject(key);
+                }
+                usage.pop_back();
+            }
+
+            return linSys;
+        }
+
         GlobalLinSysSharedPtr ExpList::GenGlobalBndLinSys(
                     const GlobalLinSysKey     &mkey,
                     const AssemblyMapSharedPtr &locToGloMap)
@@ -1398,6 +1476,173 @@ namespace Nektar
         }
 
 
+        /**
+         * Evaluates the expression \a condition of the boundary condition of
+         * region \a region at the quadrature points of its expansion \a
+         * bndExp and projects it onto the coefficients of \a bndExp, with a
+         * constrained forward transform for a Dirichlet condition and an
+         * inner product otherwise.
+         *
+         * The coordinates of the points are computed once per region. When
+         * the expression is the product of a function of time and a function
+         * of space, the latter is evaluated and projected once: since both
+         * projections are linear, later updates only scale the cached values
+         * and coefficients. Other Dirichlet conditions on edges are
+         * projected with elemental matrices built on first use, which avoids
+         * the interpolation and mass matrix solve of each element.
+         *
+         * @param   region      Index of the boundary region.
+         * @param   condition   Expression of the boundary condition.
+         * @param   time        Time at which it is evaluated.
+         * @param   x2_in       Third coordinate of the points in the
+         *                      homogeneous case, or kNekUnsetDouble.
+         * @param   dirichlet   Whether the condition is of Dirichlet type.
+         * @param   bndExp      Expansion of the boundary region.
+         */
+        void ExpList::EvaluateBndCondExpression(
+            const int                       region,
+            const LibUtilities::Equation   &condition,
+            const NekDouble                 time,
+            const NekDouble                 x2_in,
+            const bool                      dirichlet,
+            const std::shared_ptr<ExpList> &bndExp)
+        {
+            int npoints = bndExp->GetNpoints();
+            int ncoeffs = bndExp->GetNcoeffs();
+            BndCondCache &cache = m_bndCondCache[region];
+
+            if (cache.coords.num_elements() == 0 || cache.x2_in != x2_in)
+            {
+                cache.coords = Array<OneD, Array<OneD, NekDouble> >(3);
+                for (int i = 0; i < 3; ++i)
+                {
+                    cache.coords[i] = Array<OneD, NekDouble>(npoints, 0.0);
+                }
+                bndExp->GetCoords(cache.coords[0], cache.coords[1],
+                                  cache.coords[2]);
+
+                // Homogeneous input case for x2.
+                if (x2_in != NekConstants::kNekUnsetDouble)
+                {
+                    Vmath::Fill(npoints, x2_in, cache.coords[2], 1);
+                }
+
+                cache.x2_in    = x2_in;
+                cache.revision = -1;
+            }
+
+            int revision = m_session->GetInterpreter()->GetParameterRevision();
+            std::string expr = condition.GetExpression();
+
+            if (cache.revision != revision || cache.expr != expr ||
+                cache.dirichlet != dirichlet)
+            {
+                cache.expr      = expr;
+                cache.dirichlet = dirichlet;
+                cache.revision  = revision;
+                cache.separable = condition.Separate(
+                    "t", cache.timeFactor, cache.spaceFactor);
+
+                if (cache.separable)
+                {
+                    cache.phys   = Array<OneD, NekDouble>(npoints);
+                    cache.coeffs = Array<OneD, NekDouble>(ncoeffs);
+
+                    cache.spaceFactor->Evaluate(
+                        cache.coords[0], cache.coords[1], cache.coords[2],
+                        cache.phys);
+
+                    if (dirichlet)
+                    {
+                        bndExp->FwdTrans_BndConstrained(cache.phys,
+                                                        cache.coeffs);
+                    }
+                    else
+                    {
+                        bndExp->IProductWRTBase(cache.phys, cache.coeffs);
+                    }
+                }
+            }
+
+            if (cache.separable)
+            {
+                NekDouble scale = cache.timeFactor ?
+                    cache.timeFactor->Evaluate(0.0, 0.0, 0.0, time) : 1.0;
+
+                Vmath::Smul(npoints, scale, cache.phys, 1,
+                            bndExp->UpdatePhys(), 1);
+                Vmath::Smul(ncoeffs, scale, cache.coeffs, 1,
+                            bndExp->UpdateCoeffs(), 1);
+                return;
+            }
+
+            condition.Evaluate(cache.coords[0], cache.coords[1],
+                               cache.coords[2], time, bndExp->UpdatePhys());
+
+            if (!dirichlet)
+            {
+                bndExp->IProductWRTBase(bndExp->GetPhys(),
+                                        bndExp->UpdateCoeffs());
+                return;
+            }
+
+            // The elemental matrices are only worth their storage on edges;
+            // faces and homogeneous expansions use the elemental transforms.
+            if (bndExp->GetExpType() != e1D)
+            {
+                bndExp->FwdTrans_BndConstrained(bndExp->GetPhys(),
+                                                bndExp->UpdateCoeffs());
+                return;
+            }
+
+            int nexp = bndExp->GetExpSize();
+
+            if (cache.projector.num_elements() == 0)
+            {
+                int size = 0;
+                for (int n = 0; n < nexp; ++n)
+                {
+                    size += bndExp->GetExp(n)->GetNcoeffs() *
+                            bndExp->GetExp(n)->GetTotPoints();
+                }
+                cache.projector = Array<OneD, NekDouble>(size);
+
+                // Column j of the matrix of an element is the projection of
+                // the j-th unit vector of its points.
+                Array<OneD, NekDouble> tmp;
+                for (int n = 0, cnt = 0; n < nexp; ++n)
+                {
+                    LocalRegions::ExpansionSharedPtr exp = bndExp->GetExp(n);
+                    int nm = exp->GetNcoeffs();
+                    int nq = exp->GetTotPoints();
+                    Array<OneD, NekDouble> unit(nq, 0.0);
+
+                    for (int j = 0; j < nq; ++j, cnt += nm)
+                    {
+                        unit[j] = 1.0;
+                        exp->FwdTrans_BndConstrained(
+                            unit, tmp = cache.projector + cnt);
+                        unit[j] = 0.0;
+                    }
+                }
+            }
+
+            const Array<OneD, const NekDouble> &phys = bndExp->GetPhys();
+            Array<OneD, NekDouble> &coeffs = bndExp->UpdateCoeffs();
+
+            for (int n = 0, cnt = 0; n < nexp; ++n)
+            {
+                int nm = bndExp->GetExp(n)->GetNcoeffs();
+                int nq = bndExp->GetExp(n)->GetTotPoints();
+
+                Blas::Dgemv('N', nm, nq, 1.0, &cache.projector[cnt], nm,
+                            &phys[bndExp->GetPhys_Offset(n)], 1, 0.0,
+                            &coeffs[bndExp->GetCoeff_Offset(n)], 1);
+                cnt += nm * nq;
+            }
+        }
+
+
         /**
          * Given the elemental coefficients \f$\hat{u}_n^e\f$ of
          * an expansion, this function evaluates the spectral/hp
@@ -1484,13 +1729,11 @@ namespace Nektar
             NekDouble x = (gloCoords.num_elements() > 0 ? gloCoords[0] : 0.0);
             NekDouble y = (gloCoords.num_elements() > 1 ? gloCoords[1] : 0.0);
             NekDouble z = (gloCoords.num_elements() > 2 ? gloCoords[2] : 0.0);
-            SpatialDomains::PointGeomSharedPtr p
-                = MemoryManager<SpatialDomains::PointGeom>::AllocateSharedPtr(
-                        GetExp(0)->GetCoordim(), -1, x, y, z);
 
             // Get the list of elements whose bounding box contains the desired
             // point.
-            std::vector<int> elmts = m_graph->GetElementsContainingPoint(p);
+            std::vector<int> elmts;
+            m_graph->GetElementsContainingPoint(x, y, z, elmts);
 
             NekDouble nearpt     = 1e6;
             NekDouble nearpt_min = 1e6;
@@ -1547,6 +1790,117 @@ namespace Nektar
             }
         }
 
+        /**
+         * Locate a batch of points, given by their coordinates @p coords
+         * stored direction by direction, i.e. @p coords[d][i] is the d-th
+         * coordinate of point i. On output, @p elmtIds[i] holds the index
+         * of the expansion containing point i (or -1 if the point was not
+         * found and @p returnNearestElmt is false) and @p locCoords[d][i]
+         * its local coordinates in that expansion.
+         *
+         * The points are visited in the order of their Morton code, so that
+         * consecutive points are close to each other. Each point is first
+         * tested against the element in which the previous point was found,
+         * and the bounding box tree is only queried when this fails. For
+         * points which are sampled along lines, planes or the quadrature
+         * points of another mesh this avoids most tree queries and most
+         * failed inverse mappings of candidate elements.
+         */
+        void ExpList::GetExpIndices(
+            const Array<OneD, const Array<OneD, NekDouble> > &coords,
+                  Array<OneD, int>                           &elmtIds,
+                  Array<OneD, Array<OneD, NekDouble> >       &locCoords,
+                  NekDouble                                   tol,
+                  bool                                        returnNearestElmt)
+        {
+            int dim  = coords.num_elements();
+            int npts = dim > 0 ? coords[0].num_elements() : 0;
+
+            if (elmtIds.num_elements() != npts)
+            {
+                elmtIds = Array<OneD, int>(npts);
+            }
+            if (locCoords.num_elements() != dim)
+            {
+                locCoords = Array<OneD, Array<OneD, NekDouble> >(dim);
+            }
+            for (int d = 0; d < dim; ++d)
+            {
+                if (locCoords[d].num_elements() != npts)
+                {
+                    locCoords[d] = Array<OneD, NekDouble>(npts, 0.0);
+                }
+            }
+
+            if (npts == 0)
+            {
+                return;
+            }
+
+            // Quantise the coordinates in the bounding box of the points on
+            // 21 bits per direction and interleave them to a Morton code.
+            std::vector<std::pair<uint64_t, int> > order(npts);
+            Array<OneD, NekDouble> xmin(dim), scale(dim);
+            for (int d = 0; d < dim; ++d)
+            {
+                xmin[d] = Vmath::Vmin(npts, coords[d], 1);
+                NekDouble len = Vmath::Vmax(npts, coords[d], 1) - xmin[d];
+                scale[d] = len > 0.0 ? ((1 << 21) - 1) / len : 0.0;
+            }
+
+            for (int i = 0; i < npts; ++i)
+            {
+                uint64_t code = 0;
+                for (int d = 0; d < dim; ++d)
+                {
+                    uint64_t q = static_cast<uint64_t>(
+                        (coords[d][i] - xmin[d]) * scale[d]);
+                    for (int b = 0; b < 21; ++b)
+                    {
+                        code |= ((q >> b) & 1) << (dim * b + d);
+                    }
+                }
+                order[i] = std::make_pair(code, i);
+            }
+            std::sort(order.begin(), order.end());
+
+            Array<OneD, NekDouble> gloCoord(dim), locCoord(dim);
+            NekDouble resid;
+            int prev = -1;
+
+            for (int n = 0; n < npts; ++n)
+            {
+                int i = order[n].second;
+                for (int d = 0; d < dim; ++d)
+                {
+                    gloCoord[d] = coords[d][i];
+                }
+
+                int id = -1;
+                if (prev >= 0 && (*m_exp)[prev]->GetGeom()->ContainsPoint(
+                                     gloCoord, locCoord, tol, resid))
+                {
+                    id = prev;
+                }
+                else
+                {
+                    id = GetExpIndex(gloCoord, locCoord, tol,
+                                     returnNearestElmt);
+                }
+
+                elmtIds[i] = id;
+                for (int d = 0; d < dim; ++d)
+                {
+                    locCoords[d][i] = locCoord[d];
+                }
+
+                if (id >= 0)
+                {
+                    prev = id;
+                }
+            }
+        }
+
         /**
          * Given some coordinates, output the expansion field value at that
          * point
@@ -2713,6 +3067,27 @@ namespace Nektar
             NEKERROR(ErrorUtil::efatal, "HelmSolve not implemented.");
         }
 
+        /**
+         * The default implementation solves each field in turn.
+         */
+        void ExpList::v_HelmSolveMultiple(
+                const Array<OneD, ExpListSharedPtr> &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                const FlagList &flags,
+                const StdRegions::ConstFactorMap &factors,
+                const StdRegions::VarCoeffMap &varcoeff,
+                const MultiRegions::VarFactorsMap &varfactors,
+                const bool PhysSpaceForcing)
+        {
+            for (int i = 0; i < fields.num_elements(); ++i)
+            {
+                fields[i]->HelmSolve(inarray[i], outarray[i], flags, factors,
+                                     varcoeff, varfactors,
+                                     NullNekDouble1DArray, PhysSpaceForcing);
+            }
+        }
+
         void ExpList::v_LinearAdvectionDiffusionReactionSolve(
                        const Array<OneD, Array<OneD, NekDouble> > &velocity,
                        const Array<OneD, const NekDouble> &inarray,
@@ -3356,7 +3731,8 @@ namespace Nektar
                                                          impTypes, verbose);
                     }
 
-                    Collections::Collection tmp(collExp, impTypes);
+                    Collections::Collection tmp(collExp, impTypes,
+                        colOpt.IsUsingMetricOnTheFly());
                     m_collections.push_back(tmp);
                 }
                 else
@@ -3393,7 +3769,8 @@ namespace Nektar
                                                                  verbose);
                             }
 
-                            Collections::Collection tmp(collExp, impTypes);
+                            Collections::Collection tmp(collExp, impTypes,
+                                colOpt.IsUsingMetricOnTheFly());
                             m_collections.push_back(tmp);
 
 
@@ -3422,7 +3799,8 @@ namespace Nektar
                                                                  impTypes,verbose);
                             }
 
-                            Collections::Collection tmp(collExp, impTypes);
+                            Collections::Collection tmp(collExp, impTypes,
+                                colOpt.IsUsingMetricOnTheFly());
                             m_collections.push_back(tmp);
                             collExp.clear();
                             collcnt = 0;
@@ -296,6 +296,20 @@ namespace Nektar
                 const Array<OneD, const NekDouble> &dirForcing =
                 NullNekDouble1DArray,
                 const bool PhysSpaceForcing = true);
+
+            /// Solve the same Helmholtz problem for several fields of the
+            /// same type as this one.
+            inline void HelmSolveMultiple(
+                const Array<OneD, std::shared_ptr<ExpList> > &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                const FlagList &flags,
+                const StdRegions::ConstFactorMap &factors,
+                const StdRegions::VarCoeffMap &varcoeff =
+                                StdRegions::NullVarCoeffMap,
+                const MultiRegions::VarFactorsMap &varfactors =
+                                 MultiRegions::NullVarFactorsMap,
+                const bool PhysSpaceForcing = true);
             
             /// Solve Advection Diffusion Reaction
             inline void LinearAdvectionDiffusionReactionSolve(
@@ -688,6 +702,15 @@ namespace Nektar
                 Array<OneD, NekDouble>       &locCoords,
                 NekDouble tol = 0.0,
                 bool returnNearestElmt = false);
+
+            /// Locate a batch of points, returning for each the index of the
+            /// expansion containing it and its local coordinates.
+            MULTI_REGIONS_EXPORT void GetExpIndices(
+                const Array<OneD, const Array<OneD, NekDouble> > &coords,
+                      Array<OneD, int>                           &elmtIds,
+                      Array<OneD, Array<OneD, NekDouble> >       &locCoords,
+                NekDouble tol = 0.0,
+                bool returnNearestElmt = false);
             
             /** This function return the expansion field value
              * at the coordinates given as input.
@@ -1112,9 +1135,41 @@ namespace Nektar
             // or not
             bool m_WaveSpace;
 
+            /// Number of global linear systems kept by
+            /// #GetCachedGlobalLinSys, read from GlobalSysCacheSize on first
+            /// use.
+            int m_globalSysCacheSize;
+
             /// Mapping from geometry ID of element to index inside #m_exp
             std::unordered_map<int, int> m_elmtToExpId;
 
+            /// Data reused between updates of the boundary condition of a
+            /// region, see EvaluateBndCondExpression.
+            struct BndCondCache
+            {
+                /// Expression and type of the condition.
+                std::string                     expr;
+                bool                            dirichlet;
+                /// Parameter revision of the interpreter the cached values
+                /// were computed with.
+                int                             revision;
+                /// Homogeneous coordinate the points were computed with.
+                NekDouble                       x2_in;
+                Array<OneD, Array<OneD, NekDouble> > coords;
+                /// Time and space factors of a separable expression.
+                bool                            separable;
+                LibUtilities::EquationSharedPtr timeFactor;
+                LibUtilities::EquationSharedPtr spaceFactor;
+                /// Space factor at the points and its projection.
+                Array<OneD, NekDouble>          phys;
+                Array<OneD, NekDouble>          coeffs;
+                /// Elemental constrained projection matrices.
+                Array<OneD, NekDouble>          projector;
+            };
+
+            /// Cached boundary condition data of each region.
+            std::map<int, BndCondCache> m_bndCondCache;
+
             /// This function assembles the block diagonal matrix of local
             /// matrices of the type \a mtype.
             const DNekScalBlkMatSharedPtr GenBlockMatrix(
@@ -1148,12 +1203,30 @@ namespace Nektar
                 const GlobalLinSysKey &mkey,
                 const std::shared_ptr<AssemblyMapCG> &locToGloMap);
 
+            /// Retrieve the global linear system of type \a mkey from \a
+            /// manager, keeping at most GlobalSysCacheSize systems.
+            std::shared_ptr<GlobalLinSys> GetCachedGlobalLinSys(
+                LibUtilities::NekManager<GlobalLinSysKey, GlobalLinSys>
+                                      &manager,
+                const GlobalLinSysKey &mkey);
+
             /// Generate a GlobalLinSys from information provided by the key
             /// "mkey" and the mapping provided in LocToGloBaseMap.
             std::shared_ptr<GlobalLinSys> GenGlobalBndLinSys(
                 const GlobalLinSysKey     &mkey,
                 const AssemblyMapSharedPtr &locToGloMap);
 
+            /// Evaluates the expression of the boundary condition of a
+            /// region on its expansion and projects it onto the
+            /// coefficients.
+            MULTI_REGIONS_EXPORT void EvaluateBndCondExpression(
+                const int                       region,
+                const LibUtilities::Equation   &condition,
+                const NekDouble                 time,
+                const NekDouble                 x2_in,
+                const bool                      dirichlet,
+                const std::shared_ptr<ExpList> &bndExp);
+
             void ReadGlobalOptimizationParameters()
             {
                 v_ReadGlobalOptimizationParameters();
@@ -1239,6 +1312,16 @@ namespace Nektar
                 const Array<OneD, const NekDouble> &dirForcing,
                 const bool PhysSpaceForcing);
 
+            virtual void v_HelmSolveMultiple(
+                const Array<OneD, std::shared_ptr<ExpList> > &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                const FlagList &flags,
+                const StdRegions::ConstFactorMap &factors,
+                const StdRegions::VarCoeffMap &varcoeff,
+                const MultiRegions::VarFactorsMap &varfactors,
+                const bool PhysSpaceForcing);
+
             virtual void v_LinearAdvectionDiffusionReactionSolve(
                 const Array<OneD, Array<OneD, NekDouble> > &velocity,
                 const Array<OneD, const NekDouble> &inarray,
@@ -1821,6 +1904,27 @@ namespace Nektar
         }
 
 
+        /**
+         * Solve the Helmholtz problem defined by @a factors for each of
+         * @a fields, which must be expansions of the same type and
+         * discretisation as this one. Fields which share a linear system
+         * are solved together through GlobalLinSys::SolveMultiple.
+         */
+        inline void ExpList::HelmSolveMultiple(
+            const Array<OneD, std::shared_ptr<ExpList> > &fields,
+            const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                  Array<OneD,       Array<OneD, NekDouble> > &outarray,
+            const FlagList &flags,
+            const StdRegions::ConstFactorMap &factors,
+            const StdRegions::VarCoeffMap &varcoeff,
+            const MultiRegions::VarFactorsMap &varfactors,
+            const bool PhysSpaceForcing)
+        {
+            v_HelmSolveMultiple(fields, inarray, outarray, flags, factors,
+                                varcoeff, varfactors, PhysSpaceForcing);
+        }
+
+
         /**
          *
          */
@@ -143,23 +143,16 @@ namespace Nektar
 
             int n,m,j;
             Array<OneD, NekDouble> tmp_xc;
-            int nylines = m_homogeneousBasis_y->GetNumPoints();
-            int nzlines = m_homogeneousBasis_z->GetNumPoints();
+            int nylines = m_ny;
+            int nzlines = m_nz;
             int npoints = 1;
             
             // Fill x-y-z-direction
-            Array<OneD, const NekDouble> pts_y =  m_homogeneousBasis_y->GetZ();
-            Array<OneD, const NekDouble> pts_z =  m_homogeneousBasis_z->GetZ();
-            
             Array<OneD, NekDouble> x(npoints);
-            Array<OneD, NekDouble> y(nylines);
-            Array<OneD, NekDouble> z(nzlines);
-            
-            Vmath::Smul(nylines,m_lhom_y/2.0,pts_y,1,y,1);
-            Vmath::Sadd(nylines,m_lhom_y/2.0,y,1,y,1);
+            Array<OneD, NekDouble> y;
+            Array<OneD, NekDouble> z;
             
-            Vmath::Smul(nzlines,m_lhom_z/2.0,pts_z,1,z,1);
-            Vmath::Sadd(nzlines,m_lhom_z/2.0,z,1,z,1);
+            GetHomogeneousCoords(y,z);
             
             m_lines[0]->GetCoords(x);
             
@@ -204,24 +197,17 @@ namespace Nektar
             Array<OneD, NekDouble> tmp_xc;
             int npoints = 1;
             
-            int nylines = m_homogeneousBasis_y->GetNumPoints();
-            int nzlines = m_homogeneousBasis_z->GetNumPoints();
-            
-            // Fill z-direction
-            Array<OneD, const NekDouble> pts_y =  m_homogeneousBasis_y->GetZ();
-            Array<OneD, const NekDouble> pts_z =  m_homogeneousBasis_z->GetZ();
+            int nylines = m_ny;
+            int nzlines = m_nz;
             
             Array<OneD, NekDouble> x(npoints);
-            Array<OneD, NekDouble> y(nylines);
-            Array<OneD, NekDouble> z(nzlines);
+            Array<OneD, NekDouble> y;
+            Array<OneD, NekDouble> z;
             
             m_lines[0]->GetCoords(x);
             
-            Vmath::Smul(nylines,m_lhom_y/2.0,pts_y,1,y,1);
-            Vmath::Sadd(nylines,m_lhom_y/2.0,y,1,y,1);
-            
-            Vmath::Smul(nzlines,m_lhom_z/2.0,pts_z,1,z,1);
-            Vmath::Sadd(nzlines,m_lhom_z/2.0,z,1,z,1);
+            // Fill y and z directions for the local lines
+            GetHomogeneousCoords(y,z);
             
             for(m = 0; m < nzlines; ++m)
             {
@@ -261,8 +247,8 @@ namespace Nektar
             int i,j;
 
             int nquad0 = 1;
-            int nquad1 = m_homogeneousBasis_y->GetNumPoints();
-            int nquad2 = m_homogeneousBasis_z->GetNumPoints();
+            int nquad1 = m_ny;
+            int nquad2 = m_nz;
 
             Array<OneD,NekDouble> coords[3];
 
@@ -293,8 +279,8 @@ namespace Nektar
             int i,j;
             
             int nquad0 = 1;
-            int nquad1 = m_homogeneousBasis_y->GetNumPoints();
-            int nquad2 = m_homogeneousBasis_z->GetNumPoints();
+            int nquad1 = m_ny;
+            int nquad2 = m_nz;
             
             int ntot = nquad0*nquad1*nquad2;
             int ntotminus = (nquad0)*(nquad1-1)*(nquad2-1);
@@ -97,11 +97,8 @@ namespace Nektar
             {
                 (*m_exp).push_back(m_lines[0]->GetExp(j));
             }
-			
-            int ny = m_homogeneousBasis_y->GetNumPoints();
-            int nz = m_homogeneousBasis_z->GetNumPoints();
-            
-            for(n = 1; n < (ny*nz); ++n)
+
+            for(n = 1; n < m_lines.num_elements(); ++n)
             {
                 m_lines[n] = MemoryManager<ExpList1D>::AllocateSharedPtr(*line_zero,False);
                 for(j = 0; j < nel; ++j)
@@ -228,24 +225,17 @@ namespace Nektar
         {
             int n,m,j;
             Array<OneD, NekDouble> tmp_xc;
-			int nylines = m_homogeneousBasis_y->GetNumPoints();
-			int nzlines = m_homogeneousBasis_z->GetNumPoints();
+            int nylines = m_ny;
+            int nzlines = m_nz;
             
 			int npoints  = GetTotPoints(eid);
 
 			// Fill x-y-z-direction
-            Array<OneD, const NekDouble> pts_y =  m_homogeneousBasis_y->GetZ();
-			Array<OneD, const NekDouble> pts_z =  m_homogeneousBasis_z->GetZ();
-            
 			Array<OneD, NekDouble> x(npoints);
-			Array<OneD, NekDouble> y(nylines);
-			Array<OneD, NekDouble> z(nzlines);
+			Array<OneD, NekDouble> y;
+			Array<OneD, NekDouble> z;
 
-            Vmath::Smul(nylines,m_lhom_y/2.0,pts_y,1,y,1);
-            Vmath::Sadd(nylines,m_lhom_y/2.0,y,1,y,1);
-			
-			Vmath::Smul(nzlines,m_lhom_z/2.0,pts_z,1,z,1);
-            Vmath::Sadd(nzlines,m_lhom_z/2.0,z,1,z,1);
+            GetHomogeneousCoords(y,z);
 			
 			(*m_exp)[eid]->GetCoords(x);
 			
@@ -288,24 +278,17 @@ namespace Nektar
             Array<OneD, NekDouble> tmp_xc;
             int npoints = m_lines[0]->GetTotPoints();
 
-            int nylines = m_homogeneousBasis_y->GetNumPoints();
-			int nzlines = m_homogeneousBasis_z->GetNumPoints();
-
-            // Fill z-direction
-            Array<OneD, const NekDouble> pts_y =  m_homogeneousBasis_y->GetZ();
-			Array<OneD, const NekDouble> pts_z =  m_homogeneousBasis_z->GetZ();
+            int nylines = m_ny;
+            int nzlines = m_nz;
 
             Array<OneD, NekDouble> x(npoints);
-			Array<OneD, NekDouble> y(nylines);
-			Array<OneD, NekDouble> z(nzlines);
+			Array<OneD, NekDouble> y;
+			Array<OneD, NekDouble> z;
 			
 			m_lines[0]->GetCoords(x);
-			
-            Vmath::Smul(nylines,m_lhom_y/2.0,pts_y,1,y,1);
-            Vmath::Sadd(nylines,m_lhom_y/2.0,y,1,y,1);
-			
-			Vmath::Smul(nzlines,m_lhom_z/2.0,pts_z,1,z,1);
-            Vmath::Sadd(nzlines,m_lhom_z/2.0,z,1,z,1);
+
+            // Fill y and z directions for the local lines
+            GetHomogeneousCoords(y,z);
 
             for(m = 0; m < nzlines; ++m)
             {
@@ -332,8 +315,8 @@ namespace Nektar
             int i,j;
 
             int nquad0 = (*m_exp)[expansion]->GetNumPoints(0);
-            int nquad1 = m_homogeneousBasis_y->GetNumPoints();
-            int nquad2 = m_homogeneousBasis_z->GetNumPoints();
+            int nquad1 = m_ny;
+            int nquad2 = m_nz;
 
             Array<OneD,NekDouble> coords[3];
 
@@ -361,8 +344,8 @@ namespace Nektar
         {
             int i,j,k;
             int nquad0 = (*m_exp)[expansion]->GetNumPoints(0);
-            int nquad1 = m_homogeneousBasis_y->GetNumPoints();
-            int nquad2 = m_homogeneousBasis_z->GetNumPoints();
+            int nquad1 = m_ny;
+            int nquad2 = m_nz;
             int ntot = nquad0*nquad1*nquad2;
             int ntotminus = (nquad0-1)*(nquad1-1)*(nquad2-1);
 
@@ -442,18 +425,20 @@ namespace Nektar
             Array<OneD, const NekDouble> w_y = m_homogeneousBasis_y->GetW();
             Array<OneD, const NekDouble> w_z = m_homogeneousBasis_z->GetW();
             
-            int nylines = m_homogeneousBasis_y->GetNumPoints();
-            int nzlines = m_homogeneousBasis_z->GetNumPoints();
+            int yoffset = m_Ycomm->GetRank()*m_ny;
+            int zoffset = m_Zcomm->GetRank()*m_nz;
             
-            for(int m = 0; m < nzlines; ++m)
+            for(int m = 0; m < m_nz; ++m)
             {
-                for(int n = 0; n < nylines; ++n)
+                for(int n = 0; n < m_ny; ++n)
                 {
-                    errL2 = m_lines[n+(m*nylines)]->L2(inarray + cnt, soln + cnt);
-                    cnt  += m_lines[n+(m*nylines)]->GetTotPoints();
-                    err  += errL2*errL2*w_y[n]*m_lhom_y*0.5*w_z[m]*m_lhom_z*0.5;
+                    errL2 = m_lines[n+(m*m_ny)]->L2(inarray + cnt, soln + cnt);
+                    cnt  += m_lines[n+(m*m_ny)]->GetTotPoints();
+                    err  += errL2*errL2*w_y[yoffset+n]*m_lhom_y*0.5*
+                        w_z[zoffset+m]*m_lhom_z*0.5;
                 }
             }
+            m_comm->GetColumnComm()->AllReduce(err, LibUtilities::ReduceSum);
             
             return sqrt(err);
         }
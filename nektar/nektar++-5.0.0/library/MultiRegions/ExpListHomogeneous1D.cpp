@@ -100,6 +100,14 @@ namespace Nektar
 
             if(m_useFFT)
             {
+                if (m_session->DefinesCmdLineArgument("fftw-wisdom"))
+                {
+                    LibUtilities::NektarFFT::SetWisdomFile(
+                        m_session->GetCmdLineArgument<std::string>(
+                            "fftw-wisdom"),
+                        m_comm->GetRank() == 0);
+                }
+
                 m_FFT = LibUtilities::GetNektarFFTFactory().CreateInstance(
                                 "NekFFTW", m_homogeneousBasis->GetNumPoints());
             }
@@ -659,42 +667,42 @@ namespace Nektar
                                       + (num_points_per_plane % nP > 0);
                 }
 
-                Array<OneD, NekDouble> fft_in (num_dfts_per_proc*m_homogeneousBasis->GetNumPoints(),0.0);
-                Array<OneD, NekDouble> fft_out(num_dfts_per_proc*m_homogeneousBasis->GetNumPoints(),0.0);
-        
+                int nfft = num_dfts_per_proc*m_homogeneousBasis->GetNumPoints();
+
+                // Transform directly from the input and into the output
+                // when no (un)shuffling is needed, avoiding the copies.
+                Array<OneD, const NekDouble> fft_in  = inarray;
+                Array<OneD, NekDouble>       fft_out = outarray;
+
                 if(Shuff)
                 {
-                    m_transposition->Transpose(inarray,fft_in,false,LibUtilities::eXYtoZ);
+                    Array<OneD, NekDouble> tmp(nfft,0.0);
+                    m_transposition->Transpose(inarray,tmp,false,LibUtilities::eXYtoZ);
+                    fft_in = tmp;
                 }
-                else 
+
+                if(UnShuff || fft_in.data() == outarray.data())
                 {
-                    Vmath::Vcopy(num_dfts_per_proc*m_homogeneousBasis->GetNumPoints(),
-                                 inarray,1,fft_in,1);
+                    fft_out = Array<OneD, NekDouble>(nfft,0.0);
                 }
-                
+
+                // Transform all lines of this process with a single call
                 if(IsForwards)
                 {
-                    for(int i = 0 ; i < num_dfts_per_proc ; i++)
-                    {
-                        m_FFT->FFTFwdTrans(m_tmpIN = fft_in + i*m_homogeneousBasis->GetNumPoints(), m_tmpOUT = fft_out + i*m_homogeneousBasis->GetNumPoints());
-                    }
+                    m_FFT->FFTFwdTransBatch(num_dfts_per_proc, fft_in, fft_out);
                 }
                 else 
                 {
-                    for(int i = 0 ; i < num_dfts_per_proc ; i++)
-                    {
-                        m_FFT->FFTBwdTrans(m_tmpIN = fft_in + i*m_homogeneousBasis->GetNumPoints(), m_tmpOUT = fft_out + i*m_homogeneousBasis->GetNumPoints());
-                    }
+                    m_FFT->FFTBwdTransBatch(num_dfts_per_proc, fft_in, fft_out);
                 }
         
                 if(UnShuff)
                 {
                     m_transposition->Transpose(fft_out,outarray,false,LibUtilities::eZtoXY);
                 }
-                else 
+                else if(fft_out.data() != outarray.data())
                 {
-                    Vmath::Vcopy(num_dfts_per_proc*m_homogeneousBasis->GetNumPoints(),
-                                 fft_out,1,outarray,1);
+                    Vmath::Vcopy(nfft,fft_out,1,outarray,1);
                 }
             }
             else 
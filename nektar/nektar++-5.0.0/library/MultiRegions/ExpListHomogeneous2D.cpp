@@ -82,17 +82,36 @@ namespace Nektar
             m_transposition = MemoryManager<LibUtilities::Transposition>::AllocateSharedPtr(HomoBasis_y,HomoBasis_z,m_comm->GetColumnComm());
             
             m_Ycomm = m_comm->GetColumnComm()->GetRowComm();
-            m_Zcomm = m_comm->GetColumnComm()->GetRowComm();
+            m_Zcomm = m_comm->GetColumnComm()->GetColumnComm();
 
             m_ny = m_homogeneousBasis_y->GetNumPoints()/m_Ycomm->GetSize();
             m_nz = m_homogeneousBasis_z->GetNumPoints()/m_Zcomm->GetSize();
             
             m_lines = Array<OneD,ExpListSharedPtr>(m_ny*m_nz);
 
+            // Fourier modes are stored as (real, imaginary) pairs which
+            // must not be split between processes.
+            if(m_homogeneousBasis_y->GetBasisType() == LibUtilities::eFourier &&
+               m_Ycomm->GetSize() > 1)
+            {
+                ASSERTL0(m_ny % 2 == 0,
+                         "Number of y modes per process must be even.");
+            }
+            if(m_homogeneousBasis_z->GetBasisType() == LibUtilities::eFourier &&
+               m_Zcomm->GetSize() > 1)
+            {
+                ASSERTL0(m_nz % 2 == 0,
+                         "Number of z modes per process must be even.");
+            }
+
             if(m_useFFT)
             {
-                m_FFT_y = LibUtilities::GetNektarFFTFactory().CreateInstance("NekFFTW", m_ny);
-                m_FFT_z = LibUtilities::GetNektarFFTFactory().CreateInstance("NekFFTW", m_nz);
+                // Transforms act on complete pencils, so use the global
+                // number of points in each direction.
+                m_FFT_y = LibUtilities::GetNektarFFTFactory().CreateInstance(
+                    "NekFFTW", m_homogeneousBasis_y->GetNumPoints());
+                m_FFT_z = LibUtilities::GetNektarFFTFactory().CreateInstance(
+                    "NekFFTW", m_homogeneousBasis_z->GetNumPoints());
             }
             
             if(m_dealiasing)
@@ -113,7 +132,7 @@ namespace Nektar
             m_FFT_z(In.m_FFT_z),
             m_transposition(In.m_transposition),
             m_Ycomm(In.m_Ycomm),
-            m_Zcomm(In.m_Ycomm),
+            m_Zcomm(In.m_Zcomm),
             m_homogeneousBasis_y(In.m_homogeneousBasis_y),
             m_homogeneousBasis_z(In.m_homogeneousBasis_z),
             m_lhom_y(In.m_lhom_y),
@@ -138,7 +157,7 @@ namespace Nektar
             m_FFT_z(In.m_FFT_z),
             m_transposition(In.m_transposition),
             m_Ycomm(In.m_Ycomm),
-            m_Zcomm(In.m_Ycomm),
+            m_Zcomm(In.m_Zcomm),
             m_homogeneousBasis_y(In.m_homogeneousBasis_y),
             m_homogeneousBasis_z(In.m_homogeneousBasis_z),
             m_lhom_y(In.m_lhom_y),
@@ -161,6 +180,29 @@ namespace Nektar
         ExpListHomogeneous2D::~ExpListHomogeneous2D()
         {
         }
+
+        /**
+         * Fill @a y and @a z with the physical coordinates of the m_ny y
+         * lines and m_nz z lines held on this process.
+         */
+        void ExpListHomogeneous2D::GetHomogeneousCoords(
+            Array<OneD, NekDouble> &y,
+            Array<OneD, NekDouble> &z)
+        {
+            Array<OneD, const NekDouble> pts_y = m_homogeneousBasis_y->GetZ();
+            Array<OneD, const NekDouble> pts_z = m_homogeneousBasis_z->GetZ();
+            int yoffset = m_Ycomm->GetRank()*m_ny;
+            int zoffset = m_Zcomm->GetRank()*m_nz;
+
+            y = Array<OneD, NekDouble>(m_ny);
+            z = Array<OneD, NekDouble>(m_nz);
+
+            Vmath::Smul(m_ny,m_lhom_y/2.0,&pts_y[yoffset],1,&y[0],1);
+            Vmath::Sadd(m_ny,m_lhom_y/2.0,y,1,y,1);
+
+            Vmath::Smul(m_nz,m_lhom_z/2.0,&pts_z[zoffset],1,&z[0],1);
+            Vmath::Sadd(m_nz,m_lhom_z/2.0,z,1,z,1);
+        }
         
         void ExpListHomogeneous2D::v_HomogeneousFwdTrans(const Array<OneD, const NekDouble> &inarray, 
                                                          Array<OneD, NekDouble> &outarray, 
@@ -422,47 +464,35 @@ namespace Nektar
                 int n  = m_lines.num_elements();   //number of Fourier points in the Fourier directions (x-z grid)
                 int s  = inarray.num_elements();   //number of total points = n. of Fourier points * n. of points per line
                 int p  = s/n;                      //number of points per line = n of Fourier transform required
+                int ps = m_transposition->GetPencilSize(p); //size of the y and z pencil arrays
+                int ny = m_homogeneousBasis_y->GetNumPoints();
+                int nz = m_homogeneousBasis_z->GetNumPoints();
         
-                Array<OneD, NekDouble> fft_in(s);
-                Array<OneD, NekDouble> fft_out(s);
+                Array<OneD, NekDouble> fft_in(ps, 0.0);
+                Array<OneD, NekDouble> fft_out(ps, 0.0);
         
                 m_transposition->Transpose(inarray,fft_in,false,LibUtilities::eXtoYZ);
                 
                 if(IsForwards)
                 {
-                    for(int i=0;i<(p*m_nz);i++)
-                    {
-                        m_FFT_y->FFTFwdTrans(m_tmpIN = fft_in + i*m_ny, m_tmpOUT = fft_out + i*m_ny);
-                    }
-                    
+                    m_FFT_y->FFTFwdTransBatch(ps/ny, fft_in, fft_out);
                 }
                 else 
                 {
-                    for(int i=0;i<(p*m_nz);i++)
-                    {
-                        m_FFT_y->FFTBwdTrans(m_tmpIN = fft_in + i*m_ny, m_tmpOUT = fft_out + i*m_ny);
-                    }
+                    m_FFT_y->FFTBwdTransBatch(ps/ny, fft_in, fft_out);
                 }
         
                 m_transposition->Transpose(fft_out,fft_in,false,LibUtilities::eYZtoZY);
                 
                 if(IsForwards)
                 {
-                    for(int i=0;i<(p*m_ny);i++)
-                    {
-                        m_FFT_z->FFTFwdTrans(m_tmpIN = fft_in + i*m_nz, m_tmpOUT = fft_out + i*m_nz);
-                    }
-                    
+                    m_FFT_z->FFTFwdTransBatch(ps/nz, fft_in, fft_out);
                 }
                 else 
                 {
-                    for(int i=0;i<(p*m_ny);i++)
-                    {
-                        m_FFT_z->FFTBwdTrans(m_tmpIN = fft_in + i*m_nz, m_tmpOUT = fft_out + i*m_nz);
-                    }
+                    m_FFT_z->FFTBwdTransBatch(ps/nz, fft_in, fft_out);
                 }
         
-                //TODO: required ZYtoX routine
                 m_transposition->Transpose(fft_out,fft_in,false,LibUtilities::eZYtoYZ);
                 
                 m_transposition->Transpose(fft_in,outarray,false,LibUtilities::eYZtoX);
@@ -470,6 +500,10 @@ namespace Nektar
             }
             else 
             {
+                ASSERTL0(m_comm->GetColumnComm()->GetSize() == 1,
+                         "Set USEFFT to run 3D-Homo-2D matrix transforms "
+                         "in parallel.");
+
                 DNekBlkMatSharedPtr blkmatY;
                 DNekBlkMatSharedPtr blkmatZ;
         
@@ -648,8 +682,13 @@ namespace Nektar
             HomoLen[0] = m_lhom_y;
             HomoLen[1] = m_lhom_z;
             
-            int nhom_modes_y = m_homogeneousBasis_y->GetNumModes();
-            int nhom_modes_z = m_homogeneousBasis_z->GetNumModes();
+            // Each process writes the modes of its own lines.
+            int nhom_modes_y = m_homogeneousBasis_y->GetNumModes()/
+                m_Ycomm->GetSize();
+            int nhom_modes_z = m_homogeneousBasis_z->GetNumModes()/
+                m_Zcomm->GetSize();
+            int yoffset = m_Ycomm->GetRank()*nhom_modes_y;
+            int zoffset = m_Zcomm->GetRank()*nhom_modes_z;
 
             std::vector<unsigned int> sIDs
                 = LibUtilities::NullUnsignedIntVector;
@@ -661,8 +700,8 @@ namespace Nektar
             {
                 for(int m = 0; m < nhom_modes_y; ++m)
                 {
-                    zIDs.push_back(n);
-                    yIDs.push_back(m);
+                    zIDs.push_back(zoffset + n);
+                    yIDs.push_back(yoffset + m);
                 }
             }
 
@@ -682,8 +721,13 @@ namespace Nektar
             HomoLen[0] = m_lhom_y;
             HomoLen[1] = m_lhom_z;
             
-            int nhom_modes_y = m_homogeneousBasis_y->GetNumModes();
-            int nhom_modes_z = m_homogeneousBasis_z->GetNumModes();
+            // Each process writes the modes of its own lines.
+            int nhom_modes_y = m_homogeneousBasis_y->GetNumModes()/
+                m_Ycomm->GetSize();
+            int nhom_modes_z = m_homogeneousBasis_z->GetNumModes()/
+                m_Zcomm->GetSize();
+            int yoffset = m_Ycomm->GetRank()*nhom_modes_y;
+            int zoffset = m_Zcomm->GetRank()*nhom_modes_z;
 
             std::vector<unsigned int> sIDs
                 =LibUtilities::NullUnsignedIntVector;
@@ -695,8 +739,8 @@ namespace Nektar
             {
                 for(int m = 0; m < nhom_modes_y; ++m)
                 {
-                    zIDs.push_back(n);
-                    yIDs.push_back(m);
+                    zIDs.push_back(zoffset + n);
+                    yIDs.push_back(yoffset + m);
                 }
             }
             
@@ -710,8 +754,10 @@ namespace Nektar
         {
             int i,k;
             
-            int NumMod_y = m_homogeneousBasis_y->GetNumModes();
-            int NumMod_z = m_homogeneousBasis_z->GetNumModes();
+            int NumMod_y = m_homogeneousBasis_y->GetNumModes()/
+                m_Ycomm->GetSize();
+            int NumMod_z = m_homogeneousBasis_z->GetNumModes()/
+                m_Zcomm->GetSize();
             
             int ncoeffs_per_line = m_lines[0]->GetNcoeffs();
             
@@ -747,8 +793,12 @@ namespace Nektar
             int offset = 0;
             int datalen = fielddata.size()/fielddef->m_fields.size();
             int ncoeffs_per_line = m_lines[0]->GetNcoeffs();
-            int NumMod_y = m_homogeneousBasis_y->GetNumModes();
-            int NumMod_z = m_homogeneousBasis_z->GetNumModes();
+            int NumMod_y = m_homogeneousBasis_y->GetNumModes()/
+                m_Ycomm->GetSize();
+            int NumMod_z = m_homogeneousBasis_z->GetNumModes()/
+                m_Zcomm->GetSize();
+            int yoffset  = m_Ycomm->GetRank()*NumMod_y;
+            int zoffset  = m_Zcomm->GetRank()*NumMod_z;
             
             // Find data location according to field definition
             for(i = 0; i < fielddef->m_fields.size(); ++i)
@@ -770,14 +820,37 @@ namespace Nektar
                 ElmtID_to_ExpID[(*m_exp)[i]->GetGeom()->GetGlobalID()] = i;
             }
 
+            // The file may have been written by a different pencil
+            // decomposition, so only keep the lines held on this process.
+            // Files without line IDs hold every line in natural order.
+            bool hasIDs = fielddef->m_homogeneousYIDs.size() > 0;
+            int nymodes = m_homogeneousBasis_y->GetNumModes();
+            int nlines  = hasIDs ? fielddef->m_homogeneousYIDs.size() :
+                nymodes*m_homogeneousBasis_z->GetNumModes();
+            Array<OneD, int> lineID(nlines, -1);
+            for(k = 0; k < nlines; ++k)
+            {
+                int ly = (hasIDs ? fielddef->m_homogeneousYIDs[k] :
+                          k % nymodes) - yoffset;
+                int lz = (hasIDs ? fielddef->m_homogeneousZIDs[k] :
+                          k / nymodes) - zoffset;
+                if(ly >= 0 && ly < NumMod_y && lz >= 0 && lz < NumMod_z)
+                {
+                    lineID[k] = ly + lz*NumMod_y;
+                }
+            }
+
             for(i = 0; i < fielddef->m_elementIDs.size(); ++i)
             {
                 int eid = ElmtID_to_ExpID[fielddef->m_elementIDs[i]];
                 int datalen = (*m_exp)[eid]->GetNcoeffs();
                 
-                for(k = 0; k < (NumMod_y*NumMod_z); ++k)
+                for(k = 0; k < nlines; ++k)
                 {
-                    Vmath::Vcopy(datalen,&fielddata[offset],1,&coeffs[m_coeff_offset[eid] + k*ncoeffs_per_line],1);
+                    if(lineID[k] >= 0)
+                    {
+                        Vmath::Vcopy(datalen,&fielddata[offset],1,&coeffs[m_coeff_offset[eid] + lineID[k]*ncoeffs_per_line],1);
+                    }
                     offset += datalen;
                 }
             }
@@ -840,11 +913,17 @@ namespace Nektar
                 }
                 NekDouble sign = -1.0;
                 NekDouble beta;
+
+                // Wavenumbers follow the global line index. The offsets
+                // are even, so the sign pattern of the local lines is the
+                // same as in serial.
+                int yoffset = m_Ycomm->GetRank()*m_ny;
+                int zoffset = m_Zcomm->GetRank()*m_nz;
         
                 //along y
                 for(int i = 0; i < m_ny; i++)
                 {
-                    beta = -sign*2*M_PI*(i/2)/m_lhom_y;
+                    beta = -sign*2*M_PI*((yoffset+i)/2)/m_lhom_y;
                     
                     for(int j = 0; j < m_nz; j++)
                     {
@@ -858,7 +937,7 @@ namespace Nektar
                 sign = -1.0;
                 for(int i = 0; i < m_nz; i++)
                 {
-                    beta = -sign*2*M_PI*(i/2)/m_lhom_z;
+                    beta = -sign*2*M_PI*((zoffset+i)/2)/m_lhom_z;
                     Vmath::Smul(m_ny*n_points_line,beta,tmp1 = temparray + i*m_ny*n_points_line,1,tmp2 = temparray2 + (i-int(sign))*m_ny*n_points_line,1);
                     sign = -1.0*sign;
                 }
@@ -881,6 +960,10 @@ namespace Nektar
                         }
                 else 
                 {
+                    ASSERTL0(m_comm->GetColumnComm()->GetSize() == 1,
+                             "Non-Fourier 3D-Homo-2D derivatives are not "
+                             "implemented in parallel.");
+
                     StdRegions::StdQuadExp StdQuad(m_homogeneousBasis_y->GetBasisKey(),m_homogeneousBasis_z->GetBasisKey());
                     
                     m_transposition->Transpose(inarray,temparray,false,LibUtilities::eXtoYZ);
@@ -937,13 +1020,15 @@ namespace Nektar
                     }
                     NekDouble sign = -1.0;
                     NekDouble beta;
+                    int yoffset = m_Ycomm->GetRank()*m_ny;
+                    int zoffset = m_Zcomm->GetRank()*m_nz;
                     
                     if (dir == 1)
                     {
                         //along y
                         for(int i = 0; i < m_ny; i++)
                         {
-                            beta = -sign*2*M_PI*(i/2)/m_lhom_y;
+                            beta = -sign*2*M_PI*((yoffset+i)/2)/m_lhom_y;
                             
                             for(int j = 0; j < m_nz; j++)
                             {
@@ -965,7 +1050,7 @@ namespace Nektar
                         //along z
                         for(int i = 0; i < m_nz; i++)
                         {
-                            beta = -sign*2*M_PI*(i/2)/m_lhom_z;
+                            beta = -sign*2*M_PI*((zoffset+i)/2)/m_lhom_z;
                             Vmath::Smul(m_ny*n_points_line,beta,tmp1 = temparray + i*m_ny*n_points_line,1,tmp2 = temparray2 + (i-int(sign))*m_ny*n_points_line,1);
                             sign = -1.0*sign;
                         }
@@ -987,6 +1072,10 @@ namespace Nektar
                             }
                     else 
                     {
+                        ASSERTL0(m_comm->GetColumnComm()->GetSize() == 1,
+                                 "Non-Fourier 3D-Homo-2D derivatives are "
+                                 "not implemented in parallel.");
+
                         StdRegions::StdQuadExp StdQuad(m_homogeneousBasis_y->GetBasisKey(),m_homogeneousBasis_z->GetBasisKey());
             
                         m_transposition->Transpose(inarray,temparray,false,LibUtilities::eXtoYZ);
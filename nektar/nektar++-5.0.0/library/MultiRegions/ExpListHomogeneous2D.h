@@ -151,8 +151,12 @@ namespace Nektar
             NekDouble                       m_lhom_z;                   ///< Width of homogeneous direction z
             Homo2DBlockMatrixMapShPtr       m_homogeneous2DBlockMat;
             Array<OneD, ExpListSharedPtr>   m_lines;                    ///< Vector of ExpList, will be filled with ExpList1D
-            int                             m_ny;                       ///< Number of modes = number of poitns in y direction
-            int                             m_nz;                       ///< Number of modes = number of poitns in z direction
+            int                             m_ny;                       ///< Number of local modes = number of local points in y direction
+            int                             m_nz;                       ///< Number of local modes = number of local points in z direction
+            
+            /// Coordinates of the local lines in the y and z directions.
+            void GetHomogeneousCoords(Array<OneD, NekDouble> &y,
+                                      Array<OneD, NekDouble> &z);
             
             DNekBlkMatSharedPtr GenHomogeneous2DBlockMatrix(Homogeneous2DMatType mattype, CoeffState coeffstate = eLocal) const;
 
@@ -47,7 +47,7 @@ namespace Nektar
 {
     namespace MultiRegions
     {
-        std::string GlobalLinSys::lookupIds[12] = {
+        std::string GlobalLinSys::lookupIds[13] = {
             LibUtilities::SessionReader::RegisterEnumValue(
                 "GlobalSysSoln", "DirectFull",
                 MultiRegions::eDirectFullMatrix),
@@ -83,7 +83,10 @@ namespace Nektar
                 MultiRegions::ePETScStaticCond),
             LibUtilities::SessionReader::RegisterEnumValue(
                 "GlobalSysSoln", "PETScMultiLevelStaticCond",
-                MultiRegions::ePETScMultiLevelStaticCond)
+                MultiRegions::ePETScMultiLevelStaticCond),
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "GlobalSysSoln", "DirectSparseStaticCond",
+                MultiRegions::eDirectSparseStaticCond)
         };
 
 #ifdef NEKTAR_USE_SCOTCH
@@ -431,6 +434,77 @@ namespace Nektar
             vExp->DropLocStaticCondMatrix(GetBlockMatrixKey(n));
         }
 
+        /**
+         * Returns the memory held by the system itself. Derived classes add
+         * their factorisations, preconditioners and condensed blocks.
+         */
+        size_t GlobalLinSys::v_GetMemoryFootprint() const
+        {
+            return sizeof(*this);
+        }
+
+        /**
+         * Drops the elemental static condensation matrices of every element
+         * from the managers of the expansions, so that they are freed once
+         * this system is destroyed. This is used when a system is evicted
+         * from the cache of global linear systems.
+         */
+        void GlobalLinSys::ReleaseLocalMatrices()
+        {
+            std::shared_ptr<ExpList> expList = m_expList.lock();
+            if (!expList)
+            {
+                return;
+            }
+
+            for (int n = 0; n < expList->GetExpSize(); ++n)
+            {
+                v_DropStaticCondBlock(n);
+            }
+        }
+
+        /**
+         * @brief Solve the system for several right-hand sides which share
+         * the same matrix.
+         *
+         * The default implementation simply solves each system in turn.
+         * Derived classes override this to stream matrix and preconditioner
+         * data once for all right-hand sides.
+         */
+        void GlobalLinSys::v_SolveMultiple(
+            const Array<OneD, const Array<OneD, NekDouble> > &in,
+                  Array<OneD,       Array<OneD, NekDouble> > &out,
+            const AssemblyMapSharedPtr         &locToGloMap,
+            const Array<OneD, const Array<OneD, NekDouble> > &dirForcing)
+        {
+            bool dirForcCalculated = (bool) dirForcing.num_elements();
+
+            for (int i = 0; i < in.num_elements(); ++i)
+            {
+                v_Solve(in[i], out[i], locToGloMap,
+                        dirForcCalculated ? dirForcing[i]
+                                          : NullNekDouble1DArray);
+            }
+        }
+
+        /**
+         * @brief Solve the matrix system for several right-hand sides. The
+         * default implementation solves each system in turn.
+         */
+        void GlobalLinSys::v_SolveLinearSystemMultiple(
+            const int                          pNumRows,
+            const Array<OneD, const Array<OneD, NekDouble> > &pInput,
+                  Array<OneD,       Array<OneD, NekDouble> > &pOutput,
+            const AssemblyMapSharedPtr        &locToGloMap,
+            const int                          pNumDir)
+        {
+            for (int i = 0; i < pInput.num_elements(); ++i)
+            {
+                v_SolveLinearSystem(pNumRows, pInput[i], pOutput[i],
+                                    locToGloMap, pNumDir);
+            }
+        }
+
         void GlobalLinSys::v_InitObject()
         {
             NEKERROR(ErrorUtil::efatal, "Method does not exist" );
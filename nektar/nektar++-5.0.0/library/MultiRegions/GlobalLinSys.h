@@ -101,6 +101,16 @@ namespace Nektar
                 const Array<OneD, const NekDouble> &dirForcing
                     = NullNekDouble1DArray);
 
+            /// Solve the linear system for several right-hand sides sharing
+            /// the same matrix using a specified local to global map.
+            MULTI_REGIONS_EXPORT
+            inline void SolveMultiple(
+                const Array<OneD, const Array<OneD, NekDouble> > &in,
+                      Array<OneD,       Array<OneD, NekDouble> > &out,
+                const AssemblyMapSharedPtr         &locToGloMap,
+                const Array<OneD, const Array<OneD, NekDouble> > &dirForcing
+                    = NullNekDoubleArrayofArray);
+
             /// Returns a shared pointer to the current object.
             std::shared_ptr<GlobalLinSys> GetSharedThisPtr()
             {
@@ -112,6 +122,12 @@ namespace Nektar
             inline DNekScalBlkMatSharedPtr GetStaticCondBlock(unsigned int n);
             inline void                    DropStaticCondBlock(unsigned int n);
 
+            /// Release the elemental matrices this system was assembled from.
+            MULTI_REGIONS_EXPORT void ReleaseLocalMatrices();
+
+            /// Memory in bytes held by the global system.
+            inline size_t GetMemoryFootprint() const;
+
             /// Solve the linear system for given input and output vectors.
             inline void SolveLinearSystem(
                 const int                          pNumRows,
@@ -120,6 +136,14 @@ namespace Nektar
                 const AssemblyMapSharedPtr        &locToGloMap,
                 const int                          pNumDir = 0);
 
+            /// Solve the linear system for several input and output vectors.
+            inline void SolveLinearSystemMultiple(
+                const int                          pNumRows,
+                const Array<OneD, const Array<OneD, NekDouble> > &pInput,
+                      Array<OneD,       Array<OneD, NekDouble> > &pOutput,
+                const AssemblyMapSharedPtr        &locToGloMap,
+                const int                          pNumDir = 0);
+
         protected:
             /// Key associated with this linear system.
             const GlobalLinSysKey                m_linSysKey;
@@ -134,11 +158,28 @@ namespace Nektar
             virtual DNekScalMatSharedPtr    v_GetBlock          (unsigned int n);
             virtual DNekScalBlkMatSharedPtr v_GetStaticCondBlock(unsigned int n);
             virtual void                    v_DropStaticCondBlock(unsigned int n);
+            virtual size_t                  v_GetMemoryFootprint() const;
 
             PreconditionerSharedPtr CreatePrecon(AssemblyMapSharedPtr asmMap);
 
-        private:
             LocalRegions::MatrixKey GetBlockMatrixKey(unsigned int n);
+
+            /// Solve a linear system for several right-hand sides.
+            virtual void v_SolveMultiple(
+                const Array<OneD, const Array<OneD, NekDouble> > &in,
+                      Array<OneD,       Array<OneD, NekDouble> > &out,
+                const AssemblyMapSharedPtr         &locToGloMap,
+                const Array<OneD, const Array<OneD, NekDouble> > &dirForcing);
+
+            /// Solve a basic matrix system for several right-hand sides.
+            virtual void v_SolveLinearSystemMultiple(
+                const int                          pNumRows,
+                const Array<OneD, const Array<OneD, NekDouble> > &pInput,
+                      Array<OneD,       Array<OneD, NekDouble> > &pOutput,
+                const AssemblyMapSharedPtr        &locToGloMap,
+                const int                          pNumDir);
+
+        private:
             
             /// Solve a linear system based on mapping.
             virtual void v_Solve(
@@ -208,6 +249,34 @@ namespace Nektar
             v_SolveLinearSystem(pNumRows, pInput, pOutput, locToGloMap, pNumDir);
         }
 
+
+        /**
+         *
+         */
+        inline void GlobalLinSys::SolveMultiple(
+                    const Array<OneD, const Array<OneD, NekDouble> > &in,
+                          Array<OneD,       Array<OneD, NekDouble> > &out,
+                    const AssemblyMapSharedPtr &locToGloMap,
+                    const Array<OneD, const Array<OneD, NekDouble> > &dirForcing)
+        {
+            v_SolveMultiple(in,out,locToGloMap,dirForcing);
+        }
+
+
+        /**
+         *
+         */
+        inline void GlobalLinSys::SolveLinearSystemMultiple(
+                const int pNumRows,
+                const Array<OneD, const Array<OneD, NekDouble> > &pInput,
+                      Array<OneD,       Array<OneD, NekDouble> > &pOutput,
+                const AssemblyMapSharedPtr &locToGloMap,
+                const int pNumDir)
+        {
+            v_SolveLinearSystemMultiple(pNumRows, pInput, pOutput,
+                                        locToGloMap, pNumDir);
+        }
+
         inline void GlobalLinSys::InitObject()
         {
             v_InitObject();
@@ -238,6 +307,25 @@ namespace Nektar
         {
             return v_GetNumBlocks();
         }
+
+        inline size_t GlobalLinSys::GetMemoryFootprint() const
+        {
+            return v_GetMemoryFootprint();
+        }
+
+        /// Memory in bytes held by a global system, used for the accounting
+        /// of the pool of global systems.
+        inline size_t GetMemoryFootprint(const GlobalLinSys &linSys)
+        {
+            return linSys.GetMemoryFootprint();
+        }
+
+        /// Release the elemental matrices of a system evicted from the
+        /// global linear system pool.
+        inline void ReleaseEvictedObject(GlobalLinSys &linSys)
+        {
+            linSys.ReleaseLocalMatrices();
+        }
     } //end of namespace
 } //end of namespace
 
@@ -65,6 +65,17 @@ namespace Nektar
         {
         }
 
+        /// Memory held by the system, including its factorised matrix.
+        size_t GlobalLinSysDirect::v_GetMemoryFootprint() const
+        {
+            size_t bytes = GlobalLinSys::v_GetMemoryFootprint();
+            if (m_linSys)
+            {
+                bytes += m_linSys->GetMemoryFootprint();
+            }
+            return bytes;
+        }
+
         /// Solve the linear system for given input and output vectors.
         void GlobalLinSysDirect::v_SolveLinearSystem(
                 const int pNumRows,
@@ -84,5 +95,39 @@ namespace Nektar
 
             m_linSys->Solve(Vin, Vout);
         }
+
+        /**
+         * Right-hand sides are packed into a single column-major block so
+         * that the factorised matrix is traversed once by the triangular
+         * solves for all of them.
+         */
+        void GlobalLinSysDirect::v_SolveLinearSystemMultiple(
+                const int pNumRows,
+                const Array<OneD, const Array<OneD, NekDouble> > &pInput,
+                      Array<OneD,       Array<OneD, NekDouble> > &pOutput,
+                const AssemblyMapSharedPtr &pLocToGloMap,
+                const int pNumDir)
+        {
+            boost::ignore_unused(pLocToGloMap);
+
+            const int nRhs     = pInput.num_elements();
+            const int nHomDofs = pNumRows - pNumDir;
+
+            Array<OneD, NekDouble> block(nRhs * nHomDofs);
+
+            for (int i = 0; i < nRhs; ++i)
+            {
+                Vmath::Vcopy(nHomDofs, &pInput[i][pNumDir], 1,
+                             &block[i*nHomDofs], 1);
+            }
+
+            m_linSys->SolveMultiple(nRhs, block);
+
+            for (int i = 0; i < nRhs; ++i)
+            {
+                Vmath::Vcopy(nHomDofs, &block[i*nHomDofs], 1,
+                             &pOutput[i][pNumDir], 1);
+            }
+        }
     }
 }
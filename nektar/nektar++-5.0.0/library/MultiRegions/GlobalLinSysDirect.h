@@ -58,6 +58,9 @@ namespace Nektar
         protected:
             /// Basic linear system object.
             DNekLinSysSharedPtr m_linSys;
+
+            virtual size_t v_GetMemoryFootprint() const;
+
             /// Solve the linear system for given input and output vectors.
             virtual void v_SolveLinearSystem(
                 const int pNumRows,
@@ -65,6 +68,13 @@ namespace Nektar
                       Array<OneD,      NekDouble> &pOutput,
                 const AssemblyMapSharedPtr &locToGloMap,
                 const int pNumDir);
+            /// Solve the linear system for several right-hand sides at once.
+            virtual void v_SolveLinearSystemMultiple(
+                const int pNumRows,
+                const Array<OneD, const Array<OneD, NekDouble> > &pInput,
+                      Array<OneD,       Array<OneD, NekDouble> > &pOutput,
+                const AssemblyMapSharedPtr &locToGloMap,
+                const int pNumDir);
         };
     }
 }
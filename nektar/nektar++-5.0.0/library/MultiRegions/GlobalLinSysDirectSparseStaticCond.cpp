@@ -0,0 +1,250 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File GlobalLinSysDirectSparseStaticCond.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Sparse direct solver for the statically condensed system.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <MultiRegions/GlobalLinSysDirectSparseStaticCond.h>
+#include <MultiRegions/ExpList.h>
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        /**
+         * @class GlobalLinSysDirectSparseStaticCond
+         *
+         * Solves a linear system using single-level static condensation,
+         * where the Schur complement is assembled in sparse form and
+         * factorised with a supernodal sparse Cholesky factorisation.
+         *
+         * The boundary degrees of freedom are numbered by nested dissection
+         * of the mesh graph when Nektar++ is built with Scotch (and by
+         * reverse Cuthill-McKee otherwise), which limits the fill-in of the
+         * factor. The symbolic factorisation only depends on this numbering
+         * and is therefore shared by every system assembled with the same
+         * local to global mapping: when the time-step or any other
+         * coefficient of the operator changes, only the numeric factorisation
+         * is repeated.
+         */
+
+        /**
+         * Registers the class with the Factory.
+         */
+        std::string GlobalLinSysDirectSparseStaticCond::className
+                = GetGlobalLinSysFactory().RegisterCreatorFunction(
+                    "DirectSparseStaticCond",
+                    GlobalLinSysDirectSparseStaticCond::create,
+                    "Sparse direct static condensation.");
+
+        GlobalLinSysDirectSparseStaticCond::GlobalLinSysDirectSparseStaticCond(
+                     const GlobalLinSysKey                &pKey,
+                     const std::weak_ptr<ExpList>         &pExpList,
+                     const std::shared_ptr<AssemblyMap>   &pLocToGloMap)
+            : GlobalLinSys          (pKey, pExpList, pLocToGloMap),
+              GlobalLinSysStaticCond(pKey, pExpList, pLocToGloMap)
+        {
+            ASSERTL1(pKey.GetGlobalSysSolnType() == eDirectSparseStaticCond,
+                     "This constructor is only valid when using sparse "
+                     "direct static condensation");
+            ASSERTL1(pKey.GetGlobalSysSolnType()
+                        == pLocToGloMap->GetGlobalSysSolnType(),
+                     "The local to global map is not set up for the requested "
+                     "solution type");
+            ASSERTL0(pExpList.lock()->GetComm()->GetSize() == 1,
+                     "Sparse direct static condensation can only be used in "
+                     "serial.");
+
+            switch (pKey.GetMatrixType())
+            {
+                case StdRegions::eMass:
+                case StdRegions::eLaplacian:
+                case StdRegions::eHelmholtz:
+                case StdRegions::eHybridDGHelmBndLam:
+                    break;
+                default:
+                    NEKERROR(ErrorUtil::efatal,
+                             "Sparse direct static condensation requires a "
+                             "symmetric positive-definite operator.");
+            }
+        }
+
+        GlobalLinSysDirectSparseStaticCond::
+            ~GlobalLinSysDirectSparseStaticCond()
+        {
+
+        }
+
+        /// Memory held by the system, including the Cholesky factor.
+        size_t GlobalLinSysDirectSparseStaticCond::v_GetMemoryFootprint() const
+        {
+            size_t bytes = GlobalLinSysStaticCond::v_GetMemoryFootprint();
+            if (m_cholesky)
+            {
+                bytes += m_cholesky->GetSymbolic()->GetFactorNnz() *
+                    sizeof(NekDouble);
+            }
+            return bytes;
+        }
+
+        GlobalLinSysDirectSparseStaticCond::SymbolicCacheType
+            &GlobalLinSysDirectSparseStaticCond::GetSymbolicCache()
+        {
+            static SymbolicCacheType cache;
+            return cache;
+        }
+
+        /**
+         * Assemble the lower triangle of the Schur complement matrix from the
+         * block matrices stored in #m_schurCompl. Every pair of degrees of
+         * freedom of an element is entered, whatever its value, so that the
+         * pattern only depends on the local to global mapping. The symbolic
+         * factorisation of a previous system with the same mapping is reused
+         * when available.
+         *
+         * @param   pLocToGloMap Local to global mapping information.
+         */
+        void GlobalLinSysDirectSparseStaticCond::v_AssembleSchurComplement(
+            const AssemblyMapSharedPtr pLocToGloMap)
+        {
+            int i, j, n, cnt, gid1, gid2;
+            NekDouble sign1, sign2;
+
+            int nBndDofs  = pLocToGloMap->GetNumGlobalBndCoeffs();
+            int NumDirBCs = pLocToGloMap->GetNumGlobalDirBndCoeffs();
+            unsigned int rows = nBndDofs - NumDirBCs;
+
+            DNekScalBlkMatSharedPtr SchurCompl = m_schurCompl;
+
+            COOMatType gmat;
+            DNekScalMatSharedPtr loc_mat;
+            int loc_lda;
+            for(n = cnt = 0; n < SchurCompl->GetNumberOfBlockRows(); ++n)
+            {
+                loc_mat = SchurCompl->GetBlock(n,n);
+                loc_lda = loc_mat->GetRows();
+
+                for(i = 0; i < loc_lda; ++i)
+                {
+                    gid1  = pLocToGloMap->GetLocalToGlobalBndMap (cnt + i)
+                                                                    - NumDirBCs;
+                    sign1 = pLocToGloMap->GetLocalToGlobalBndSign(cnt + i);
+
+                    if(gid1 < 0)
+                    {
+                        continue;
+                    }
+
+                    for(j = 0; j < loc_lda; ++j)
+                    {
+                        gid2  = pLocToGloMap->GetLocalToGlobalBndMap(cnt + j)
+                                                                 - NumDirBCs;
+                        sign2 = pLocToGloMap->GetLocalToGlobalBndSign(cnt + j);
+
+                        if(gid2 >= 0 && gid2 <= gid1)
+                        {
+                            gmat[CoordType(gid1, gid2)] +=
+                                sign1*sign2*(*loc_mat)(i,j);
+                        }
+                    }
+                }
+                cnt += loc_lda;
+            }
+
+            if(rows == 0)
+            {
+                return;
+            }
+
+            SymbolicCacheType &cache = GetSymbolicCache();
+
+            // Drop the analyses of mappings which no longer exist.
+            for (auto it = cache.begin(); it != cache.end();)
+            {
+                if (it->first.expired())
+                {
+                    it = cache.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+
+            SparseCholeskySymbolicSharedPtr &symbolic =
+                cache[std::weak_ptr<AssemblyMap>(pLocToGloMap)];
+
+            if (!symbolic || !symbolic->MatchesPattern(rows, gmat))
+            {
+                symbolic = MemoryManager<SparseCholeskySymbolic>
+                    ::AllocateSharedPtr(rows, gmat);
+            }
+
+            m_cholesky = MemoryManager<SparseCholesky>
+                ::AllocateSharedPtr(symbolic);
+            m_cholesky->Factorise(gmat);
+        }
+
+        GlobalLinSysStaticCondSharedPtr
+            GlobalLinSysDirectSparseStaticCond::v_Recurse(
+            const GlobalLinSysKey                &mkey,
+            const std::weak_ptr<ExpList>         &pExpList,
+            const DNekScalBlkMatSharedPtr         pSchurCompl,
+            const DNekScalBlkMatSharedPtr         pBinvD,
+            const DNekScalBlkMatSharedPtr         pC,
+            const DNekScalBlkMatSharedPtr         pInvD,
+            const std::shared_ptr<AssemblyMap>   &l2gMap)
+        {
+            boost::ignore_unused(mkey, pExpList, pSchurCompl, pBinvD, pC,
+                                 pInvD, l2gMap);
+            NEKERROR(ErrorUtil::efatal,
+                     "Sparse direct static condensation is single-level.");
+            return GlobalLinSysStaticCondSharedPtr();
+        }
+
+        void GlobalLinSysDirectSparseStaticCond::v_SolveLinearSystem(
+                const int pNumRows,
+                const Array<OneD,const NekDouble> &pInput,
+                      Array<OneD,      NekDouble> &pOutput,
+                const AssemblyMapSharedPtr &pLocToGloMap,
+                const int pNumDir)
+        {
+            boost::ignore_unused(pLocToGloMap);
+
+            const int nHomDofs = pNumRows - pNumDir;
+
+            Array<OneD, NekDouble> x = pOutput + pNumDir;
+            Vmath::Vcopy(nHomDofs, &pInput[pNumDir], 1, &x[0], 1);
+
+            m_cholesky->Solve(x);
+        }
+    }
+}
@@ -0,0 +1,117 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File GlobalLinSysDirectSparseStaticCond.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: GlobalLinSysDirectSparseStaticCond header
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_MULTIREGIONS_GLOBALLINSYSDIRECTSPARSESTATICCOND_H
+#define NEKTAR_LIB_MULTIREGIONS_GLOBALLINSYSDIRECTSPARSESTATICCOND_H
+
+#include <MultiRegions/GlobalLinSysStaticCond.h>
+#include <MultiRegions/MultiRegionsDeclspec.h>
+#include <LibUtilities/LinearAlgebra/SparseCholesky.h>
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        // Forward declarations
+        class ExpList;
+        class GlobalLinSysDirectSparseStaticCond;
+
+        typedef std::shared_ptr<GlobalLinSysDirectSparseStaticCond>
+            GlobalLinSysDirectSparseStaticCondSharedPtr;
+
+        /// Static condensation with a sparse Cholesky factorisation of the
+        /// Schur complement.
+        class GlobalLinSysDirectSparseStaticCond
+            : virtual public GlobalLinSysStaticCond
+        {
+        public:
+            /// Creates an instance of this class
+            static GlobalLinSysSharedPtr create(
+                        const GlobalLinSysKey                &pLinSysKey,
+                        const std::weak_ptr<ExpList>         &pExpList,
+                        const std::shared_ptr<AssemblyMap>   &pLocToGloMap)
+            {
+                GlobalLinSysDirectSparseStaticCondSharedPtr ret =
+                    MemoryManager<GlobalLinSysDirectSparseStaticCond>
+                    ::AllocateSharedPtr(pLinSysKey, pExpList, pLocToGloMap);
+                ret->InitObject();
+                return ret;
+            }
+
+            /// Name of class
+            MULTI_REGIONS_EXPORT static std::string className;
+
+            MULTI_REGIONS_EXPORT GlobalLinSysDirectSparseStaticCond(
+                        const GlobalLinSysKey                &mkey,
+                        const std::weak_ptr<ExpList>         &pExpList,
+                        const std::shared_ptr<AssemblyMap>   &locToGloMap);
+
+            MULTI_REGIONS_EXPORT virtual ~GlobalLinSysDirectSparseStaticCond();
+
+        protected:
+            /// Numeric factorisation of the Schur complement.
+            SparseCholeskySharedPtr m_cholesky;
+
+            virtual size_t v_GetMemoryFootprint() const;
+            virtual void v_AssembleSchurComplement(
+                std::shared_ptr<AssemblyMap> pLocToGloMap);
+            virtual GlobalLinSysStaticCondSharedPtr v_Recurse(
+                const GlobalLinSysKey                &mkey,
+                const std::weak_ptr<ExpList>         &pExpList,
+                const DNekScalBlkMatSharedPtr         pSchurCompl,
+                const DNekScalBlkMatSharedPtr         pBinvD,
+                const DNekScalBlkMatSharedPtr         pC,
+                const DNekScalBlkMatSharedPtr         pInvD,
+                const std::shared_ptr<AssemblyMap>   &l2gMap);
+            virtual void v_SolveLinearSystem(
+                const int                          pNumRows,
+                const Array<OneD,const NekDouble> &pInput,
+                      Array<OneD,      NekDouble> &pOutput,
+                const AssemblyMapSharedPtr        &locToGloMap,
+                const int                          pNumDir);
+
+        private:
+            typedef std::map<std::weak_ptr<AssemblyMap>,
+                             SparseCholeskySymbolicSharedPtr,
+                             std::owner_less<std::weak_ptr<AssemblyMap> > >
+                SymbolicCacheType;
+
+            /// Symbolic factorisations shared between all systems assembled
+            /// with the same local to global mapping.
+            static SymbolicCacheType &GetSymbolicCache();
+        };
+    }
+}
+
+#endif
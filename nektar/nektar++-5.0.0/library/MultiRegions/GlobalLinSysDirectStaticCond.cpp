@@ -128,6 +128,14 @@ namespace Nektar
 
         }
 
+        /// Memory held by the system, including the factorised Schur
+        /// complement and the condensed blocks.
+        size_t GlobalLinSysDirectStaticCond::v_GetMemoryFootprint() const
+        {
+            return GlobalLinSysDirect::v_GetMemoryFootprint() +
+                GetStaticCondFootprint();
+        }
+
 
         MatrixStorage GlobalLinSysDirectStaticCond::DetermineMatrixStorage(
             const AssemblyMapSharedPtr &pLocToGloMap)
@@ -90,6 +90,7 @@ namespace Nektar
             MULTI_REGIONS_EXPORT virtual ~GlobalLinSysDirectStaticCond();
 
         protected:
+            virtual size_t v_GetMemoryFootprint() const;
             virtual void v_AssembleSchurComplement(
                 std::shared_ptr<AssemblyMap> pLocToGloMap);
             virtual GlobalLinSysStaticCondSharedPtr v_Recurse(
@@ -33,6 +33,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <MultiRegions/GlobalLinSysIterative.h>
+#include <LibUtilities/BasicUtils/SessionReader.h>
+#include <LibUtilities/LinearAlgebra/Lapack.hpp>
 
 using namespace std;
 
@@ -40,6 +42,22 @@ namespace Nektar
 {
     namespace MultiRegions
     {
+        std::string GlobalLinSysIterative::lookupIds[3] = {
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "SuccessiveRHSType", "Projection",
+                MultiRegions::eSuccessiveRHSProjection),
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "SuccessiveRHSType", "PODProjection",
+                MultiRegions::eSuccessiveRHSPODProjection),
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "SuccessiveRHSType", "Extrapolation",
+                MultiRegions::eSuccessiveRHSExtrapolation)
+        };
+
+        std::string GlobalLinSysIterative::def =
+            LibUtilities::SessionReader::RegisterDefaultSolverInfo(
+                "SuccessiveRHSType", "Projection");
+
         /**
          * @class GlobalLinSysIterative
          *
@@ -58,7 +76,9 @@ namespace Nektar
                   m_precon(NullPreconditionerSharedPtr),
                   m_totalIterations(0),
                   m_useProjection(false),
-                  m_numPrevSols(0)
+                  m_numPrevSols(0),
+                  m_successiveRHSType(pLocToGloMap->GetSuccessiveRHSType()),
+                  m_successiveRHSSlot(0)
         {
             m_tolerance = pLocToGloMap->GetIterativeTolerance();
             m_maxiter   = pLocToGloMap->GetMaxIterations();
@@ -70,6 +90,17 @@ namespace Nektar
             
             if((successiveRHS = pLocToGloMap->GetSuccessiveRHS()))
             {
+                if (m_successiveRHSType == eSuccessiveRHSExtrapolation)
+                {
+                    // Extrapolation is implemented up to third order
+                    successiveRHS = min(successiveRHS, 3);
+                }
+                else if (m_successiveRHSType == eSuccessiveRHSPODProjection)
+                {
+                    m_solCorrelation = Array<OneD, NekDouble>(
+                        (successiveRHS+1)*(successiveRHS+1), 0.0);
+                }
+
                 m_prevLinSol.set_capacity(successiveRHS);
                 m_useProjection = true;
             }
@@ -83,6 +114,72 @@ namespace Nektar
         {
         }
 
+        /// Memory held by the system, including the preconditioner and the
+        /// stored previous solutions.
+        size_t GlobalLinSysIterative::v_GetMemoryFootprint() const
+        {
+            size_t bytes = GlobalLinSys::v_GetMemoryFootprint() +
+                GetIterativeFootprint();
+            if (m_precon)
+            {
+                bytes += m_precon->GetMemoryFootprint();
+            }
+            return bytes;
+        }
+
+        /// Memory held by the mapping and the stored previous solutions.
+        size_t GlobalLinSysIterative::GetIterativeFootprint() const
+        {
+            size_t bytes = m_map.num_elements() * sizeof(int) +
+                m_solCorrelation.num_elements() * sizeof(NekDouble);
+            for (auto &sol : m_prevLinSol)
+            {
+                bytes += sol.num_elements() * sizeof(NekDouble);
+            }
+            for (int i = 0; i < m_slotPrevLinSol.size(); ++i)
+            {
+                bytes += m_slotSolCorrelation[i].num_elements() *
+                    sizeof(NekDouble);
+                for (auto &sol : m_slotPrevLinSol[i])
+                {
+                    bytes += sol.num_elements() * sizeof(NekDouble);
+                }
+            }
+            return bytes;
+        }
+
+
+        /**
+         * The previous solutions only span the solutions of a single field
+         * when each right-hand side of SolveMultiple keeps its own history,
+         * e.g. for the velocity components of the incompressible solver
+         * sharing a Helmholtz system. The history of the selected slot is
+         * swapped into #m_prevLinSol and #m_solCorrelation, and the one it
+         * replaces is stored, so that the solvers are unchanged.
+         */
+        void GlobalLinSysIterative::SelectSuccessiveRHSSlot(const int slot)
+        {
+            if (slot == m_successiveRHSSlot)
+            {
+                return;
+            }
+
+            while (m_slotPrevLinSol.size() <= max(slot, m_successiveRHSSlot))
+            {
+                m_slotPrevLinSol.push_back(
+                    boost::circular_buffer<Array<OneD, NekDouble> >(
+                        m_prevLinSol.capacity()));
+                m_slotSolCorrelation.push_back(Array<OneD, NekDouble>(
+                    m_solCorrelation.num_elements(), 0.0));
+            }
+
+            swap(m_prevLinSol,     m_slotPrevLinSol    [m_successiveRHSSlot]);
+            swap(m_solCorrelation, m_slotSolCorrelation[m_successiveRHSSlot]);
+            swap(m_prevLinSol,     m_slotPrevLinSol    [slot]);
+            swap(m_solCorrelation, m_slotSolCorrelation[slot]);
+            m_successiveRHSSlot = slot;
+        }
+
 
         /**
          * 
@@ -94,7 +191,13 @@ namespace Nektar
                     const AssemblyMapSharedPtr &plocToGloMap,
                     const int nDir)
         {
-            if (m_useProjection)
+            if (m_useProjection &&
+                m_successiveRHSType == eSuccessiveRHSExtrapolation)
+            {
+                DoSolutionExtrapolation(nGlobal, pInput, pOutput, plocToGloMap,
+                                        nDir);
+            }
+            else if (m_useProjection)
             {
                 DoAconjugateProjection(nGlobal, pInput, pOutput, plocToGloMap, nDir);
             }
@@ -106,6 +209,53 @@ namespace Nektar
         }
 
 
+        /**
+         * Several right-hand sides are solved together by
+         * DoConjugateGradientMultiple. The reuse of previous solutions
+         * relies on the sequence of solutions of each right-hand side, so
+         * that each right-hand side is solved in turn with its own history
+         * when it is enabled.
+         */
+        void GlobalLinSysIterative::v_SolveLinearSystemMultiple(
+                    const int nGlobal,
+                    const Array<OneD, const Array<OneD, NekDouble> > &pInput,
+                          Array<OneD,       Array<OneD, NekDouble> > &pOutput,
+                    const AssemblyMapSharedPtr &plocToGloMap,
+                    const int nDir)
+        {
+            if (m_useProjection)
+            {
+                for (int i = 0; i < pInput.num_elements(); ++i)
+                {
+                    SelectSuccessiveRHSSlot(i);
+                    v_SolveLinearSystem(nGlobal, pInput[i], pOutput[i],
+                                        plocToGloMap, nDir);
+                }
+                SelectSuccessiveRHSSlot(0);
+            }
+            else
+            {
+                DoConjugateGradientMultiple(
+                    nGlobal, pInput, pOutput, plocToGloMap, nDir);
+            }
+        }
+
+
+        /**
+         * Default implementation applies the operator to each vector in
+         * turn.
+         */
+        void GlobalLinSysIterative::v_DoMatrixMultiplyMultiple(
+                const Array<OneD, Array<OneD, NekDouble> > &pInput,
+                      Array<OneD, Array<OneD, NekDouble> > &pOutput)
+        {
+            for (int i = 0; i < pInput.num_elements(); ++i)
+            {
+                v_DoMatrixMultiply(pInput[i], pOutput[i]);
+            }
+        }
+
+
         /**
          * This method implements A-conjugate projection technique
          * in order to speed up successive linear solves with
@@ -185,7 +335,7 @@ namespace Nektar
 
                 for (int i = 0; i < m_prevLinSol.size(); i++)
                 {
-                    if (alpha[i] < NekConstants::kNekZeroTol)
+                    if (fabs(alpha[i]) < NekConstants::kNekZeroTol)
                     {
                         continue;
                     }
@@ -212,7 +362,7 @@ namespace Nektar
                 x = tmpx + px;
 
                 // save the auxiliary solution to prev. known solutions
-                UpdateKnownSolutions(nGlobal, tmpx_s, nDir);
+                UpdateKnownSolutions(nGlobal, tmpx_s, nDir, alpha);
             }
         }
 
@@ -249,14 +399,24 @@ namespace Nektar
         /**
          * Updates the storage of previously known solutions.
          * Performs normalisation of input vector wrt A-norm.
+         *
+         * When POD compression is selected, the coefficients of the full
+         * solution in the stored basis (\a projCoeffs from the projection
+         * step plus the coefficients of \a newX) are accumulated in a
+         * correlation matrix. Once the basis is full it is compressed onto
+         * its dominant modes rather than discarding the oldest vector.
          */
         void GlobalLinSysIterative::UpdateKnownSolutions(
                                                          const int nGlobal,
                                                          const Array<OneD,const NekDouble> &newX,
-                                                         const int nDir)
+                                                         const int nDir,
+                                                         const Array<OneD,const NekDouble> &projCoeffs)
         {
             // Get vector sizes
             int nNonDir = nGlobal - nDir;
+            int nPrev   = m_prevLinSol.size();
+            bool usePOD =
+                m_successiveRHSType == eSuccessiveRHSPODProjection;
 
             // Get the communicator for performing data exchanges
             LibUtilities::CommSharedPtr vComm
@@ -291,13 +451,13 @@ namespace Nektar
                          tmp1 = newX + nDir, 1,
                          tmp2 = px_s + nDir, 1);
 
-            if (m_prevLinSol.size() > 0)
+            if (nPrev > 0)
             {
                 v_DoMatrixMultiply(newX, tmpAx_s);
             }
 
-            Array<OneD, NekDouble> alpha (m_prevLinSol.size(), 0.0);
-            for (int i = 0; i < m_prevLinSol.size(); i++)
+            Array<OneD, NekDouble> alpha (nPrev, 0.0);
+            for (int i = 0; i < nPrev; i++)
             {
                 alpha[i] = Vmath::Dot2(nNonDir,
                                        m_prevLinSol[i],
@@ -306,9 +466,9 @@ namespace Nektar
             }
             vComm->AllReduce(alpha, Nektar::LibUtilities::ReduceSum);
 
-            for (int i = 0; i < m_prevLinSol.size(); i++)
+            for (int i = 0; i < nPrev; i++)
             {
-                if (alpha[i] < NekConstants::kNekZeroTol)
+                if (fabs(alpha[i]) < NekConstants::kNekZeroTol)
                 {
                     continue;
                 }
@@ -323,7 +483,32 @@ namespace Nektar
             // Not going to store identically zero solutions.
 
             NekDouble anorm = CalculateAnorm(nGlobal, px_s, nDir);
-            if (anorm < NekConstants::kNekZeroTol)
+            bool addNew     = anorm >= NekConstants::kNekZeroTol;
+
+            if (usePOD)
+            {
+                // Coefficients of the full solution in the current basis,
+                // extended by the new direction.
+                int ld = m_prevLinSol.capacity() + 1;
+                Array<OneD, NekDouble> coeffs(nPrev + 1, 0.0);
+
+                Vmath::Vcopy(nPrev, alpha, 1, coeffs, 1);
+                if (projCoeffs.num_elements())
+                {
+                    Vmath::Vadd(nPrev, projCoeffs, 1, coeffs, 1, coeffs, 1);
+                }
+                coeffs[nPrev] = addNew ? anorm : 0.0;
+
+                for (int i = 0; i < nPrev + 1; ++i)
+                {
+                    for (int j = 0; j < nPrev + 1; ++j)
+                    {
+                        m_solCorrelation[i*ld+j] += coeffs[i]*coeffs[j];
+                    }
+                }
+            }
+
+            if (!addNew)
             {
                 return;
             }
@@ -331,8 +516,145 @@ namespace Nektar
             // normalisation of new solution
             Vmath::Smul(nNonDir, 1.0/anorm, px_s.get() + nDir, 1, px_s.get() + nDir, 1);
 
-            // updating storage with non-Dirichlet-dof part of new solution vector
-            m_prevLinSol.push_back(px_s + nDir);
+            if (usePOD && m_prevLinSol.full())
+            {
+                std::vector<Array<OneD, NekDouble> > basis(
+                    m_prevLinSol.begin(), m_prevLinSol.end());
+                basis.push_back(px_s + nDir);
+
+                CompressKnownSolutions(nNonDir, basis);
+
+                m_prevLinSol.clear();
+                m_prevLinSol.insert(m_prevLinSol.end(),
+                                    basis.begin(), basis.end());
+            }
+            else
+            {
+                // updating storage with non-Dirichlet-dof part of new
+                // solution vector
+                m_prevLinSol.push_back(px_s + nDir);
+            }
+            m_numPrevSols++;
+        }
+
+
+        /**
+         * Compress the A-orthonormal basis \a basis onto the dominant
+         * proper orthogonal decomposition modes of the previous solutions.
+         *
+         * Since the basis is A-orthonormal, the A-inner products of previous
+         * solutions are given by the correlation of their coefficients
+         * accumulated in #m_solCorrelation. Its eigenvectors therefore
+         * define an orthogonal rotation of the basis which remains
+         * A-orthonormal, and only the half of the modes with the largest
+         * energy is kept. The correlation matrix is replaced by its
+         * retained eigenvalues so that the energy of discarded solutions is
+         * still accounted for at the next compression.
+         */
+        void GlobalLinSysIterative::CompressKnownSolutions(
+            const int                              nNonDir,
+            std::vector<Array<OneD, NekDouble> > &basis)
+        {
+            int nBasis = basis.size();
+            int ld     = m_prevLinSol.capacity() + 1;
+            int nKeep  = max(1, (int)m_prevLinSol.capacity() / 2);
+            int info   = 0;
+
+            // Pack upper triangle of the correlation matrix
+            Array<OneD, NekDouble> packed(nBasis*(nBasis+1)/2);
+            for (int j = 0; j < nBasis; ++j)
+            {
+                for (int i = 0; i <= j; ++i)
+                {
+                    packed[i + j*(j+1)/2] = m_solCorrelation[i*ld+j];
+                }
+            }
+
+            Array<OneD, NekDouble> eigVal(nBasis);
+            Array<OneD, NekDouble> eigVec(nBasis*nBasis);
+            Array<OneD, NekDouble> work  (3*nBasis);
+
+            Lapack::Dspev('V', 'U', nBasis, packed.get(), eigVal.get(),
+                          eigVec.get(), nBasis, work.get(), info);
+            ASSERTL0(info == 0, "Failed to compute POD of previous solutions");
+
+            // Eigenvalues are returned in ascending order
+            std::vector<Array<OneD, NekDouble> > modes(nKeep);
+            Vmath::Zero(ld*ld, m_solCorrelation, 1);
+
+            for (int k = 0; k < nKeep; ++k)
+            {
+                int mode = nBasis - 1 - k;
+                modes[k] = Array<OneD, NekDouble>(nNonDir, 0.0);
+
+                for (int i = 0; i < nBasis; ++i)
+                {
+                    Vmath::Svtvp(nNonDir, eigVec[mode*nBasis + i],
+                                 basis[i], 1, modes[k], 1, modes[k], 1);
+                }
+
+                m_solCorrelation[k*ld+k] = max(eigVal[mode], 0.0);
+            }
+
+            basis.swap(modes);
+        }
+
+
+        /**
+         * Construct an initial guess by polynomial extrapolation of the
+         * stored previous solutions (up to third order, depending on the
+         * history available) and solve for the correction with conjugate
+         * gradients. This costs a single additional matrix multiply per
+         * solve, independently of the history depth.
+         */
+        void GlobalLinSysIterative::DoSolutionExtrapolation(
+                    const int nGlobal,
+                    const Array<OneD,const NekDouble> &pInput,
+                          Array<OneD,      NekDouble> &pOutput,
+                    const AssemblyMapSharedPtr &plocToGloMap,
+                    const int nDir)
+        {
+            static const NekDouble coeffs[3][3] = {{ 1.0,  0.0, 0.0},
+                                                   { 2.0, -1.0, 0.0},
+                                                   { 3.0, -3.0, 1.0}};
+
+            int nNonDir = nGlobal - nDir;
+            int nPrev   = m_prevLinSol.size();
+
+            if (0 == nPrev)
+            {
+                DoConjugateGradient(nGlobal, pInput, pOutput, plocToGloMap, nDir);
+            }
+            else
+            {
+                Array<OneD, NekDouble> x0_s (nGlobal, 0.0);
+                Array<OneD, NekDouble> pb_s (nGlobal, 0.0);
+                Array<OneD, NekDouble> dx_s (nGlobal, 0.0);
+                Array<OneD, NekDouble> tmp;
+
+                // x0 = sum_j c_j x^{n-1-j}, most recent solution last
+                for (int j = 0; j < nPrev; ++j)
+                {
+                    Vmath::Svtvp(nNonDir, coeffs[nPrev-1][j],
+                                 m_prevLinSol[nPrev-1-j], 1,
+                                 tmp = x0_s + nDir, 1,
+                                 tmp = x0_s + nDir, 1);
+                }
+
+                // pb = b^n - A x0
+                v_DoMatrixMultiply(x0_s, pb_s);
+                Vmath::Vsub(nNonDir, pInput + nDir, 1, pb_s + nDir, 1,
+                            tmp = pb_s + nDir, 1);
+
+                DoConjugateGradient(nGlobal, pb_s, dx_s, plocToGloMap, nDir);
+
+                Vmath::Vadd(nNonDir, x0_s + nDir, 1, dx_s + nDir, 1,
+                            tmp = pOutput + nDir, 1);
+            }
+
+            Array<OneD, NekDouble> sol(nNonDir);
+            Vmath::Vcopy(nNonDir, pOutput + nDir, 1, sol, 1);
+            m_prevLinSol.push_back(sol);
             m_numPrevSols++;
         }
 
@@ -540,6 +862,253 @@ namespace Nektar
             }
         }
 
+        /**
+         * Solve several systems sharing the same matrix with preconditioned
+         * conjugate gradient iterations performed in lockstep. The operator
+         * is applied to all unconverged search directions together through
+         * v_DoMatrixMultiplyMultiple and the inner products of all
+         * right-hand sides are exchanged in a single reduction per
+         * iteration. Each system keeps its own recurrence and is converged
+         * relative to the magnitude of its own right-hand side, so iterates
+         * are identical to solving the systems individually.
+         */
+        void GlobalLinSysIterative::DoConjugateGradientMultiple(
+            const int                          nGlobal,
+            const Array<OneD, const Array<OneD, NekDouble> > &pInput,
+                  Array<OneD,       Array<OneD, NekDouble> > &pOutput,
+            const AssemblyMapSharedPtr        &plocToGloMap,
+            const int                          nDir)
+        {
+            if (!m_precon)
+            {
+                v_UniqueMap();
+                m_precon = CreatePrecon(plocToGloMap);
+                m_precon->BuildPreconditioner();
+            }
+
+            // Get the communicator for performing data exchanges
+            LibUtilities::CommSharedPtr vComm
+                = m_expList.lock()->GetComm()->GetRowComm();
+
+            // Get vector sizes
+            int nRhs    = pInput.num_elements();
+            int nNonDir = nGlobal - nDir;
+
+            // Allocate array storage
+            Array<OneD, Array<OneD, NekDouble> > w_A(nRhs), s_A(nRhs);
+            Array<OneD, Array<OneD, NekDouble> > p_A(nRhs), r_A(nRhs);
+            Array<OneD, Array<OneD, NekDouble> > q_A(nRhs);
+            Array<OneD, NekDouble> tmp;
+
+            Array<OneD, NekDouble> alpha(nRhs), beta(nRhs, 0.0), rho(nRhs);
+            Array<OneD, NekDouble> mu(nRhs), eps(nRhs);
+            Array<OneD, NekDouble> rhsMag(nRhs), tol(nRhs);
+            Array<OneD, NekDouble> vExchange(3*nRhs, 0.0);
+            Array<OneD, int>       active(nRhs, 0);
+
+            int i, k, nActive;
+
+            for (i = 0; i < nRhs; ++i)
+            {
+                w_A[i] = Array<OneD, NekDouble>(nGlobal, 0.0);
+                s_A[i] = Array<OneD, NekDouble>(nGlobal, 0.0);
+                p_A[i] = Array<OneD, NekDouble>(nNonDir, 0.0);
+                q_A[i] = Array<OneD, NekDouble>(nNonDir, 0.0);
+                r_A[i] = Array<OneD, NekDouble>(nNonDir);
+
+                // Copy initial residual from input before zeroing the
+                // output, in case input and output are the same array
+                Vmath::Vcopy(nNonDir, &pInput[i][nDir], 1, &r_A[i][0], 1);
+                Vmath::Zero(nNonDir, &pOutput[i][nDir], 1);
+
+                // magnitude of this right-hand side for the tolerance
+                vExchange[3*i]   = Vmath::Dot2(nGlobal,
+                                               pInput[i],
+                                               pInput[i],
+                                               m_map);
+
+                // evaluate initial residual error for exit check
+                vExchange[3*i+2] = Vmath::Dot2(nNonDir,
+                                               r_A[i],
+                                               r_A[i],
+                                               m_map + nDir);
+            }
+
+            vComm->AllReduce(vExchange, Nektar::LibUtilities::ReduceSum);
+
+            m_totalIterations = 0;
+            nActive           = 0;
+
+            for (i = 0; i < nRhs; ++i)
+            {
+                // As in Set_Rhs_Magnitude, very small right-hand sides
+                // are measured against an absolute tolerance.
+                rhsMag[i] = (vExchange[3*i] > 1e-6) ? vExchange[3*i] : 1.0;
+                tol[i]    = m_tolerance * m_tolerance * rhsMag[i];
+
+                eps[i]    = vExchange[3*i+2];
+                active[i] = eps[i] >= tol[i];
+                nActive  += active[i];
+            }
+
+            // Largest error relative to the right-hand side magnitudes
+            auto relError = [&]()
+            {
+                NekDouble err = 0.0;
+                for (int j = 0; j < nRhs; ++j)
+                {
+                    err = max(err, eps[j]/rhsMag[j]);
+                }
+                return sqrt(err);
+            };
+
+            // Search directions of the unconverged systems
+            Array<OneD, Array<OneD, NekDouble> > w_act, s_act;
+            auto gatherActive = [&]()
+            {
+                w_act = Array<OneD, Array<OneD, NekDouble> >(nActive);
+                s_act = Array<OneD, Array<OneD, NekDouble> >(nActive);
+                for (int j = 0, cnt = 0; j < nRhs; ++j)
+                {
+                    if (active[j])
+                    {
+                        w_act[cnt]   = w_A[j];
+                        s_act[cnt++] = s_A[j];
+                    }
+                }
+            };
+
+            k = 0;
+
+            while (nActive)
+            {
+                if(k >= m_maxiter)
+                {
+                    if (m_root)
+                    {
+                        cout << "CG iterations made = " << m_totalIterations
+                             << " using tolerance of "  << m_tolerance
+                             << " (error = " << relError() << ")" << endl;
+                    }
+                    ROOTONLY_NEKERROR(ErrorUtil::efatal,
+                                      "Exceeded maximum number of iterations");
+                }
+
+                for (i = 0; i < nRhs; ++i)
+                {
+                    if (!active[i] || m_totalIterations == 0)
+                    {
+                        continue;
+                    }
+
+                    // Compute new search direction p_k, q_k
+                    Vmath::Svtvp(nNonDir, beta[i], &p_A[i][0], 1,
+                                 &w_A[i][nDir], 1, &p_A[i][0], 1);
+                    Vmath::Svtvp(nNonDir, beta[i], &q_A[i][0], 1,
+                                 &s_A[i][nDir], 1, &q_A[i][0], 1);
+
+                    // Update solution x_{k+1}
+                    Vmath::Svtvp(nNonDir, alpha[i], &p_A[i][0], 1,
+                                 &pOutput[i][nDir], 1, &pOutput[i][nDir], 1);
+
+                    // Update residual vector r_{k+1}
+                    Vmath::Svtvp(nNonDir, -alpha[i], &q_A[i][0], 1,
+                                 &r_A[i][0], 1, &r_A[i][0], 1);
+                }
+
+                // Apply preconditioner
+                for (i = 0; i < nRhs; ++i)
+                {
+                    if (active[i])
+                    {
+                        m_precon->DoPreconditioner(r_A[i],
+                                                   tmp = w_A[i] + nDir);
+                    }
+                }
+
+                // Apply the operator to all active directions together
+                gatherActive();
+                v_DoMatrixMultiplyMultiple(w_act, s_act);
+
+                Vmath::Zero(3*nRhs, vExchange, 1);
+                for (i = 0; i < nRhs; ++i)
+                {
+                    if (!active[i])
+                    {
+                        continue;
+                    }
+
+                    // <r_{k+1}, w_{k+1}>
+                    vExchange[3*i]   = Vmath::Dot2(nNonDir,
+                                                   r_A[i],
+                                                   w_A[i] + nDir,
+                                                   m_map + nDir);
+                    // <s_{k+1}, w_{k+1}>
+                    vExchange[3*i+1] = Vmath::Dot2(nNonDir,
+                                                   s_A[i] + nDir,
+                                                   w_A[i] + nDir,
+                                                   m_map + nDir);
+                    // <r_{k+1}, r_{k+1}>
+                    vExchange[3*i+2] = Vmath::Dot2(nNonDir,
+                                                   r_A[i],
+                                                   r_A[i],
+                                                   m_map + nDir);
+                }
+
+                // Perform inner-product exchanges of all systems at once
+                vComm->AllReduce(vExchange, Nektar::LibUtilities::ReduceSum);
+
+                for (i = 0; i < nRhs; ++i)
+                {
+                    if (!active[i])
+                    {
+                        continue;
+                    }
+
+                    NekDouble rho_new = vExchange[3*i];
+                    mu[i]             = vExchange[3*i+1];
+
+                    if (m_totalIterations == 0)
+                    {
+                        // First direction: no convergence test, matching
+                        // DoConjugateGradient.
+                        rho[i]   = rho_new;
+                        beta[i]  = 0.0;
+                        alpha[i] = rho[i]/mu[i];
+                        continue;
+                    }
+
+                    eps[i] = vExchange[3*i+2];
+
+                    // test if norm is within tolerance
+                    if (eps[i] < tol[i])
+                    {
+                        active[i] = 0;
+                        --nActive;
+                        continue;
+                    }
+
+                    // Compute search direction and solution coefficients
+                    beta[i]  = rho_new/rho[i];
+                    alpha[i] = rho_new/(mu[i] - rho_new*beta[i]/alpha[i]);
+                    rho[i]   = rho_new;
+                }
+
+                if (m_totalIterations++ > 0)
+                {
+                    k++;
+                }
+            }
+
+            if (m_verbose && m_root)
+            {
+                cout << "CG iterations made = " << m_totalIterations
+                     << " using tolerance of "  << m_tolerance
+                     << " for " << nRhs << " right-hand sides"
+                     << " (error = " << relError() << ")" << endl;
+            }
+        }
+
         void GlobalLinSysIterative::Set_Rhs_Magnitude(
             const NekVector<NekDouble> &pIn)
         {
@@ -93,6 +93,30 @@ namespace Nektar
             /// Total counter of previous solutions
             int m_numPrevSols;
 
+            /// Method used to reuse previous solutions
+            SuccessiveRHSType m_successiveRHSType;
+
+            /// Correlation of previous solutions in the coordinates of
+            /// #m_prevLinSol, used for POD compression of the basis
+            Array<OneD, NekDouble> m_solCorrelation;
+
+            /// Right-hand side of SolveMultiple whose previous solutions are
+            /// held in #m_prevLinSol and #m_solCorrelation
+            int m_successiveRHSSlot;
+
+            /// Previous solutions of the other right-hand sides, indexed by
+            /// their position in SolveMultiple
+            std::vector<boost::circular_buffer<Array<OneD, NekDouble> > >
+                m_slotPrevLinSol;
+
+            /// Correlations of the previous solutions of the other
+            /// right-hand sides
+            std::vector<Array<OneD, NekDouble> > m_slotSolCorrelation;
+
+            /// Make the previous solutions of right-hand side @p slot those
+            /// used by the next solve.
+            void SelectSuccessiveRHSSlot(const int slot);
+
             /// A-conjugate projection technique
             void DoAconjugateProjection(
                     const int pNumRows,
@@ -101,6 +125,14 @@ namespace Nektar
                     const AssemblyMapSharedPtr &locToGloMap,
                     const int pNumDir);
 
+            /// Initial guess from extrapolation of previous solutions
+            void DoSolutionExtrapolation(
+                    const int pNumRows,
+                    const Array<OneD,const NekDouble> &pInput,
+                          Array<OneD,      NekDouble> &pOutput,
+                    const AssemblyMapSharedPtr &locToGloMap,
+                    const int pNumDir);
+
             /// Actual iterative solve
             void DoConjugateGradient(
                     const int pNumRows,
@@ -109,16 +141,42 @@ namespace Nektar
                     const AssemblyMapSharedPtr &locToGloMap,
                     const int pNumDir);
 
+            /// Conjugate gradient iterations for several right-hand sides
+            void DoConjugateGradientMultiple(
+                    const int pNumRows,
+                    const Array<OneD, const Array<OneD, NekDouble> > &pInput,
+                          Array<OneD,       Array<OneD, NekDouble> > &pOutput,
+                    const AssemblyMapSharedPtr &locToGloMap,
+                    const int pNumDir);
 
             void Set_Rhs_Magnitude(const NekVector<NekDouble> &pIn);
 
+            virtual size_t v_GetMemoryFootprint() const;
+
+            /// Memory held by the mapping and the stored previous solutions.
+            size_t GetIterativeFootprint() const;
+
             virtual void v_UniqueMap() = 0;
+
+            /// Matrix multiply applied to several vectors at once
+            virtual void v_DoMatrixMultiplyMultiple(
+                    const Array<OneD, Array<OneD, NekDouble> > &pInput,
+                          Array<OneD, Array<OneD, NekDouble> > &pOutput);
             
         private:
+            static std::string lookupIds[];
+            static std::string def;
+
             void UpdateKnownSolutions(
                     const int pGlobalBndDofs,
                     const Array<OneD,const NekDouble> &pSolution,
-                    const int pNumDirBndDofs);
+                    const int pNumDirBndDofs,
+                    const Array<OneD,const NekDouble> &pProjCoeffs
+                        = NullNekDouble1DArray);
+
+            void CompressKnownSolutions(
+                    const int pNumNonDir,
+                    std::vector<Array<OneD, NekDouble> > &pBasis);
 
             NekDouble CalculateAnorm(
                     const int nGlobal,
@@ -134,6 +192,14 @@ namespace Nektar
                     const AssemblyMapSharedPtr &locToGloMap,
                     const int pNumDir);
 
+            /// Solve the matrix system for several right-hand sides
+            virtual void v_SolveLinearSystemMultiple(
+                    const int pNumRows,
+                    const Array<OneD, const Array<OneD, NekDouble> > &pInput,
+                          Array<OneD,       Array<OneD, NekDouble> > &pOutput,
+                    const AssemblyMapSharedPtr &locToGloMap,
+                    const int pNumDir);
+
             virtual void v_DoMatrixMultiply(
                     const Array<OneD, NekDouble>& pInput,
                           Array<OneD, NekDouble>& pOutput) = 0;
@@ -183,6 +183,30 @@ namespace Nektar
         }
 
 
+        /**
+         * The right-hand sides are solved in turn, selecting the previous
+         * solutions of each of them when they are reused.
+         */
+        void GlobalLinSysIterativeFull::v_SolveMultiple(
+                    const Array<OneD, const Array<OneD, NekDouble> > &pInput,
+                          Array<OneD,       Array<OneD, NekDouble> > &pOutput,
+                    const AssemblyMapSharedPtr &pLocToGloMap,
+                    const Array<OneD, const Array<OneD, NekDouble> >
+                                                        &pDirForcing)
+        {
+            bool dirForcCalculated = (bool) pDirForcing.num_elements();
+
+            for (int i = 0; i < pInput.num_elements(); ++i)
+            {
+                SelectSuccessiveRHSSlot(i);
+                v_Solve(pInput[i], pOutput[i], pLocToGloMap,
+                        dirForcCalculated ? pDirForcing[i]
+                                          : NullNekDouble1DArray);
+            }
+            SelectSuccessiveRHSSlot(0);
+        }
+
+
         /**
          *
          */
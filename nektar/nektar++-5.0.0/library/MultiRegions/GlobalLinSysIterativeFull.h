@@ -83,6 +83,15 @@ namespace Nektar
                     const Array<OneD, const NekDouble> &dirForcing
                                                         = NullNekDouble1DArray);
 
+            /// Solve for several right-hand sides, each of them with its own
+            /// previous solutions.
+            virtual void v_SolveMultiple(
+                    const Array<OneD, const Array<OneD, NekDouble> > &in,
+                          Array<OneD,       Array<OneD, NekDouble> > &out,
+                    const AssemblyMapSharedPtr &locToGloMap,
+                    const Array<OneD, const Array<OneD, NekDouble> >
+                                                        &dirForcing);
+
             virtual void v_DoMatrixMultiply(
                     const Array<OneD, NekDouble>& pInput,
                           Array<OneD, NekDouble>& pOutput);
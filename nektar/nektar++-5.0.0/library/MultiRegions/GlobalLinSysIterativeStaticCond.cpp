@@ -72,7 +72,7 @@ namespace Nektar
             LibUtilities::SessionReader::RegisterDefaultSolverInfo(
                 "LocalMatrixStorageStrategy",
                 "Sparse");
-        std::string GlobalLinSysIterativeStaticCond::storagelookupIds[3] = {
+        std::string GlobalLinSysIterativeStaticCond::storagelookupIds[4] = {
             LibUtilities::SessionReader::RegisterEnumValue(
                 "LocalMatrixStorageStrategy",
                 "Contiguous",
@@ -85,6 +85,10 @@ namespace Nektar
                 "LocalMatrixStorageStrategy",
                 "Sparse",
                 MultiRegions::eSparse),
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "LocalMatrixStorageStrategy",
+                "MatrixFree",
+                MultiRegions::eMatrixFree),
         };
 
         /**
@@ -112,7 +116,8 @@ namespace Nektar
             const std::shared_ptr<AssemblyMap>   &pLocToGloMap)
             : GlobalLinSys          (pKey, pExpList, pLocToGloMap),
               GlobalLinSysIterative (pKey, pExpList, pLocToGloMap),
-              GlobalLinSysStaticCond(pKey, pExpList, pLocToGloMap)
+              GlobalLinSysStaticCond(pKey, pExpList, pLocToGloMap),
+              m_matrixFree          (false)
         {
             ASSERTL1((pKey.GetGlobalSysSolnType()==eIterativeStaticCond)||
                      (pKey.GetGlobalSysSolnType()==eIterativeMultiLevelStaticCond),
@@ -139,7 +144,8 @@ namespace Nektar
             const PreconditionerSharedPtr         pPrecon)
             : GlobalLinSys          (pKey, pExpList, pLocToGloMap),
               GlobalLinSysIterative (pKey, pExpList, pLocToGloMap),
-              GlobalLinSysStaticCond(pKey, pExpList, pLocToGloMap)
+              GlobalLinSysStaticCond(pKey, pExpList, pLocToGloMap),
+              m_matrixFree          (false)
         {
             m_schurCompl  = pSchurCompl;
             m_S1Blk       = pSchurCompl;
@@ -156,6 +162,20 @@ namespace Nektar
 
             m_precon = CreatePrecon(asmMap);
 
+            m_matrixFree = m_expList.lock()->GetSession()->
+                GetSolverInfoAsEnum<LocalMatrixStorageStrategy>(
+                    "LocalMatrixStorageStrategy") == eMatrixFree;
+
+            if (m_matrixFree)
+            {
+                // Only the diagonal of the boundary blocks is kept, which
+                // is all the preconditioner requires.
+                SetupMatrixFree();
+                m_precon->BuildPreconditioner();
+                Initialise(asmMap);
+                return;
+            }
+
             // Allocate memory for top-level structure
             SetupTopLevel(asmMap);
 
@@ -206,6 +226,49 @@ namespace Nektar
             
         }
 
+        /**
+         * Returns the memory held by the system, including the condensed
+         * blocks, the contiguous or sparse storage of the Schur complement and
+         * the lower levels. The preconditioner is shared by all levels of a
+         * multi-level system and is counted once, at the lowest level.
+         */
+        size_t GlobalLinSysIterativeStaticCond::v_GetMemoryFootprint() const
+        {
+            size_t bytes = GlobalLinSys::v_GetMemoryFootprint() +
+                GetIterativeFootprint() + GetStaticCondFootprint();
+
+            // Untransformed blocks, which are only distinct from those of the
+            // Schur complement under the low energy preconditioner.
+            if (m_S1Blk && m_schurCompl && m_S1Blk != m_schurCompl)
+            {
+                for (int n = 0; n < m_S1Blk->GetNumberOfBlockRows(); ++n)
+                {
+                    DNekScalMatSharedPtr blk = m_S1Blk->GetBlock(n, n);
+                    if (blk && blk != m_schurCompl->GetBlock(n, n))
+                    {
+                        bytes += Nektar::GetMemoryFootprint(*blk);
+                    }
+                }
+            }
+
+            bytes += m_storage.capacity() * sizeof(double) +
+                m_denseBlocks.capacity() * sizeof(const double*) +
+                m_rows.num_elements() * sizeof(unsigned int) +
+                m_scale.num_elements() * sizeof(NekDouble);
+
+            if (m_sparseSchurCompl)
+            {
+                bytes += m_sparseSchurCompl->GetMemoryFootprint();
+            }
+
+            if (m_precon && !m_recursiveSchurCompl)
+            {
+                bytes += m_precon->GetMemoryFootprint();
+            }
+
+            return bytes;
+        }
+
         DNekScalBlkMatSharedPtr GlobalLinSysIterativeStaticCond::
             v_GetStaticCondBlock(unsigned int n)
         {
@@ -385,6 +448,12 @@ namespace Nektar
                     }
                     break;
                 }
+                case MultiRegions::eMatrixFree:
+                {
+                    // Nothing to store, the operator is applied elementally
+                    // in v_DoMatrixMultiply.
+                    break;
+                }
                 case MultiRegions::eSparse:
                 {
                     DNekScalMatSharedPtr loc_mat;
@@ -469,7 +538,7 @@ namespace Nektar
                 default:
                     ErrorUtil::NekError("Solver info property \
                         LocalMatrixStorageStrategy takes values \
-                        Contiguous, Non-contiguous and Sparse");
+                        Contiguous, Non-contiguous, Sparse and MatrixFree");
             }
         }
 
@@ -496,6 +565,22 @@ namespace Nektar
                 m_sparseSchurCompl->Multiply(in,out);
                 asmMap->UniversalAssembleBnd(pOutput, nDir);
             }
+            else if (m_matrixFree)
+            {
+                // Apply the condensed elemental operators on the fly
+                Array<OneD, NekDouble> tmp = m_wsp + nLocal;
+                Array<OneD, NekDouble> bndIn, bndOut;
+
+                asmMap->GlobalToLocalBnd(pInput, m_wsp);
+                for (int n = 0, cnt = 0; n < m_mfKeys.size(); ++n)
+                {
+                    MatrixFreeCondensedOp(n, NullNekDouble1DArray,
+                                          bndIn  = m_wsp + cnt,
+                                          bndOut = tmp   + cnt);
+                    cnt += m_mfBndMap[n].num_elements();
+                }
+                asmMap->AssembleBnd(tmp, pOutput);
+            }
             else if (m_sparseSchurCompl)
             {
                 // Do matrix multiply locally using block-diagonal sparse matrix
@@ -523,6 +608,56 @@ namespace Nektar
             }
         }
 
+        /**
+         * When the Schur complement is held as dense elemental blocks, the
+         * local vectors are gathered into a single column-major block and
+         * each elemental matrix is applied to all of them with one Dgemm
+         * call, so that it is read from memory once per set of vectors.
+         */
+        void GlobalLinSysIterativeStaticCond::v_DoMatrixMultiplyMultiple(
+                const Array<OneD, Array<OneD, NekDouble> > &pInput,
+                      Array<OneD, Array<OneD, NekDouble> > &pOutput)
+        {
+            const int nVec = pInput.num_elements();
+
+            if (nVec < 2 || m_sparseSchurCompl || m_matrixFree ||
+                m_expList.lock()->GetGlobalOptParam()->
+                    DoGlobalMatOp(m_linSysKey.GetMatrixType()))
+            {
+                GlobalLinSysIterative::v_DoMatrixMultiplyMultiple(
+                    pInput, pOutput);
+                return;
+            }
+
+            auto asmMap = m_locToGloMap.lock();
+
+            int nLocal = asmMap->GetNumLocalBndCoeffs();
+            int i, cnt;
+
+            Array<OneD, NekDouble> locIn (nLocal*nVec);
+            Array<OneD, NekDouble> locOut(nLocal*nVec);
+            Array<OneD, NekDouble> tmp;
+
+            for (i = 0; i < nVec; ++i)
+            {
+                asmMap->GlobalToLocalBnd(pInput[i], tmp = locIn + i*nLocal);
+            }
+
+            for (i = cnt = 0; i < m_denseBlocks.size(); cnt += m_rows[i], ++i)
+            {
+                const int rows = m_rows[i];
+                Blas::Dgemm('N', 'N', rows, nVec, rows,
+                            m_scale[i], m_denseBlocks[i], rows,
+                            locIn.get()+cnt, nLocal,
+                            0.0, locOut.get()+cnt, nLocal);
+            }
+
+            for (i = 0; i < nVec; ++i)
+            {
+                asmMap->AssembleBnd(tmp = locOut + i*nLocal, pOutput[i]);
+            }
+        }
+
         void GlobalLinSysIterativeStaticCond::v_UniqueMap()
         {
             m_map = m_locToGloMap.lock()->GetGlobalToUniversalBndMapUnique();
@@ -569,6 +704,316 @@ namespace Nektar
 	    m_precon->DoTransformFromLowEnergy(pInOut);
         }
 
+        void GlobalLinSysIterativeStaticCond::v_CondensedBndForcing(
+            const DNekScalBlkMatSharedPtr &sc,
+            NekVector<NekDouble>          &F_Int,
+            NekVector<NekDouble>          &V_LocBnd,
+            bool                           useBnd)
+        {
+            if (!m_matrixFree)
+            {
+                GlobalLinSysStaticCond::v_CondensedBndForcing(
+                    sc, F_Int, V_LocBnd, useBnd);
+                return;
+            }
+
+            Array<OneD, NekDouble> f   = F_Int.GetPtr();
+            Array<OneD, NekDouble> bnd = V_LocBnd.GetPtr();
+            Array<OneD, NekDouble> fInt, bndIn, bndOut;
+
+            // Without known boundary values the local boundary input is
+            // zero, so that only the interior forcing contributes.
+            if (!useBnd)
+            {
+                Vmath::Zero(V_LocBnd.GetDimension(), bnd, 1);
+            }
+
+            for (int n = 0, cnt = 0, cntInt = 0; n < m_mfKeys.size(); ++n)
+            {
+                MatrixFreeCondensedOp(n, fInt   = f   + cntInt,
+                                         bndIn  = bnd + cnt,
+                                         bndOut = bnd + cnt);
+                cnt    += m_mfBndMap[n].num_elements();
+                cntInt += m_mfIntMap[n].num_elements();
+            }
+        }
+
+        void GlobalLinSysIterativeStaticCond::v_CondensedIntSolve(
+            NekVector<NekDouble>          &F_Int,
+            NekVector<NekDouble>          &V_LocBnd,
+            NekVector<NekDouble>          &V_Int,
+            bool                           useBnd)
+        {
+            if (!m_matrixFree)
+            {
+                GlobalLinSysStaticCond::v_CondensedIntSolve(
+                    F_Int, V_LocBnd, V_Int, useBnd);
+                return;
+            }
+
+            Array<OneD, NekDouble> f   = F_Int.GetPtr();
+            Array<OneD, NekDouble> bnd = V_LocBnd.GetPtr();
+            Array<OneD, NekDouble> sol = V_Int.GetPtr();
+            Array<OneD, NekDouble> fInt, solInt;
+
+            for (int n = 0, cnt = 0, cntInt = 0; n < m_mfKeys.size(); ++n)
+            {
+                const Array<OneD, const unsigned int> &bmap = m_mfBndMap[n];
+                const Array<OneD, const unsigned int> &imap = m_mfIntMap[n];
+                const int nBnd = bmap.num_elements();
+                const int nInt = imap.num_elements();
+
+                if (useBnd)
+                {
+                    // Remove the coupling to the boundary values
+                    const int nCoeffs = m_expList.lock()->GetExp(n)->
+                        GetNcoeffs();
+                    Vmath::Zero(nCoeffs, m_mfIn, 1);
+                    for (int i = 0; i < nBnd; ++i)
+                    {
+                        m_mfIn[bmap[i]] = bnd[cnt + i];
+                    }
+                    MatrixFreeElmtOp(n, m_mfIn, m_mfOut);
+                    for (int i = 0; i < nInt; ++i)
+                    {
+                        f[cntInt + i] -= m_mfOut[imap[i]];
+                    }
+                }
+
+                MatrixFreeIntSolve(n, fInt = f + cntInt, solInt = sol + cntInt);
+
+                cnt    += nBnd;
+                cntInt += nInt;
+            }
+        }
+
+        /**
+         * Set up the data required to apply the statically condensed
+         * operator without forming elemental matrices. Each elemental
+         * operator is applied through Expansion::GeneralMatrixOp, which uses
+         * the sum-factorised kernels of the expansion, and the interior
+         * problems are solved by fast diagonalisation where the element
+         * supports it and by a local conjugate gradient iteration otherwise.
+         * Only the diagonal of the boundary-boundary block of each
+         * elemental matrix is stored, so that the diagonal preconditioner
+         * can still be assembled.
+         */
+        void GlobalLinSysIterativeStaticCond::SetupMatrixFree()
+        {
+            auto asmMap  = m_locToGloMap.lock();
+            auto expList = m_expList.lock();
+
+            StdRegions::MatrixType mType = m_linSysKey.GetMatrixType();
+            ASSERTL0(mType == StdRegions::eMass      ||
+                     mType == StdRegions::eLaplacian ||
+                     mType == StdRegions::eHelmholtz,
+                     "MatrixFree storage strategy only supports mass, "
+                     "Laplacian and Helmholtz operators.");
+            ASSERTL0(m_linSysKey.GetGlobalSysSolnType() ==
+                     eIterativeStaticCond,
+                     "MatrixFree storage strategy is only available for "
+                     "single-level static condensation.");
+            ASSERTL0(m_robinBCInfo.size() == 0,
+                     "MatrixFree storage strategy does not support Robin "
+                     "boundary conditions.");
+            ASSERTL0(asmMap->GetPreconType() == eNull ||
+                     asmMap->GetPreconType() == eDiagonal,
+                     "MatrixFree storage strategy requires the Null or "
+                     "Diagonal preconditioner.");
+            ASSERTL0(!expList->GetGlobalOptParam()->DoGlobalMatOp(mType),
+                     "MatrixFree storage strategy cannot be combined with a "
+                     "global matrix operator.");
+
+            int n, i, n_exp = expList->GetNumElmts();
+            int maxCoeffs = 0;
+
+            const Array<OneD,const unsigned int>& nbdry_size
+                    = asmMap->GetNumLocalBndCoeffsPerPatch();
+
+            bool useFastDiag = UseFastDiagInteriorSolve();
+
+            m_mfKeys.clear();
+            m_mfBndMap.resize(n_exp);
+            m_mfIntMap.resize(n_exp);
+            m_mfFastDiag.resize(n_exp);
+
+            for (n = 0; n < n_exp; ++n)
+            {
+                LocalRegions::ExpansionSharedPtr exp = expList->GetExp(n);
+                m_mfKeys.push_back(GetBlockMatrixKey(n));
+                exp->GetBoundaryMap(m_mfBndMap[n]);
+                exp->GetInteriorMap(m_mfIntMap[n]);
+                m_mfFastDiag[n] = useFastDiag &&
+                    exp->HasFastDiagInteriorSolve(m_mfKeys[n]);
+                maxCoeffs = max(maxCoeffs, exp->GetNcoeffs());
+            }
+
+            // Full elemental vectors for the operator and workspace for the
+            // interior solves.
+            m_mfIn  = Array<OneD, NekDouble>(maxCoeffs,   0.0);
+            m_mfOut = Array<OneD, NekDouble>(maxCoeffs,   0.0);
+            m_mfElmt = Array<OneD, NekDouble>(maxCoeffs,  0.0);
+            m_mfWsp = Array<OneD, NekDouble>(5*maxCoeffs, 0.0);
+
+            m_schurCompl = MemoryManager<DNekScalBlkMat>
+                ::AllocateSharedPtr(nbdry_size, nbdry_size, eDIAGONAL);
+
+            for (n = 0; n < n_exp; ++n)
+            {
+                const Array<OneD, const unsigned int> &bmap = m_mfBndMap[n];
+                const int nBnd    = bmap.num_elements();
+                const int nCoeffs = expList->GetExp(n)->GetNcoeffs();
+
+                DNekMatSharedPtr diag = MemoryManager<DNekMat>
+                    ::AllocateSharedPtr(nBnd, nBnd, 0.0, eDIAGONAL);
+
+                for (i = 0; i < nBnd; ++i)
+                {
+                    Vmath::Zero(nCoeffs, m_mfIn, 1);
+                    m_mfIn[bmap[i]] = 1.0;
+                    MatrixFreeElmtOp(n, m_mfIn, m_mfOut);
+                    (*diag)(i, i) = m_mfOut[bmap[i]];
+                }
+
+                DNekScalMatSharedPtr mat = MemoryManager<DNekScalMat>
+                    ::AllocateSharedPtr(1.0, diag);
+                m_schurCompl->SetBlock(n, n, mat);
+            }
+
+            m_S1Blk = m_schurCompl;
+        }
+
+        void GlobalLinSysIterativeStaticCond::MatrixFreeElmtOp(
+            const int                           n,
+            const Array<OneD, const NekDouble> &pInput,
+                  Array<OneD,       NekDouble> &pOutput)
+        {
+            m_expList.lock()->GetExp(n)->GeneralMatrixOp(
+                pInput, pOutput, m_mfKeys[n]);
+        }
+
+        /**
+         * Solve @f$ A_{ii} x = b @f$ for the interior modes of element @a n
+         * using an unpreconditioned conjugate gradient iteration. The
+         * interior solve has to be considerably more accurate than the
+         * global iteration, since its error perturbs the condensed operator.
+         */
+        void GlobalLinSysIterativeStaticCond::MatrixFreeIntSolve(
+            const int                           n,
+            const Array<OneD, const NekDouble> &pRhs,
+                  Array<OneD,       NekDouble> &pSol)
+        {
+            const Array<OneD, const unsigned int> &imap = m_mfIntMap[n];
+            const int nInt    = imap.num_elements();
+            const int nCoeffs = m_expList.lock()->GetExp(n)->GetNcoeffs();
+
+            if (nInt == 0)
+            {
+                return;
+            }
+
+            if (m_mfFastDiag[n])
+            {
+                m_expList.lock()->GetExp(n)->FastDiagInteriorSolve(
+                    m_mfKeys[n], pRhs, pSol);
+                return;
+            }
+
+            Array<OneD, NekDouble> r   = m_mfWsp;
+            Array<OneD, NekDouble> p   = r + nInt;
+            Array<OneD, NekDouble> q   = p + nInt;
+
+            Vmath::Zero(nInt, pSol, 1);
+            Vmath::Vcopy(nInt, pRhs, 1, r, 1);
+            Vmath::Vcopy(nInt, r,    1, p, 1);
+
+            NekDouble rr  = Vmath::Dot(nInt, r, r);
+            NekDouble tol = 1e-4 * m_tolerance * m_tolerance * rr;
+
+            for (int k = 0; k < 2*nInt && rr > tol; ++k)
+            {
+                // q = A_ii p
+                Vmath::Zero(nCoeffs, m_mfIn, 1);
+                for (int i = 0; i < nInt; ++i)
+                {
+                    m_mfIn[imap[i]] = p[i];
+                }
+                MatrixFreeElmtOp(n, m_mfIn, m_mfOut);
+                for (int i = 0; i < nInt; ++i)
+                {
+                    q[i] = m_mfOut[imap[i]];
+                }
+
+                NekDouble alpha = rr / Vmath::Dot(nInt, p, q);
+                Vmath::Svtvp(nInt,  alpha, p, 1, pSol, 1, pSol, 1);
+                Vmath::Svtvp(nInt, -alpha, q, 1, r,    1, r,    1);
+
+                NekDouble rrNew = Vmath::Dot(nInt, r, r);
+                Vmath::Svtvp(nInt, rrNew / rr, p, 1, r, 1, p, 1);
+                rr = rrNew;
+            }
+        }
+
+        /**
+         * Compute @f$ A_{bb} u_b + A_{bi} w @f$ for element @a n, where
+         * @f$ w = A_{ii}^{-1} (f_i - A_{ib} u_b) @f$. With @a pIntForcing
+         * empty this is the action of the elemental Schur complement on
+         * @a pBndInput, and with a zero @a pBndInput it is @f$ B D^{-1}
+         * f_i @f$. @a pBndInput and @a pBndOutput may alias.
+         */
+        void GlobalLinSysIterativeStaticCond::MatrixFreeCondensedOp(
+            const int                           n,
+            const Array<OneD, const NekDouble> &pIntForcing,
+            const Array<OneD, const NekDouble> &pBndInput,
+                  Array<OneD,       NekDouble> &pBndOutput)
+        {
+            const Array<OneD, const unsigned int> &bmap = m_mfBndMap[n];
+            const Array<OneD, const unsigned int> &imap = m_mfIntMap[n];
+            const int nBnd    = bmap.num_elements();
+            const int nInt    = imap.num_elements();
+            const int nCoeffs = m_expList.lock()->GetExp(n)->GetNcoeffs();
+
+            // The interior solve uses the first 3*nInt entries of m_mfWsp
+            // and overwrites m_mfIn and m_mfOut, so u_b is kept in m_mfElmt.
+            Array<OneD, NekDouble> rhs  = m_mfWsp + 3*nInt;
+            Array<OneD, NekDouble> w    = rhs + nInt;
+            Array<OneD, NekDouble> in   = m_mfElmt;
+            Array<OneD, NekDouble> out  = m_mfOut;
+
+            Vmath::Zero(nCoeffs, in, 1);
+            for (int i = 0; i < nBnd; ++i)
+            {
+                in[bmap[i]] = pBndInput[i];
+            }
+
+            if (nInt)
+            {
+                // rhs = f_i - A_ib u_b
+                MatrixFreeElmtOp(n, in, out);
+                for (int i = 0; i < nInt; ++i)
+                {
+                    rhs[i] = -out[imap[i]];
+                }
+                if (pIntForcing.num_elements())
+                {
+                    Vmath::Vadd(nInt, pIntForcing, 1, rhs, 1, rhs, 1);
+                }
+
+                MatrixFreeIntSolve(n, rhs, w);
+
+                for (int i = 0; i < nInt; ++i)
+                {
+                    in[imap[i]] = w[i];
+                }
+            }
+
+            MatrixFreeElmtOp(n, in, out);
+            for (int i = 0; i < nBnd; ++i)
+            {
+                pBndOutput[i] = out[bmap[i]];
+            }
+        }
+
         GlobalLinSysStaticCondSharedPtr GlobalLinSysIterativeStaticCond::v_Recurse(
             const GlobalLinSysKey                &mkey,
             const std::weak_ptr<ExpList>         &pExpList,
@@ -56,14 +56,16 @@ namespace Nektar
             eNoStrategy,
             eContiguous,
             eNonContiguous,
-            eSparse
+            eSparse,
+            eMatrixFree
         };
 
         const char* const LocalMatrixStorageStrategyMap[] =
         {
             "Contiguous",
             "Non-contiguous",
-            "Sparse"
+            "Sparse",
+            "MatrixFree"
         };
 
 
@@ -114,6 +116,7 @@ namespace Nektar
             virtual ~GlobalLinSysIterativeStaticCond();
 
         protected:
+            virtual size_t v_GetMemoryFootprint() const;
             virtual DNekScalBlkMatSharedPtr v_GetStaticCondBlock(unsigned int n);
             virtual GlobalLinSysStaticCondSharedPtr v_Recurse(
                 const GlobalLinSysKey                &mkey,
@@ -133,6 +136,17 @@ namespace Nektar
             virtual void v_BasisBwdTransform(
                 Array<OneD, NekDouble>& pInOut);
 
+            virtual void v_CondensedBndForcing(
+                const DNekScalBlkMatSharedPtr &sc,
+                NekVector<NekDouble>          &F_Int,
+                NekVector<NekDouble>          &V_LocBnd,
+                bool                           useBnd);
+            virtual void v_CondensedIntSolve(
+                NekVector<NekDouble>          &F_Int,
+                NekVector<NekDouble>          &V_LocBnd,
+                NekVector<NekDouble>          &V_Int,
+                bool                           useBnd);
+
         private:
             DNekScalBlkMatSharedPtr                  m_S1Blk;
             /// Dense storage for block Schur complement matrix
@@ -145,12 +159,54 @@ namespace Nektar
             Array<OneD, NekDouble>                   m_scale;
             /// Sparse representation of Schur complement matrix at this level
             DNekSmvBsrDiagBlkMatSharedPtr            m_sparseSchurCompl;
+            /// Apply the Schur complement without forming local matrices
+            bool                                     m_matrixFree;
+            /// Elemental matrix keys used by the matrix-free operator
+            std::vector<LocalRegions::MatrixKey>     m_mfKeys;
+            /// Elemental boundary maps used by the matrix-free operator
+            std::vector<Array<OneD, unsigned int> >  m_mfBndMap;
+            /// Elemental interior maps used by the matrix-free operator
+            std::vector<Array<OneD, unsigned int> >  m_mfIntMap;
+            /// Elements whose matrix-free interior solve uses fast
+            /// diagonalisation
+            std::vector<bool>                        m_mfFastDiag;
+            /// Elemental input and output vectors of the matrix-free operator
+            Array<OneD, NekDouble>                   m_mfIn;
+            Array<OneD, NekDouble>                   m_mfOut;
+            /// Elemental vector holding the boundary and interior values in
+            /// the condensed operator, kept apart from m_mfIn which the
+            /// interior solve overwrites
+            Array<OneD, NekDouble>                   m_mfElmt;
+            /// Workspace for the matrix-free interior solves
+            Array<OneD, NekDouble>                   m_mfWsp;
             /// Utility strings
             static std::string                       storagedef;
             static std::string                       storagelookupIds[];
 
             virtual void v_InitObject();
 
+            /// Set up the elemental data for the matrix-free operator.
+            void SetupMatrixFree();
+
+            /// Apply the elemental operator to a local coefficient vector.
+            void MatrixFreeElmtOp(
+                    const int                           n,
+                    const Array<OneD, const NekDouble> &pInput,
+                          Array<OneD,       NekDouble> &pOutput);
+
+            /// Solve the elemental interior problem.
+            void MatrixFreeIntSolve(
+                    const int                           n,
+                    const Array<OneD, const NekDouble> &pRhs,
+                          Array<OneD,       NekDouble> &pSol);
+
+            /// Apply the elemental condensed operator.
+            void MatrixFreeCondensedOp(
+                    const int                           n,
+                    const Array<OneD, const NekDouble> &pIntForcing,
+                    const Array<OneD, const NekDouble> &pBndInput,
+                          Array<OneD,       NekDouble> &pBndOutput);
+
             /// Assemble the Schur complement matrix.
             void v_AssembleSchurComplement(
                 const std::shared_ptr<AssemblyMap> locToGloMap);
@@ -164,6 +220,12 @@ namespace Nektar
                     const Array<OneD, NekDouble>& pInput,
                           Array<OneD, NekDouble>& pOutput);
 
+            /// Perform a Schur-complement matrix multiply operation on
+            /// several vectors at once.
+            virtual void v_DoMatrixMultiplyMultiple(
+                    const Array<OneD, Array<OneD, NekDouble> > &pInput,
+                          Array<OneD, Array<OneD, NekDouble> > &pOutput);
+
             virtual void v_UniqueMap();
         };
     }
@@ -106,6 +106,132 @@ namespace Nektar
                   Array<OneD,       NekDouble> &out,
             const AssemblyMapSharedPtr         &pLocToGloMap,
             const Array<OneD, const NekDouble> &dirForcing)
+        {
+            bool atLastLevel       = pLocToGloMap->AtLastLevel();
+            int nGlobBndDofs       = pLocToGloMap->GetNumGlobalBndCoeffs();
+            int nDirBndDofs        = pLocToGloMap->GetNumGlobalDirBndCoeffs();
+            int nGlobHomBndDofs    = nGlobBndDofs - nDirBndDofs;
+            int nLocBndDofs        = pLocToGloMap->GetNumLocalBndCoeffs();
+
+            Array<OneD, NekDouble> F = m_wsp + 2*nLocBndDofs + nGlobHomBndDofs;
+
+            CondenseForcing(in, out, F, pLocToGloMap, dirForcing);
+
+            if(nGlobHomBndDofs)
+            {
+                // solve boundary system
+                if(atLastLevel)
+                {
+                    Array<OneD, NekDouble> pert(nGlobBndDofs,0.0);
+
+                    // Solve for difference from initial solution given inout;
+                    SolveLinearSystem(
+                        nGlobBndDofs, F, pert, pLocToGloMap, nDirBndDofs);
+
+                    // Transform back to original basis
+                    v_BasisBwdTransform(pert);
+
+                    // Add back initial conditions onto difference
+                    Vmath::Vadd(nGlobHomBndDofs,&out[nDirBndDofs],1,
+                                &pert[nDirBndDofs],1,&out[nDirBndDofs],1);
+                }
+                else
+                {
+                    m_recursiveSchurCompl->Solve(F, out,
+                                pLocToGloMap->GetNextLevelLocalToGlobalMap());
+                }
+            }
+
+            SolveInterior(out, F, pLocToGloMap, dirForcing);
+        }
+
+
+        /**
+         * Each right-hand side is condensed in turn, after which the
+         * boundary systems are solved together so that the Schur complement
+         * (or its factorisation) is streamed once for all right-hand sides.
+         * The interior solves are then performed for each right-hand side.
+         */
+        void GlobalLinSysStaticCond::v_SolveMultiple(
+            const Array<OneD, const Array<OneD, NekDouble> > &in,
+                  Array<OneD,       Array<OneD, NekDouble> > &out,
+            const AssemblyMapSharedPtr         &pLocToGloMap,
+            const Array<OneD, const Array<OneD, NekDouble> > &dirForcing)
+        {
+            bool dirForcCalculated = (bool) dirForcing.num_elements();
+            bool atLastLevel       = pLocToGloMap->AtLastLevel();
+            int  nRhs              = in.num_elements();
+
+            int nGlobDofs          = pLocToGloMap->GetNumGlobalCoeffs();
+            int nGlobBndDofs       = pLocToGloMap->GetNumGlobalBndCoeffs();
+            int nDirBndDofs        = pLocToGloMap->GetNumGlobalDirBndCoeffs();
+            int nGlobHomBndDofs    = nGlobBndDofs - nDirBndDofs;
+
+            if (nRhs < 2)
+            {
+                GlobalLinSys::v_SolveMultiple(in, out, pLocToGloMap,
+                                              dirForcing);
+                return;
+            }
+
+            Array<OneD, Array<OneD, NekDouble> > F(nRhs);
+            Array<OneD, Array<OneD, NekDouble> > pert(nRhs);
+
+            for (int i = 0; i < nRhs; ++i)
+            {
+                F[i] = Array<OneD, NekDouble>(nGlobDofs);
+                CondenseForcing(in[i], out[i], F[i], pLocToGloMap,
+                                dirForcCalculated ? dirForcing[i]
+                                                  : NullNekDouble1DArray);
+            }
+
+            if(nGlobHomBndDofs)
+            {
+                if(atLastLevel)
+                {
+                    for (int i = 0; i < nRhs; ++i)
+                    {
+                        pert[i] = Array<OneD, NekDouble>(nGlobBndDofs, 0.0);
+                    }
+
+                    SolveLinearSystemMultiple(
+                        nGlobBndDofs, F, pert, pLocToGloMap, nDirBndDofs);
+
+                    for (int i = 0; i < nRhs; ++i)
+                    {
+                        v_BasisBwdTransform(pert[i]);
+                        Vmath::Vadd(nGlobHomBndDofs,&out[i][nDirBndDofs],1,
+                                    &pert[i][nDirBndDofs],1,
+                                    &out[i][nDirBndDofs],1);
+                    }
+                }
+                else
+                {
+                    m_recursiveSchurCompl->SolveMultiple(F, out,
+                                pLocToGloMap->GetNextLevelLocalToGlobalMap());
+                }
+            }
+
+            for (int i = 0; i < nRhs; ++i)
+            {
+                SolveInterior(out[i], F[i], pLocToGloMap,
+                              dirForcCalculated ? dirForcing[i]
+                                                : NullNekDouble1DArray);
+            }
+        }
+
+
+        /**
+         * Construct the statically condensed boundary forcing in \a F from
+         * the global right-hand side \a in. On exit the interior part of \a
+         * F holds the interior forcing required by SolveInterior.
+         */
+        void GlobalLinSysStaticCond::CondenseForcing(
+            const Array<OneD, const NekDouble> &in,
+                  Array<OneD,       NekDouble> &out,
+                  Array<OneD,       NekDouble> &F,
+            const AssemblyMapSharedPtr         &pLocToGloMap,
+            const Array<OneD, const NekDouble> &dirForcing)
         {
             bool dirForcCalculated = (bool) dirForcing.num_elements();
             bool atLastLevel       = pLocToGloMap->AtLastLevel();
@@ -119,7 +245,6 @@ namespace Nektar
             int nIntDofs           = pLocToGloMap->GetNumGlobalCoeffs()
                 - nGlobBndDofs;
 
-            Array<OneD, NekDouble> F = m_wsp + 2*nLocBndDofs + nGlobHomBndDofs;
             Array<OneD, NekDouble> tmp;
             if(nDirBndDofs && dirForcCalculated)
             {
@@ -136,10 +261,6 @@ namespace Nektar
             NekVector<NekDouble> F_Int(nIntDofs,tmp=F+nGlobBndDofs,eWrapper);
             
             NekVector<NekDouble> V_GlobBnd(nGlobBndDofs,out,eWrapper);
-            NekVector<NekDouble> V_GlobHomBnd(nGlobHomBndDofs,
-                                              tmp=out+nDirBndDofs,
-                                              eWrapper);
-            NekVector<NekDouble> V_Int(nIntDofs,tmp=out+nGlobBndDofs,eWrapper);
             NekVector<NekDouble> V_LocBnd(nLocBndDofs,m_wsp,eWrapper);
             
             NekVector<NekDouble> V_GlobHomBndTmp(
@@ -151,27 +272,13 @@ namespace Nektar
             if(nGlobHomBndDofs)
             {
                 // construct boundary forcing
-                if( nIntDofs  && ((!dirForcCalculated) && (atLastLevel)) )
+                bool useBnd = (!dirForcCalculated) && (atLastLevel);
+                if(useBnd)
                 {
-                    DNekScalBlkMat &BinvD      = *m_BinvD;
-                    DNekScalBlkMat &SchurCompl = *sc;
-
                     // include dirichlet boundary forcing
                     pLocToGloMap->GlobalToLocalBnd(V_GlobBnd,V_LocBnd);
-                    V_LocBnd = BinvD*F_Int + SchurCompl*V_LocBnd;
-                }
-                else if((!dirForcCalculated) && (atLastLevel))
-                {
-                    // include dirichlet boundary forcing
-                    DNekScalBlkMat &SchurCompl = *sc;
-                    pLocToGloMap->GlobalToLocalBnd(V_GlobBnd,V_LocBnd);
-                    V_LocBnd = SchurCompl*V_LocBnd;
-                }
-                else
-                {
-                    DNekScalBlkMat &BinvD      = *m_BinvD;
-                    DiagonalBlockFullScalMatrixMultiply( V_LocBnd, BinvD, F_Int);
                 }
+                v_CondensedBndForcing(sc, F_Int, V_LocBnd, useBnd);
                 
                 pLocToGloMap->AssembleBnd(V_LocBnd,V_GlobHomBndTmp,
                                           nDirBndDofs);
@@ -203,40 +310,47 @@ namespace Nektar
                         Subtract( F_HomBnd, F_HomBnd, V_GlobHomBndTmp);
                     }
                 }
+            }
+        }
 
-                // solve boundary system
-                if(atLastLevel)
-                {
-                    Array<OneD, NekDouble> pert(nGlobBndDofs,0.0);
-
-                    // Solve for difference from initial solution given inout;
-                    SolveLinearSystem(
-                        nGlobBndDofs, F, pert, pLocToGloMap, nDirBndDofs);
-
-                    // Transform back to original basis
-                    v_BasisBwdTransform(pert);
 
-                    // Add back initial conditions onto difference
-                    Vmath::Vadd(nGlobHomBndDofs,&out[nDirBndDofs],1,
-                                &pert[nDirBndDofs],1,&out[nDirBndDofs],1);
-                }
-                else
-                {
-                    m_recursiveSchurCompl->Solve(F,
-                                V_GlobBnd.GetPtr(),
-                                pLocToGloMap->GetNextLevelLocalToGlobalMap());
-                }
-            }
+        /**
+         * Recover the interior degrees of freedom of \a out once its
+         * boundary degrees of freedom are known, using the interior forcing
+         * held in \a F by CondenseForcing.
+         */
+        void GlobalLinSysStaticCond::SolveInterior(
+                  Array<OneD,       NekDouble> &out,
+                  Array<OneD,       NekDouble> &F,
+            const AssemblyMapSharedPtr         &pLocToGloMap,
+            const Array<OneD, const NekDouble> &dirForcing)
+        {
+            bool dirForcCalculated = (bool) dirForcing.num_elements();
+            int nGlobBndDofs       = pLocToGloMap->GetNumGlobalBndCoeffs();
+            int nDirBndDofs        = pLocToGloMap->GetNumGlobalDirBndCoeffs();
+            int nGlobHomBndDofs    = nGlobBndDofs - nDirBndDofs;
+            int nLocBndDofs        = pLocToGloMap->GetNumLocalBndCoeffs();
+            int nIntDofs           = pLocToGloMap->GetNumGlobalCoeffs()
+                - nGlobBndDofs;
 
             // solve interior system
             if(nIntDofs)
             {
-                DNekScalBlkMat &invD  = *m_invD;
-
-                if(nGlobHomBndDofs || nDirBndDofs)
+                Array<OneD, NekDouble> tmp;
+                NekVector<NekDouble> F_Int(nIntDofs,tmp=F+nGlobBndDofs,
+                                           eWrapper);
+                NekVector<NekDouble> V_GlobBnd(nGlobBndDofs,out,eWrapper);
+                NekVector<NekDouble> V_GlobHomBnd(nGlobHomBndDofs,
+                                                  tmp=out+nDirBndDofs,
+                                                  eWrapper);
+                NekVector<NekDouble> V_Int(nIntDofs,tmp=out+nGlobBndDofs,
+                                           eWrapper);
+                NekVector<NekDouble> V_LocBnd(nLocBndDofs,m_wsp,eWrapper);
+
+                bool useBnd = nGlobHomBndDofs || nDirBndDofs;
+
+                if(useBnd)
                 {
-                    DNekScalBlkMat &C     = *m_C;
-
                     if(dirForcCalculated && nDirBndDofs)
                     {
                         pLocToGloMap->GlobalToLocalBnd(V_GlobHomBnd,V_LocBnd,
@@ -246,9 +360,76 @@ namespace Nektar
                     {
                         pLocToGloMap->GlobalToLocalBnd(V_GlobBnd,V_LocBnd);
                     }
-                    F_Int = F_Int - C*V_LocBnd;
                 }
-                Multiply( V_Int, invD, F_Int);
+                v_CondensedIntSolve(F_Int, V_LocBnd, V_Int, useBnd);
+            }
+        }
+
+
+        /**
+         * Compute the condensed boundary forcing in \a V_LocBnd. This is
+         * \f$ BD^{-1} F_{int} + S u_{bnd} \f$ when \a useBnd is set, where
+         * \f$ u_{bnd} \f$ are the known boundary values held on entry in \a
+         * V_LocBnd, and \f$ BD^{-1} F_{int} \f$ otherwise.
+         */
+        void GlobalLinSysStaticCond::v_CondensedBndForcing(
+            const DNekScalBlkMatSharedPtr &sc,
+            NekVector<NekDouble>          &F_Int,
+            NekVector<NekDouble>          &V_LocBnd,
+            bool                           useBnd)
+        {
+            if(useBnd && F_Int.GetDimension())
+            {
+                DNekScalBlkMat &BinvD      = *m_BinvD;
+                DNekScalBlkMat &SchurCompl = *sc;
+                V_LocBnd = BinvD*F_Int + SchurCompl*V_LocBnd;
+            }
+            else if(useBnd)
+            {
+                DNekScalBlkMat &SchurCompl = *sc;
+                V_LocBnd = SchurCompl*V_LocBnd;
+            }
+            else
+            {
+                DNekScalBlkMat &BinvD      = *m_BinvD;
+                DiagonalBlockFullScalMatrixMultiply( V_LocBnd, BinvD, F_Int);
+            }
+        }
+
+
+        /**
+         * Solve for the interior values \f$ V_{int} = D^{-1}(F_{int} - C
+         * u_{bnd}) \f$, where the boundary term is only included when \a
+         * useBnd is set.
+         */
+        void GlobalLinSysStaticCond::v_CondensedIntSolve(
+            NekVector<NekDouble>          &F_Int,
+            NekVector<NekDouble>          &V_LocBnd,
+            NekVector<NekDouble>          &V_Int,
+            bool                           useBnd)
+        {
+            DNekScalBlkMat &invD  = *m_invD;
+
+            if(useBnd)
+            {
+                DNekScalBlkMat &C     = *m_C;
+                F_Int = F_Int - C*V_LocBnd;
+            }
+
+            // Blocks of elements solved by fast diagonalisation are empty
+            // and skipped here; their values are set below.
+            Multiply( V_Int, invD, F_Int);
+
+            Array<OneD, NekDouble> f = F_Int.GetPtr();
+            Array<OneD, NekDouble> v = V_Int.GetPtr();
+            Array<OneD, NekDouble> fElmt, vElmt;
+            for (int i = 0; i < m_fastDiagElmts.size(); ++i)
+            {
+                int offset = m_fastDiagOffsets[i];
+                m_expList.lock()->GetExp(m_fastDiagElmts[i])->
+                    FastDiagInteriorSolve(m_fastDiagKeys[i],
+                                          fElmt = f + offset,
+                                          vElmt = v + offset);
             }
         }
 
@@ -287,6 +468,43 @@ namespace Nektar
             return m_schurCompl->GetNumberOfBlockRows();
         }
 
+        /// Memory held by the system, including its condensed blocks.
+        size_t GlobalLinSysStaticCond::v_GetMemoryFootprint() const
+        {
+            return GlobalLinSys::v_GetMemoryFootprint() +
+                GetStaticCondFootprint();
+        }
+
+        /**
+         * Returns the memory held by the condensed blocks of this level and by
+         * the systems of the lower levels. The blocks of the top level are
+         * shared with the static condensation matrices of the expansions until
+         * ReleaseLocalMatrices is called, after which this system is their
+         * only owner. The \f$ D^{-1} \f$ blocks of elements solved by fast
+         * diagonalisation are empty and are skipped.
+         */
+        size_t GlobalLinSysStaticCond::GetStaticCondFootprint() const
+        {
+            size_t bytes = 0;
+
+            DNekScalBlkMatSharedPtr blkMats[4] =
+                { m_schurCompl, m_BinvD, m_C, m_invD };
+            for (auto &blkMat : blkMats)
+            {
+                if (blkMat)
+                {
+                    bytes += Nektar::GetMemoryFootprint(*blkMat);
+                }
+            }
+
+            if (m_recursiveSchurCompl)
+            {
+                bytes += m_recursiveSchurCompl->GetMemoryFootprint();
+            }
+
+            return bytes;
+        }
+
         /**
          * For the first level in multi-level static condensation, or the only
          * level in the case of single-level static condensation, allocate the
@@ -297,7 +515,7 @@ namespace Nektar
         void GlobalLinSysStaticCond::SetupTopLevel(
                 const std::shared_ptr<AssemblyMap>& pLocToGloMap)
         {
-            int n;
+            int n, cnt;
             int n_exp = m_expList.lock()->GetNumElmts();
 
             const Array<OneD,const unsigned int>& nbdry_size
@@ -316,7 +534,13 @@ namespace Nektar
             m_invD       = MemoryManager<DNekScalBlkMat>
                     ::AllocateSharedPtr(nint_size , nint_size , blkmatStorage);
 
-            for(n = 0; n < n_exp; ++n)
+            bool useFastDiag = UseFastDiagInteriorSolve();
+
+            m_fastDiagElmts.clear();
+            m_fastDiagOffsets.clear();
+            m_fastDiagKeys.clear();
+
+            for(n = 0, cnt = 0; n < n_exp; cnt += nint_size[n], ++n)
             {
                 if (m_linSysKey.GetMatrixType() ==
                         StdRegions::eHybridDGHelmBndLam)
@@ -327,17 +551,117 @@ namespace Nektar
                 }
                 else
                 {
-                    DNekScalBlkMatSharedPtr loc_schur
-                        = GlobalLinSys::v_GetStaticCondBlock(n);
+                    LocalRegions::MatrixKey key = GetBlockMatrixKey(n);
+                    bool fastDiag = useFastDiag && nint_size[n] > 0 &&
+                        m_robinBCInfo.count(n) == 0 &&
+                        m_expList.lock()->GetExp(n)->
+                            HasFastDiagInteriorSolve(key);
+
+                    DNekScalBlkMatSharedPtr loc_schur = fastDiag
+                        ? FastDiagStaticCondBlock(n, key)
+                        : GlobalLinSys::v_GetStaticCondBlock(n);
                     DNekScalMatSharedPtr t;
                     m_schurCompl->SetBlock(n, n, t = loc_schur->GetBlock(0,0));
                     m_BinvD     ->SetBlock(n, n, t = loc_schur->GetBlock(0,1));
                     m_C         ->SetBlock(n, n, t = loc_schur->GetBlock(1,0));
-                    m_invD      ->SetBlock(n, n, t = loc_schur->GetBlock(1,1));
+
+                    if (fastDiag)
+                    {
+                        // The interior inverse is applied by fast
+                        // diagonalisation in v_CondensedIntSolve, so the
+                        // block of m_invD is left empty and skipped by the
+                        // block multiply.
+                        m_fastDiagElmts  .push_back(n);
+                        m_fastDiagOffsets.push_back(cnt);
+                        m_fastDiagKeys   .push_back(key);
+                    }
+                    else
+                    {
+                        m_invD->SetBlock(n, n, t = loc_schur->GetBlock(1,1));
+                    }
                 }
             }
         }
 
+        /**
+         * Form the Schur complement @f$ A - B D^{-1} C @f$, @f$ B D^{-1}
+         * @f$ and @f$ C @f$ of element @a n from its full elemental matrix
+         * without inverting the interior block @f$ D @f$. The columns of
+         * @f$ D^{-1} C @f$ are found by fast diagonalisation, and since the
+         * operator is symmetric @f$ B D^{-1} = (D^{-1} C)^T @f$. The
+         * interior inverse block is not formed.
+         */
+        DNekScalBlkMatSharedPtr GlobalLinSysStaticCond::FastDiagStaticCondBlock(
+            const int                        n,
+            const LocalRegions::MatrixKey   &key)
+        {
+            int i, j;
+            LocalRegions::ExpansionSharedPtr exp = m_expList.lock()->GetExp(n);
+            DNekScalMat &mat = *exp->GetLocMatrix(key);
+
+            unsigned int nbdry = exp->NumBndryCoeffs();
+            unsigned int nint  = exp->GetNcoeffs() - nbdry;
+            unsigned int exp_size[] = {nbdry, nint};
+
+            Array<OneD, unsigned int> bmap(nbdry);
+            Array<OneD, unsigned int> imap(nint);
+            exp->GetBoundaryMap(bmap);
+            exp->GetInteriorMap(imap);
+
+            DNekMatSharedPtr A = MemoryManager<DNekMat>::
+                AllocateSharedPtr(nbdry, nbdry);
+            DNekMatSharedPtr B = MemoryManager<DNekMat>::
+                AllocateSharedPtr(nbdry, nint);
+            DNekMatSharedPtr C = MemoryManager<DNekMat>::
+                AllocateSharedPtr(nint, nbdry);
+
+            Array<OneD, NekDouble> col(nint), invDCol(nint);
+            for (j = 0; j < nbdry; ++j)
+            {
+                for (i = 0; i < nbdry; ++i)
+                {
+                    (*A)(i,j) = mat(bmap[i], bmap[j]);
+                }
+                for (i = 0; i < nint; ++i)
+                {
+                    col[i]    = mat(imap[i], bmap[j]);
+                    (*C)(i,j) = col[i];
+                }
+
+                exp->FastDiagInteriorSolve(key, col, invDCol);
+                for (i = 0; i < nint; ++i)
+                {
+                    (*B)(j,i) = invDCol[i];
+                }
+            }
+
+            (*A) = (*A) - (*B)*(*C);
+
+            DNekScalBlkMatSharedPtr returnval = MemoryManager<DNekScalBlkMat>::
+                AllocateSharedPtr(2, 2, exp_size, exp_size);
+            DNekScalMatSharedPtr t;
+            returnval->SetBlock(0, 0, t = MemoryManager<DNekScalMat>::
+                                AllocateSharedPtr(1.0, A));
+            returnval->SetBlock(0, 1, t = MemoryManager<DNekScalMat>::
+                                AllocateSharedPtr(1.0, B));
+            returnval->SetBlock(1, 0, t = MemoryManager<DNekScalMat>::
+                                AllocateSharedPtr(1.0, C));
+            return returnval;
+        }
+
+        /**
+         * Fast diagonalisation of the interior problems is used by default
+         * where the element supports it, and can be disabled by setting the
+         * solver info property FastDiagInteriorSolve to False.
+         */
+        bool GlobalLinSysStaticCond::UseFastDiagInteriorSolve()
+        {
+            bool useFastDiag;
+            m_expList.lock()->GetSession()->MatchSolverInfo(
+                "FastDiagInteriorSolve", "True", useFastDiag, true);
+            return useFastDiag;
+        }
+
         /**
          *
          */
@@ -40,6 +40,7 @@
 #include <MultiRegions/GlobalMatrix.h>
 #include <MultiRegions/GlobalLinSysIterative.h>
 #include <LibUtilities/LinearAlgebra/SparseMatrixFwd.hpp>
+#include <LocalRegions/MatrixKey.h>
 
 namespace Nektar
 {
@@ -86,6 +87,18 @@ namespace Nektar
                 boost::ignore_unused(pInOut);
             }
 
+            virtual void v_CondensedBndForcing(
+                const DNekScalBlkMatSharedPtr &sc,
+                NekVector<NekDouble>          &F_Int,
+                NekVector<NekDouble>          &V_LocBnd,
+                bool                           useBnd);
+
+            virtual void v_CondensedIntSolve(
+                NekVector<NekDouble>          &F_Int,
+                NekVector<NekDouble>          &V_LocBnd,
+                NekVector<NekDouble>          &V_Int,
+                bool                           useBnd);
+
             virtual void v_AssembleSchurComplement(
                 std::shared_ptr<AssemblyMap> pLoctoGloMap)
             {
@@ -94,6 +107,11 @@ namespace Nektar
 
             virtual int v_GetNumBlocks();
 
+            virtual size_t v_GetMemoryFootprint() const;
+
+            /// Memory held by the condensed blocks and the lower levels.
+            size_t GetStaticCondFootprint() const;
+
             virtual GlobalLinSysStaticCondSharedPtr v_Recurse(
                 const GlobalLinSysKey                &mkey,
                 const std::weak_ptr<ExpList>         &pExpList,
@@ -117,6 +135,12 @@ namespace Nektar
             std::weak_ptr<AssemblyMap>               m_locToGloMap;
             /// Workspace array for matrix multiplication
             Array<OneD, NekDouble>                   m_wsp;
+            /// Elements whose interior is solved by fast diagonalisation.
+            std::vector<int>                         m_fastDiagElmts;
+            /// Offsets of their interior degrees of freedom.
+            std::vector<int>                         m_fastDiagOffsets;
+            /// Matrix keys of their interior problems.
+            std::vector<LocalRegions::MatrixKey>     m_fastDiagKeys;
 
             /// Solve the linear system for given input and output vectors
             /// using a specified local to global map.
@@ -127,6 +151,31 @@ namespace Nektar
                 const Array<OneD, const NekDouble> &dirForcing
                     = NullNekDouble1DArray);
 
+            /// Solve the linear system for several right-hand sides,
+            /// performing the boundary solves together.
+            virtual void v_SolveMultiple(
+                const Array<OneD, const Array<OneD, NekDouble> > &in,
+                      Array<OneD,       Array<OneD, NekDouble> > &out,
+                const AssemblyMapSharedPtr         &locToGloMap,
+                const Array<OneD, const Array<OneD, NekDouble> > &dirForcing);
+
+            /// Construct the condensed boundary forcing for a right-hand
+            /// side.
+            void CondenseForcing(
+                const Array<OneD, const NekDouble> &in,
+                      Array<OneD,       NekDouble> &out,
+                      Array<OneD,       NekDouble> &F,
+                const AssemblyMapSharedPtr         &locToGloMap,
+                const Array<OneD, const NekDouble> &dirForcing);
+
+            /// Solve for the interior degrees of freedom given the boundary
+            /// solution.
+            void SolveInterior(
+                      Array<OneD,       NekDouble> &out,
+                      Array<OneD,       NekDouble> &F,
+                const AssemblyMapSharedPtr         &locToGloMap,
+                const Array<OneD, const NekDouble> &dirForcing);
+
             virtual void v_InitObject();
 
             /// Initialise this object
@@ -138,6 +187,16 @@ namespace Nektar
             void SetupTopLevel(
                     const std::shared_ptr<AssemblyMap>& locToGloMap);
 
+            /// Whether interior problems may be solved by fast
+            /// diagonalisation.
+            bool UseFastDiagInteriorSolve();
+
+            /// Statically condensed blocks of an element whose interior
+            /// problem is solved by fast diagonalisation.
+            DNekScalBlkMatSharedPtr FastDiagStaticCondBlock(
+                    const int                        n,
+                    const LocalRegions::MatrixKey   &key);
+
             ///
             void ConstructNextLevelCondensedSystem(
                     const std::shared_ptr<AssemblyMap>& locToGloMap);
@@ -88,6 +88,7 @@ namespace Nektar
             ePETScFullMatrix,
             ePETScStaticCond,
             ePETScMultiLevelStaticCond,
+            eDirectSparseStaticCond,
             eSIZE_GlobalSysSolnType
         };
 
@@ -106,7 +107,8 @@ namespace Nektar
             "XxtMultiLevelStaticCond",
             "PETScFull",
             "PETScStaticCond",
-            "PETScMultiLevelStaticCond"
+            "PETScMultiLevelStaticCond",
+            "DirectSparseStaticCond"
         };
 
         /// Type of Galerkin projection.
@@ -142,6 +144,23 @@ namespace Nektar
         };
 
 
+        /// Method used by iterative solvers to construct an initial guess
+        /// from the solutions of previous linear problems.
+        enum SuccessiveRHSType
+        {
+            eSuccessiveRHSProjection,
+            eSuccessiveRHSPODProjection,
+            eSuccessiveRHSExtrapolation
+        };
+
+        const char* const SuccessiveRHSTypeMap[] =
+        {
+            "Projection",
+            "PODProjection",
+            "Extrapolation"
+        };
+
+
         // let's keep this for linking to external
         // sparse libraries
         enum MatrixStorageType
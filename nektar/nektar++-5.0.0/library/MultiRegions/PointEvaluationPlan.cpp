@@ -0,0 +1,247 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File PointEvaluationPlan.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Reusable evaluation of an expansion list at a set of points
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <MultiRegions/PointEvaluationPlan.h>
+#include <MultiRegions/ExpList.h>
+#include <LibUtilities/LinearAlgebra/Blas.hpp>
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        /**
+         * Locate the points and set up the interpolation weights of each
+         * located point. The local coordinates are clamped to the standard
+         * region, since points are located with a tolerance.
+         */
+        PointEvaluationPlan::PointEvaluationPlan(
+            const std::shared_ptr<ExpList>                   &expList,
+            const Array<OneD, const Array<OneD, NekDouble> > &coords,
+            const NekDouble                                   tol,
+            const bool                                        returnNearestElmt)
+            : m_numLocated(0)
+        {
+            expList->GetExpIndices(coords, m_elmtIds, m_locCoords,
+                                   tol, returnNearestElmt);
+            SetupWeights(expList);
+        }
+
+        /**
+         * Set up the interpolation weights of points which have already
+         * been located, e.g. by a search with its own rules to assign the
+         * points lying on partition boundaries.
+         */
+        PointEvaluationPlan::PointEvaluationPlan(
+            const std::shared_ptr<ExpList>                   &expList,
+            const Array<OneD, const int>                     &elmtIds,
+            const Array<OneD, const Array<OneD, NekDouble> > &locCoords)
+            : m_numLocated(0)
+        {
+            int npts = elmtIds.num_elements();
+            m_elmtIds = Array<OneD, int>(npts);
+            Vmath::Vcopy(npts, elmtIds.get(), 1, m_elmtIds.get(), 1);
+
+            // The local coordinates are clamped, so keep a copy.
+            m_locCoords = Array<OneD, Array<OneD, NekDouble> >(
+                locCoords.num_elements());
+            for (int d = 0; d < locCoords.num_elements(); ++d)
+            {
+                m_locCoords[d] = Array<OneD, NekDouble>(npts);
+                Vmath::Vcopy(npts, locCoords[d].get(), 1,
+                                   m_locCoords[d].get(), 1);
+            }
+
+            SetupWeights(expList);
+        }
+
+        void PointEvaluationPlan::SetupWeights(
+            const std::shared_ptr<ExpList> &expList)
+        {
+            int i, d, n;
+            int dim = m_locCoords.num_elements();
+
+            int npts     = m_elmtIds.num_elements();
+            int nWeights = 0;
+            for (i = 0; i < npts; ++i)
+            {
+                if (m_elmtIds[i] < 0)
+                {
+                    continue;
+                }
+
+                const LocalRegions::ExpansionSharedPtr &exp =
+                    expList->GetExp(m_elmtIds[i]);
+                int nd = exp->GetShapeDimension();
+                ASSERTL0(nd > 0 && nd <= dim,
+                         "Points can only be evaluated in elements of "
+                         "dimension one to three.");
+
+                nWeights += 3 - nd;
+                for (d = 0; d < nd; ++d)
+                {
+                    nWeights += exp->GetNumPoints(d);
+                }
+                ++m_numLocated;
+            }
+
+            m_points     = Array<OneD, int>      (m_numLocated);
+            m_physOffset = Array<OneD, int>      (m_numLocated);
+            m_numQuad    = Array<OneD, int>      (3 * m_numLocated, 1);
+            m_weightPtr  = Array<OneD, int>      (m_numLocated);
+            m_weights    = Array<OneD, NekDouble>(nWeights, 1.0);
+
+            Array<OneD, NekDouble> xi(dim), eta(dim);
+            int ptr = 0;
+            for (i = n = 0; i < npts; ++i)
+            {
+                int elmt = m_elmtIds[i];
+                if (elmt < 0)
+                {
+                    continue;
+                }
+
+                const LocalRegions::ExpansionSharedPtr &exp =
+                    expList->GetExp(elmt);
+                int nd = exp->GetShapeDimension();
+
+                for (d = 0; d < nd; ++d)
+                {
+                    m_locCoords[d][i] = std::max(m_locCoords[d][i], -1.0);
+                    m_locCoords[d][i] = std::min(m_locCoords[d][i],  1.0);
+                    xi[d] = m_locCoords[d][i];
+                }
+
+                if (nd == 1)
+                {
+                    eta[0] = xi[0];
+                }
+                else
+                {
+                    exp->LocCoordToLocCollapsed(xi, eta);
+                }
+
+                m_points    [n] = i;
+                m_physOffset[n] = expList->GetPhys_Offset(elmt);
+                m_weightPtr [n] = ptr;
+
+                // Directions beyond the shape dimension keep a single
+                // unit weight.
+                for (d = 0; d < 3; ++d)
+                {
+                    if (d < nd)
+                    {
+                        int nq = exp->GetNumPoints(d);
+                        DNekMatSharedPtr I = exp->GetBasis(d)->GetI(eta + d);
+                        Vmath::Vcopy(nq, &(I->GetPtr())[0], 1,
+                                         &m_weights[ptr],   1);
+                        m_numQuad[3 * n + d] = nq;
+                        ptr += nq;
+                    }
+                    else
+                    {
+                        ++ptr;
+                    }
+                }
+                ++n;
+            }
+        }
+
+        /**
+         * Value at the n-th located point of the field whose physical
+         * values are @p phys, obtained by sum factorisation of the tensor
+         * product weights.
+         */
+        inline NekDouble PointEvaluationPlan::EvaluatePoint(
+            const int        n,
+            const NekDouble *phys) const
+        {
+            const int nq0 = m_numQuad[3 * n];
+            const int nq1 = m_numQuad[3 * n + 1];
+            const int nq2 = m_numQuad[3 * n + 2];
+
+            const NekDouble *w0 = &m_weights[m_weightPtr[n]];
+            const NekDouble *w1 = w0 + nq0;
+            const NekDouble *w2 = w1 + nq1;
+            const NekDouble *u  = phys + m_physOffset[n];
+
+            NekDouble value = 0.0;
+            for (int k = 0; k < nq2; ++k)
+            {
+                NekDouble tmp = 0.0;
+                for (int j = 0; j < nq1; ++j)
+                {
+                    tmp += w1[j] * Blas::Ddot(nq0, w0, 1,
+                                              u + (k * nq1 + j) * nq0, 1);
+                }
+                value += w2[k] * tmp;
+            }
+
+            return value;
+        }
+
+        void PointEvaluationPlan::Evaluate(
+            const Array<OneD, const NekDouble> &phys,
+                  Array<OneD,       NekDouble> &out) const
+        {
+            ASSERTL1(out.num_elements() >= m_elmtIds.num_elements(),
+                     "Output array is too small.");
+
+            for (int n = 0; n < m_numLocated; ++n)
+            {
+                out[m_points[n]] = EvaluatePoint(n, &phys[0]);
+            }
+        }
+
+        /**
+         * The fields are evaluated point by point, so that the weights of
+         * each point are only loaded once for all fields.
+         */
+        void PointEvaluationPlan::Evaluate(
+            const Array<OneD, const Array<OneD, NekDouble> > &phys,
+                  Array<OneD,       Array<OneD, NekDouble> > &out) const
+        {
+            int nFields = phys.num_elements();
+            ASSERTL1(out.num_elements() >= phys.num_elements(),
+                     "Output array is too small.");
+
+            for (int n = 0; n < m_numLocated; ++n)
+            {
+                for (int f = 0; f < nFields; ++f)
+                {
+                    out[f][m_points[n]] = EvaluatePoint(n, &phys[f][0]);
+                }
+            }
+        }
+    }
+}
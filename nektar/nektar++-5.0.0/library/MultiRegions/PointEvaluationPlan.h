@@ -0,0 +1,167 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File PointEvaluationPlan.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Reusable evaluation of an expansion list at a set of points
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_MULTIREGIONS_POINTEVALUATIONPLAN_H
+#define NEKTAR_LIB_MULTIREGIONS_POINTEVALUATIONPLAN_H
+
+#include <memory>
+
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+#include <LibUtilities/BasicConst/NektarUnivConsts.hpp>
+#include <MultiRegions/MultiRegionsDeclspec.h>
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        // Forward declarations
+        class ExpList;
+        class PointEvaluationPlan;
+
+        typedef std::shared_ptr<PointEvaluationPlan>
+            PointEvaluationPlanSharedPtr;
+
+        /**
+         * @brief Evaluation of the fields of an expansion list at a fixed
+         * set of points.
+         *
+         * The points are located once with ExpList::GetExpIndices. For each
+         * point which lies in the domain, the plan stores the element
+         * containing it, its local coordinates and the Lagrange weights
+         * interpolating from the quadrature points of that element. Since
+         * the quadrature points of every element form a (collapsed) tensor
+         * product grid, the weights are stored in factorised form as one
+         * set of one-dimensional weights per direction.
+         *
+         * Evaluating a field at all the points is then a sparse
+         * matrix-vector product with its physical values, without any
+         * further search, inverse mapping or basis evaluation. The same
+         * plan may be applied to any number of fields, or time slices of a
+         * field, defined on the expansion list it was built from.
+         */
+        class PointEvaluationPlan
+        {
+        public:
+            /**
+             * @param expList           Expansion list of the fields.
+             * @param coords            Coordinates of the points, stored
+             *                          direction by direction.
+             * @param tol               Tolerance used to locate points.
+             * @param returnNearestElmt Attach points which are not found in
+             *                          any element to the nearest one.
+             */
+            MULTI_REGIONS_EXPORT PointEvaluationPlan(
+                const std::shared_ptr<ExpList>                   &expList,
+                const Array<OneD, const Array<OneD, NekDouble> > &coords,
+                const NekDouble  tol               = NekConstants::kNekZeroTol,
+                const bool       returnNearestElmt = false);
+
+            /**
+             * @param expList   Expansion list of the fields.
+             * @param elmtIds   Element containing each point, or -1.
+             * @param locCoords Local coordinates of the points in their
+             *                  element, stored direction by direction.
+             */
+            MULTI_REGIONS_EXPORT PointEvaluationPlan(
+                const std::shared_ptr<ExpList>                   &expList,
+                const Array<OneD, const int>                     &elmtIds,
+                const Array<OneD, const Array<OneD, NekDouble> > &locCoords);
+
+            /// Number of points of the plan.
+            int GetNumPoints() const
+            {
+                return m_elmtIds.num_elements();
+            }
+
+            /// Number of points which were located in an element.
+            int GetNumLocated() const
+            {
+                return m_numLocated;
+            }
+
+            /// Index of the element containing each point, or -1.
+            const Array<OneD, const int> &GetElmtIds() const
+            {
+                return m_elmtIds;
+            }
+
+            /// Local coordinates of the points, stored direction by
+            /// direction.
+            const Array<OneD, const Array<OneD, NekDouble> >
+                &GetLocCoords() const
+            {
+                return m_locCoords;
+            }
+
+            /// Evaluate a field given by its physical values at the points.
+            /// Values of points which were not located are left unchanged.
+            MULTI_REGIONS_EXPORT void Evaluate(
+                const Array<OneD, const NekDouble> &phys,
+                      Array<OneD,       NekDouble> &out) const;
+
+            /// Evaluate several fields at the points.
+            MULTI_REGIONS_EXPORT void Evaluate(
+                const Array<OneD, const Array<OneD, NekDouble> > &phys,
+                      Array<OneD,       Array<OneD, NekDouble> > &out) const;
+
+        protected:
+            /// Index of the element containing each point, or -1.
+            Array<OneD, int>                     m_elmtIds;
+            /// Local coordinates of each point.
+            Array<OneD, Array<OneD, NekDouble> > m_locCoords;
+            /// Number of points which were located.
+            int                                  m_numLocated;
+            /// Indices of the located points.
+            Array<OneD, int>                     m_points;
+            /// Offset of the element of each located point in the
+            /// physical values.
+            Array<OneD, int>                     m_physOffset;
+            /// Number of quadrature points of the element of each located
+            /// point in each of the three directions.
+            Array<OneD, int>                     m_numQuad;
+            /// Offset of the weights of each located point in #m_weights.
+            Array<OneD, int>                     m_weightPtr;
+            /// One-dimensional interpolation weights.
+            Array<OneD, NekDouble>               m_weights;
+
+            void SetupWeights(const std::shared_ptr<ExpList> &expList);
+
+            inline NekDouble EvaluatePoint(
+                const int       n,
+                const NekDouble *phys) const;
+        };
+    }
+}
+
+#endif
@@ -177,6 +177,20 @@ namespace Nektar
         {
         }
 
+        /**
+         * Returns the memory held by the preconditioner. Derived classes add
+         * the matrices they assemble.
+         */
+        size_t Preconditioner::v_GetMemoryFootprint() const
+        {
+            size_t bytes = sizeof(*this);
+            if (m_preconditioner)
+            {
+                bytes += Nektar::GetMemoryFootprint(*m_preconditioner);
+            }
+            return bytes;
+        }
+
         /**
          * \brief Get block elemental transposed transformation matrix
          * \f$\mathbf{R}^{T}\f$
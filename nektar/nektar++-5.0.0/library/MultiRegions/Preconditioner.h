@@ -105,6 +105,9 @@ namespace Nektar
 
    	    inline void InitObject();
 
+            /// Memory in bytes held by the preconditioner.
+            inline size_t GetMemoryFootprint() const;
+
             Array<OneD, NekDouble> AssembleStaticCondGlobalDiagonals();
 
              inline const DNekScalBlkMatSharedPtr&
@@ -140,6 +143,8 @@ namespace Nektar
                         int offset, int bndoffset,
                         const std::shared_ptr<DNekScalMat > &loc_mat);
 
+            virtual size_t v_GetMemoryFootprint() const;
+
 
 	private:
 
@@ -282,6 +287,14 @@ namespace Nektar
         {
 	    v_BuildPreconditioner();
         }
+
+        /**
+         *
+         */
+        inline size_t Preconditioner::GetMemoryFootprint() const
+        {
+            return v_GetMemoryFootprint();
+        }
     }
 }
 
@@ -691,6 +691,17 @@ namespace Nektar
             }
         }
 
+        /// Memory held by the preconditioner, including its block matrix.
+        size_t PreconditionerBlock::v_GetMemoryFootprint() const
+        {
+            size_t bytes = Preconditioner::v_GetMemoryFootprint();
+            if (m_blkMat)
+            {
+                bytes += Nektar::GetMemoryFootprint(*m_blkMat);
+            }
+            return bytes;
+        }
+
         /**
          * @brief Apply preconditioner to \p pInput and store the result in \p
          * pOutput.
@@ -84,6 +84,8 @@ namespace Nektar
                 const Array<OneD, NekDouble>& pInput,
                 Array<OneD, NekDouble>& pOutput);
             virtual void v_BuildPreconditioner();
+
+            virtual size_t v_GetMemoryFootprint() const;
         };
     }
 }
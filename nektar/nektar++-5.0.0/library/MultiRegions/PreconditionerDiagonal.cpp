@@ -185,6 +185,13 @@ namespace Nektar
             Vmath::Sdiv(rows, 1.0, &vOutput[nDirBnd], 1, &m_diagonals[0], 1);
         }
 
+        /// Memory held by the preconditioner, including its diagonal.
+        size_t PreconditionerDiagonal::v_GetMemoryFootprint() const
+        {
+            return Preconditioner::v_GetMemoryFootprint() +
+                m_diagonals.num_elements() * sizeof(NekDouble);
+        }
+
         /**
          *
          */
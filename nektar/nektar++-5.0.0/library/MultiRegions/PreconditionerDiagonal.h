@@ -88,6 +88,8 @@ namespace Nektar
 
             virtual void v_BuildPreconditioner();
 
+            virtual size_t v_GetMemoryFootprint() const;
+
             static std::string lookupIds[];
             static std::string def;
 	};
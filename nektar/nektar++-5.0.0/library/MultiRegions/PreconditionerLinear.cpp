@@ -162,6 +162,18 @@ namespace Nektar
             }
 	}
 
+        /// Memory held by the preconditioner, including the linear space
+        /// system.
+        size_t PreconditionerLinear::v_GetMemoryFootprint() const
+        {
+            size_t bytes = Preconditioner::v_GetMemoryFootprint();
+            if (m_vertLinsys)
+            {
+                bytes += m_vertLinsys->GetMemoryFootprint();
+            }
+            return bytes;
+        }
+
         /**
          *
          */
@@ -100,6 +100,8 @@ namespace Nektar
 		      
             virtual void v_BuildPreconditioner();
 
+            virtual size_t v_GetMemoryFootprint() const;
+
         };
     }
 }
@@ -87,6 +87,21 @@ namespace Nektar
 	}
 
 
+        /// Memory held by the linear space and high order preconditioners.
+        size_t PreconditionerLinearWithBlock::v_GetMemoryFootprint() const
+        {
+            size_t bytes = Preconditioner::v_GetMemoryFootprint();
+            if (m_linSpacePrecon)
+            {
+                bytes += m_linSpacePrecon->GetMemoryFootprint();
+            }
+            if (m_blockPrecon)
+            {
+                bytes += m_blockPrecon->GetMemoryFootprint();
+            }
+            return bytes;
+        }
+
         /**
          *
          */
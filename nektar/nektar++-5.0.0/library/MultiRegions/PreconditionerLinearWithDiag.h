@@ -85,6 +85,8 @@ namespace Nektar
 
             virtual void v_BuildPreconditioner();
 
+            virtual size_t v_GetMemoryFootprint() const;
+
         };
     }
 }
@@ -116,6 +116,21 @@ namespace Nektar
 	}
 
 
+        /// Memory held by the linear space and high order preconditioners.
+        size_t PreconditionerLinearWithLowEnergy::v_GetMemoryFootprint() const
+        {
+            size_t bytes = Preconditioner::v_GetMemoryFootprint();
+            if (m_linSpacePrecon)
+            {
+                bytes += m_linSpacePrecon->GetMemoryFootprint();
+            }
+            if (m_lowEnergyPrecon)
+            {
+                bytes += m_lowEnergyPrecon->GetMemoryFootprint();
+            }
+            return bytes;
+        }
+
         /**
          *
          */
@@ -39,6 +39,7 @@
 #include <MultiRegions/GlobalLinSys.h>
 #include <LocalRegions/MatrixKey.h>
 #include <math.h>
+#include <set>
 
 using namespace std;
 
@@ -929,6 +930,41 @@ namespace Nektar
         }
             
         
+        /**
+         * Returns the memory held by the preconditioner and the
+         * transformation matrices. Consecutive blocks of \f$ R \f$ and \f$
+         * R^{-1} \f$ may share the same matrix and are counted once.
+         */
+        size_t PreconditionerLowEnergy::v_GetMemoryFootprint() const
+        {
+            size_t bytes = Preconditioner::v_GetMemoryFootprint() +
+                m_locToGloSignMult.num_elements() * sizeof(NekDouble) +
+                m_multiplicity.num_elements() * sizeof(NekDouble) +
+                m_map.num_elements() * sizeof(int);
+
+            std::set<const DNekMat *> counted;
+            DNekBlkMatSharedPtr blkMats[3] = { m_BlkMat, m_RBlk, m_InvRBlk };
+            for (auto &blkMat : blkMats)
+            {
+                if (!blkMat)
+                {
+                    continue;
+                }
+
+                bytes += sizeof(*blkMat);
+                for (int n = 0; n < blkMat->GetNumberOfBlockRows(); ++n)
+                {
+                    DNekMatSharedPtr blk = blkMat->GetBlock(n, n);
+                    if (blk && counted.insert(blk.get()).second)
+                    {
+                        bytes += Nektar::GetMemoryFootprint(*blk);
+                    }
+                }
+            }
+
+            return bytes;
+        }
+
         /**
          * Apply the low energy preconditioner during the conjugate gradient
          * routine
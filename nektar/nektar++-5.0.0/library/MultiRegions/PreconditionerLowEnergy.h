@@ -172,6 +172,8 @@ namespace Nektar
                 Array<OneD, NekDouble>& pOutput);
             
             virtual void v_BuildPreconditioner();
+
+            virtual size_t v_GetMemoryFootprint() const;
             
             virtual DNekScalMatSharedPtr
                 v_TransformedSchurCompl(int n, int offset, 
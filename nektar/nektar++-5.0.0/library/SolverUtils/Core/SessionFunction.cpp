@@ -253,6 +253,38 @@ void SessionFunction::EvaluateExp(string pFieldName,
         pArray = Array<OneD, NekDouble>(nq);
     }
 
+    LibUtilities::EquationSharedPtr ffunc =
+        m_session->GetFunction(m_name, pFieldName, domain);
+
+    // Expressions which do not depend on time, or only through a factor
+    // f(t), are evaluated at the quadrature points once and then copied or
+    // scaled, until a parameter changes.
+    std::pair<std::string, int> key(pFieldName, domain);
+    auto sepIt = m_separable.find(key);
+    if (sepIt == m_separable.end())
+    {
+        SeparableExp sep;
+        sep.revision  = -1;
+        sep.separable = ffunc->Separate("t", sep.timeFactor, sep.spaceFactor);
+        sepIt = m_separable.insert(std::make_pair(key, sep)).first;
+    }
+    SeparableExp &sep = sepIt->second;
+
+    int revision = m_session->GetInterpreter()->GetParameterRevision();
+    if (sep.separable && sep.revision == revision)
+    {
+        if (sep.timeFactor)
+        {
+            Vmath::Smul(nq, sep.timeFactor->Evaluate(0.0, 0.0, 0.0, pTime),
+                        sep.space, 1, pArray, 1);
+        }
+        else
+        {
+            Vmath::Vcopy(nq, sep.space, 1, pArray, 1);
+        }
+        return;
+    }
+
     Array<OneD, NekDouble> x0(nq);
     Array<OneD, NekDouble> x1(nq);
     Array<OneD, NekDouble> x2(nq);
@@ -260,10 +292,18 @@ void SessionFunction::EvaluateExp(string pFieldName,
     // Get the coordinates (assuming all fields have the same
     // discretisation)
     m_field->GetCoords(x0, x1, x2);
-    LibUtilities::EquationSharedPtr ffunc =
-        m_session->GetFunction(m_name, pFieldName, domain);
 
-    ffunc->Evaluate(x0, x1, x2, pTime, pArray);
+    if (!sep.separable)
+    {
+        ffunc->Evaluate(x0, x1, x2, pTime, pArray);
+        return;
+    }
+
+    sep.space = Array<OneD, NekDouble>(nq);
+    sep.spaceFactor->Evaluate(x0, x1, x2, pTime, sep.space);
+    sep.revision = revision;
+
+    EvaluateExp(pFieldName, pArray, pTime, domain);
 }
 
 /**
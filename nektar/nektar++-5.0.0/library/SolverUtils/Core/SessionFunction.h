@@ -123,6 +123,21 @@ private:
     /// Cached result arrays
     std::map<std::pair<std::string, int>, Array<OneD, NekDouble> > m_arrays;
 
+    /// Expression of a variable & domain combination split into a factor
+    /// of time and a factor of space, the latter being kept at the
+    /// quadrature points together with the parameter revision it was
+    /// evaluated with.
+    struct SeparableExp
+    {
+        bool separable;
+        LibUtilities::EquationSharedPtr timeFactor;
+        LibUtilities::EquationSharedPtr spaceFactor;
+        Array<OneD, NekDouble> space;
+        int revision;
+    };
+    /// Separation of expressions for a variable & domain combination
+    std::map<std::pair<std::string, int>, SeparableExp> m_separable;
+
     // Evaluates a function from expression
     SOLVER_UTILS_EXPORT void EvaluateExp(std::string pFieldName,
                                          Array<OneD, NekDouble> &pArray,
@@ -68,6 +68,31 @@ FilterAverageFields::~FilterAverageFields()
 {
 }
 
+void FilterAverageFields::v_Initialise(
+    const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
+    const NekDouble &time)
+{
+    // Initialise output arrays, reading the restart file if any
+    FilterFieldConvert::v_Initialise(pFields, time);
+
+    // The average is linear, so that it is computed on the coefficients.
+    // Each field has its own accumulator, as the fields may have different
+    // numbers of coefficients.
+    m_stats.resize(m_outFields.size());
+    for (int n = 0; n < m_outFields.size(); ++n)
+    {
+        m_stats[n] = MemoryManager<LibUtilities::StreamingStatistics>
+            ::AllocateSharedPtr(m_outFields[n].num_elements(), 1, 1);
+
+        // Continue from the average of the restart file
+        if (m_numSamples)
+        {
+            Array<OneD, Array<OneD, NekDouble> > avg(1, m_outFields[n]);
+            m_stats[n]->SetStatistics(m_numSamples, avg);
+        }
+    }
+}
+
 void FilterAverageFields::v_ProcessSample(
     const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
           std::vector<Array<OneD, NekDouble> > &fieldcoeffs,
@@ -75,15 +100,10 @@ void FilterAverageFields::v_ProcessSample(
 {
     boost::ignore_unused(pFields, time);
 
-    for(int n = 0; n < m_outFields.size(); ++n)
+    for (int n = 0; n < m_stats.size(); ++n)
     {
-        Vmath::Vadd(m_outFields[n].num_elements(),
-                    fieldcoeffs[n],
-                    1,
-                    m_outFields[n],
-                    1,
-                    m_outFields[n],
-                    1);
+        Array<OneD, Array<OneD, NekDouble> > sample(1, fieldcoeffs[n]);
+        m_stats[n]->Update(sample);
     }
 }
 
@@ -95,11 +115,19 @@ void FilterAverageFields::v_PrepareOutput(
 
     m_fieldMetaData["NumberOfFieldDumps"] =
         boost::lexical_cast<std::string>(m_numSamples);
-}
 
-NekDouble FilterAverageFields::v_GetScale()
-{
-    return 1.0 / m_numSamples;
+    // Keep the initial fields if no sample has been taken
+    if (m_numSamples == 0)
+    {
+        return;
+    }
+
+    // Write the average into the storage of the output fields
+    for (int n = 0; n < m_stats.size(); ++n)
+    {
+        Array<OneD, Array<OneD, NekDouble> > avg(1, m_outFields[n]);
+        m_stats[n]->GetStatistics(avg);
+    }
 }
 
 }
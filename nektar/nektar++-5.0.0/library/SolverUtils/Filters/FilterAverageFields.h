@@ -35,6 +35,7 @@
 #ifndef NEKTAR_SOLVERUTILS_FILTERS_FILTERAVERAGEFIELDS_H
 #define NEKTAR_SOLVERUTILS_FILTERS_FILTERAVERAGEFIELDS_H
 
+#include <LibUtilities/BasicUtils/StreamingStatistics.h>
 #include <SolverUtils/Filters/FilterFieldConvert.h>
 
 namespace Nektar
@@ -67,6 +68,9 @@ public:
     SOLVER_UTILS_EXPORT virtual ~FilterAverageFields();
 
 protected:
+    virtual void v_Initialise(
+        const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
+        const NekDouble &time);
     virtual void v_ProcessSample(
         const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
               std::vector<Array<OneD, NekDouble> > &fieldcoeffs,
@@ -74,11 +78,13 @@ protected:
     virtual void v_PrepareOutput(
         const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
         const NekDouble &time);
-    virtual NekDouble v_GetScale();
     virtual std::string v_GetFileSuffix()
     {
         return "_avg";
     }
+
+    /// Mean of the coefficients of each field.
+    std::vector<LibUtilities::StreamingStatisticsSharedPtr> m_stats;
 };
 }
 }
@@ -185,6 +185,19 @@ FilterFieldConvert::FilterFieldConvert(
         }
     }
     
+    // In-situ option
+    it = pParams.find("InSitu");
+    if (it == pParams.end())
+    {
+        m_inSitu = false;
+    }
+    else
+    {
+        std::string sOption = it->second.c_str();
+        m_inSitu = (boost::iequals(sOption, "true")) ||
+                   (boost::iequals(sOption, "yes"));
+    }
+
     m_numSamples  = 0;
     m_index       = 0;
     m_outputIndex = 0;
@@ -193,6 +206,16 @@ FilterFieldConvert::FilterFieldConvert(
     // FieldConvert modules
     //
     m_f = std::shared_ptr<Field>(new Field());
+
+    // Threads used by the modules
+    it = pParams.find("Threads");
+    if (it != pParams.end())
+    {
+        LibUtilities::Equation equ(
+            m_session->GetInterpreter(), it->second);
+        m_f->m_nThreads = std::max(1, (int) round(equ.Evaluate()));
+    }
+
     std::vector<std::string> modcmds;
     // Process modules
     std::stringstream moduleStream;
@@ -418,6 +441,17 @@ void FilterFieldConvert::v_ProcessSample(
 {
     boost::ignore_unused(pFields, time);
 
+    // In the in-situ mode the modules work on the coefficients of the
+    // sample, which are shared rather than copied.
+    if (m_inSitu)
+    {
+        for(int n = 0; n < m_outFields.size(); ++n)
+        {
+            m_outFields[n] = fieldcoeffs[n];
+        }
+        return;
+    }
+
     for(int n = 0; n < m_outFields.size(); ++n)
     {
         Vmath::Vcopy(m_outFields[n].num_elements(),
@@ -628,16 +662,40 @@ void FilterFieldConvert::CreateFields(
         // if n >= pFields.num_elements() assume we have used n=0 field
         nfield = (n < pFields.num_elements())? n: 0;
         
-        m_f->m_exp[n] = m_f->AppendExpList(
-                            m_f->m_numHomogeneousDir, m_variables[0]);
-        m_f->m_exp[n]->SetWaveSpace(false);
+        if (m_inSitu && n < m_inSituExp.size())
+        {
+            m_f->m_exp[n] = m_inSituExp[n];
+        }
+        else
+        {
+            m_f->m_exp[n] = m_f->AppendExpList(
+                                m_f->m_numHomogeneousDir, m_variables[0]);
+            m_f->m_exp[n]->SetWaveSpace(false);
+
+            if (m_inSitu)
+            {
+                // The expansions are kept and share the coefficients of
+                // m_outFields when these are ordered in the same way.
+                m_inSituExp.push_back(m_f->m_exp[n]);
+                m_inSituShared.push_back(
+                    pFields[nfield]->GetExp() == m_f->m_exp[n]->GetExp());
+            }
+        }
 
         ASSERTL1(pFields[nfield]->GetNcoeffs() == m_outFields[n].num_elements(),
                  "pFields[nfield] does not have the "
                  "same number of coefficients as m_outFields[n]");
         
-        m_f->m_exp[n]->ExtractCoeffsToCoeffs(pFields[nfield], m_outFields[n],
-                                             m_f->m_exp[n]->UpdateCoeffs());
+        if (m_inSitu && m_inSituShared[n])
+        {
+            m_f->m_exp[n]->SetCoeffsArray(m_outFields[n]);
+        }
+        else
+        {
+            m_f->m_exp[n]->ExtractCoeffsToCoeffs(
+                pFields[nfield], m_outFields[n],
+                m_f->m_exp[n]->UpdateCoeffs());
+        }
 
         m_f->m_exp[n]->BwdTrans( m_f->m_exp[n]->GetCoeffs(),
                                  m_f->m_exp[n]->UpdatePhys());
@@ -682,6 +740,19 @@ void FilterFieldConvert::CheckModules(std::vector<ModuleSharedPtr> &modules)
         ASSERTL0(false, ss.str());
     }
 
+    // In the in-situ mode the fields share their coefficients with the
+    // solver, so modules modifying them in place are not valid
+    if (m_inSitu)
+    {
+        for (int i = 0; i < modules.size(); ++i)
+        {
+            ASSERTL0(!modules[i]->ModifiesInput(),
+                     "Module " + modules[i]->GetModuleName() +
+                     " modifies the fields in place and is not compatible "
+                     "with the InSitu option of FilterFieldConvert.");
+        }
+    }
+
     // Modules of type eConvertExpToPts are not compatible with eBndExtraction
     if( modulesCount[eConvertExpToPts] != 0 &&
         modulesCount[eBndExtraction]   != 0)
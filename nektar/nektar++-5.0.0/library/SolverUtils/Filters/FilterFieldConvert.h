@@ -132,6 +132,14 @@ protected:
     NekDouble    m_phaseTolerance;
     NekDouble    m_dt;
 
+    // In-situ parameters
+    bool         m_inSitu;
+    /// Expansions of the fields passed to the modules, kept between
+    /// outputs in the in-situ mode.
+    std::vector<MultiRegions::ExpListSharedPtr> m_inSituExp;
+    /// Whether each in-situ expansion shares the storage of m_outFields.
+    std::vector<bool> m_inSituShared;
+
     std::vector<ModuleSharedPtr> m_modules;
     LibUtilities::FieldMetaDataMap m_fieldMetaData;
     std::vector<Array<OneD, NekDouble> > m_outFields;
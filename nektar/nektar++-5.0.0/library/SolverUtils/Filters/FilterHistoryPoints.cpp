@@ -32,10 +32,12 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
 #include <iomanip>
 using namespace std;
 
 #include <boost/core/ignore_unused.hpp>
+#include <boost/filesystem.hpp>
 #include <boost/format.hpp>
 
 #include <LibUtilities/Memory/NekMemoryManager.hpp>
@@ -119,6 +121,34 @@ FilterHistoryPoints::FilterHistoryPoints(
         }
     }
 
+    // OutputFormat
+    it = pParams.find("OutputFormat");
+    if (it == pParams.end() || boost::iequals(it->second, "Text"))
+    {
+        m_binary = false;
+    }
+    else
+    {
+        ASSERTL0(boost::iequals(it->second, "Binary"),
+                 "Unknown OutputFormat: " + it->second);
+        m_binary = true;
+    }
+
+    // BufferSteps
+    it = pParams.find("BufferSteps");
+    if (it == pParams.end())
+    {
+        m_bufferSteps = 1;
+    }
+    else
+    {
+        LibUtilities::Equation equ(
+            m_session->GetInterpreter(), it->second);
+        int bufferSteps = round(equ.Evaluate());
+        ASSERTL0(bufferSteps > 0, "BufferSteps must be positive.");
+        m_bufferSteps = bufferSteps;
+    }
+
     // Points
     it = pParams.find("Points");
     ASSERTL0(it != pParams.end(), "Missing parameter 'Points'.");
@@ -345,6 +375,91 @@ void FilterHistoryPoints::v_Initialise(
         }
     }
 
+    // Set up the interpolation weights of the points output by this
+    // process, grouped by plane for homogeneous expansions. In that case
+    // the processes which do not hold the plane of a point skip it.
+    m_localPoints.clear();
+    m_localIndex.clear();
+    m_groups.clear();
+    m_bufferTimes.clear();
+    m_buffer.clear();
+
+    std::map<int, std::vector<int> > groupElmts;
+    std::map<int, std::vector<Array<OneD, NekDouble> > > groupCoords;
+    i = 0;
+    for (auto &x : m_historyList)
+    {
+        int point = m_historyLocalPointMap[i++];
+        int plane = m_isHomogeneous1D ? m_planeIDs[point] : 0;
+        if (plane == -1)
+        {
+            m_localIndex.push_back(-1);
+            continue;
+        }
+
+        m_localIndex.push_back(m_localPoints.size());
+        m_groups[plane].points.push_back(m_localPoints.size());
+        m_localPoints.push_back(point);
+        groupElmts[plane].push_back(x.first->GetGlobalID());
+        groupCoords[plane].push_back(x.second);
+    }
+
+    for (auto &g : m_groups)
+    {
+        int nPoints = g.second.points.size();
+        Array<OneD, int> elmtIds(nPoints);
+        Array<OneD, Array<OneD, NekDouble> > locCoords(3);
+        for (int j = 0; j < 3; ++j)
+        {
+            locCoords[j] = Array<OneD, NekDouble>(nPoints);
+            for (int n = 0; n < nPoints; ++n)
+            {
+                locCoords[j][n] = groupCoords[g.first][n][j];
+            }
+        }
+        for (int n = 0; n < nPoints; ++n)
+        {
+            elmtIds[n] = groupElmts[g.first][n];
+        }
+
+        MultiRegions::ExpListSharedPtr exp = m_isHomogeneous1D ?
+            pFields[0]->GetPlane(g.first) : pFields[0];
+        g.second.plan = MemoryManager<MultiRegions::PointEvaluationPlan>
+            ::AllocateSharedPtr(exp, elmtIds, locCoords);
+
+        g.second.elmts = groupElmts[g.first];
+        std::sort(g.second.elmts.begin(), g.second.elmts.end());
+        g.second.elmts.erase(std::unique(g.second.elmts.begin(),
+                                         g.second.elmts.end()),
+                             g.second.elmts.end());
+    }
+
+    // Send the list of the points of each process to the root, which
+    // assembles the outputs.
+    Array<OneD, int> numLocal(1, (int)m_localPoints.size());
+    Array<OneD, int> counts = vComm->Gather(0, numLocal);
+    if (vComm->GetRank() == 0)
+    {
+        m_rankPoints.resize(vComm->GetSize());
+        m_rankPoints[0] = m_localPoints;
+        int total = counts[0];
+        for (int p = 1; p < vComm->GetSize(); ++p)
+        {
+            m_rankPoints[p].resize(counts[p]);
+            if (counts[p] > 0)
+            {
+                vComm->Recv(p, m_rankPoints[p]);
+            }
+            total += counts[p];
+        }
+        ASSERTL0(total == vHP,
+                 "History points must be output by exactly one process.");
+    }
+    else if (m_localPoints.size() > 0)
+    {
+        vComm->Send(0, m_localPoints);
+    }
+
     // Collate the element ID list across processes and check each
     // history point is allocated to a process
     vComm->AllReduce(idList, LibUtilities::ReduceMax);
@@ -381,48 +496,92 @@ void FilterHistoryPoints::v_Initialise(
         bool adaptive;
         m_session->MatchSolverInfo("Driver", "Adaptive",
                                     adaptive, false);
-        if (adaptive)
-        {
-            m_outputStream.open(m_outputFile.c_str(), ofstream::app);
-        }
-        else
+        ios_base::openmode mode = ofstream::out;
+        if (m_binary)
         {
-            m_outputStream.open(m_outputFile.c_str());
+            mode |= ofstream::binary;
         }
-        m_outputStream << "# History data for variables (:";
-
-        for (i = 0; i < pFields.num_elements(); ++i)
+        if (adaptive)
         {
-            m_outputStream << m_session->GetVariable(i) <<",";
+            mode |= ofstream::app;
         }
 
-        if(m_isHomogeneous1D)
+        if (m_binary)
         {
-            m_outputStream << ") at points:" << endl;
+            namespace fs = boost::filesystem;
+            bool header = !adaptive || !fs::exists(m_outputFile) ||
+                fs::file_size(m_outputFile) == 0;
+            m_outputStream.open(m_outputFile.c_str(), mode);
+
+            // The header holds the number of points and fields, the names
+            // of the fields, whether the values are in wavespace and the
+            // coordinates of the points. Each output then consists of the
+            // time followed by the value of each field at each point.
+            if (header)
+            {
+                const char magic[8] = {'N', 'E', 'K', 'H', 'I', 'S', '0', '1'};
+                int sizes[3] = { vHP, (int)pFields.num_elements(),
+                                 m_isHomogeneous1D && m_waveSpace };
+                m_outputStream.write(magic, 8);
+                m_outputStream.write((const char *)sizes, sizeof(sizes));
+                for (i = 0; i < pFields.num_elements(); ++i)
+                {
+                    std::string var = m_session->GetVariable(i);
+                    int len = var.size();
+                    m_outputStream.write((const char *)&len, sizeof(int));
+                    m_outputStream.write(var.c_str(), len);
+                }
+                for (i = 0; i < vHP; ++i)
+                {
+                    m_historyPoints[i]->GetCoords(gloCoord[0],
+                                                  gloCoord[1],
+                                                  gloCoord[2]);
+                    m_outputStream.write((const char *)gloCoord.get(),
+                                         3 * sizeof(NekDouble));
+                }
+            }
         }
         else
         {
-            m_outputStream << ") at points:" << endl;
-        }
+            m_outputStream.open(m_outputFile.c_str(), mode);
+            m_outputStream << "# History data for variables (:";
 
-        for (i = 0; i < vHP; ++i)
-        {
-            m_historyPoints[i]->GetCoords(  gloCoord[0],
-                                            gloCoord[1],
-                                            gloCoord[2]);
+            for (i = 0; i < pFields.num_elements(); ++i)
+            {
+                m_outputStream << m_session->GetVariable(i) <<",";
+            }
 
-            m_outputStream << "# " << boost::format("%6.0f") % i;
-            m_outputStream << " " << boost::format("%25.19e") % gloCoord[0];
-            m_outputStream << " " << boost::format("%25.19e") % gloCoord[1];
-            m_outputStream << " " << boost::format("%25.19e") % gloCoord[2];
-            m_outputStream << endl;
-        }
+            if(m_isHomogeneous1D)
+            {
+                m_outputStream << ") at points:" << endl;
+            }
+            else
+            {
+                m_outputStream << ") at points:" << endl;
+            }
 
-        if(m_isHomogeneous1D)
-        {
-            if (m_waveSpace)
+            for (i = 0; i < vHP; ++i)
             {
-                m_outputStream << "# (in Wavespace)" << endl;
+                m_historyPoints[i]->GetCoords(  gloCoord[0],
+                                                gloCoord[1],
+                                                gloCoord[2]);
+
+                m_outputStream << "# " << boost::format("%6.0f") % i;
+                m_outputStream << " "
+                               << boost::format("%25.19e") % gloCoord[0];
+                m_outputStream << " "
+                               << boost::format("%25.19e") % gloCoord[1];
+                m_outputStream << " "
+                               << boost::format("%25.19e") % gloCoord[2];
+                m_outputStream << endl;
+            }
+
+            if(m_isHomogeneous1D)
+            {
+                if (m_waveSpace)
+                {
+                    m_outputStream << "# (in Wavespace)" << endl;
+                }
             }
         }
     }
@@ -441,160 +600,237 @@ void FilterHistoryPoints::v_Update(const Array<OneD, const MultiRegions::ExpList
         return;
     }
 
-    int j         = 0;
-    int k         = 0;
-    int numPoints = m_historyPoints.size();
     int numFields = pFields.num_elements();
-    LibUtilities::CommSharedPtr vComm = pFields[0]->GetComm();
-    Array<OneD, NekDouble> data(numPoints*numFields, 0.0);
-    Array<OneD, NekDouble> physvals;
-    Array<OneD, NekDouble> locCoord;
-    int expId;
+    int numLocal  = m_localPoints.size();
+
+    // Append the values of this output to the buffer
+    size_t offset = m_buffer.size();
+    m_buffer.resize(offset + numLocal * numFields, 0.0);
+    m_bufferTimes.push_back(time);
+    NekDouble *data = m_buffer.data() + offset;
 
     // Pull out data values field by field
-    for (j = 0; j < numFields; ++j)
+    for (int j = 0; j < numFields; ++j)
     {
-        if(m_isHomogeneous1D)
+        if (m_waveSpace)
         {
-            k = 0;
+            ASSERTL0( pFields[j]->GetWaveSpace() == true,
+                "HistoryPoints in wavespace require that solution is in "
+                "wavespace");
+        }
+
+        if (m_isHomogeneous1D && pFields[j]->GetWaveSpace() && !m_waveSpace)
+        {
+            int k = 0;
+            Array<OneD, NekDouble> physvals;
+            Array<OneD, NekDouble> locCoord;
             for (auto &x : m_historyList)
             {
+                if (m_localIndex[k] == -1)
+                {
+                    ++k;
+                    continue;
+                }
+
                 locCoord = x.second;
-                expId    = x.first->GetGlobalID();
-                NekDouble value = 0.0;
+                int expId = x.first->GetGlobalID();
                 const int plane = m_planeIDs[m_historyLocalPointMap[k]];
 
-                if (m_waveSpace)
-                {
-                    ASSERTL0( pFields[j]->GetWaveSpace() == true,
-                        "HistoryPoints in wavespace require that solution is in wavespace");
-                }
-                if ( pFields[j]->GetWaveSpace() == false || m_waveSpace)
+                // Create vector with eIDs across all planes
+                std::vector<unsigned int> eIDs;
+                int nPlanes = pFields[j]->GetZIDs().num_elements();
+                int elmtsPerPlane = pFields[j]->GetExpSize()/nPlanes;
+
+                for ( int n = 0; n < nPlanes; n++)
                 {
-                    if (plane != -1)
-                    {
-                        physvals = pFields[j]->GetPlane(plane)->
-                                   UpdatePhys() + pFields[j]->GetPhys_Offset(expId);
-
-                        // transform elemental data if required.
-                        if(pFields[j]->GetPhysState() == false)
-                        {
-                            pFields[j]->GetPlane(plane)->GetExp(expId)->
-                                      BwdTrans(pFields[j]->GetPlane(plane)->
-                                      GetCoeffs() + pFields[j]->
-                                      GetCoeff_Offset(expId),physvals);
-                        }
-                        // Interpolate data
-                        value = pFields[j]->GetPlane(plane)->GetExp(expId)->
-                                StdPhysEvaluate(locCoord,physvals);
-                    }
+                    eIDs.push_back(expId + n*elmtsPerPlane);
                 }
-                else
-                {
-                    // Create vector with eIDs across all planes
-                    std::vector<unsigned int> eIDs;
-                    int nPlanes = pFields[j]->GetZIDs().num_elements();
-                    int elmtsPerPlane = pFields[j]->GetExpSize()/nPlanes;
 
-                    for ( int n = 0; n < nPlanes; n++)
-                    {
-                        eIDs.push_back(expId + n*elmtsPerPlane);
-                    }
-
-                    // Create new 3DH1D expansion with one element per plane
-                    MultiRegions::ExpList3DHomogeneous1DSharedPtr tmp =
-                            std::dynamic_pointer_cast<MultiRegions::
-                            ExpList3DHomogeneous1D>(pFields[j]);
-                    ASSERTL0(tmp,"Failed to type cast expansion");
-
-                    MultiRegions::ExpList3DHomogeneous1DSharedPtr exp =
-                            MemoryManager<MultiRegions::
-                                ExpList3DHomogeneous1D>::
-                                AllocateSharedPtr(*tmp, eIDs);
-                    // Fill phys array of new expansion and apply HomoBwdTrans
-                    for ( int n = 0; n < nPlanes; n++)
+                // Create new 3DH1D expansion with one element per plane
+                MultiRegions::ExpList3DHomogeneous1DSharedPtr tmp =
+                        std::dynamic_pointer_cast<MultiRegions::
+                        ExpList3DHomogeneous1D>(pFields[j]);
+                ASSERTL0(tmp,"Failed to type cast expansion");
+
+                MultiRegions::ExpList3DHomogeneous1DSharedPtr exp =
+                        MemoryManager<MultiRegions::
+                            ExpList3DHomogeneous1D>::
+                            AllocateSharedPtr(*tmp, eIDs);
+                // Fill phys array of new expansion and apply HomoBwdTrans
+                for ( int n = 0; n < nPlanes; n++)
+                {
+                    Array<OneD, NekDouble> toPhys =
+                            exp->GetPlane(n)->UpdatePhys();
+                    if(pFields[j]->GetPhysState())
                     {
-                        Array<OneD, NekDouble> toPhys =
-                                exp->GetPlane(n)->UpdatePhys();
-                        if(pFields[j]->GetPhysState())
-                        {
-                            int nq = exp->GetPlane(0)->GetTotPoints();
-                            Array<OneD, NekDouble> fromPhys =
-                                    pFields[j]->GetPlane(n)->GetPhys() +
-                                    pFields[j]->GetPhys_Offset(expId);
-                            Vmath::Vcopy(nq, fromPhys, 1, toPhys, 1);
-                        }
-                        else
-                        {
-                            Array<OneD, NekDouble> fromCoeffs =
-                                    pFields[j]->GetPlane(n)->GetCoeffs() +
-                                    pFields[j]->GetCoeff_Offset(expId);
-                            exp->GetPlane(n)->GetExp(0)->
-                                      BwdTrans(fromCoeffs, toPhys);
-                        }
+                        int nq = exp->GetPlane(0)->GetTotPoints();
+                        Array<OneD, NekDouble> fromPhys =
+                                pFields[j]->GetPlane(n)->GetPhys() +
+                                pFields[j]->GetPhys_Offset(expId);
+                        Vmath::Vcopy(nq, fromPhys, 1, toPhys, 1);
                     }
-                    exp->HomogeneousBwdTrans(exp->GetPhys(), exp->UpdatePhys());
-                    // Interpolate data
-                    if (plane != -1)
+                    else
                     {
-                        physvals = exp->GetPlane(plane)->UpdatePhys();
-
-                        value = exp->GetPlane(plane)->GetExp(0)->
-                            StdPhysEvaluate(locCoord,physvals);
+                        Array<OneD, NekDouble> fromCoeffs =
+                                pFields[j]->GetPlane(n)->GetCoeffs() +
+                                pFields[j]->GetCoeff_Offset(expId);
+                        exp->GetPlane(n)->GetExp(0)->
+                                  BwdTrans(fromCoeffs, toPhys);
                     }
                 }
+                exp->HomogeneousBwdTrans(exp->GetPhys(), exp->UpdatePhys());
+                // Interpolate data
+                physvals = exp->GetPlane(plane)->UpdatePhys();
+                data[m_localIndex[k]*numFields+j] =
+                    exp->GetPlane(plane)->GetExp(0)->
+                        StdPhysEvaluate(locCoord,physvals);
+                ++k;
+            }
+            continue;
+        }
+
+        // Interpolate the points of each plane with their stored weights
+        for (auto &g : m_groups)
+        {
+            MultiRegions::ExpListSharedPtr exp = m_isHomogeneous1D ?
+                pFields[j]->GetPlane(g.first) : pFields[j];
 
-                // store data
-                if (plane != -1)
+            // transform elemental data if required.
+            if (pFields[j]->GetPhysState() == false)
+            {
+                for (auto &e : g.second.elmts)
                 {
-                    data[m_historyLocalPointMap[k]*numFields+j] = value;
+                    Array<OneD, NekDouble> physvals =
+                        exp->UpdatePhys() + exp->GetPhys_Offset(e);
+                    exp->GetExp(e)->BwdTrans(
+                        exp->GetCoeffs() + exp->GetCoeff_Offset(e), physvals);
                 }
+            }
 
-                ++k;
+            Array<OneD, NekDouble> values(g.second.points.size());
+            g.second.plan->Evaluate(exp->GetPhys(), values);
+            for (int n = 0; n < g.second.points.size(); ++n)
+            {
+                data[g.second.points[n]*numFields+j] = values[n];
             }
         }
-        else
+    }
+
+    if (m_bufferTimes.size() >= m_bufferSteps)
+    {
+        Flush(pFields[0]->GetComm(), numFields);
+    }
+}
+
+
+/**
+ * Send the buffered outputs of each process to the root, which assembles
+ * them and writes them in the background while the solver continues. Only
+ * the processes which own history points take part.
+ */
+void FilterHistoryPoints::Flush(
+    const LibUtilities::CommSharedPtr &comm,
+    int                                numFields)
+{
+    int numSteps = m_bufferTimes.size();
+    if (numSteps == 0)
+    {
+        return;
+    }
+
+    if (comm->GetRank() != 0)
+    {
+        if (m_localPoints.size() > 0)
         {
-            k = 0;
-            for (auto &x : m_historyList)
-            {
-                locCoord = x.second;
-                expId    = x.first->GetGlobalID();
+            comm->Send(0, m_buffer);
+        }
+        m_buffer.clear();
+        m_bufferTimes.clear();
+        return;
+    }
 
-                physvals = pFields[j]->UpdatePhys() + pFields[j]->GetPhys_Offset(expId);
+    int numPoints = m_historyPoints.size();
+    std::vector<NekDouble> data(numSteps * numPoints * numFields, 0.0);
+    std::vector<NekDouble> recv;
+    for (int p = 0; p < m_rankPoints.size(); ++p)
+    {
+        const std::vector<int> &points = m_rankPoints[p];
+        int nPoints = points.size();
+        if (nPoints == 0)
+        {
+            continue;
+        }
 
-                // transform elemental data if required.
-                if(pFields[j]->GetPhysState() == false)
-                {
-                    pFields[j]->GetExp(expId)->BwdTrans(pFields[j]->GetCoeffs() + pFields[j]->GetCoeff_Offset(expId),physvals);
-                }
+        const NekDouble *buf = m_buffer.data();
+        if (p > 0)
+        {
+            recv.resize(numSteps * nPoints * numFields);
+            comm->Recv(p, recv);
+            buf = recv.data();
+        }
 
-                // interpolate point
-                data[m_historyLocalPointMap[k]*numFields+j] = pFields[j]->GetExp(expId)->StdPhysEvaluate(locCoord,physvals);
-                ++k;
+        for (int t = 0; t < numSteps; ++t)
+        {
+            for (int n = 0; n < nPoints; ++n)
+            {
+                Vmath::Vcopy(numFields,
+                             buf + (t * nPoints + n) * numFields, 1,
+                             &data[(t * numPoints + points[n]) * numFields],
+                             1);
             }
         }
     }
+    m_buffer.clear();
+
+    // Wait for the previous outputs to be written
+    if (m_writer.valid())
+    {
+        m_writer.get();
+    }
 
-    // Exchange history data
-    // This could be improved to reduce communication but works for now
-    vComm->AllReduce(data, LibUtilities::ReduceSum);
+    std::vector<NekDouble> times;
+    times.swap(m_bufferTimes);
+    m_writer = std::async(std::launch::async, &FilterHistoryPoints::Write,
+                          this, std::move(times), std::move(data),
+                          numFields);
+}
 
-    // Only the root process writes out history data
-    if (vComm->GetRank() == 0)
+
+/**
+ * Write outputs assembled by the root, stored time by time, then point by
+ * point and field by field.
+ */
+void FilterHistoryPoints::Write(
+    const std::vector<NekDouble> &times,
+    const std::vector<NekDouble> &data,
+    int                           numFields)
+{
+    int numPoints = m_historyPoints.size();
+    for (int t = 0; t < times.size(); ++t)
     {
+        const NekDouble *values = &data[t * numPoints * numFields];
+
+        if (m_binary)
+        {
+            m_outputStream.write((const char *)&times[t], sizeof(NekDouble));
+            m_outputStream.write((const char *)values,
+                                 numPoints * numFields * sizeof(NekDouble));
+            continue;
+        }
 
         // Write data values point by point
-        for (k = 0; k < m_historyPoints.size(); ++k)
+        for (int k = 0; k < numPoints; ++k)
         {
-            m_outputStream << boost::format("%25.19e") % time;
+            m_outputStream << boost::format("%25.19e") % times[t];
             for (int j = 0; j < numFields; ++j)
             {
-                m_outputStream << " " << boost::format("%25.19e") % data[k*numFields+j];
+                m_outputStream << " " << boost::format("%25.19e")
+                                         % values[k*numFields+j];
             }
-            m_outputStream << endl;
+            m_outputStream << "\n";
         }
     }
+    m_outputStream.flush();
 }
 
 
@@ -605,8 +841,14 @@ void FilterHistoryPoints::v_Finalise(const Array<OneD, const MultiRegions::ExpLi
 {
     boost::ignore_unused(time);
 
+    Flush(pFields[0]->GetComm(), pFields.num_elements());
+
     if (pFields[0]->GetComm()->GetRank() == 0)
     {
+        if (m_writer.valid())
+        {
+            m_writer.get();
+        }
         m_outputStream.close();
     }
 }
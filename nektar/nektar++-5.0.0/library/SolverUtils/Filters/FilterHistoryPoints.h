@@ -35,6 +35,9 @@
 #ifndef NEKTAR_SOLVERUTILS_FILTERS_FILTERHISTORYPOINTS_H
 #define NEKTAR_SOLVERUTILS_FILTERS_FILTERHISTORYPOINTS_H
 
+#include <future>
+
+#include <MultiRegions/PointEvaluationPlan.h>
 #include <SolverUtils/Filters/Filter.h>
 
 namespace Nektar
@@ -79,6 +82,17 @@ class FilterHistoryPoints : public Filter
             const NekDouble &time);
         SOLVER_UTILS_EXPORT virtual bool v_IsTimeDependent();
 
+        /// History points of one plane output by this process.
+        struct PointGroup
+        {
+            /// Interpolation weights of the points.
+            MultiRegions::PointEvaluationPlanSharedPtr plan;
+            /// Index of each point of the plan in #m_localPoints.
+            std::vector<int>                           points;
+            /// Elements containing the points.
+            std::vector<int>                           elmts;
+        };
+
         SpatialDomains::PointGeomVector         m_historyPoints;
         unsigned int                            m_index;
         unsigned int                            m_outputFrequency;
@@ -93,6 +107,29 @@ class FilterHistoryPoints : public Filter
         std::list<std::pair<SpatialDomains::PointGeomSharedPtr,
                             Array<OneD, NekDouble> > > m_historyList;
         std::map<int, int >                     m_historyLocalPointMap;
+        /// Write the history data in binary rather than text format.
+        bool                                    m_binary;
+        /// Number of outputs buffered before they are written.
+        unsigned int                            m_bufferSteps;
+        /// Global index of each point output by this process.
+        std::vector<int>                        m_localPoints;
+        /// Index in #m_localPoints of each entry of #m_historyList, or -1.
+        std::vector<int>                        m_localIndex;
+        /// Points output by this process, by plane.
+        std::map<int, PointGroup>               m_groups;
+        /// Times of the buffered outputs.
+        std::vector<NekDouble>                  m_bufferTimes;
+        /// Values at the points of this process of the buffered outputs.
+        std::vector<NekDouble>                  m_buffer;
+        /// Global indices of the points output by each process, on the root.
+        std::vector<std::vector<int> >          m_rankPoints;
+        /// Write of the previous outputs, on the root.
+        std::future<void>                       m_writer;
+
+        void Flush(const LibUtilities::CommSharedPtr &comm, int numFields);
+        void Write(const std::vector<NekDouble> &times,
+                   const std::vector<NekDouble> &data,
+                   int                           numFields);
 };
 
 }
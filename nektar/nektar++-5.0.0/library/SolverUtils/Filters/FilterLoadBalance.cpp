@@ -0,0 +1,323 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File FilterLoadBalance.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Measures per-element costs for load-balanced partitioning.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <tuple>
+
+#include <boost/core/ignore_unused.hpp>
+
+#include <LibUtilities/BasicUtils/Timer.h>
+#include <SolverUtils/Filters/FilterLoadBalance.h>
+
+using namespace std;
+
+namespace Nektar
+{
+namespace SolverUtils
+{
+std::string FilterLoadBalance::className =
+        GetFilterFactory().RegisterCreatorFunction(
+                "LoadBalance", FilterLoadBalance::create);
+
+/**
+ * @class FilterLoadBalance
+ *
+ * Measures the cost of applying the core elemental operators (backward
+ * transform, inner product and physical derivative) to every element of the
+ * local partition, and writes the results as a list of `elmtid weight` pairs
+ * which can be passed back to the partitioner through the `--part-weights`
+ * command-line option. The load imbalance of the current partitioning is
+ * reported, and a warning is issued when it exceeds the given threshold.
+ *
+ * Elements sharing the same shape, number of modes and points and geometry
+ * type are assumed to have the same cost, so timings are taken once per
+ * distinct element type.
+ */
+FilterLoadBalance::FilterLoadBalance(
+    const LibUtilities::SessionReaderSharedPtr &pSession,
+    const std::weak_ptr<EquationSystem>      &pEquation,
+    const ParamMap &pParams) :
+    Filter(pSession, pEquation),
+    m_index(0)
+{
+    // OutputFile
+    auto it = pParams.find("OutputFile");
+    if (it == pParams.end())
+    {
+        m_outputFile = m_session->GetSessionName();
+    }
+    else
+    {
+        ASSERTL0(it->second.length() > 0, "Empty parameter 'OutputFile'.");
+        m_outputFile = it->second;
+    }
+    m_outputFile += ".wgt";
+
+    // OutputFrequency
+    it = pParams.find("OutputFrequency");
+    if (it == pParams.end())
+    {
+        m_outputFrequency = 0;
+    }
+    else
+    {
+        LibUtilities::Equation equ(m_session->GetInterpreter(), it->second);
+        m_outputFrequency = round(equ.Evaluate());
+    }
+
+    // NumSamples
+    it = pParams.find("NumSamples");
+    if (it == pParams.end())
+    {
+        m_numSamples = 10;
+    }
+    else
+    {
+        LibUtilities::Equation equ(m_session->GetInterpreter(), it->second);
+        m_numSamples = round(equ.Evaluate());
+        ASSERTL0(m_numSamples > 0, "Parameter 'NumSamples' must be positive.");
+    }
+
+    // Threshold
+    it = pParams.find("Threshold");
+    if (it == pParams.end())
+    {
+        m_threshold = 1.1;
+    }
+    else
+    {
+        LibUtilities::Equation equ(m_session->GetInterpreter(), it->second);
+        m_threshold = equ.Evaluate();
+    }
+}
+
+FilterLoadBalance::~FilterLoadBalance()
+{
+
+}
+
+void FilterLoadBalance::v_Initialise(
+        const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
+        const NekDouble &time)
+{
+    boost::ignore_unused(time);
+
+    m_index = 0;
+    OutputWeights(pFields);
+}
+
+void FilterLoadBalance::v_Update(
+        const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
+        const NekDouble &time)
+{
+    boost::ignore_unused(time);
+
+    if (m_outputFrequency == 0 || ++m_index % m_outputFrequency > 0)
+    {
+        return;
+    }
+
+    OutputWeights(pFields);
+}
+
+void FilterLoadBalance::v_Finalise(
+        const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
+        const NekDouble &time)
+{
+    boost::ignore_unused(pFields, time);
+}
+
+bool FilterLoadBalance::v_IsTimeDependent()
+{
+    return true;
+}
+
+/**
+ * @brief Time the elemental operators on each distinct type of element in
+ * the local partition.
+ *
+ * @param pFields   Fields of the equation system.
+ * @param elmtIds   Global IDs of the local elements.
+ * @param costs     Measured time in seconds per element, summed over all
+ *                  fields.
+ */
+void FilterLoadBalance::MeasureElementCosts(
+        const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
+        std::vector<int> &elmtIds,
+        std::vector<NekDouble> &costs)
+{
+    typedef std::tuple<int, int, int, int> ElmtKey;
+    std::map<ElmtKey, NekDouble> keyCost;
+    LibUtilities::Timer timer;
+
+    int nElmt = pFields[0]->GetExpSize();
+    elmtIds.resize(nElmt);
+    costs.assign(nElmt, 0.0);
+
+    for (int i = 0; i < nElmt; ++i)
+    {
+        elmtIds[i] = pFields[0]->GetExp(i)->GetGeom()->GetGlobalID();
+    }
+
+    for (int f = 0; f < pFields.num_elements(); ++f)
+    {
+        for (int i = 0; i < std::min(nElmt, pFields[f]->GetExpSize()); ++i)
+        {
+            LocalRegions::ExpansionSharedPtr exp = pFields[f]->GetExp(i);
+
+            ElmtKey key(exp->DetShapeType(), exp->GetNcoeffs(),
+                        exp->GetTotPoints(),
+                        exp->GetMetricInfo()->GetGtype());
+
+            auto it = keyCost.find(key);
+            if (it == keyCost.end())
+            {
+                int nq = exp->GetTotPoints();
+                Array<OneD, NekDouble> coeffs(exp->GetNcoeffs(), 1.0);
+                Array<OneD, NekDouble> phys(nq), d0(nq), d1(nq), d2(nq);
+
+                timer.Start();
+                for (int n = 0; n < m_numSamples; ++n)
+                {
+                    exp->BwdTrans(coeffs, phys);
+                    exp->PhysDeriv(phys, d0, d1, d2);
+                    exp->IProductWRTBase(phys, coeffs);
+                }
+                timer.Stop();
+
+                it = keyCost.insert(
+                    std::make_pair(key, timer.TimePerTest(m_numSamples))).first;
+            }
+
+            costs[i] += it->second;
+        }
+    }
+}
+
+/**
+ * @brief Measure element costs, report the load imbalance and write the
+ * element weights file on the root process.
+ */
+void FilterLoadBalance::OutputWeights(
+        const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields)
+{
+    LibUtilities::CommSharedPtr vComm = pFields[0]->GetComm();
+    int rank = vComm->GetRank();
+    int nProc = vComm->GetSize();
+
+    std::vector<int> elmtIds;
+    std::vector<NekDouble> costs;
+    MeasureElementCosts(pFields, elmtIds, costs);
+
+    // Compute load imbalance as ratio of maximum to mean partition cost.
+    NekDouble localCost = 0.0, minCost = std::numeric_limits<NekDouble>::max();
+    for (auto &cost : costs)
+    {
+        localCost += cost;
+        minCost = std::min(minCost, cost);
+    }
+
+    NekDouble maxCost = localCost, sumCost = localCost;
+    vComm->AllReduce(maxCost, LibUtilities::ReduceMax);
+    vComm->AllReduce(sumCost, LibUtilities::ReduceSum);
+    vComm->AllReduce(minCost, LibUtilities::ReduceMin);
+
+    NekDouble imbalance = sumCost > 0.0 ? maxCost * nProc / sumCost : 1.0;
+
+    // Weights are normalised so that the cheapest element has weight 100,
+    // which retains enough resolution to distinguish element types when
+    // truncated to integers by the partitioner.
+    std::vector<NekDouble> weights(costs.size());
+    for (int i = 0; i < costs.size(); ++i)
+    {
+        weights[i] = minCost > 0.0 ? 100.0 * costs[i] / minCost : 100.0;
+    }
+
+    if (rank > 0)
+    {
+        int nElmt = elmtIds.size();
+        vComm->Send(0, nElmt);
+        if (nElmt > 0)
+        {
+            vComm->Send(0, elmtIds);
+            vComm->Send(0, weights);
+        }
+        return;
+    }
+
+    std::ofstream out(m_outputFile.c_str());
+    ASSERTL0(out.good(), "Unable to open file " + m_outputFile);
+
+    out << "# Element weights measured on " << nProc << " processes"
+        << std::endl;
+    out << "# Load imbalance (max/mean): " << imbalance << std::endl;
+    out << "# ElmtID  Weight" << std::endl;
+
+    for (int p = 0; p < nProc; ++p)
+    {
+        if (p > 0)
+        {
+            int nElmt;
+            vComm->Recv(p, nElmt);
+            elmtIds.resize(nElmt);
+            weights.resize(nElmt);
+            if (nElmt > 0)
+            {
+                vComm->Recv(p, elmtIds);
+                vComm->Recv(p, weights);
+            }
+        }
+
+        for (int i = 0; i < elmtIds.size(); ++i)
+        {
+            out << elmtIds[i] << " " << std::setprecision(8) << weights[i]
+                << std::endl;
+        }
+    }
+
+    if (imbalance > m_threshold)
+    {
+        std::cout << "Load imbalance of " << imbalance << " exceeds threshold "
+                  << m_threshold << "; restart with --part-weights "
+                  << m_outputFile << " to repartition." << std::endl;
+    }
+    else if (m_session->DefinesCmdLineArgument("verbose"))
+    {
+        std::cout << "Load imbalance: " << imbalance << std::endl;
+    }
+}
+}
+}
@@ -108,6 +108,33 @@ FilterMovingAverage::~FilterMovingAverage()
 {
 }
 
+void FilterMovingAverage::v_Initialise(
+    const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
+    const NekDouble &time)
+{
+    // Initialise output arrays, reading the restart file if any
+    FilterFieldConvert::v_Initialise(pFields, time);
+
+    // \bar{u}_n = alpha * u_n + (1-alpha) * \bar{u}_{n-1}, the first sample
+    // being taken as initial vector. The average is linear, so that it is
+    // computed on the coefficients. Each field has its own accumulator, as
+    // the fields may have different numbers of coefficients.
+    m_stats.resize(m_outFields.size());
+    for (int n = 0; n < m_outFields.size(); ++n)
+    {
+        m_stats[n] = MemoryManager<LibUtilities::StreamingStatistics>
+            ::AllocateSharedPtr(m_outFields[n].num_elements(), 1, 1,
+                                std::vector<std::pair<int, int> >(), m_alpha);
+
+        // Continue from the average of the restart file
+        if (m_numSamples)
+        {
+            Array<OneD, Array<OneD, NekDouble> > avg(1, m_outFields[n]);
+            m_stats[n]->SetStatistics(m_numSamples, avg);
+        }
+    }
+}
+
 void FilterMovingAverage::v_ProcessSample(
     const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
           std::vector<Array<OneD, NekDouble> > &fieldcoeffs,
@@ -115,25 +142,33 @@ void FilterMovingAverage::v_ProcessSample(
 {
     boost::ignore_unused(pFields, time);
 
-    // Take first sample as initial vector
-    NekDouble alpha = m_alpha;
-    if (m_numSamples == 1)
+    for (int n = 0; n < m_stats.size(); ++n)
     {
-        alpha = 1.0;
+        Array<OneD, Array<OneD, NekDouble> > sample(1, fieldcoeffs[n]);
+        m_stats[n]->Update(sample);
     }
+}
 
-    // \bar{u}_n = alpha * u_n + (1-alpha) * \bar{u}_{n-1}
-    for (int n = 0; n < m_outFields.size(); ++n)
+void FilterMovingAverage::v_PrepareOutput(
+    const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
+    const NekDouble &time)
+{
+    boost::ignore_unused(pFields, time);
+
+    m_fieldMetaData["NumberOfFieldDumps"] =
+        boost::lexical_cast<std::string>(m_numSamples);
+
+    // Keep the initial fields if no sample has been taken
+    if (m_numSamples == 0)
+    {
+        return;
+    }
+
+    // Write the average into the storage of the output fields
+    for (int n = 0; n < m_stats.size(); ++n)
     {
-        Vmath::Svtsvtp(m_outFields[n].num_elements(),
-                       alpha,
-                       fieldcoeffs[n],
-                       1,
-                       (1.0 - alpha),
-                       m_outFields[n],
-                       1,
-                       m_outFields[n],
-                       1);
+        Array<OneD, Array<OneD, NekDouble> > avg(1, m_outFields[n]);
+        m_stats[n]->GetStatistics(avg);
     }
 }
 
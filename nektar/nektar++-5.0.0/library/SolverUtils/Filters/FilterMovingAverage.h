@@ -36,6 +36,7 @@
 #ifndef NEKTAR_SOLVERUTILS_FILTERS_FILTERMOVINGAVERAGE_H
 #define NEKTAR_SOLVERUTILS_FILTERS_FILTERMOVINGAVERAGE_H
 
+#include <LibUtilities/BasicUtils/StreamingStatistics.h>
 #include <SolverUtils/Filters/FilterFieldConvert.h>
 
 namespace Nektar
@@ -69,16 +70,24 @@ public:
     SOLVER_UTILS_EXPORT virtual ~FilterMovingAverage();
 
 protected:
+    virtual void v_Initialise(
+        const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
+        const NekDouble &time);
     virtual void v_ProcessSample(
         const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
               std::vector<Array<OneD, NekDouble> > &fieldcoeffs,
         const NekDouble &time);
+    virtual void v_PrepareOutput(
+        const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
+        const NekDouble &time);
     virtual std::string v_GetFileSuffix()
     {
         return "_movAvg";
     }
 
     NekDouble m_alpha;
+    /// Moving average of the coefficients of each field.
+    std::vector<LibUtilities::StreamingStatisticsSharedPtr> m_stats;
 };
 }
 }
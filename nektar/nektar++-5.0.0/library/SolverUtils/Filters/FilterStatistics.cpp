@@ -0,0 +1,339 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File FilterStatistics.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Streaming statistics of the solution fields during
+//              time-stepping.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include <boost/algorithm/string.hpp>
+
+#include <SolverUtils/Filters/FilterStatistics.h>
+
+namespace Nektar
+{
+namespace SolverUtils
+{
+std::string FilterStatistics::className =
+        GetFilterFactory().RegisterCreatorFunction(
+                "Statistics", FilterStatistics::create);
+
+/**
+ * @class FilterStatistics
+ *
+ * @brief Compute the mean, the central moments and the correlations of the
+ * fields in a single pass over the samples.
+ *
+ * The statistics of the physical values of each field are accumulated by
+ * LibUtilities::StreamingStatistics, which stays accurate when the
+ * fluctuations are small compared to the mean. Besides the mean of each
+ * field, the output contains its central moments up to the requested order
+ * (named e.g. @a uu, @a uuu and @a uuuu) and the covariances of the
+ * requested pairs of fields (named e.g. @a uv).
+ *
+ * The statistics are either cumulative, restarted after each output, or
+ * exponentially weighted moving averages defined by @a alpha or @a tau as
+ * in FilterMovingAverage.
+ */
+FilterStatistics::FilterStatistics(
+    const LibUtilities::SessionReaderSharedPtr &pSession,
+    const std::weak_ptr<EquationSystem>      &pEquation,
+    const ParamMap &pParams)
+    : FilterFieldConvert(pSession, pEquation, pParams),
+      m_alpha(0.0), m_resetWindow(false)
+{
+    // Load sampling frequency
+    auto it = pParams.find("SampleFrequency");
+    if (it == pParams.end())
+    {
+        m_sampleFrequency = 1;
+    }
+    else
+    {
+        LibUtilities::Equation equ(
+            m_session->GetInterpreter(), it->second);
+        m_sampleFrequency = round(equ.Evaluate());
+    }
+
+    // Load order of the moments
+    it = pParams.find("Order");
+    if (it == pParams.end())
+    {
+        m_order = 2;
+    }
+    else
+    {
+        LibUtilities::Equation equ(
+            m_session->GetInterpreter(), it->second);
+        m_order = round(equ.Evaluate());
+    }
+    ASSERTL0(m_order >= 1 && m_order <= 4,
+             "Order of the statistics must be between 1 and 4.");
+
+    // Load correlations, given as products of variables
+    it = pParams.find("Correlations");
+    if (it != pParams.end())
+    {
+        std::vector<std::string> products;
+        boost::split(products, it->second, boost::is_any_of(","));
+        for (auto &product : products)
+        {
+            std::vector<std::string> vars;
+            boost::split(vars, product, boost::is_any_of("*"));
+            ASSERTL0(vars.size() == 2,
+                     "Correlations must be given as products of two "
+                     "variables, e.g. u*v.");
+            boost::trim(vars[0]);
+            boost::trim(vars[1]);
+            m_correlations.push_back(std::make_pair(vars[0], vars[1]));
+        }
+    }
+
+    // Load type of average
+    it = pParams.find("Average");
+    if (it == pParams.end() || boost::iequals(it->second, "Cumulative"))
+    {
+        m_averageType = eCumulative;
+    }
+    else if (boost::iequals(it->second, "Window"))
+    {
+        m_averageType = eWindow;
+    }
+    else if (boost::iequals(it->second, "Exponential"))
+    {
+        m_averageType = eExponential;
+    }
+    else
+    {
+        ASSERTL0(false, "Unknown average type: " + it->second);
+    }
+
+    if (m_averageType != eExponential)
+    {
+        return;
+    }
+
+    // Load alpha parameter for moving average
+    it = pParams.find("alpha");
+    if (it == pParams.end())
+    {
+        it = pParams.find("tau");
+        if (it == pParams.end())
+        {
+            ASSERTL0(false, "Exponential average needs either alpha or tau.");
+        }
+        else
+        {
+            // Load time constant
+            LibUtilities::Equation equ(
+                m_session->GetInterpreter(), it->second);
+            NekDouble tau = equ.Evaluate();
+            // Load delta T between samples
+            NekDouble dT;
+            m_session->LoadParameter("TimeStep", dT);
+            dT = dT * m_sampleFrequency;
+            // Calculate alpha
+            m_alpha = dT / (tau + dT);
+        }
+    }
+    else
+    {
+        LibUtilities::Equation equ(
+            m_session->GetInterpreter(), it->second);
+        m_alpha = equ.Evaluate();
+        // Check if tau was also defined
+        it = pParams.find("tau");
+        if (it != pParams.end())
+        {
+            ASSERTL0(false,
+                     "Cannot define both alpha and tau in Statistics.");
+        }
+    }
+    // Check bounds of m_alpha
+    ASSERTL0(m_alpha > 0 && m_alpha < 1, "Alpha out of bounds.");
+    ASSERTL0(m_order <= 2,
+             "Exponential averages are only available up to order 2.");
+}
+
+FilterStatistics::~FilterStatistics()
+{
+}
+
+void FilterStatistics::v_Initialise(
+    const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
+    const NekDouble &time)
+{
+    // Initialise output arrays, reading the restart file if any
+    FilterFieldConvert::v_Initialise(pFields, time);
+
+    std::vector<std::pair<int, int> > pairs;
+    for (auto &corr : m_correlations)
+    {
+        auto i = std::find(m_sampleVariables.begin(),
+                           m_sampleVariables.end(), corr.first);
+        auto j = std::find(m_sampleVariables.begin(),
+                           m_sampleVariables.end(), corr.second);
+        ASSERTL0(i != m_sampleVariables.end() &&
+                 j != m_sampleVariables.end(),
+                 "Unknown variable in correlation " + corr.first + "*" +
+                 corr.second + ".");
+        pairs.push_back(std::make_pair(
+                            int(i - m_sampleVariables.begin()),
+                            int(j - m_sampleVariables.begin())));
+    }
+
+    int nq = pFields[0]->GetTotPoints();
+    m_stats = MemoryManager<LibUtilities::StreamingStatistics>
+        ::AllocateSharedPtr(nq, m_sampleVariables.size(), m_order, pairs,
+                            m_alpha);
+
+    m_sample = Array<OneD, Array<OneD, NekDouble> >(m_sampleVariables.size());
+    for (int n = 0; n < m_sample.num_elements(); ++n)
+    {
+        m_sample[n] = Array<OneD, NekDouble>(nq);
+    }
+
+    m_statFields = Array<OneD, Array<OneD, NekDouble> >(m_outFields.size());
+    for (int n = 0; n < m_statFields.num_elements(); ++n)
+    {
+        m_statFields[n] = Array<OneD, NekDouble>(nq, 0.0);
+    }
+
+    // Continue from the statistics of the restart file
+    if (m_numSamples)
+    {
+        for (int n = 0; n < m_outFields.size(); ++n)
+        {
+            pFields[0]->BwdTrans(m_outFields[n], m_statFields[n]);
+            if (pFields[0]->GetWaveSpace())
+            {
+                pFields[0]->HomogeneousBwdTrans(m_statFields[n],
+                                                m_statFields[n]);
+            }
+        }
+        m_stats->SetStatistics(m_numSamples, m_statFields);
+    }
+}
+
+void FilterStatistics::v_FillVariablesName(
+    const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields)
+{
+    // The sampled variables are those written by FilterFieldConvert
+    FilterFieldConvert::v_FillVariablesName(pFields);
+    m_sampleVariables = m_variables;
+
+    for (int k = 2; k <= m_order; ++k)
+    {
+        for (auto &var : m_sampleVariables)
+        {
+            std::string name;
+            for (int i = 0; i < k; ++i)
+            {
+                name += var;
+            }
+            m_variables.push_back(name);
+        }
+    }
+
+    for (auto &corr : m_correlations)
+    {
+        m_variables.push_back(corr.first + corr.second);
+    }
+}
+
+void FilterStatistics::v_ProcessSample(
+    const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
+          std::vector<Array<OneD, NekDouble> > &fieldcoeffs,
+    const NekDouble &time)
+{
+    // Start a new window with this sample
+    if (m_resetWindow)
+    {
+        m_stats->Reset();
+        m_numSamples = 1;
+        m_fieldMetaData["InitialTime"] =
+            boost::lexical_cast<std::string>(time);
+        m_resetWindow = false;
+    }
+
+    // The statistics are computed in physical space
+    bool waveSpace = pFields[0]->GetWaveSpace();
+    for (int n = 0; n < m_sample.num_elements(); ++n)
+    {
+        pFields[0]->BwdTrans(fieldcoeffs[n], m_sample[n]);
+        if (waveSpace)
+        {
+            pFields[0]->HomogeneousBwdTrans(m_sample[n], m_sample[n]);
+        }
+    }
+
+    m_stats->Update(m_sample);
+}
+
+void FilterStatistics::v_PrepareOutput(
+    const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
+    const NekDouble &time)
+{
+    boost::ignore_unused(time);
+
+    m_fieldMetaData["NumberOfFieldDumps"] =
+        boost::lexical_cast<std::string>(m_numSamples);
+
+    // Keep the initial fields if no sample has been taken
+    if (m_numSamples == 0)
+    {
+        return;
+    }
+
+    m_stats->GetStatistics(m_statFields);
+
+    // Set wavespace to false, as calculations were performed in physical space
+    bool waveSpace = pFields[0]->GetWaveSpace();
+    pFields[0]->SetWaveSpace(false);
+
+    for (int n = 0; n < m_outFields.size(); ++n)
+    {
+        pFields[0]->FwdTrans_IterPerExp(m_statFields[n], m_outFields[n]);
+    }
+
+    // Restore waveSpace
+    pFields[0]->SetWaveSpace(waveSpace);
+
+    // Statistics of the next window start from the next sample
+    if (m_averageType == eWindow)
+    {
+        m_resetWindow = true;
+    }
+}
+
+}
+}
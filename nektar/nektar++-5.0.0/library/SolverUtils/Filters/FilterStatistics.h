@@ -0,0 +1,114 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File FilterStatistics.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Streaming statistics of the solution fields during
+//              time-stepping.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_SOLVERUTILS_FILTERS_FILTERSTATISTICS_H
+#define NEKTAR_SOLVERUTILS_FILTERS_FILTERSTATISTICS_H
+
+#include <LibUtilities/BasicUtils/StreamingStatistics.h>
+#include <SolverUtils/Filters/FilterFieldConvert.h>
+
+namespace Nektar
+{
+namespace SolverUtils
+{
+class FilterStatistics : public FilterFieldConvert
+{
+public:
+    friend class MemoryManager<FilterStatistics>;
+
+    /// Creates an instance of this class
+    static FilterSharedPtr create(
+        const LibUtilities::SessionReaderSharedPtr &pSession,
+        const std::weak_ptr<EquationSystem>      &pEquation,
+        const std::map<std::string, std::string>   &pParams)
+    {
+        FilterSharedPtr p = MemoryManager<FilterStatistics>
+                            ::AllocateSharedPtr(pSession, pEquation, pParams);
+        return p;
+    }
+
+    ///Name of the class
+    static std::string className;
+
+    SOLVER_UTILS_EXPORT FilterStatistics(
+        const LibUtilities::SessionReaderSharedPtr &pSession,
+        const std::weak_ptr<EquationSystem>      &pEquation,
+        const ParamMap &pParams);
+    SOLVER_UTILS_EXPORT virtual ~FilterStatistics();
+
+protected:
+    enum AverageType
+    {
+        eCumulative,
+        eWindow,
+        eExponential
+    };
+
+    virtual void v_Initialise(
+        const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
+        const NekDouble &time);
+    virtual void v_FillVariablesName(
+        const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields);
+    virtual void v_ProcessSample(
+        const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
+              std::vector<Array<OneD, NekDouble> > &fieldcoeffs,
+        const NekDouble &time);
+    virtual void v_PrepareOutput(
+        const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
+        const NekDouble &time);
+    virtual std::string v_GetFileSuffix()
+    {
+        return "_stats";
+    }
+
+    AverageType  m_averageType;
+    int          m_order;
+    NekDouble    m_alpha;
+    /// Correlations requested in the session, as pairs of variable names.
+    std::vector<std::pair<std::string, std::string> > m_correlations;
+    /// Names of the sampled variables.
+    std::vector<std::string> m_sampleVariables;
+    /// Whether the window is restarted with the next sample.
+    bool         m_resetWindow;
+    LibUtilities::StreamingStatisticsSharedPtr m_stats;
+    /// Physical values of the current sample.
+    Array<OneD, Array<OneD, NekDouble> > m_sample;
+    /// Physical values of the statistics.
+    Array<OneD, Array<OneD, NekDouble> > m_statFields;
+};
+}
+}
+
+#endif /* NEKTAR_SOLVERUTILS_FILTERS_FILTERSTATISTICS_H */
@@ -34,6 +34,7 @@
 
 #include <iostream>
 #include <iomanip>
+#include <cmath>
 using namespace std;
 
 #include <boost/core/ignore_unused.hpp>
@@ -41,6 +42,7 @@ using namespace std;
 
 #include <LibUtilities/TimeIntegration/TimeIntegrationWrapper.h>
 #include <LibUtilities/BasicUtils/Timer.h>
+#include <LibUtilities/BasicUtils/NekManager.hpp>
 #include <MultiRegions/AssemblyMap/AssemblyMapDG.h>
 #include <SolverUtils/UnsteadySystem.h>
 
@@ -69,7 +71,9 @@ namespace Nektar
             const LibUtilities::SessionReaderSharedPtr& pSession,
             const SpatialDomains::MeshGraphSharedPtr& pGraph)
             : EquationSystem(pSession, pGraph),
-              m_infosteps(10)
+              m_infosteps(10),
+              m_timeStepLevelRatio(0.0),
+              m_timeStepLevelRef(0.0)
 
         {
         }
@@ -110,6 +114,8 @@ namespace Nektar
                 m_session->LoadParameter("IO_FiltersInfoSteps",
                     m_filtersInfosteps, 10.0 * m_infosteps);
                 m_session->LoadParameter("CFL", m_cflSafetyFactor, 0.0);
+                m_session->LoadParameter("TimeStepLevelRatio",
+                                         m_timeStepLevelRatio, 0.0);
 
                 // Time tolerance between filter update time and time integration
                 m_session->LoadParameter("FilterTimeWarning", m_filterTimeWarning, 1);
@@ -277,6 +283,11 @@ namespace Nektar
                 if (m_cflSafetyFactor)
                 {
                     m_timestep = GetTimeStep(fields);
+
+                    if (m_timeStepLevelRatio > 1.0)
+                    {
+                        m_timestep = QuantiseTimeStep(m_timestep);
+                    }
         
                     // Ensure that the final timestep finishes at the final
                     // time, or at a prescribed IO_CheckTime.
@@ -478,6 +489,9 @@ namespace Nektar
                 // Step advance
                 ++step;
                 ++stepCounter;
+
+                // Release cached matrices exceeding their memory budget
+                LibUtilities::EnforceNekManagerBudgets();
             }
         
             // Print out summary statistics
@@ -489,6 +503,12 @@ namespace Nektar
                          << "CFL time-step     : " << m_timestep        << endl;
                 }
 
+                if (m_cflSafetyFactor > 0.0 && m_timeStepLevelRatio > 1.0)
+                {
+                    cout << "Time-step levels  : " << m_timeStepLevelRef
+                         << " x " << m_timeStepLevelRatio << "^k" << endl;
+                }
+
                 if (m_session->GetSolverInfo("Driver") != "SteadyState")
                 {
                     cout << "Time-integration  : " << intTime  << "s"   << endl;
@@ -685,6 +705,37 @@ namespace Nektar
             return 0.0;
         }
 
+        /**
+         * @brief Round a time-step computed from the CFL condition down to
+         * the closest level \f$ \Delta t_0 r^k \f$, \f$ k \in \mathbb{Z}
+         * \f$, where \f$ r \f$ is the TimeStepLevelRatio parameter and
+         * \f$ \Delta t_0 \f$ is the first CFL time-step.
+         *
+         * Implicit operators such as the Helmholtz solves of the
+         * incompressible and advection-diffusion solvers depend on the
+         * time-step, so that every new time-step requires the assembly of new
+         * global linear systems. Restricting the time-step to a discrete set
+         * of levels means that the systems created for a level are reused
+         * whenever the time-step returns to it.
+         *
+         * @param   dt          Time-step allowed by the CFL condition.
+         * @returns Largest time-step level not exceeding @p dt.
+         */
+        NekDouble UnsteadySystem::QuantiseTimeStep(const NekDouble dt)
+        {
+            if (m_timeStepLevelRef == 0.0)
+            {
+                m_timeStepLevelRef = dt;
+                return dt;
+            }
+
+            NekDouble k = std::floor(
+                std::log(dt / m_timeStepLevelRef) /
+                std::log(m_timeStepLevelRatio) + NekConstants::kNekZeroTol);
+
+            return m_timeStepLevelRef * std::pow(m_timeStepLevelRatio, k);
+        }
+
         bool UnsteadySystem::v_PreIntegrate(int step)
         {
             boost::ignore_unused(step);
@@ -57,6 +57,9 @@ public:
     /// CFL safety factor (comprise between 0 to 1).
     NekDouble m_cflSafetyFactor;
 
+    /// Round a CFL time-step down to the closest time-step level.
+    SOLVER_UTILS_EXPORT NekDouble QuantiseTimeStep(const NekDouble dt);
+
 protected:
     /// Number of time steps between outputting status information.
     int m_infosteps;
@@ -64,6 +67,10 @@ protected:
     int m_abortSteps;
     /// Number of time steps between outputting filters information.
     int m_filtersInfosteps;
+    /// Ratio between consecutive CFL time-step levels (disabled if <= 1).
+    NekDouble m_timeStepLevelRatio;
+    /// Reference time-step level, set by the first CFL time-step.
+    NekDouble m_timeStepLevelRef;
     int m_nanSteps;
     /// Wrapper to the time integration scheme
     LibUtilities::TimeIntegrationWrapperSharedPtr m_intScheme;
@@ -95,7 +95,8 @@ namespace Nektar
             m_coordDim(coordim),
             m_valid(true),
             m_xmap(xmap),
-            m_coords(coords)
+            m_coords(coords),
+            m_metricChecked(false)
         {
             CheckIfValid();
         }
@@ -111,7 +112,9 @@ namespace Nektar
             m_coordDim(S.m_coordDim),
             m_valid(S.m_valid),
             m_xmap(S.m_xmap),
-            m_coords(S.m_coords)
+            m_coords(S.m_coords),
+            m_metricSource(S.m_metricSource),
+            m_metricChecked(S.m_metricChecked)
         {
         }
 
@@ -158,6 +161,164 @@ namespace Nektar
         }
 
 
+        /**
+         * The coordinate maps use modified (boundary-interior) bases, for
+         * which the vertex modes form a partition of unity and all other modes
+         * vanish at the vertices. A translation of the element therefore only
+         * changes the vertex coefficients, and subtracting the position of
+         * vertex 0 from them yields a representation of the mapping that is
+         * independent of the location of the element.
+         *
+         * @param   scale       On output, the largest absolute value of the
+         *                      reduced coefficients.
+         * @returns             Reduced coefficients for each coordinate, or an
+         *                      empty array if the mapping does not use
+         *                      modified bases.
+         */
+        Array<OneD, Array<OneD, NekDouble> > GeomFactors::GetReducedCoords(
+                NekDouble &scale) const
+        {
+            Array<OneD, Array<OneD, NekDouble> > reduced;
+            scale = 0.0;
+
+            for (int i = 0; i < m_expDim; ++i)
+            {
+                switch (m_xmap->GetBasisType(i))
+                {
+                    case LibUtilities::eModified_A:
+                    case LibUtilities::eModified_B:
+                    case LibUtilities::eModified_C:
+                    case LibUtilities::eModifiedPyr_C:
+                        break;
+                    default:
+                        return reduced;
+                }
+            }
+
+            const int nVerts = m_xmap->GetNverts();
+            const int vert0  = m_xmap->GetVertexMap(0);
+
+            reduced = Array<OneD, Array<OneD, NekDouble> >(m_coordDim);
+            for (int i = 0; i < m_coordDim; ++i)
+            {
+                reduced[i] = Array<OneD, NekDouble>(m_coords[i].num_elements());
+                Vmath::Vcopy(m_coords[i].num_elements(),
+                             m_coords[i], 1, reduced[i], 1);
+
+                const NekDouble origin = m_coords[i][vert0];
+                for (int j = 0; j < nVerts; ++j)
+                {
+                    reduced[i][m_xmap->GetVertexMap(j)] -= origin;
+                }
+
+                scale = std::max(scale, Vmath::Vamax(reduced[i].num_elements(),
+                                                     reduced[i], 1));
+            }
+
+            return reduced;
+        }
+
+
+        /**
+         * The hash is computed from the geometry type, shape, basis of the
+         * coordinate mapping and the coordinate coefficients relative to
+         * vertex 0, rounded to a tolerance relative to the element size.
+         * Elements with equal hashes are candidates for sharing their metric
+         * terms, which is confirmed by GeomFactors::IsMetricEqual.
+         *
+         * @returns             Translation-invariant hash of the metric, or
+         *                      zero if the metric cannot be shared.
+         */
+        size_t GeomFactors::GetMetricHash() const
+        {
+            NekDouble scale;
+            Array<OneD, Array<OneD, NekDouble> > reduced =
+                GetReducedCoords(scale);
+
+            if (reduced.num_elements() == 0 || scale == 0.0)
+            {
+                return 0;
+            }
+
+            size_t hash = 0;
+            hash_combine(hash, (int)m_type, m_expDim, m_coordDim,
+                         (int)m_xmap->DetShapeType());
+            for (int i = 0; i < m_expDim; ++i)
+            {
+                hash_combine(hash, (int)m_xmap->GetBasisType(i),
+                             m_xmap->GetBasisNumModes(i),
+                             (int)m_xmap->GetPointsType(i),
+                             m_xmap->GetNumPoints(i));
+            }
+
+            const NekDouble tol = NekConstants::kGeomFactorsTol * scale;
+            for (int i = 0; i < m_coordDim; ++i)
+            {
+                for (int j = 0; j < reduced[i].num_elements(); ++j)
+                {
+                    hash_combine(hash, std::llround(reduced[i][j] / tol));
+                }
+            }
+
+            // Never return zero for a shareable metric.
+            return hash == 0 ? 1 : hash;
+        }
+
+
+        /**
+         * @param   other       GeomFactors to compare against.
+         * @returns             True if the coordinate mappings of both elements
+         *                      coincide after translating vertex 0 of each to
+         *                      the origin.
+         */
+        bool GeomFactors::IsMetricEqual(const GeomFactors &other) const
+        {
+            if (m_type     != other.m_type     ||
+                m_expDim   != other.m_expDim   ||
+                m_coordDim != other.m_coordDim ||
+                m_xmap->DetShapeType() != other.m_xmap->DetShapeType())
+            {
+                return false;
+            }
+
+            for (int i = 0; i < m_expDim; ++i)
+            {
+                if (m_xmap->GetBasis(i)->GetBasisKey() !=
+                    other.m_xmap->GetBasis(i)->GetBasisKey())
+                {
+                    return false;
+                }
+            }
+
+            NekDouble scale, otherScale;
+            Array<OneD, Array<OneD, NekDouble> > reduced =
+                GetReducedCoords(scale);
+            Array<OneD, Array<OneD, NekDouble> > otherReduced =
+                other.GetReducedCoords(otherScale);
+
+            if (reduced.num_elements() == 0 ||
+                otherReduced.num_elements() == 0)
+            {
+                return false;
+            }
+
+            const NekDouble tol = NekConstants::kNekZeroTol *
+                std::max(scale, otherScale);
+            for (int i = 0; i < m_coordDim; ++i)
+            {
+                for (int j = 0; j < reduced[i].num_elements(); ++j)
+                {
+                    if (fabs(reduced[i][j] - otherReduced[i][j]) > tol)
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+
         /**
          * Derivatives are computed at the geometry point distributions and
          * interpolated to the target point distributions.
@@ -396,36 +557,115 @@ namespace Nektar
          */
         Array<TwoD, NekDouble> GeomFactors::ComputeDerivFactors(
                 const LibUtilities::PointsKeyVector& keyTgt) const
+        {
+            Array<TwoD, NekDouble> factors;
+            DerivFactorsWork       work;
+            ComputeDerivFactors(keyTgt, factors, work);
+            return factors;
+        }
+
+
+        /**
+         * @param   keyTgt      Target point distributions.
+         * @param   factors     Derivative factors evaluated at the target
+         *                      point distributions, reallocated if it is too
+         *                      small.
+         * @param   work        Scratch storage, reallocated if it does not
+         *                      match the point distributions.
+         */
+        void GeomFactors::ComputeDerivFactors(
+                const LibUtilities::PointsKeyVector& keyTgt,
+                      Array<TwoD, NekDouble>&        factors,
+                      DerivFactorsWork&              work) const
         {
             ASSERTL1(keyTgt.size() == m_expDim,
                      "Dimension of target point distribution does not match "
                      "expansion dimension.");
 
             int i = 0, j = 0, k = 0, l = 0;
-            int ptsTgt   = 1;
+            int nqtot_map    = 1;
+            int nqtot_tbasis = 1;
+            bool same        = true;
+            LibUtilities::PointsKeyVector map_points(m_expDim);
 
-            if (m_type == eDeformed)
+            for (i = 0; i < m_expDim; ++i)
             {
-                // Allocate storage and compute number of points
+                map_points[i]  = m_xmap->GetBasis(i)->GetPointsKey();
+                nqtot_map     *= map_points[i].GetNumPoints();
+                nqtot_tbasis  *= keyTgt[i].GetNumPoints();
+                same = same && (map_points[i] == keyTgt[i]);
+            }
+
+            int ptsTgt = m_type == eDeformed ? nqtot_tbasis : 1;
+
+            // Allocate the scratch storage if it does not fit these point
+            // distributions.
+            if (work.m_coords.num_elements() != nqtot_map ||
+                work.m_deriv.num_elements()  != m_expDim  ||
+                work.m_deriv[0].num_elements() != m_coordDim ||
+                work.m_deriv[0][0].num_elements() != nqtot_tbasis)
+            {
+                work.m_coords = Array<OneD, NekDouble>(nqtot_map);
+                work.m_dmap   = DerivStorage(m_expDim);
+                work.m_deriv  = DerivStorage(m_expDim);
                 for (i = 0; i < m_expDim; ++i)
                 {
-                    ptsTgt   *= keyTgt[i].GetNumPoints();
+                    work.m_dmap[i]  =
+                        Array<OneD, Array<OneD, NekDouble> >(m_coordDim);
+                    work.m_deriv[i] =
+                        Array<OneD, Array<OneD, NekDouble> >(m_coordDim);
+                    for (j = 0; j < m_coordDim; ++j)
+                    {
+                        work.m_dmap[i][j]  =
+                            Array<OneD, NekDouble>(nqtot_map);
+                        work.m_deriv[i][j] =
+                            Array<OneD, NekDouble>(nqtot_tbasis);
+                    }
                 }
+                work.m_g   = Array<TwoD, NekDouble>(m_expDim*m_expDim,
+                                                    nqtot_tbasis);
+                work.m_adj = Array<TwoD, NekDouble>(m_expDim*m_expDim,
+                                                    nqtot_tbasis);
+                work.m_jac = Array<OneD, NekDouble>(nqtot_tbasis);
+            }
+
+            if (factors.GetRows()    < m_expDim*m_coordDim ||
+                factors.GetColumns() < ptsTgt)
+            {
+                factors = Array<TwoD, NekDouble>(m_expDim*m_coordDim, ptsTgt);
             }
 
             // Get derivative at geometry points
-            DerivStorage deriv = ComputeDeriv(keyTgt);
+            DerivStorage &deriv = work.m_deriv;
+            for (i = 0; i < m_coordDim; ++i)
+            {
+                m_xmap->BwdTrans(m_coords[i], work.m_coords);
+                for (j = 0; j < m_expDim; ++j)
+                {
+                    m_xmap->StdPhysDeriv(j, work.m_coords, work.m_dmap[j][i]);
+                    if (same)
+                    {
+                        Vmath::Vcopy(nqtot_tbasis, work.m_dmap[j][i], 1,
+                                     deriv[j][i], 1);
+                    }
+                    else
+                    {
+                        Interp(map_points, work.m_dmap[j][i], keyTgt,
+                               deriv[j][i]);
+                    }
+                }
+            }
 
-            Array<TwoD, NekDouble> tmp (m_expDim*m_expDim, ptsTgt, 0.0);
-            Array<TwoD, NekDouble> gmat(m_expDim*m_expDim, ptsTgt, 0.0);
-            Array<OneD, NekDouble> jac (ptsTgt, 0.0);
-            Array<TwoD, NekDouble> factors(m_expDim*m_coordDim, ptsTgt, 0.0);
+            Array<TwoD, NekDouble> &tmp  = work.m_g;
+            Array<TwoD, NekDouble> &gmat = work.m_adj;
+            Array<OneD, NekDouble> &jac  = work.m_jac;
 
             // Compute g_{ij} as t_i \cdot t_j and store in tmp
             for (i = 0, l = 0; i < m_expDim; ++i)
             {
                 for (j = 0; j < m_expDim; ++j, ++l)
                 {
+                    Vmath::Zero(ptsTgt, &tmp[l][0], 1);
                     for (k = 0; k < m_coordDim; ++k)
                     {
                         Vmath::Vvtvp(ptsTgt, &deriv[i][k][0], 1,
@@ -436,10 +676,11 @@ namespace Nektar
                 }
             }
 
-            Adjoint(tmp, gmat);
+            Adjoint(tmp, gmat, ptsTgt);
 
             // Compute g = det(g_{ij}) (= Jacobian squared) and store
             // temporarily in m_jac.
+            Vmath::Zero(ptsTgt, &jac[0], 1);
             for (i = 0; i < m_expDim; ++i)
             {
                 Vmath::Vvtvp(ptsTgt, &tmp[i][0], 1, &gmat[i*m_expDim][0], 1,
@@ -451,14 +692,12 @@ namespace Nektar
                 Vmath::Vdiv(ptsTgt, &gmat[i][0], 1, &jac[0], 1, &gmat[i][0], 1);
             }
 
-            // Compute the Jacobian = sqrt(g)
-            Vmath::Vsqrt(ptsTgt, &jac[0], 1, &jac[0], 1);
-
             // Compute the derivative factors
             for (k = 0, l = 0; k < m_coordDim; ++k)
             {
                 for (j = 0; j < m_expDim; ++j, ++l)
                 {
+                    Vmath::Zero(ptsTgt, &factors[l][0], 1);
                     for (i = 0; i < m_expDim; ++i)
                     {
                         Vmath::Vvtvp(ptsTgt, &deriv[i][k][0],        1,
@@ -468,8 +707,6 @@ namespace Nektar
                     }
                 }
             }
-
-            return factors;
         }
 
         void GeomFactors::ComputeMovingFrames(
@@ -716,12 +953,27 @@ namespace Nektar
         void GeomFactors::Adjoint(
                     const Array<TwoD, const NekDouble>& src,
                     Array<TwoD, NekDouble>& tgt) const
+        {
+            Adjoint(src, tgt, src[0].num_elements());
+        }
+
+
+        /**
+         * As above, restricted to the first @p n points, so that larger
+         * storage can be reused.
+         * @param   src         Input data array.
+         * @param   tgt         Storage for adjoint matrix data.
+         * @param   n           Number of points.
+         */
+        void GeomFactors::Adjoint(
+                    const Array<TwoD, const NekDouble>& src,
+                    Array<TwoD, NekDouble>& tgt,
+                    const int n) const
         {
             ASSERTL1(src.num_elements() == tgt.num_elements(),
                      "Source matrix is of different size to destination"
                      "matrix for computing adjoint.");
 
-            int n = src[0].num_elements();
             switch (m_expDim)
             {
                 case 1:
@@ -35,6 +35,7 @@
 #ifndef NEKTAR_SPATIALDOMAINS_GEOMFACTORS_H
 #define NEKTAR_SPATIALDOMAINS_GEOMFACTORS_H
 
+#include <unordered_map>
 #include <unordered_set>
 
 #include <LibUtilities/Foundations/Basis.h>
@@ -65,10 +66,32 @@ namespace SpatialDomains
     /// An unordered set of GeomFactor pointers.
     typedef std::unordered_set< GeomFactorsSharedPtr >
                                                 GeomFactorsSet;
+    /// Registry of GeomFactors indexed by their translation-invariant
+    /// metric hash.
+    typedef std::unordered_map< size_t,
+                                std::vector<std::weak_ptr<GeomFactors> > >
+                                                GeomFactorsMetricMap;
     /// Storage type for derivative of mapping.
     typedef Array<OneD, Array<OneD, Array<OneD,NekDouble> > >
                                                 DerivStorage;
 
+    /// Scratch storage for evaluating derivative factors, which can be
+    /// reused between elements with the same point distributions.
+    struct DerivFactorsWork
+    {
+        /// Coordinates at the points of the mapping.
+        Array<OneD, NekDouble> m_coords;
+        /// Derivatives of the mapping at its own points.
+        DerivStorage           m_dmap;
+        /// Derivatives of the mapping at the target points.
+        DerivStorage           m_deriv;
+        /// Metric tensor and its adjoint.
+        Array<TwoD, NekDouble> m_g;
+        Array<TwoD, NekDouble> m_adj;
+        /// Square of the Jacobian.
+        Array<OneD, NekDouble> m_jac;
+    };
+
     /// Calculation and storage of geometric factors associated with the
     /// mapping from StdRegions reference elements to a given LocalRegions
     /// physical element in the mesh.
@@ -111,6 +134,17 @@ namespace SpatialDomains
             inline const Array<TwoD, const NekDouble> GetDerivFactors(
                     const LibUtilities::PointsKeyVector &keyTgt);
 
+            /// Return the derivative factors without caching the result.
+            inline Array<TwoD, NekDouble> GetDerivFactorsUncached(
+                    const LibUtilities::PointsKeyVector &keyTgt) const;
+
+            /// Compute the derivative factors into existing storage without
+            /// caching the result.
+            inline void GetDerivFactorsUncached(
+                    const LibUtilities::PointsKeyVector &keyTgt,
+                          Array<TwoD, NekDouble>        &factors,
+                          DerivFactorsWork              &work) const;
+
             /// Returns moving frames
             inline void GetMovingFrames(
                     const LibUtilities::PointsKeyVector &keyTgt,
@@ -130,6 +164,19 @@ namespace SpatialDomains
             /// Computes a hash of this GeomFactors element.
             inline size_t GetHash();
 
+            /// Computes a hash of the metric, invariant under translation.
+            SPATIAL_DOMAINS_EXPORT size_t GetMetricHash() const;
+
+            /// Tests if two elements have the same metric up to translation.
+            SPATIAL_DOMAINS_EXPORT bool IsMetricEqual(
+                    const GeomFactors &other) const;
+
+            /// Share the Jacobian and derivative factors of another element.
+            inline void SetMetricSource(const GeomFactorsSharedPtr &src);
+
+            /// Returns whether a shared metric has already been looked for.
+            inline bool IsMetricChecked() const;
+
     protected:
             /// Type of geometry (e.g. eRegular, eDeformed, eMovingRegular).
             GeomType m_type;
@@ -153,6 +200,11 @@ namespace SpatialDomains
             /// DerivFactors vector cache
             std::map<LibUtilities::PointsKeyVector, Array<TwoD, NekDouble> >
                                                 m_derivFactorCache;
+            /// Element with an identical metric providing the Jacobian and
+            /// derivative factors of this one.
+            GeomFactorsSharedPtr m_metricSource;
+            /// Whether a shared metric has already been looked for.
+            bool m_metricChecked;
             /// Return the Xmap;
             inline StdRegions::StdExpansionSharedPtr &GetXmap();
 
@@ -160,6 +212,10 @@ namespace SpatialDomains
             /// Tests if the element is valid and not self-intersecting.
             void CheckIfValid();
 
+            /// Return the coordinate coefficients relative to vertex 0.
+            Array<OneD, Array<OneD, NekDouble> > GetReducedCoords(
+                    NekDouble &scale) const;
+
             SPATIAL_DOMAINS_EXPORT DerivStorage ComputeDeriv(
                     const LibUtilities::PointsKeyVector &keyTgt) const;
 
@@ -176,6 +232,11 @@ namespace SpatialDomains
             SPATIAL_DOMAINS_EXPORT Array<TwoD, NekDouble> ComputeDerivFactors(
                     const LibUtilities::PointsKeyVector &keyTgt) const;
 
+            SPATIAL_DOMAINS_EXPORT void ComputeDerivFactors(
+                    const LibUtilities::PointsKeyVector &keyTgt,
+                          Array<TwoD, NekDouble>        &factors,
+                          DerivFactorsWork              &work) const;
+
             SPATIAL_DOMAINS_EXPORT void ComputeMovingFrames(
                     const LibUtilities::PointsKeyVector &keyTgt,
                     const SpatialDomains::GeomMMF MMFdir,
@@ -195,6 +256,13 @@ namespace SpatialDomains
                     const Array<TwoD, const NekDouble>& src,
                     Array<TwoD, NekDouble>& tgt) const;
 
+            /// Compute the transpose of the cofactors matrix at the first
+            /// @p n points.
+            void Adjoint(
+                    const Array<TwoD, const NekDouble>& src,
+                    Array<TwoD, NekDouble>& tgt,
+                    const int n) const;
+
             void ComputePrincipleDirection(
                     const LibUtilities::PointsKeyVector& keyTgt,
                     const SpatialDomains::GeomMMF MMFdir,
@@ -248,6 +316,11 @@ namespace SpatialDomains
     inline const Array<OneD, const NekDouble> GeomFactors::GetJac(
             const LibUtilities::PointsKeyVector &keyTgt)
     {
+        if (m_metricSource)
+        {
+            return m_metricSource->GetJac(keyTgt);
+        }
+
         auto x = m_jacCache.find(keyTgt);
 
         if (x != m_jacCache.end())
@@ -286,6 +359,11 @@ namespace SpatialDomains
     inline const Array<TwoD, const NekDouble> GeomFactors::GetDerivFactors(
             const LibUtilities::PointsKeyVector &keyTgt)
     {
+        if (m_metricSource)
+        {
+            return m_metricSource->GetDerivFactors(keyTgt);
+        }
+
         auto x = m_derivFactorCache.find(keyTgt);
 
         if (x != m_derivFactorCache.end())
@@ -299,6 +377,40 @@ namespace SpatialDomains
 
     }
     
+    /**
+     * Unlike GetDerivFactors, the result is recomputed from the coordinate
+     * mapping on every call and is not stored. This is used when metric
+     * terms are evaluated on the fly to reduce memory usage.
+     *
+     * @param   keyTgt      Target point distributions.
+     * @returns             Derivative factors evaluated at target point
+     *                      distributions.
+     * @see                 GeomFactors::ComputeDerivFactors
+     */
+    inline Array<TwoD, NekDouble> GeomFactors::GetDerivFactorsUncached(
+            const LibUtilities::PointsKeyVector &keyTgt) const
+    {
+        return ComputeDerivFactors(keyTgt);
+    }
+
+    /**
+     * The factors are written to the first columns of @p factors, one per
+     * quadrature point for deformed elements and a single one for regular
+     * elements. @p factors and @p work are only reallocated if they do not
+     * fit @p keyTgt, so that they can be reused between elements.
+     *
+     * @param   keyTgt      Target point distributions.
+     * @param   factors     Storage for the derivative factors.
+     * @param   work        Scratch storage.
+     */
+    inline void GeomFactors::GetDerivFactorsUncached(
+            const LibUtilities::PointsKeyVector &keyTgt,
+                  Array<TwoD, NekDouble>        &factors,
+                  DerivFactorsWork              &work) const
+    {
+        ComputeDerivFactors(keyTgt, factors, work);
+    }
+
     inline void GeomFactors::GetMovingFrames(const LibUtilities::PointsKeyVector &keyTgt,
                                              const SpatialDomains::GeomMMF MMFdir,
                                              const Array<OneD, const NekDouble> &CircCentre,
@@ -363,6 +475,29 @@ namespace SpatialDomains
         return hash;
     }
 
+    /**
+     * Once set, the Jacobian and derivative factors are requested from
+     * @p src, so that elements which are translated copies of each other
+     * hold a single set of metric arrays.
+     *
+     * @param   src         GeomFactors with an identical metric, or an
+     *                      empty pointer if none was found.
+     */
+    inline void GeomFactors::SetMetricSource(const GeomFactorsSharedPtr &src)
+    {
+        m_metricSource  = src;
+        m_metricChecked = true;
+    }
+
+    /**
+     * @returns             True if this object has already been compared
+     *                      against other GeomFactors for a shared metric.
+     */
+    inline bool GeomFactors::IsMetricChecked() const
+    {
+        return m_metricChecked;
+    }
+
     StdRegions::StdExpansionSharedPtr &GeomFactors::GetXmap(void)
     {
         return m_xmap;
@@ -46,7 +46,8 @@ namespace SpatialDomains
 {
 
 // static class property
-GeomFactorsVector Geometry::m_regGeomFactorsManager;
+GeomFactorsMetricMap Geometry::m_regGeomFactorsManager;
+std::mutex           Geometry::m_regGeomFactorsMutex;
 
 /**
  * @brief Default constructor.
@@ -75,48 +76,70 @@ Geometry::~Geometry()
 
 /**
  * @brief Check to see if a geometric factor has already been created that
- * contains the same regular information.
+ * contains the same metric information.
  *
- * The principle behind this is that many regular (i.e. constant Jacobian)
- * elements have identicial geometric factors. Memory may therefore be reduced
- * by storing only the unique factors.
+ * The principle behind this is that many elements, in particular on
+ * extruded and structured meshes, are translated copies of each other and so
+ * have identical geometric factors. Memory may therefore be reduced by
+ * storing only the unique factors. Candidates are found through a hash of the
+ * coordinate mapping relative to vertex 0 (see GeomFactors::GetMetricHash) so
+ * the lookup is performed only once per GeomFactors object. A match shares its
+ * Jacobian and derivative factors with @p geomFactor, which otherwise remains
+ * a distinct object since it still describes the position of the element.
+ * The registry is shared by all geometries, so the lookup is serialised.
  *
  * @param geomFactor  The GeomFactor to check.
  *
- * @return Either the cached GeomFactor or @p geomFactor.
- *
- * @todo Currently this method is disabled since the lookup is very expensive.
+ * @return @p geomFactor.
  */
 GeomFactorsSharedPtr Geometry::ValidateRegGeomFactor(
     GeomFactorsSharedPtr geomFactor)
 {
-    GeomFactorsSharedPtr returnval = geomFactor;
+    if (!geomFactor)
+    {
+        return geomFactor;
+    }
+
+    std::lock_guard<std::mutex> lock(m_regGeomFactorsMutex);
 
-/// \todo should this '#if 0' statement be removed?
-#if 0
-    bool found = false;
-    if (geomFactor->GetGtype() == eRegular)
+    if (geomFactor->IsMetricChecked())
     {
-        for (GeomFactorsVectorIter iter = m_regGeomFactorsManager.begin();
-             iter != m_regGeomFactorsManager.end();
-             ++iter)
+        return geomFactor;
+    }
+
+    GeomFactorsSharedPtr source;
+    size_t hash = geomFactor->GetMetricHash();
+
+    if (hash != 0)
+    {
+        std::vector<std::weak_ptr<GeomFactors> > &candidates =
+            m_regGeomFactorsManager[hash];
+
+        for (auto it = candidates.begin(); it != candidates.end();)
         {
-            if (**iter == *geomFactor)
+            GeomFactorsSharedPtr candidate = it->lock();
+            if (!candidate)
+            {
+                it = candidates.erase(it);
+                continue;
+            }
+
+            if (candidate->IsMetricEqual(*geomFactor))
             {
-                returnval = *iter;
-                found = true;
+                source = candidate;
                 break;
             }
+            ++it;
         }
 
-        if (!found)
+        if (!source)
         {
-            m_regGeomFactorsManager.push_back(geomFactor);
-            returnval = geomFactor;
+            candidates.push_back(geomFactor);
         }
     }
-#endif
-    return returnval;
+
+    geomFactor->SetMetricSource(source);
+    return geomFactor;
 }
 
 bool SortByGlobalId(const std::shared_ptr<Geometry> &lhs,
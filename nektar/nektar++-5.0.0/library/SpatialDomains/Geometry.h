@@ -43,6 +43,7 @@
 
 #include <unordered_map>
 #include <array>
+#include <mutex>
 
 namespace Nektar
 {
@@ -177,7 +178,10 @@ public:
 protected:
     SPATIAL_DOMAINS_EXPORT static GeomFactorsSharedPtr ValidateRegGeomFactor(
         GeomFactorsSharedPtr geomFactor);
-    static GeomFactorsVector m_regGeomFactorsManager;
+    static GeomFactorsMetricMap m_regGeomFactorsManager;
+    /// Guards m_regGeomFactorsManager and the metric state of the geometric
+    /// factors being validated.
+    static std::mutex           m_regGeomFactorsMutex;
 
     /// Coordinate dimension of this geometry object.
     int                               m_coordim;
@@ -85,16 +85,9 @@ struct MeshGraph::GeomRTree
     typedef bg::model::box<BgPoint> BgBox;
     typedef std::pair<BgBox, int> BgRtreeValue;
 
-    bg::index::rtree< BgRtreeValue, bg::index::rstar<16, 4> > m_bgTree;
+    typedef bg::index::rtree<BgRtreeValue, bg::index::rstar<16, 4>> BgRTree;
 
-    void InsertGeom(GeometrySharedPtr const &geom)
-    {
-        std::array<NekDouble, 6> minMax = geom->GetBoundingBox();
-        BgPoint ptMin(minMax[0], minMax[1], minMax[2]);
-        BgPoint ptMax(minMax[3], minMax[4], minMax[5]);
-        m_bgTree.insert(
-            std::make_pair(BgBox(ptMin, ptMax), geom->GetGlobalID()));
-    }
+    BgRTree m_bgTree;
 };
 
 MeshGraph::MeshGraph()
@@ -165,6 +158,8 @@ MeshGraphSharedPtr MeshGraph::Read(
 
 void MeshGraph::FillGraph()
 {
+    m_boundingBoxTree->m_bgTree.clear();
+
     ReadExpansions();
 
     switch (m_meshDimension)
@@ -212,80 +207,105 @@ void MeshGraph::FillGraph()
     }
 }
 
+/**
+ * @brief Construct the bounding box tree used for point location.
+ *
+ * The bounding boxes of all elements are gathered first, so that the tree is
+ * bulk-loaded in a single pass rather than built by repeated insertion.
+ */
 void MeshGraph::FillBoundingBoxTree()
 {
+    std::vector<GeomRTree::BgRtreeValue> values;
+
+    auto addGeom = [&values](GeometrySharedPtr const &geom)
+    {
+        std::array<NekDouble, 6> minMax = geom->GetBoundingBox();
+        GeomRTree::BgPoint ptMin(minMax[0], minMax[1], minMax[2]);
+        GeomRTree::BgPoint ptMax(minMax[3], minMax[4], minMax[5]);
+        values.push_back(std::make_pair(GeomRTree::BgBox(ptMin, ptMax),
+                                        geom->GetGlobalID()));
+    };
 
-    m_boundingBoxTree->m_bgTree.clear();
     switch (m_meshDimension)
     {
         case 1:
             for (auto &x : m_segGeoms)
             {
-                m_boundingBoxTree->InsertGeom(x.second);
+                addGeom(x.second);
             }
             break;
         case 2:
             for (auto &x : m_triGeoms)
             {
-                m_boundingBoxTree->InsertGeom(x.second);
+                addGeom(x.second);
             }
             for (auto &x : m_quadGeoms)
             {
-                m_boundingBoxTree->InsertGeom(x.second);
+                addGeom(x.second);
             }
             break;
         case 3:
             for (auto &x : m_tetGeoms)
             {
-                m_boundingBoxTree->InsertGeom(x.second);
+                addGeom(x.second);
             }
             for (auto &x : m_prismGeoms)
             {
-                m_boundingBoxTree->InsertGeom(x.second);
+                addGeom(x.second);
             }
             for (auto &x : m_pyrGeoms)
             {
-                m_boundingBoxTree->InsertGeom(x.second);
+                addGeom(x.second);
             }
             for (auto &x : m_hexGeoms)
             {
-                m_boundingBoxTree->InsertGeom(x.second);
+                addGeom(x.second);
             }
             break;
         default:
             ASSERTL0(false, "Unknown dim");
     }
+
+    m_boundingBoxTree->m_bgTree = GeomRTree::BgRTree(
+        values.begin(), values.end());
 }
 
 std::vector<int> MeshGraph::GetElementsContainingPoint(
     PointGeomSharedPtr p)
+{
+    NekDouble x = 0.0;
+    NekDouble y = 0.0;
+    NekDouble z = 0.0;
+
+    p->GetCoords(x, y, z);
+
+    std::vector<int> vals;
+    GetElementsContainingPoint(x, y, z, vals);
+    return vals;
+}
+
+void MeshGraph::GetElementsContainingPoint(
+    NekDouble x, NekDouble y, NekDouble z, std::vector<int> &elmts)
 {
     if (m_boundingBoxTree->m_bgTree.empty())
     {
         FillBoundingBoxTree();
     }
 
-    NekDouble x = 0.0;
-    NekDouble y = 0.0;
-    NekDouble z = 0.0;
     std::vector<GeomRTree::BgRtreeValue> matches;
 
-    p->GetCoords(x, y, z);
-
     GeomRTree::BgBox b(GeomRTree::BgPoint(x, y, z),
                        GeomRTree::BgPoint(x, y, z));
 
     m_boundingBoxTree->m_bgTree.query(bg::index::intersects(b),
                                       std::back_inserter(matches));
 
-    std::vector<int> vals(matches.size());
+    elmts.resize(matches.size());
 
     for (int i = 0; i < matches.size(); ++i)
     {
-        vals[i] = matches[i].second;
+        elmts[i] = matches[i].second;
     }
-
-    return vals;
 }
 
 void MeshGraph::SetDomainRange(NekDouble xmin, NekDouble xmax, NekDouble ymin,
@@ -195,6 +195,11 @@ public:
     SPATIAL_DOMAINS_EXPORT std::vector<int> GetElementsContainingPoint(
         PointGeomSharedPtr p);
 
+    /// Return the ids of the elements whose bounding box contains the
+    /// point (x, y, z), without constructing a PointGeom.
+    SPATIAL_DOMAINS_EXPORT void GetElementsContainingPoint(
+        NekDouble x, NekDouble y, NekDouble z, std::vector<int> &elmts);
+
     ////////////////////
     ////////////////////
 
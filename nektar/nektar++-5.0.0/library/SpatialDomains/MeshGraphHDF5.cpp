@@ -87,31 +87,6 @@ void MeshGraphHDF5::ReadGeometry(
     }
 }
 
-/**
- * @brief Utility function to split a vector equally amongst a number of
- * processors.
- *
- * @param vecsize  Size of the total amount of work
- * @param rank     Rank of this process
- * @param nprocs   Number of processors in the group
- *
- * @return A pair with the offset this process should occupy, along with the
- *         count for the amount of work.
- */
-std::pair<size_t, size_t> SplitWork(size_t vecsize, int rank, int nprocs)
-{
-    size_t div = vecsize / nprocs;
-    size_t rem = vecsize % nprocs;
-    if (rank < rem)
-    {
-        return std::make_pair(rank * (div + 1), div + 1);
-    }
-    else
-    {
-        return std::make_pair((rank - rem) * div + rem * (div + 1), div);
-    }
-}
-
 template<class T, typename std::enable_if<T::kDim == 0, int>::type = 0>
 inline int GetGeomDataDim(std::map<int, std::shared_ptr<T>> &geomMap)
 {
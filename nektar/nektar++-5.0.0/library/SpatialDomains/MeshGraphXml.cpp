@@ -34,6 +34,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <iomanip>
+#include <unordered_set>
 
 #include <SpatialDomains/MeshGraphXml.h>
 #include <SpatialDomains/MeshPartition.h>
@@ -312,21 +313,117 @@ void MeshGraphXml::PartitionMesh(
                 m_compOrder = CreateCompositeOrdering();
                 auto comp = CreateCompositeDescriptor();
 
-                // Partitioner now operates in parallel. Each process receives
-                // partitioning over interconnect and writes its own session
-                // file to the working directory.
-                MeshPartitionSharedPtr partitioner =
-                    GetMeshPartitionFactory().CreateInstance(
-                        partitionerName, session, m_meshDimension,
-                        CreateMeshEntities(), comp);
+                // Use the parallel graph partitioner if it is requested and
+                // the mesh communicator spans all processes (i.e. the
+                // communicator is not split for homogeneous directions).
+                bool parallelPart =
+                    session->DefinesCmdLineArgument("use-ptscotch");
 
-                partitioner->PartitionMesh(nParts, false);
+                if (parallelPart)
+                {
+                    ASSERTL0(
+                        GetMeshPartitionFactory().ModuleExists("PtScotch"),
+                        "--use-ptscotch requires Nektar++ to be compiled "
+                        "with NEKTAR_USE_SCOTCH and MPI.");
+
+                    if (commMesh->GetSize() != comm->GetSize())
+                    {
+                        parallelPart = false;
+                        if (isRoot)
+                        {
+                            NEKERROR(ErrorUtil::ewarning,
+                                     "PtScotch is not used for homogeneous "
+                                     "expansions; using the serial "
+                                     "partitioner instead.");
+                        }
+                    }
+                }
 
                 vector<unsigned int> parts(1), tmp;
                 parts[0] = commMesh->GetRank();
                 vector<set<unsigned int>> elIDs(1);
-                partitioner->GetElementIDs(parts[0], tmp);
-                elIDs[0].insert(tmp.begin(), tmp.end());
+                MeshPartitionSharedPtr partitioner;
+
+                if (parallelPart)
+                {
+                    // Each process contributes a contiguous block of
+                    // elements to the distributed dual graph, together with
+                    // ghost copies of the neighbouring elements. Graph
+                    // vertices are numbered by their row in the element
+                    // list, as required by the parallel partitioner.
+                    //
+                    // Only the graph partitioning is distributed: every
+                    // process has still read the whole mesh above, builds
+                    // the entities of all elements and scans all of them
+                    // for ghosts, so memory use and set-up time remain
+                    // O(N) in the total number of elements per process.
+                    std::map<int, MeshEntity> allElmts = CreateMeshEntities();
+                    std::vector<MeshEntity> elmts;
+                    elmts.reserve(allElmts.size());
+                    for (auto &elmt : allElmts)
+                    {
+                        MeshEntity e = elmt.second;
+                        e.id = elmts.size();
+                        elmts.push_back(e);
+                    }
+
+                    auto elRange = SplitWork(
+                        elmts.size(), commMesh->GetRank(), nParts);
+
+                    std::map<int, MeshEntity> partElmts;
+                    std::unordered_set<int> facetIDs;
+                    for (int el = elRange.first;
+                         el < elRange.first + elRange.second; ++el)
+                    {
+                        partElmts[el] = elmts[el];
+                        facetIDs.insert(elmts[el].list.begin(),
+                                        elmts[el].list.end());
+                    }
+
+                    for (int el = 0; el < elmts.size(); ++el)
+                    {
+                        if (partElmts.count(el))
+                        {
+                            continue;
+                        }
+
+                        for (auto &facet : elmts[el].list)
+                        {
+                            if (facetIDs.find(facet) != facetIDs.end())
+                            {
+                                partElmts[el] = elmts[el];
+                                partElmts[el].ghost = true;
+                                break;
+                            }
+                        }
+                    }
+
+                    partitioner = GetMeshPartitionFactory().CreateInstance(
+                        "PtScotch", session, m_meshDimension, partElmts, comp);
+                    partitioner->PartitionMesh(
+                        nParts, false, false, elRange.second);
+
+                    partitioner->GetElementIDs(parts[0], tmp);
+                    for (auto &row : tmp)
+                    {
+                        elIDs[0].insert(elmts[row].origId);
+                    }
+                }
+                else
+                {
+                    // Partitioner now operates in parallel. Each process
+                    // receives partitioning over interconnect and writes its
+                    // own session file to the working directory.
+                    partitioner = GetMeshPartitionFactory().CreateInstance(
+                        partitionerName, session, m_meshDimension,
+                        CreateMeshEntities(), comp);
+
+                    partitioner->PartitionMesh(nParts, false);
+
+                    partitioner->GetElementIDs(parts[0], tmp);
+                    elIDs[0].insert(tmp.begin(), tmp.end());
+                }
+
                 this->WriteXMLGeometry(session->GetSessionName(), elIDs, parts);
 
                 if (m_session->DefinesCmdLineArgument("part-info") && isRoot)
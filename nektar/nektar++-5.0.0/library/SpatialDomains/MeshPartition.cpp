@@ -42,14 +42,17 @@
 #include <SpatialDomains/MeshPartition.h>
 #include <SpatialDomains/Geometry.h>
 
+#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <map>
+#include <numeric>
 #include <vector>
 
 #include <tinyxml.h>
 
 #include <LibUtilities/BasicUtils/FileSystem.h>
+#include <LibUtilities/BasicUtils/HashUtils.hpp>
 #include <LibUtilities/BasicUtils/ParseUtils.h>
 #include <LibUtilities/BasicUtils/ShapeType.hpp>
 #include <LibUtilities/BasicUtils/FieldIO.h>
@@ -73,6 +76,46 @@ SPATIAL_DOMAINS_EXPORT MeshPartitionFactory &GetMeshPartitionFactory()
     return instance;
 }
 
+std::string MeshPartition::weightsCmdSwitch =
+    LibUtilities::SessionReader::RegisterCmdLineArgument(
+        "part-weights", "",
+        "File of measured per-element costs used to weight partitions.");
+
+std::string MeshPartition::cacheCmdSwitch =
+    LibUtilities::SessionReader::RegisterCmdLineFlag(
+        "part-cache", "",
+        "Reuse mesh partitions cached on disk by previous runs.");
+
+/**
+ * @brief Utility function to split a vector equally amongst a number of
+ * processors.
+ *
+ * @param vecsize  Size of the total amount of work
+ * @param rank     Rank of this process
+ * @param nprocs   Number of processors in the group
+ *
+ * @return A pair with the offset this process should occupy, along with the
+ *         count for the amount of work.
+ */
+std::pair<size_t, size_t> SplitWork(size_t vecsize, int rank, int nprocs)
+{
+    size_t div = vecsize / nprocs;
+    size_t rem = vecsize % nprocs;
+    if (rank < rem)
+    {
+        return std::make_pair(rank * (div + 1), div + 1);
+    }
+    else
+    {
+        return std::make_pair((rank - rem) * div + rem * (div + 1), div);
+    }
+}
+
+/// Identifier written at the start of every partition cache file.
+static const char partCacheMagic[8] = {'N', 'E', 'K', 'P', 'A', 'R', 'T', '\0'};
+/// Version of the partition cache file layout.
+static const unsigned int partCacheVersion = 1;
+
 MeshPartition::MeshPartition(const LibUtilities::SessionReaderSharedPtr session,
                              int                                        meshDim,
                              std::map<int, MeshEntity>                  element,
@@ -80,11 +123,14 @@ MeshPartition::MeshPartition(const LibUtilities::SessionReaderSharedPtr session,
     : m_session(session), m_dim(meshDim), m_numFields(0), m_elements(element),
       m_compMap(compMap), m_fieldNameToId(), m_comm(session->GetComm()),
       m_weightingRequired(false), m_weightBnd(false), m_weightDofs(false),
-      m_parallel(false)
+      m_weightCost(false), m_parallel(false), m_useCache(false)
 {
+    m_useCache = session->DefinesCmdLineArgument("part-cache");
+
     // leave the meshpartition method of reading expansions and conditions
     ReadConditions();
     ReadExpansions();
+    ReadMeasuredWeights();
 
     for (auto elIt = m_elements.cbegin(); elIt != m_elements.cend();)
     {
@@ -113,7 +159,10 @@ void MeshPartition::PartitionMesh(
              "Too few elements for this many processes.");
     m_shared = shared;
 
-    ASSERTL0(!m_parallel || shared,
+    // Each process computes its own part in parallel partitioning, so the
+    // result only needs distributing when the communicator is split.
+    ASSERTL0(!m_parallel || shared ||
+             m_comm->GetColumnComm()->GetSize() == 1,
              "Parallel partitioning requires shared filesystem.");
 
     if (m_weightingRequired)
@@ -122,7 +171,18 @@ void MeshPartition::PartitionMesh(
     }
     CreateGraph();
 
-    PartitionGraph(nParts, overlapping);
+    if (!m_useCache)
+    {
+        PartitionGraph(nParts, overlapping);
+        return;
+    }
+
+    std::size_t hash = CalculateGraphHash(nParts, overlapping);
+    if (!ReadPartitionCache(nParts, hash))
+    {
+        PartitionGraph(nParts, overlapping);
+        WritePartitionCache(nParts, hash);
+    }
 }
 
 void MeshPartition::ReadExpansions()
@@ -431,12 +491,64 @@ void MeshPartition::ReadConditions()
                 m_weightDofs        = true;
                 m_weightBnd         = true;
             }
+            else if (propertyValueUpper == "COST")
+            {
+                m_weightingRequired = true;
+                m_weightDofs        = true;
+                m_weightCost        = true;
+            }
             return;
         }
         solverInfo = solverInfo->NextSiblingElement("I");
     }
 }
 
+/**
+ * @brief Read measured per-element costs from the file given by the
+ * `--part-weights` command-line argument.
+ *
+ * The file is a plain text list of `elmtid weight` pairs, as written by the
+ * LoadBalance filter; lines starting with `#` are ignored. Any element listed
+ * in the file has its DOF weighting replaced by the measured value, so that
+ * partitions are balanced according to the actual cost observed at runtime.
+ */
+void MeshPartition::ReadMeasuredWeights()
+{
+    if (!m_session->DefinesCmdLineArgument("part-weights"))
+    {
+        return;
+    }
+
+    std::string filename =
+        m_session->GetCmdLineArgument<std::string>("part-weights");
+    std::ifstream in(filename.c_str());
+    ASSERTL0(in.is_open(), "Unable to open partition weights file " +
+             filename);
+
+    std::string line;
+    while (std::getline(in, line))
+    {
+        boost::trim(line);
+        if (line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+
+        std::istringstream ss(line);
+        int elmtId;
+        NekDouble weight;
+        ss >> elmtId >> weight;
+        ASSERTL0(!ss.fail(), "Unable to parse line '" + line +
+                 "' of partition weights file " + filename);
+
+        m_measuredWeights[elmtId] =
+            std::max(1u, static_cast<unsigned int>(std::round(weight)));
+    }
+
+    m_weightingRequired = true;
+    m_weightDofs        = true;
+}
+
 /*
  * Calculate element weights based on
  *   - element type (Q,T,H,P,R,A)
@@ -448,6 +560,10 @@ void MeshPartition::ReadConditions()
  * with all work which scales linearly with the number of its
  * coefficients: communication, vector updates etc.
  *
+ * If COST weighting is requested, the first weighting instead follows the
+ * operation count of sum-factorised operators on the element. Measured
+ * weights read through ReadMeasuredWeights take precedence over both.
+ *
  * \todo Refactor this code to explicitly represent performance model
  * and flexibly generate graph vertex weights depending on perf data.
  */
@@ -497,7 +613,8 @@ void MeshPartition::WeightElements()
                 continue;
             }
 
-            m_vertWeights[elid][m_fieldNameToId[it->first]] =
+            m_vertWeights[elid][m_fieldNameToId[it->first]] = m_weightCost ?
+                CalculateElementCost(m_shape[elid], na, nb, nc) :
                 CalculateElementWeight(m_shape[elid], false, na, nb, nc);
             m_vertBndWeights[elid][m_fieldNameToId[it->first]] =
                 CalculateElementWeight(m_shape[elid], true, na, nb, nc);
@@ -505,6 +622,16 @@ void MeshPartition::WeightElements()
                 CalculateEdgeWeight(m_shape[elid], na, nb, nc);
         }
     } // for i
+
+    for (auto &measured : m_measuredWeights)
+    {
+        auto wIt = m_vertWeights.find(measured.first);
+        if (wIt != m_vertWeights.end())
+        {
+            std::fill(wIt->second.begin(), wIt->second.end(),
+                      measured.second);
+        }
+    }
 }
 
 void MeshPartition::CreateGraph()
@@ -814,6 +941,261 @@ void MeshPartition::PartitionGraph(int nParts, bool overlapping)
     }
 }
 
+/**
+ * @brief Compute a hash of everything which determines the outcome of
+ * PartitionGraph.
+ *
+ * This covers the partitioner, the element IDs and their facets (i.e. the
+ * dual graph), the vertex and edge weights (which encode the expansion orders
+ * when weighting is enabled), the number of partitions and the communicator
+ * layout. In
+ * parallel the hash is local to this process' portion of the graph.
+ */
+std::size_t MeshPartition::CalculateGraphHash(int nParts, bool overlapping)
+{
+    std::size_t hash = 0;
+    hash_combine(hash, GetPartitionerName(), nParts, overlapping, m_parallel,
+                 m_weightingRequired, m_weightDofs, m_weightBnd,
+                 m_comm->GetSize());
+
+    if (m_parallel)
+    {
+        hash_combine(hash, m_comm->GetRank());
+    }
+
+    BoostVertexIterator vertit, vertit_end;
+    BoostAdjacencyIterator adjvertit, adjvertit_end;
+    for (boost::tie(vertit, vertit_end) = boost::vertices(m_graph);
+         vertit != vertit_end; ++vertit)
+    {
+        const GraphVertexProperties &vert = m_graph[*vertit];
+        hash_combine(hash, vert.id, vert.partition);
+        hash_range(hash, vert.weight.begin(), vert.weight.end());
+        hash_range(hash, vert.bndWeight.begin(), vert.bndWeight.end());
+        hash_range(hash, vert.edgeWeight.begin(), vert.edgeWeight.end());
+
+        for (boost::tie(adjvertit, adjvertit_end) =
+                 boost::adjacent_vertices(*vertit, m_graph);
+             adjvertit != adjvertit_end; ++adjvertit)
+        {
+            hash_combine(hash, m_graph[*adjvertit].id);
+        }
+    }
+
+    for (auto &elmt : m_elements)
+    {
+        hash_combine(hash, elmt.first, elmt.second.origId);
+        hash_range(hash, elmt.second.list.begin(), elmt.second.list.end());
+    }
+
+    return hash;
+}
+
+/**
+ * @brief Return the name of the partition cache file for @p nParts
+ * partitions.
+ *
+ * Files are stored in a directory named after the session, with one file
+ * per process when partitioning is performed in parallel.
+ */
+std::string MeshPartition::GetPartitionCacheFile(int nParts)
+{
+    fs::path dirname(m_session->GetSessionName() + "_partcache");
+    boost::format pad("N%1$07d.bin");
+    pad % nParts;
+
+    if (m_parallel)
+    {
+        pad = boost::format("N%1$07d_P%2$07d.bin");
+        pad % nParts % m_comm->GetRank();
+    }
+
+    return LibUtilities::PortablePath(dirname / fs::path(pad.str()));
+}
+
+/**
+ * @brief Attempt to populate #m_localPartition from the partition cache.
+ *
+ * The cache is only used if the file exists and its stored hash matches @p
+ * hash. In serial partitioning without a shared filesystem, only the root
+ * process holds the cache file, so it reads and validates it and then
+ * broadcasts the partition to the other processes. In parallel partitioning
+ * each process reads its own file and they agree collectively on whether
+ * the cache is used, so that either all of them skip PartitionGraph or none
+ * of them do.
+ *
+ * @return True if the partition was loaded from the cache.
+ */
+bool MeshPartition::ReadPartitionCache(int nParts, std::size_t hash)
+{
+    std::vector<std::vector<unsigned int>> partition;
+    std::string filename = GetPartitionCacheFile(nParts);
+    bool bcast = !m_shared && !m_parallel;
+    int valid = 0;
+
+    std::ifstream in;
+    if (!bcast || m_comm->GetRank() == 0)
+    {
+        in.open(filename.c_str(), std::ios::in | std::ios::binary);
+    }
+
+    if (in.is_open())
+    {
+        char magic[8];
+        unsigned int version, nStored;
+        NekUInt64 storedHash;
+
+        in.read(magic, sizeof(magic));
+        in.read(reinterpret_cast<char *>(&version), sizeof(version));
+        in.read(reinterpret_cast<char *>(&storedHash), sizeof(storedHash));
+        in.read(reinterpret_cast<char *>(&nStored), sizeof(nStored));
+
+        valid = in.good() &&
+            std::equal(magic, magic + 8, partCacheMagic) &&
+            version == partCacheVersion &&
+            storedHash == static_cast<NekUInt64>(hash) &&
+            nStored == nParts;
+
+        if (valid)
+        {
+            partition.resize(nParts);
+            for (int i = 0; i < nParts && in.good(); ++i)
+            {
+                unsigned int nElmt;
+                in.read(reinterpret_cast<char *>(&nElmt), sizeof(nElmt));
+                if (!in.good())
+                {
+                    break;
+                }
+                partition[i].resize(nElmt);
+                if (nElmt > 0)
+                {
+                    in.read(reinterpret_cast<char *>(&partition[i][0]),
+                            nElmt * sizeof(unsigned int));
+                }
+            }
+            valid = in.good();
+        }
+    }
+
+    if (bcast)
+    {
+        m_comm->Bcast(valid, 0);
+
+        if (valid)
+        {
+            // Broadcast the number of elements of each partition, then the
+            // concatenated element IDs.
+            std::vector<unsigned int> sizes(nParts), elmtIds;
+            if (m_comm->GetRank() == 0)
+            {
+                for (int i = 0; i < nParts; ++i)
+                {
+                    sizes[i] = partition[i].size();
+                    elmtIds.insert(elmtIds.end(), partition[i].begin(),
+                                   partition[i].end());
+                }
+            }
+            m_comm->Bcast(sizes, 0);
+
+            elmtIds.resize(std::accumulate(sizes.begin(), sizes.end(), 0u));
+            if (elmtIds.size() > 0)
+            {
+                m_comm->Bcast(elmtIds, 0);
+            }
+
+            partition.resize(nParts);
+            auto elmtIt = elmtIds.begin();
+            for (int i = 0; i < nParts; ++i)
+            {
+                partition[i].assign(elmtIt, elmtIt + sizes[i]);
+                elmtIt += sizes[i];
+            }
+        }
+    }
+    else if (m_parallel)
+    {
+        m_comm->AllReduce(valid, LibUtilities::ReduceMin);
+    }
+
+    if (!valid)
+    {
+        return false;
+    }
+
+    m_localPartition = partition;
+
+    if (m_comm->TreatAsRankZero() &&
+        m_session->DefinesCmdLineArgument("verbose"))
+    {
+        std::cout << "Using cached mesh partition: " << filename << std::endl;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Write #m_localPartition to the partition cache.
+ *
+ * In serial partitioning every process holds the complete partition, so
+ * only the root process writes the file. In parallel, each process writes
+ * the element IDs of its own partition.
+ */
+void MeshPartition::WritePartitionCache(int nParts, std::size_t hash)
+{
+    if (!m_parallel && !m_comm->TreatAsRankZero())
+    {
+        return;
+    }
+
+    std::string filename = GetPartitionCacheFile(nParts);
+    fs::path dirname = fs::path(filename).parent_path();
+
+    try
+    {
+        if (!fs::is_directory(dirname))
+        {
+            fs::create_directories(dirname);
+        }
+    }
+    catch (fs::filesystem_error &e)
+    {
+        NEKERROR(ErrorUtil::ewarning,
+                 "Unable to create partition cache directory: " +
+                 std::string(e.what()));
+        return;
+    }
+
+    std::ofstream out(filename.c_str(), std::ios::out | std::ios::binary);
+    if (!out.is_open())
+    {
+        NEKERROR(ErrorUtil::ewarning,
+                 "Unable to write partition cache file " + filename);
+        return;
+    }
+
+    NekUInt64 storedHash = static_cast<NekUInt64>(hash);
+    unsigned int nStored = nParts;
+
+    out.write(partCacheMagic, sizeof(partCacheMagic));
+    out.write(reinterpret_cast<const char *>(&partCacheVersion),
+              sizeof(partCacheVersion));
+    out.write(reinterpret_cast<const char *>(&storedHash),
+              sizeof(storedHash));
+    out.write(reinterpret_cast<const char *>(&nStored), sizeof(nStored));
+
+    for (int i = 0; i < nParts; ++i)
+    {
+        unsigned int nElmt = m_localPartition[i].size();
+        out.write(reinterpret_cast<const char *>(&nElmt), sizeof(nElmt));
+        if (nElmt > 0)
+        {
+            out.write(reinterpret_cast<const char *>(&m_localPartition[i][0]),
+                      nElmt * sizeof(unsigned int));
+        }
+    }
+}
+
 void MeshPartition::CheckPartitions(int nParts, Array<OneD, int> &pPart)
 {
     unsigned int i   = 0;
@@ -925,6 +1307,57 @@ int MeshPartition::CalculateElementWeight(LibUtilities::ShapeType elmtType,
     return weight;
 }
 
+/**
+ * @brief Estimate the cost of applying an operator to an element.
+ *
+ * Sum-factorised operators on an element require, for each of the
+ * quadrature points, a contraction over the modes in every direction. The
+ * cost is therefore modelled as the number of quadrature points (taken as
+ * one more than the number of modes in each direction) multiplied by the
+ * sum of the directional mode counts. Simplex elements use collapsed
+ * coordinates and so have approximately the same cost as their tensor
+ * product counterparts, scaled by their relative number of coefficients.
+ */
+int MeshPartition::CalculateElementCost(LibUtilities::ShapeType elmtType,
+                                        int na, int nb, int nc)
+{
+    int nq = 0;
+    int ns = 0;
+
+    switch (elmtType)
+    {
+        case LibUtilities::eTetrahedron:
+        case LibUtilities::ePrism:
+        case LibUtilities::eHexahedron:
+        case LibUtilities::ePyramid:
+            nq = (na + 1) * (nb + 1) * (nc + 1);
+            ns = na + nb + nc;
+            break;
+        case LibUtilities::eQuadrilateral:
+        case LibUtilities::eTriangle:
+            nq = (na + 1) * (nb + 1);
+            ns = na + nb;
+            break;
+        case LibUtilities::eSegment:
+            nq = na + 1;
+            ns = na;
+            break;
+        case LibUtilities::ePoint:
+            return 1;
+        default:
+            break;
+    }
+
+    // Scale by the ratio of simplex to tensor-product coefficient counts.
+    int nTensor = CalculateElementWeight(
+        m_dim == 3 ? LibUtilities::eHexahedron :
+        m_dim == 2 ? LibUtilities::eQuadrilateral :
+                     LibUtilities::eSegment, false, na, nb, nc);
+    int nElmt   = CalculateElementWeight(elmtType, false, na, nb, nc);
+
+    return std::max(1, nq * ns * nElmt / std::max(1, nTensor));
+}
+
 /**
  *     Calculate the number of modes needed for communication when
  *        in partition boundary, to be used as weighting for edges.
@@ -63,6 +63,9 @@ typedef LibUtilities::NekFactory<std::string, MeshPartition,
 
 SPATIAL_DOMAINS_EXPORT MeshPartitionFactory &GetMeshPartitionFactory();
 
+SPATIAL_DOMAINS_EXPORT std::pair<size_t, size_t> SplitWork(
+    size_t vecsize, int rank, int nprocs);
+
 class MeshPartition
 {
 
@@ -85,6 +88,9 @@ public:
         const int                  procid,
         std::vector<unsigned int> &tmp);
 
+    static std::string cacheCmdSwitch;
+    static std::string weightsCmdSwitch;
+
 protected:
     typedef std::vector<unsigned int> MultiWeight;
 
@@ -144,6 +150,9 @@ protected:
     std::map<int, MultiWeight> m_vertBndWeights;
     std::map<int, MultiWeight> m_edgeWeights;
 
+    // measured element weights read from file: elmt id -> weight
+    std::map<int, unsigned int> m_measuredWeights;
+
     BoostGraph m_graph;
     std::vector<std::vector<unsigned int>> m_localPartition;
 
@@ -152,15 +161,23 @@ protected:
     bool m_weightingRequired;
     bool m_weightBnd;
     bool m_weightDofs;
+    bool m_weightCost;
     bool m_shared;
     bool m_parallel;
+    bool m_useCache;
 
     void ReadExpansions();
     void ReadConditions();
+    void ReadMeasuredWeights();
     void WeightElements();
     void CreateGraph();
     void PartitionGraph(int nParts, bool overlapping = false);
 
+    std::size_t CalculateGraphHash(int nParts, bool overlapping);
+    std::string GetPartitionCacheFile(int nParts);
+    bool ReadPartitionCache(int nParts, std::size_t hash);
+    void WritePartitionCache(int nParts, std::size_t hash);
+
     virtual void PartitionGraphImpl(int &nVerts, int &nVertConds,
                                     Nektar::Array<Nektar::OneD, int> &xadj,
                                     Nektar::Array<Nektar::OneD, int> &adjcy,
@@ -170,11 +187,16 @@ protected:
                                     int &nparts, int &volume,
                                     Nektar::Array<Nektar::OneD, int> &part) = 0;
 
+    /// Name of the partitioner, as registered with the factory.
+    virtual const std::string &GetPartitionerName() const = 0;
+
     void CheckPartitions(int nParts, Array<OneD, int> &pPart);
     int CalculateElementWeight(LibUtilities::ShapeType elmtType, bool bndWeight,
                                int na, int nb, int nc);
     int CalculateEdgeWeight(LibUtilities::ShapeType elmtType,
                             int na, int nb, int nc);
+    int CalculateElementCost(LibUtilities::ShapeType elmtType,
+                             int na, int nb, int nc);
 };
 
 typedef std::shared_ptr<MeshPartition> MeshPartitionSharedPtr;
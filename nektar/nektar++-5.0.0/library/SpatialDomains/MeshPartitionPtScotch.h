@@ -67,6 +67,11 @@ public:
     virtual ~MeshPartitionPtScotch();
 
 private:
+    virtual const std::string &GetPartitionerName() const
+    {
+        return className;
+    }
+
     virtual void PartitionGraphImpl(int &nVerts, int &nVertConds,
                                     Nektar::Array<Nektar::OneD, int> &xadj,
                                     Nektar::Array<Nektar::OneD, int> &adjcy,
@@ -74,6 +74,11 @@ namespace SpatialDomains
             virtual ~MeshPartitionScotch();
 
         private:
+            virtual const std::string &GetPartitionerName() const
+            {
+                return className;
+            }
+
             virtual void PartitionGraphImpl(
                     int&                              nVerts,
                     int&                              nVertConds,
@@ -0,0 +1,147 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TestSparseCholesky.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Tests of the supernodal sparse Cholesky factorisation.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <LibUtilities/LinearAlgebra/SparseCholesky.h>
+
+namespace Nektar
+{
+    namespace SparseCholeskyUnitTests
+    {
+        /// Lower triangle of a shifted five-point Laplacian on an n x n grid.
+        COOMatType Laplacian(int n, NekDouble shift)
+        {
+            COOMatType mat;
+            for (int i = 0; i < n; ++i)
+            {
+                for (int j = 0; j < n; ++j)
+                {
+                    int row = i * n + j;
+                    mat[CoordType(row, row)] = 4.0 + shift;
+                    if (j > 0)
+                    {
+                        mat[CoordType(row, row - 1)] = -1.0;
+                    }
+                    if (i > 0)
+                    {
+                        mat[CoordType(row, row - n)] = -1.0;
+                    }
+                }
+            }
+            return mat;
+        }
+
+        /// Check that x solves A x = b, with A given by its lower triangle.
+        void CheckSolution(const COOMatType &mat,
+                           const Array<OneD, NekDouble> &x,
+                           const Array<OneD, NekDouble> &b)
+        {
+            Array<OneD, NekDouble> res(b.num_elements(), 0.0);
+            for (auto &entry : mat)
+            {
+                int r = entry.first.first, c = entry.first.second;
+                res[r] += entry.second * x[c];
+                if (r != c)
+                {
+                    res[c] += entry.second * x[r];
+                }
+            }
+
+            for (int i = 0; i < b.num_elements(); ++i)
+            {
+                BOOST_CHECK_SMALL(res[i] - b[i], 1e-10);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestSparseCholeskySolve)
+        {
+            const int n = 8, nRows = n * n;
+
+            COOMatType mat = Laplacian(n, 0.0);
+            SparseCholeskySymbolicSharedPtr symbolic =
+                std::make_shared<SparseCholeskySymbolic>(nRows, mat);
+
+            BOOST_CHECK(symbolic->MatchesPattern(nRows, mat));
+            BOOST_CHECK(symbolic->GetNumSupernodes() < nRows);
+
+            SparseCholesky chol(symbolic);
+            chol.Factorise(mat);
+
+            Array<OneD, NekDouble> b(nRows), x(nRows);
+            for (int i = 0; i < nRows; ++i)
+            {
+                b[i] = x[i] = 1.0 + 0.1 * i;
+            }
+            chol.Solve(x);
+
+            CheckSolution(mat, x, b);
+        }
+
+        BOOST_AUTO_TEST_CASE(TestSparseCholeskyRefactorise)
+        {
+            const int n = 6, nRows = n * n;
+
+            SparseCholeskySymbolicSharedPtr symbolic =
+                std::make_shared<SparseCholeskySymbolic>(
+                    nRows, Laplacian(n, 0.0));
+
+            // Reuse the analysis for matrices with the same pattern.
+            SparseCholesky chol(symbolic);
+            for (NekDouble shift = 0.5; shift < 4.0; shift *= 2.0)
+            {
+                COOMatType mat = Laplacian(n, shift);
+                BOOST_CHECK(symbolic->MatchesPattern(nRows, mat));
+
+                chol.Factorise(mat);
+
+                Array<OneD, NekDouble> b(nRows), x(nRows);
+                for (int i = 0; i < nRows; ++i)
+                {
+                    b[i] = x[i] = (i % 3) - 1.0;
+                }
+                chol.Solve(x);
+
+                CheckSolution(mat, x, b);
+            }
+
+            // A different pattern must not match.
+            COOMatType other = Laplacian(n, 0.0);
+            other[CoordType(nRows - 1, 0)] = -0.1;
+            BOOST_CHECK(!symbolic->MatchesPattern(nRows, other));
+        }
+    }
+}
@@ -42,5 +42,83 @@ BOOST_AUTO_TEST_CASE(TestPowOperator)
     BOOST_CHECK_EQUAL(out[0], 65536);
 }
 
+BOOST_AUTO_TEST_CASE(TestOptimisedExpressions)
+{
+    LibUtilities::Interpreter interp;
+    interp.SetParameter("a", 3.0);
+    int func1 = interp.DefineFunction(
+        "x y", "sin(x*y)*(x^2+y^2) + cos(x*y)*(y*y+x*x) - 2*x*y");
+    int func2 = interp.DefineFunction("x y", "1*x + 0 - x^3/y^-1*a + a*y");
+    int func3 = interp.DefineFunction("x y", "a - x*y + exp(x*y)^2");
+
+    const int npts = 1500;
+    Array<OneD, NekDouble> x(npts), y(npts), out(npts);
+    for (int i = 0; i < npts; ++i)
+    {
+        x[i] = 0.001 * i - 0.5;
+        y[i] = 0.002 * i + 0.25;
+    }
+
+    interp.Evaluate(func1, { x, y }, out);
+    for (int i = 0; i < npts; ++i)
+    {
+        NekDouble r2 = x[i] * x[i] + y[i] * y[i];
+        NekDouble xy = x[i] * y[i];
+        NekDouble f  = std::sin(xy) * r2 + std::cos(xy) * r2 - 2 * xy;
+        BOOST_CHECK_CLOSE(out[i], f, 1e-10);
+        BOOST_CHECK_CLOSE(interp.Evaluate(func1, x[i], y[i], 0.0, 0.0), f,
+                          1e-10);
+    }
+
+    interp.Evaluate(func2, { x, y }, out);
+    for (int i = 0; i < npts; ++i)
+    {
+        NekDouble f = x[i] - std::pow(x[i], 3) * y[i] * 3.0 + 3.0 * y[i];
+        BOOST_CHECK_CLOSE(out[i], f, 1e-10);
+    }
+
+    interp.SetParameter("a", 2.0);
+    interp.Evaluate(func3, { x, y }, out);
+    for (int i = 0; i < npts; ++i)
+    {
+        NekDouble f = 2.0 - x[i] * y[i] + std::exp(2 * x[i] * y[i]);
+        BOOST_CHECK_CLOSE(out[i], f, 1e-10);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestSeparateFunction)
+{
+    LibUtilities::Interpreter interp;
+    interp.SetParameter("U", 2.0);
+    int func1 = interp.DefineFunction(
+        "x y z t", "-U*sin(PI*x)/(1+y^2)*exp(-t)*cos(t)/2");
+    int func2 = interp.DefineFunction("x y z t", "U*x*y");
+    int func3 = interp.DefineFunction("x y z t", "x*t + 1");
+    int func4 = interp.DefineFunction("x y z t", "x*sin(x*t)");
+
+    int varId, restId;
+    BOOST_CHECK(interp.SeparateFunction(func1, "t", varId, restId));
+    for (NekDouble t = 0.0; t < 1.0; t += 0.25)
+    {
+        NekDouble f = interp.Evaluate(func1, 0.3, 0.7, 0.0, t);
+        NekDouble g = interp.Evaluate(varId, 0.0, 0.0, 0.0, t) *
+                      interp.Evaluate(restId, 0.3, 0.7, 0.0, 0.0);
+        BOOST_CHECK_CLOSE(f, g, 1e-12);
+    }
+
+    BOOST_CHECK(interp.SeparateFunction(func2, "t", varId, restId));
+    BOOST_CHECK_EQUAL(varId, -1);
+    BOOST_CHECK_EQUAL(restId, func2);
+
+    BOOST_CHECK(!interp.SeparateFunction(func3, "t", varId, restId));
+    BOOST_CHECK(!interp.SeparateFunction(func4, "t", varId, restId));
+
+    int revision = interp.GetParameterRevision();
+    interp.SetParameter("U", 2.0);
+    BOOST_CHECK_EQUAL(interp.GetParameterRevision(), revision);
+    interp.SetParameter("U", 3.0);
+    BOOST_CHECK_EQUAL(interp.GetParameterRevision(), revision + 1);
+}
+
 }
 }
@@ -0,0 +1,146 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TestNekManager.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Tests of the memory accounting of NekManager pools.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <LibUtilities/BasicUtils/NekManager.hpp>
+#include <LibUtilities/LinearAlgebra/NekMatrix.hpp>
+
+namespace Nektar
+{
+    namespace NekManagerUnitTests
+    {
+        typedef NekMatrix<NekDouble, StandardMatrixTag> MatType;
+        typedef LibUtilities::NekManager<int, MatType> ManagerType;
+
+        std::shared_ptr<MatType> CreateMatrix(const int &n)
+        {
+            return std::make_shared<MatType>(n, n, 1.0);
+        }
+
+        BOOST_AUTO_TEST_CASE(TestNekManagerAccounting)
+        {
+            const std::string pool = "TestNekManagerAccounting";
+            ManagerType manager(CreateMatrix, pool);
+
+            size_t bytes10 = GetMemoryFootprint(*manager[10]);
+            size_t bytes20 = GetMemoryFootprint(*manager[20]);
+
+            BOOST_CHECK_EQUAL(bytes10, sizeof(MatType) + 100*sizeof(NekDouble));
+            BOOST_CHECK_EQUAL(LibUtilities::GetNekManagerBytes(pool),
+                              bytes10 + bytes20);
+
+            manager.DeleteObject(10);
+            BOOST_CHECK_EQUAL(LibUtilities::GetNekManagerBytes(pool), bytes20);
+
+            ManagerType::ClearManager(pool);
+            BOOST_CHECK_EQUAL(LibUtilities::GetNekManagerBytes(pool), 0);
+        }
+
+        BOOST_AUTO_TEST_CASE(TestNekManagerBudget)
+        {
+            const std::string pool = "TestNekManagerBudget";
+            const size_t bytes10 = sizeof(MatType) + 100*sizeof(NekDouble);
+            const size_t bytes30 = sizeof(MatType) + 900*sizeof(NekDouble);
+
+            LibUtilities::SetNekManagerBudget(pool, bytes10 + bytes30);
+            ManagerType manager(CreateMatrix, pool);
+
+            manager[10];
+            manager[20];
+            manager[30];
+
+            // Objects are only evicted when the budget is enforced.
+            BOOST_CHECK(manager.AlreadyCreated(20));
+
+            // Using the first object makes the second the least recently
+            // used one, which is the only one to be evicted.
+            manager[10];
+            LibUtilities::EnforceNekManagerBudgets();
+
+            BOOST_CHECK( manager.AlreadyCreated(10));
+            BOOST_CHECK(!manager.AlreadyCreated(20));
+            BOOST_CHECK( manager.AlreadyCreated(30));
+            BOOST_CHECK_EQUAL(LibUtilities::GetNekManagerBytes(pool),
+                              bytes10 + bytes30);
+
+            // Evicted objects are created again on demand.
+            BOOST_CHECK_EQUAL(manager[20]->GetRows(), 20);
+        }
+
+        /// Object holding storage outside of itself, which is released when
+        /// it is evicted.
+        struct EvictedObject
+        {
+            int  m_size;
+            bool m_released;
+        };
+
+        size_t GetMemoryFootprint(const EvictedObject &obj)
+        {
+            return obj.m_size;
+        }
+
+        void ReleaseEvictedObject(EvictedObject &obj)
+        {
+            obj.m_released = true;
+        }
+
+        std::shared_ptr<EvictedObject> CreateEvictedObject(const int &n)
+        {
+            return std::make_shared<EvictedObject>(EvictedObject{n, false});
+        }
+
+        BOOST_AUTO_TEST_CASE(TestNekManagerBudgetRelease)
+        {
+            const std::string pool = "TestNekManagerBudgetRelease";
+            typedef LibUtilities::NekManager<int, EvictedObject> EvictManager;
+
+            LibUtilities::SetNekManagerBudget(pool, 300);
+            EvictManager manager(CreateEvictedObject, pool);
+
+            std::shared_ptr<EvictedObject> obj100 = manager[100];
+            std::shared_ptr<EvictedObject> obj200 = manager[200];
+            std::shared_ptr<EvictedObject> obj300 = manager[300];
+            LibUtilities::EnforceNekManagerBudgets();
+
+            // The two least recently used objects are evicted and released.
+            BOOST_CHECK( obj100->m_released);
+            BOOST_CHECK( obj200->m_released);
+            BOOST_CHECK(!obj300->m_released);
+            BOOST_CHECK_EQUAL(LibUtilities::GetNekManagerBytes(pool), 300);
+        }
+    }
+}
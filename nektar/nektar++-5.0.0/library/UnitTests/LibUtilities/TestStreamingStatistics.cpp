@@ -0,0 +1,202 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TestStreamingStatistics.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Test the one-pass statistics against two-pass sums.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <LibUtilities/BasicUtils/StreamingStatistics.h>
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <vector>
+
+namespace Nektar
+{
+namespace StreamingStatisticsUnitTests
+{
+
+using namespace LibUtilities;
+
+const int nPoints  = 3;
+const int nSamples = 50;
+
+// Two variables with a large offset, which defeats naive sums of powers.
+void GetSample(int s, Array<OneD, Array<OneD, NekDouble> > &sample)
+{
+    for (int i = 0; i < nPoints; ++i)
+    {
+        sample[0][i] = 1.0e4 + std::sin(0.3 * s + i) + 0.1 * i;
+        sample[1][i] = -2.0 + std::cos(0.7 * s * s + i) * (i + 1);
+    }
+}
+
+Array<OneD, Array<OneD, NekDouble> > NewSample()
+{
+    Array<OneD, Array<OneD, NekDouble> > sample(2);
+    sample[0] = Array<OneD, NekDouble>(nPoints);
+    sample[1] = Array<OneD, NekDouble>(nPoints);
+    return sample;
+}
+
+BOOST_AUTO_TEST_CASE(TestCumulative)
+{
+    std::vector<std::pair<int, int> > pairs = { {0, 1} };
+    StreamingStatistics stats(nPoints, 2, 4, pairs);
+
+    Array<OneD, Array<OneD, NekDouble> > sample = NewSample();
+    for (int s = 0; s < nSamples; ++s)
+    {
+        GetSample(s, sample);
+        stats.Update(sample);
+    }
+
+    Array<OneD, Array<OneD, NekDouble> > result;
+    stats.GetStatistics(result);
+    BOOST_CHECK_EQUAL(result.num_elements(), 9);
+    BOOST_CHECK_EQUAL(stats.GetCount(), nSamples);
+
+    for (int i = 0; i < nPoints; ++i)
+    {
+        NekDouble mean[2] = {0.0, 0.0};
+        for (int s = 0; s < nSamples; ++s)
+        {
+            GetSample(s, sample);
+            mean[0] += sample[0][i] / nSamples;
+            mean[1] += sample[1][i] / nSamples;
+        }
+
+        NekDouble mom[3][2] = {{0.0}}, cov = 0.0;
+        for (int s = 0; s < nSamples; ++s)
+        {
+            GetSample(s, sample);
+            for (int v = 0; v < 2; ++v)
+            {
+                NekDouble d = sample[v][i] - mean[v];
+                mom[0][v] += d * d / nSamples;
+                mom[1][v] += d * d * d / nSamples;
+                mom[2][v] += d * d * d * d / nSamples;
+            }
+            cov += (sample[0][i] - mean[0]) *
+                   (sample[1][i] - mean[1]) / nSamples;
+        }
+
+        for (int v = 0; v < 2; ++v)
+        {
+            BOOST_CHECK_CLOSE(result[v][i], mean[v], 1e-8);
+            for (int k = 0; k < 3; ++k)
+            {
+                BOOST_CHECK_SMALL(result[2 + 2 * k + v][i] - mom[k][v],
+                                  1e-10);
+            }
+        }
+        BOOST_CHECK_SMALL(result[8][i] - cov, 1e-10);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestMerge)
+{
+    std::vector<std::pair<int, int> > pairs = { {0, 1}, {1, 1} };
+    StreamingStatistics full(nPoints, 2, 4, pairs);
+    StreamingStatistics first(nPoints, 2, 4, pairs);
+    StreamingStatistics second(nPoints, 2, 4, pairs);
+
+    Array<OneD, Array<OneD, NekDouble> > sample = NewSample();
+    for (int s = 0; s < nSamples; ++s)
+    {
+        GetSample(s, sample);
+        full.Update(sample);
+        if (s < 17)
+        {
+            first.Update(sample);
+        }
+        else
+        {
+            second.Update(sample);
+        }
+    }
+    first.Merge(second);
+
+    // A restarted accumulator continues from the saved statistics.
+    Array<OneD, Array<OneD, NekDouble> > result, merged;
+    first.GetStatistics(merged);
+    StreamingStatistics restart(nPoints, 2, 4, pairs);
+    restart.SetStatistics(first.GetCount(), merged);
+    GetSample(nSamples, sample);
+    full.Update(sample);
+    restart.Update(sample);
+
+    full.GetStatistics(result);
+    restart.GetStatistics(merged);
+    for (int j = 0; j < result.num_elements(); ++j)
+    {
+        for (int i = 0; i < nPoints; ++i)
+        {
+            BOOST_CHECK_SMALL(result[j][i] - merged[j][i], 1e-8);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestExponential)
+{
+    const NekDouble alpha = 0.1;
+    StreamingStatistics stats(nPoints, 2, 2, {}, alpha);
+
+    Array<OneD, Array<OneD, NekDouble> > sample = NewSample();
+    NekDouble mean = 0.0, var = 0.0;
+    for (int s = 0; s < nSamples; ++s)
+    {
+        GetSample(s, sample);
+        stats.Update(sample);
+
+        NekDouble x = sample[1][0];
+        if (s == 0)
+        {
+            mean = x;
+        }
+        else
+        {
+            NekDouble d = x - mean;
+            var  = (1.0 - alpha) * (var + alpha * d * d);
+            mean = mean + alpha * d;
+        }
+    }
+
+    Array<OneD, Array<OneD, NekDouble> > result;
+    stats.GetStatistics(result);
+    BOOST_CHECK_CLOSE(result[1][0], mean, 1e-10);
+    BOOST_CHECK_CLOSE(result[3][0], var, 1e-10);
+}
+
+}
+}
@@ -0,0 +1,198 @@
+///////////////////////////////////////////////////////////////////////////////
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Compare fast diagonalisation interior solves against the
+// stored interior inverse of the static condensation matrix.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <LocalRegions/QuadExp.h>
+#include <LocalRegions/HexExp.h>
+#include <LocalRegions/MatrixKey.h>
+#include <SpatialDomains/MeshGraph.h>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace Nektar
+{
+    namespace FastDiagInteriorSolveTests
+    {
+        SpatialDomains::SegGeomSharedPtr CreateSegGeom(unsigned int id,
+            int coordim,
+            SpatialDomains::PointGeomSharedPtr v0,
+            SpatialDomains::PointGeomSharedPtr v1)
+        {
+            SpatialDomains::PointGeomSharedPtr vertices[] = {v0, v1};
+            SpatialDomains::SegGeomSharedPtr result(
+                new SpatialDomains::SegGeom(id, coordim, vertices));
+            return result;
+        }
+
+        SpatialDomains::QuadGeomSharedPtr CreateQuadGeom(unsigned int id,
+            int coordim,
+            SpatialDomains::PointGeomSharedPtr v0,
+            SpatialDomains::PointGeomSharedPtr v1,
+            SpatialDomains::PointGeomSharedPtr v2,
+            SpatialDomains::PointGeomSharedPtr v3,
+            unsigned int edgeId)
+        {
+            SpatialDomains::SegGeomSharedPtr edges[] =
+            {
+                CreateSegGeom(edgeId,   coordim, v0, v1),
+                CreateSegGeom(edgeId+1, coordim, v1, v2),
+                CreateSegGeom(edgeId+2, coordim, v2, v3),
+                CreateSegGeom(edgeId+3, coordim, v3, v0)
+            };
+            SpatialDomains::QuadGeomSharedPtr result(
+                new SpatialDomains::QuadGeom(id, edges));
+            return result;
+        }
+
+        /// Apply the stored interior inverse and the fast diagonalisation
+        /// solve to the same right-hand side and compare the results.
+        void CheckInteriorSolve(LocalRegions::ExpansionSharedPtr exp,
+                                LibUtilities::ShapeType shape)
+        {
+            StdRegions::ConstFactorMap factors;
+            factors[StdRegions::eFactorLambda] = 2.5;
+            LocalRegions::MatrixKey key(StdRegions::eHelmholtz, shape,
+                                        *exp, factors);
+
+            BOOST_CHECK(exp->HasFastDiagInteriorSolve(key));
+
+            DNekScalMatSharedPtr invD =
+                exp->GetLocStaticCondMatrix(key)->GetBlock(1, 1);
+            int nInt = invD->GetRows();
+
+            Array<OneD, NekDouble> rhs(nInt), ref(nInt, 0.0), sol(nInt);
+            for (int i = 0; i < nInt; ++i)
+            {
+                rhs[i] = 1.0 + 0.1 * i - 0.01 * i * i;
+            }
+
+            for (int i = 0; i < nInt; ++i)
+            {
+                for (int j = 0; j < nInt; ++j)
+                {
+                    ref[i] += (*invD)(i, j) * rhs[j];
+                }
+            }
+
+            exp->FastDiagInteriorSolve(key, rhs, sol);
+
+            double epsilon = 1.0e-8;
+            for (int i = 0; i < nInt; ++i)
+            {
+                BOOST_CHECK_CLOSE(sol[i], ref[i], epsilon);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestQuadExpFastDiagInteriorSolve)
+        {
+            SpatialDomains::PointGeomSharedPtr v0(
+                new SpatialDomains::PointGeom(2u, 0u, 0.0, 0.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v1(
+                new SpatialDomains::PointGeom(2u, 1u, 2.0, 0.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v2(
+                new SpatialDomains::PointGeom(2u, 2u, 2.0, 0.5, 0.0));
+            SpatialDomains::PointGeomSharedPtr v3(
+                new SpatialDomains::PointGeom(2u, 3u, 0.0, 0.5, 0.0));
+
+            SpatialDomains::QuadGeomSharedPtr quadGeom =
+                CreateQuadGeom(0, 2, v0, v1, v2, v3, 0);
+
+            const LibUtilities::PointsKey pointsKey(
+                8, LibUtilities::eGaussLobattoLegendre);
+            const LibUtilities::BasisKey basisKey0(
+                LibUtilities::eModified_A, 7, pointsKey);
+            const LibUtilities::BasisKey basisKey1(
+                LibUtilities::eModified_A, 6, pointsKey);
+
+            LocalRegions::QuadExpSharedPtr quadExp =
+                MemoryManager<LocalRegions::QuadExp>::AllocateSharedPtr(
+                    basisKey0, basisKey1, quadGeom);
+
+            CheckInteriorSolve(quadExp, LibUtilities::eQuadrilateral);
+        }
+
+        BOOST_AUTO_TEST_CASE(TestHexExpFastDiagInteriorSolve)
+        {
+            NekDouble lx = 1.0, ly = 0.5, lz = 0.25;
+            SpatialDomains::PointGeomSharedPtr v[8];
+            for (int i = 0; i < 8; ++i)
+            {
+                NekDouble x = ((i % 4 == 1) || (i % 4 == 2)) ? lx : 0.0;
+                NekDouble y = (i % 4 >= 2) ? ly : 0.0;
+                NekDouble z = (i >= 4) ? lz : 0.0;
+                v[i] = MemoryManager<SpatialDomains::PointGeom>::
+                    AllocateSharedPtr(3u, i, x, y, z);
+            }
+
+            const int edgeVerts[12][2] =
+            {
+                {0, 1}, {1, 2}, {2, 3}, {3, 0}, {0, 4}, {1, 5},
+                {2, 6}, {3, 7}, {4, 5}, {5, 6}, {6, 7}, {4, 7}
+            };
+            SpatialDomains::SegGeomSharedPtr e[12];
+            for (int i = 0; i < 12; ++i)
+            {
+                e[i] = CreateSegGeom(i, 3, v[edgeVerts[i][0]],
+                                           v[edgeVerts[i][1]]);
+            }
+
+            const int faceEdges[6][4] =
+            {
+                {0, 1, 2, 3}, {0, 5, 8, 4}, {1, 6, 9, 5},
+                {2, 6, 10, 7}, {3, 7, 11, 4}, {8, 9, 10, 11}
+            };
+            SpatialDomains::QuadGeomSharedPtr faces[6];
+            for (int i = 0; i < 6; ++i)
+            {
+                SpatialDomains::SegGeomSharedPtr edges[] =
+                {
+                    e[faceEdges[i][0]], e[faceEdges[i][1]],
+                    e[faceEdges[i][2]], e[faceEdges[i][3]]
+                };
+                faces[i] = MemoryManager<SpatialDomains::QuadGeom>::
+                    AllocateSharedPtr(i, edges);
+            }
+            SpatialDomains::HexGeomSharedPtr hexGeom(
+                new SpatialDomains::HexGeom(0, faces));
+
+            const LibUtilities::PointsKey pointsKey(
+                7, LibUtilities::eGaussLobattoLegendre);
+            const LibUtilities::BasisKey basisKey(
+                LibUtilities::eModified_A, 6, pointsKey);
+
+            LocalRegions::HexExpSharedPtr hexExp =
+                MemoryManager<LocalRegions::HexExp>::AllocateSharedPtr(
+                    basisKey, basisKey, basisKey, hexGeom);
+
+            CheckInteriorSolve(hexExp, LibUtilities::eHexahedron);
+        }
+    }
+}
@@ -318,5 +318,26 @@ namespace Nektar
             BOOST_CHECK_CLOSE(xt[2], -5.0, epsilon);
             
         }
+
+        BOOST_AUTO_TEST_CASE(TestMultipleRightHandSides)
+        {
+            double matrix_buf[] = {81, -5, 
+                                    -28, 4};
+
+            std::shared_ptr<NekMatrix<double> > A(new NekMatrix<double>(2, 2, matrix_buf,eFULL));
+            LinearSystem linsys(A);
+
+            // Two right-hand sides stored column by column.
+            double b_buf[] = {-941, 348, 81, -5};
+            Array<OneD, double> x(4, b_buf);
+
+            linsys.SolveMultiple(2, x);
+
+            double epsilon = 1e-11;
+            BOOST_CHECK_CLOSE(x[0], 32.5, epsilon);
+            BOOST_CHECK_CLOSE(x[1], 127.625, epsilon);
+            BOOST_CHECK_CLOSE(x[2], 1.0, epsilon);
+            BOOST_CHECK_SMALL(x[3], epsilon);
+        }
     }
 }
@@ -33,6 +33,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <iostream>
+#include <limits>
 
 #include <boost/core/ignore_unused.hpp>
 
@@ -527,27 +528,74 @@ namespace Nektar
 
 
     /**
-     *
+     * Time-step of the advection substeps, given by the SubStepCFL
+     * parameter.
      */
     NekDouble UnsteadyAdvectionDiffusion::GetSubstepTimeStep()
+    {
+        return GetCFLTimeStep(m_cflSafetyFactor);
+    }
+
+    /**
+     * Time-step of the outer time integration when the CFL parameter is
+     * set. UnsteadySystem rounds it down to a time-step level when
+     * TimeStepLevelRatio is set, so that the implicit diffusion solves reuse
+     * their global systems.
+     *
+     * Multistep schemes combine previous steps assuming a constant
+     * time-step, so only one-step schemes are supported.
+     */
+    NekDouble UnsteadyAdvectionDiffusion::v_GetTimeStep(
+        const Array<OneD, const Array<OneD, NekDouble> > &inarray)
+    {
+        boost::ignore_unused(inarray);
+
+        ASSERTL0(m_intScheme->GetIntegrationSteps() == 1,
+                 "The CFL parameter requires a one-step time integration "
+                 "method.");
+
+        NekDouble TimeStep = GetCFLTimeStep(UnsteadySystem::m_cflSafetyFactor);
+
+        // No element is advected: keep the previous time-step, or step to
+        // the final time.
+        if (TimeStep == std::numeric_limits<NekDouble>::max())
+        {
+            TimeStep = m_timestep > 0.0 ? m_timestep : m_fintime - m_time;
+            ASSERTL0(TimeStep > 0.0,
+                     "The CFL condition does not set a time-step without "
+                     "advection velocity: set FinTime.");
+        }
+
+        return TimeStep;
+    }
+
+    /**
+     * Largest time-step satisfying the CFL condition with safety factor
+     * @p cfl for the advection velocity. Elements at rest do not restrict
+     * the time-step.
+     */
+    NekDouble UnsteadyAdvectionDiffusion::GetCFLTimeStep(const NekDouble cfl)
     {
         int n_element      = m_fields[0]->GetExpSize();
 
         const Array<OneD, int> ExpOrder=m_fields[0]->EvalBasisNumModesMaxPerExp();
-        Array<OneD, int> ExpOrderList (n_element, ExpOrder);
 
         const NekDouble cLambda = 0.2; // Spencer book pag. 317
 
-        Array<OneD, NekDouble> tstep      (n_element, 0.0);
+        Array<OneD, NekDouble> tstep(
+            n_element, std::numeric_limits<NekDouble>::max());
         Array<OneD, NekDouble> stdVelocity(n_element, 0.0);
 
         stdVelocity = GetMaxStdVelocity(m_velocity);
 
         for(int el = 0; el < n_element; ++el)
         {
-            tstep[el] = m_cflSafetyFactor /
-                (stdVelocity[el] * cLambda *
-                 (ExpOrder[el]-1) * (ExpOrder[el]-1));
+            if (stdVelocity[el] > 0.0)
+            {
+                tstep[el] = cfl /
+                    (stdVelocity[el] * cLambda *
+                     (ExpOrder[el]-1) * (ExpOrder[el]-1));
+            }
         }
 
         NekDouble TimeStep = Vmath::Vmin(n_element, tstep, 1);
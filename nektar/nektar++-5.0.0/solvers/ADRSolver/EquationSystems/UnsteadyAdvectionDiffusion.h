@@ -126,6 +126,10 @@ namespace Nektar
         /// Print Summary
         virtual void v_GenerateSummary(SolverUtils::SummaryList& s);
 
+        /// Time-step given by the CFL parameter.
+        virtual NekDouble v_GetTimeStep(
+            const Array<OneD, const Array<OneD, NekDouble> > &inarray);
+
         /// PreIntegration step for substepping.
         virtual bool v_PreIntegrate(int step);
 
@@ -133,6 +137,7 @@ namespace Nektar
         void SubStepAdvance(const LibUtilities::TimeIntegrationSolutionSharedPtr &integrationSoln,
                             int nstep,  NekDouble time);
         NekDouble GetSubstepTimeStep();
+        NekDouble GetCFLTimeStep(const NekDouble cfl);
         void SetUpSubSteppingTimeIntegration(int intMethod,
                          const LibUtilities::TimeIntegrationWrapperSharedPtr &IntegrationScheme);
 
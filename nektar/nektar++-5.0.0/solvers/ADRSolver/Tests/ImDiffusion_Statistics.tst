@@ -0,0 +1,135 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>2D implicit diffusion with windowed Statistics filter</description>
+    <executable>ADRSolver</executable>
+    <parameters>ImDiffusion_Statistics.xml</parameters>
+    <files>
+        <file description="Session File">ImDiffusion_Statistics.xml</file>
+    </files>
+    <metrics>
+        <!-- Norms of the statistics of the first window, of the second
+             window, at the step and final outputs, then errors of the
+             solution. -->
+        <metric type="regex" id="1">
+            <regex>^L 2 error\s*\(variable (\w+)\)\s*:\s*([+-]?\d.+\d|-?\d|[+-]?nan|[+-]?inf).*</regex>
+            <matches>
+                <match>
+                    <field id="0">u</field>
+                    <field id="1" tolerance="1e-9">0.7320063752</field>
+                </match>
+                <match>
+                    <field id="0">v</field>
+                    <field id="1" tolerance="1e-9">0.7320063752</field>
+                </match>
+                <match>
+                    <field id="0">uu</field>
+                    <field id="1" tolerance="1e-10">0.0825</field>
+                </match>
+                <match>
+                    <field id="0">vv</field>
+                    <field id="1" tolerance="1e-10">0.0825</field>
+                </match>
+                <match>
+                    <field id="0">uuu</field>
+                    <field id="1" tolerance="1e-10">0</field>
+                </match>
+                <match>
+                    <field id="0">vvv</field>
+                    <field id="1" tolerance="1e-10">0</field>
+                </match>
+                <match>
+                    <field id="0">uuuu</field>
+                    <field id="1" tolerance="1e-10">0.01208625</field>
+                </match>
+                <match>
+                    <field id="0">vvvv</field>
+                    <field id="1" tolerance="1e-10">0.01208625</field>
+                </match>
+                <match>
+                    <field id="0">uv</field>
+                    <field id="1" tolerance="1e-10">0.0825</field>
+                </match>
+                <match>
+                    <field id="0">u</field>
+                    <field id="1" tolerance="1e-9">1.723127002</field>
+                </match>
+                <match>
+                    <field id="0">v</field>
+                    <field id="1" tolerance="1e-9">1.723127002</field>
+                </match>
+                <match>
+                    <field id="0">uu</field>
+                    <field id="1" tolerance="1e-10">0.0825</field>
+                </match>
+                <match>
+                    <field id="0">vv</field>
+                    <field id="1" tolerance="1e-10">0.0825</field>
+                </match>
+                <match>
+                    <field id="0">uuu</field>
+                    <field id="1" tolerance="1e-10">0</field>
+                </match>
+                <match>
+                    <field id="0">vvv</field>
+                    <field id="1" tolerance="1e-10">0</field>
+                </match>
+                <match>
+                    <field id="0">uuuu</field>
+                    <field id="1" tolerance="1e-10">0.01208625</field>
+                </match>
+                <match>
+                    <field id="0">vvvv</field>
+                    <field id="1" tolerance="1e-10">0.01208625</field>
+                </match>
+                <match>
+                    <field id="0">uv</field>
+                    <field id="1" tolerance="1e-10">0.0825</field>
+                </match>
+                <match>
+                    <field id="0">u</field>
+                    <field id="1" tolerance="1e-9">1.723127002</field>
+                </match>
+                <match>
+                    <field id="0">v</field>
+                    <field id="1" tolerance="1e-9">1.723127002</field>
+                </match>
+                <match>
+                    <field id="0">uu</field>
+                    <field id="1" tolerance="1e-10">0.0825</field>
+                </match>
+                <match>
+                    <field id="0">vv</field>
+                    <field id="1" tolerance="1e-10">0.0825</field>
+                </match>
+                <match>
+                    <field id="0">uuu</field>
+                    <field id="1" tolerance="1e-10">0</field>
+                </match>
+                <match>
+                    <field id="0">vvv</field>
+                    <field id="1" tolerance="1e-10">0</field>
+                </match>
+                <match>
+                    <field id="0">uuuu</field>
+                    <field id="1" tolerance="1e-10">0.01208625</field>
+                </match>
+                <match>
+                    <field id="0">vvvv</field>
+                    <field id="1" tolerance="1e-10">0.01208625</field>
+                </match>
+                <match>
+                    <field id="0">uv</field>
+                    <field id="1" tolerance="1e-10">0.0825</field>
+                </match>
+                <match>
+                    <field id="0">u</field>
+                    <field id="1" tolerance="1e-10">0</field>
+                </match>
+                <match>
+                    <field id="0">v</field>
+                    <field id="1" tolerance="1e-10">0</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
@@ -87,6 +87,8 @@ namespace Nektar
         
         void UpdateRobinPrimCoeff(void);
 
+        inline void SetTimeStep(const NekDouble dt);
+
         inline void SubSteppingTimeIntegration(
             const int intMethod,
             const LibUtilities::TimeIntegrationWrapperSharedPtr &IntegrationScheme);
@@ -344,6 +346,15 @@ namespace Nektar
         v_EvaluatePressureBCs(inarray,N,kinvis);
     }
 
+    /**
+     * Set the time-step of the extrapolation when it is changed by the CFL
+     * condition.
+     */
+    inline void Extrapolate::SetTimeStep(const NekDouble dt)
+    {
+        m_timestep = dt;
+    }
+
     /**
      *
      */
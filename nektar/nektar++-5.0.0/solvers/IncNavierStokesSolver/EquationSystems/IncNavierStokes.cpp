@@ -35,6 +35,7 @@
 
 #include <iomanip>
 #include <boost/algorithm/string.hpp>
+#include <boost/core/ignore_unused.hpp>
 
 #include <IncNavierStokesSolver/EquationSystems/IncNavierStokes.h>
 #include <LibUtilities/BasicUtils/Timer.h>
@@ -49,6 +50,7 @@
 #include <algorithm>
 #include <iostream>
 #include <fstream>
+#include <limits>
 #include <sstream>
 
 #include <tinyxml.h>
@@ -816,6 +818,61 @@ namespace Nektar
         return stdVelocity;
     }
 
+    /**
+     * Time-step given by the CFL parameter. UnsteadySystem rounds it down to
+     * a time-step level when TimeStepLevelRatio is set, so that the
+     * Helmholtz solves reuse their global systems.
+     *
+     * Multistep schemes, and the extrapolation of the pressure boundary
+     * conditions, combine previous steps assuming a constant time-step, so
+     * only one-step schemes are supported.
+     */
+    NekDouble IncNavierStokes::v_GetTimeStep(
+        const Array<OneD, const Array<OneD, NekDouble> > &inarray)
+    {
+        boost::ignore_unused(inarray);
+
+        ASSERTL0(m_intScheme->GetIntegrationSteps() == 1,
+                 "The CFL parameter requires a one-step time integration "
+                 "method.");
+
+        int n_element = m_fields[0]->GetExpSize();
+
+        const Array<OneD, int> ExpOrder =
+            m_fields[0]->EvalBasisNumModesMaxPerExp();
+
+        const NekDouble cLambda = 0.2; // Spencer book pag. 317
+
+        Array<OneD, NekDouble> tstep(
+            n_element, std::numeric_limits<NekDouble>::max());
+        Array<OneD, NekDouble> stdVelocity = v_GetMaxStdVelocity();
+
+        for(int el = 0; el < n_element; ++el)
+        {
+            if (stdVelocity[el] > 0.0)
+            {
+                tstep[el] = m_cflSafetyFactor /
+                    (stdVelocity[el] * cLambda *
+                     (ExpOrder[el]-1) * (ExpOrder[el]-1));
+            }
+        }
+
+        NekDouble TimeStep = Vmath::Vmin(n_element, tstep, 1);
+        m_comm->AllReduce(TimeStep, LibUtilities::ReduceMin);
+
+        // The flow is at rest: keep the previous time-step, or step to the
+        // final time.
+        if (TimeStep == std::numeric_limits<NekDouble>::max())
+        {
+            TimeStep = m_timestep > 0.0 ? m_timestep : m_fintime - m_time;
+            ASSERTL0(TimeStep > 0.0,
+                     "The CFL condition does not set a time-step for a flow "
+                     "at rest: set FinTime.");
+        }
+
+        return TimeStep;
+    }
+
     /**
      *
      */
@@ -855,6 +912,7 @@ namespace Nektar
      */
     bool IncNavierStokes::v_PreIntegrate(int step)
     {
+        m_extrapolation->SetTimeStep(m_timestep);
         m_extrapolation->SubStepSaveFields(step);
         m_extrapolation->SubStepAdvance(m_intSoln,step,m_time);
         SetBoundaryConditions(m_time+m_timestep);
@@ -265,6 +265,9 @@ namespace Nektar
 
         virtual Array<OneD, NekDouble> v_GetMaxStdVelocity();
 
+        virtual NekDouble v_GetTimeStep(
+            const Array<OneD, const Array<OneD, NekDouble> > &inarray);
+
         virtual bool v_PreIntegrate(int step);
 
     private:
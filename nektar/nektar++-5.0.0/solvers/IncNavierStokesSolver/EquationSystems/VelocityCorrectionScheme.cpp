@@ -819,6 +819,37 @@ namespace Nektar
 
         AppendSVVFactors(factors,varFactorsMap);
 
+        // Velocity components with the same diffusion coefficient share
+        // their Helmholtz operator and are solved together
+        bool sameDiff = true;
+        for(int i = 1; i < m_nConvectiveFields; ++i)
+        {
+            sameDiff = sameDiff && m_diffCoeff[i] == m_diffCoeff[0];
+        }
+
+        if (sameDiff && m_nConvectiveFields > 1)
+        {
+            Array<OneD, MultiRegions::ExpListSharedPtr>
+                fields(m_nConvectiveFields);
+            Array<OneD, Array<OneD, NekDouble> > coeffs(m_nConvectiveFields);
+            for(int i = 0; i < m_nConvectiveFields; ++i)
+            {
+                fields[i] = m_fields[i];
+                coeffs[i] = m_fields[i]->UpdateCoeffs();
+            }
+
+            factors[StdRegions::eFactorLambda] = 1.0/aii_Dt/m_diffCoeff[0];
+            m_fields[0]->HelmSolveMultiple(fields, Forcing, coeffs,
+                                           NullFlagList, factors,
+                                           varCoeffMap, varFactorsMap);
+
+            for(int i = 0; i < m_nConvectiveFields; ++i)
+            {
+                m_fields[i]->BwdTrans(m_fields[i]->GetCoeffs(),outarray[i]);
+            }
+            return;
+        }
+
         // Solve Helmholtz system and put in Physical space
         for(int i = 0; i < m_nConvectiveFields; ++i)
         {
@@ -50,14 +50,16 @@ std::string FilterReynoldsStresses::className =
  * This class appends the average fields with the Reynolds stresses of the form
  * \f$ \overline{u' v'} \f$.
  *
- * For the default case, this is achieved by calculating
+ * For the default case, this is achieved by accumulating
  * \f$ C_{n} = \Sigma_{i=1}^{n} (u_i - \bar{u}_n)(v_i - \bar{v}_n)\f$
- * using the recursive relation:
+ * in physical space with LibUtilities::StreamingStatistics, using the
+ * recursive relation:
  *
- * \f[ C_{n} = C_{n-1} + \frac{n}{n-1} (u_n - \bar{u}_n)(v_n - \bar{v}_n) \f]
+ * \f[ C_{n} = C_{n-1} + \frac{n-1}{n} (u_n - \bar{u}_{n-1})
+ *     (v_n - \bar{v}_{n-1}) \f]
  *
- * The FilterSampler base class then divides the result by n, leading
- * to the Reynolds stress.
+ * The Reynolds stress is then given by \f$ C_{n} / n \f$. The pressure is
+ * only averaged, which is done on its coefficients.
  *
  * It is also possible to perform the averages using an exponential moving
  *  average, in which case either the moving average parameter \f$ \alpha \f$
@@ -67,7 +69,7 @@ FilterReynoldsStresses::FilterReynoldsStresses(
     const LibUtilities::SessionReaderSharedPtr         &pSession,
     const std::weak_ptr<SolverUtils::EquationSystem> &pEquation,
     const std::map<std::string, std::string> &pParams)
-    : FilterFieldConvert(pSession, pEquation, pParams)
+    : FilterFieldConvert(pSession, pEquation, pParams), m_alpha(0.0)
 {
     // Load sampling frequency
     auto it = pParams.find("SampleFrequency");
@@ -147,35 +149,57 @@ void FilterReynoldsStresses::v_Initialise(
 {
     int dim          = pFields.num_elements() - 1;
     int nExtraFields = dim == 2 ? 3 : 6;
-    int origFields   = pFields.num_elements();
+    int nq           = pFields[0]->GetTotPoints();
 
-    // Allocate storage
-    m_fields.resize(origFields + nExtraFields);
-    m_delta.resize(dim);
+    // Initialise output arrays
+    FilterFieldConvert::v_Initialise(pFields, time);
 
-    for (int n = 0; n < m_fields.size(); ++n)
+    // Covariances uu, uv, ..., in the order of the variables
+    std::vector<std::pair<int, int> > pairs;
+    for (int i = 0; i < dim; ++i)
     {
-        m_fields[n] = Array<OneD, NekDouble>(pFields[0]->GetTotPoints(), 0.0);
+        for (int j = i; j < dim; ++j)
+        {
+            pairs.push_back(std::make_pair(i, j));
+        }
     }
-    for (int n = 0; n < m_delta.size(); ++n)
+
+    m_stats = MemoryManager<LibUtilities::StreamingStatistics>
+        ::AllocateSharedPtr(nq, dim, 1, pairs, m_alpha);
+    m_pressureStats = MemoryManager<LibUtilities::StreamingStatistics>
+        ::AllocateSharedPtr(m_outFields[dim].num_elements(), 1, 1,
+                            std::vector<std::pair<int, int> >(), m_alpha);
+
+    // Allocate storage
+    m_velocity = Array<OneD, Array<OneD, NekDouble> >(dim);
+    for (int n = 0; n < dim; ++n)
     {
-        m_delta[n] = Array<OneD, NekDouble>(pFields[0]->GetTotPoints(), 0.0);
+        m_velocity[n] = Array<OneD, NekDouble>(nq, 0.0);
+    }
+    m_statFields = Array<OneD, Array<OneD, NekDouble> >(dim + nExtraFields);
+    for (int n = 0; n < m_statFields.num_elements(); ++n)
+    {
+        m_statFields[n] = Array<OneD, NekDouble>(nq, 0.0);
     }
 
-    // Initialise output arrays
-    FilterFieldConvert::v_Initialise(pFields, time);
-
-    // Update m_fields if using restart file
+    // Continue from the statistics of the restart file
     if (m_numSamples)
     {
-        for (int j = 0; j < m_fields.size(); ++j)
+        for (int n = 0; n < m_statFields.num_elements(); ++n)
         {
-            pFields[0]->BwdTrans(m_outFields[j], m_fields[j]);
+            // Skip the pressure in m_outFields
+            int j = n < dim ? n : n + 1;
+            pFields[0]->BwdTrans(m_outFields[j], m_statFields[n]);
             if (pFields[0]->GetWaveSpace())
             {
-                pFields[0]->HomogeneousBwdTrans(m_fields[j], m_fields[j]);
+                pFields[0]->HomogeneousBwdTrans(m_statFields[n],
+                                                m_statFields[n]);
             }
         }
+        m_stats->SetStatistics(m_numSamples, m_statFields);
+
+        Array<OneD, Array<OneD, NekDouble> > pressure(1, m_outFields[dim]);
+        m_pressureStats->SetStatistics(m_numSamples, pressure);
     }
 }
 
@@ -216,119 +240,68 @@ void FilterReynoldsStresses::v_ProcessSample(
           std::vector<Array<OneD, NekDouble> > &fieldcoeffs,
     const NekDouble &time)
 {
-    int i, j, n;
-    int nq             = pFields[0]->GetTotPoints();
-    int dim            = pFields.num_elements() - 1;
-    bool waveSpace     = pFields[0]->GetWaveSpace();
-    NekDouble nSamples = (NekDouble)m_numSamples;
-
-    // For moving average, take first sample as initial vector
-    NekDouble alpha = m_alpha;
-    if (m_numSamples == 1)
-    {
-        alpha = 1.0;
-    }
-
-    // Define auxiliary constants for averages
-    NekDouble facOld, facAvg, facStress, facDelta;
-    if (m_movAvg)
-    {
-        facOld    = 1.0 - alpha;
-        facAvg    = alpha;
-        facStress = alpha;
-        facDelta  = 1.0;
-    }
-    else
-    {
-        facOld    = 1.0;
-        facAvg    = 1.0;
-        facStress = nSamples / (nSamples - 1);
-        facDelta  = 1.0 / nSamples;
-    }
+    boost::ignore_unused(time);
 
-    Array<OneD, NekDouble> vel(nq);
-    Array<OneD, NekDouble> tmp(nq);
+    int nq         = pFields[0]->GetTotPoints();
+    int dim        = pFields.num_elements() - 1;
+    bool waveSpace = pFields[0]->GetWaveSpace();
 
-    // Update original velocities in phys space and calculate (\bar{u} - u_n)
-    for (n = 0; n < dim; ++n)
+    // Update the statistics of the velocities in phys space
+    for (int n = 0; n < dim; ++n)
     {
         if (waveSpace)
         {
-            pFields[n]->HomogeneousBwdTrans(pFields[n]->GetPhys(), vel);
+            pFields[n]->HomogeneousBwdTrans(pFields[n]->GetPhys(),
+                                            m_velocity[n]);
         }
         else
         {
-            vel = pFields[n]->GetPhys();
+            Vmath::Vcopy(nq, pFields[n]->GetPhys(), 1, m_velocity[n], 1);
         }
-        Vmath::Svtsvtp(
-            nq, facAvg, vel, 1, facOld, m_fields[n], 1, m_fields[n], 1);
-        Vmath::Svtvm(nq, facDelta, m_fields[n], 1, vel, 1, m_delta[n], 1);
-    }
-    // Update pressure (directly to outFields)
-    Vmath::Svtsvtp(m_outFields[dim].num_elements(),
-                   facAvg,
-                   pFields[dim]->GetCoeffs(),
-                   1,
-                   facOld,
-                   m_outFields[dim],
-                   1,
-                   m_outFields[dim],
-                   1);
-
-    // Ignore Reynolds stress for first sample (its contribution is zero)
-    if (m_numSamples == 1)
-    {
-        return;
     }
+    m_stats->Update(m_velocity);
 
-    // Calculate C_{n} = facOld * C_{n-1} + facStress * deltaI * deltaJ
-    for (i = 0, n = dim + 1; i < dim; ++i)
-    {
-        for (j = i; j < dim; ++j, ++n)
-        {
-            Vmath::Vmul(nq, m_delta[i], 1, m_delta[j], 1, tmp, 1);
-            Vmath::Svtsvtp(
-                nq, facStress, tmp, 1, facOld, m_fields[n], 1, m_fields[n], 1);
-        }
-    }
+    // Update pressure (on its coefficients)
+    Array<OneD, Array<OneD, NekDouble> > pressure(1, fieldcoeffs[dim]);
+    m_pressureStats->Update(pressure);
 }
 
 void FilterReynoldsStresses::v_PrepareOutput(
     const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
     const NekDouble &time)
 {
+    boost::ignore_unused(time);
+
     int dim = pFields.num_elements() - 1;
 
     m_fieldMetaData["NumberOfFieldDumps"] =
         boost::lexical_cast<std::string>(m_numSamples);
 
+    // Keep the initial fields if no sample has been taken
+    if (m_numSamples == 0)
+    {
+        return;
+    }
+
+    m_stats->GetStatistics(m_statFields);
+
     // Set wavespace to false, as calculations were performed in physical space
     bool waveSpace = pFields[0]->GetWaveSpace();
     pFields[0]->SetWaveSpace(false);
 
     // Forward transform and put into m_outFields (except pressure)
-    for (int i = 0; i < m_fields.size(); ++i)
+    for (int n = 0; n < m_statFields.num_elements(); ++n)
     {
-        if (i != dim)
-        {
-            pFields[0]->FwdTrans_IterPerExp(m_fields[i], m_outFields[i]);
-        }
+        int j = n < dim ? n : n + 1;
+        pFields[0]->FwdTrans_IterPerExp(m_statFields[n], m_outFields[j]);
     }
 
     // Restore waveSpace
     pFields[0]->SetWaveSpace(waveSpace);
-}
 
-NekDouble FilterReynoldsStresses::v_GetScale()
-{
-    if (m_movAvg)
-    {
-        return 1.0;
-    }
-    else
-    {
-        return 1.0 / m_numSamples;
-    }
+    // Write the average pressure directly to m_outFields
+    Array<OneD, Array<OneD, NekDouble> > pressure(1, m_outFields[dim]);
+    m_pressureStats->GetStatistics(pressure);
 }
 
 }
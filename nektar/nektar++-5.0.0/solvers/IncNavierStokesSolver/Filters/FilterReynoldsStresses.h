@@ -35,6 +35,7 @@
 #ifndef NEKTAR_SOLVERUTILS_FILTERS_FILTERREYNOLDSSTRESSES_H
 #define NEKTAR_SOLVERUTILS_FILTERS_FILTERREYNOLDSSTRESSES_H
 
+#include <LibUtilities/BasicUtils/StreamingStatistics.h>
 #include <SolverUtils/Filters/FilterFieldConvert.h>
 
 namespace Nektar
@@ -81,16 +82,21 @@ protected:
     virtual void v_PrepareOutput(
         const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
         const NekDouble &time);
-    virtual NekDouble v_GetScale();
     virtual std::string v_GetFileSuffix()
     {
         return "_stress";
     }
 
-    std::vector<Array<OneD, NekDouble> > m_fields;
-    std::vector<Array<OneD, NekDouble> > m_delta;
     NekDouble m_alpha;
     bool m_movAvg;
+    /// Means and covariances of the physical values of the velocity.
+    LibUtilities::StreamingStatisticsSharedPtr m_stats;
+    /// Mean of the coefficients of the pressure.
+    LibUtilities::StreamingStatisticsSharedPtr m_pressureStats;
+    /// Physical values of the velocity of the current sample.
+    Array<OneD, Array<OneD, NekDouble> > m_velocity;
+    /// Physical values of the means and covariances of the velocity.
+    Array<OneD, Array<OneD, NekDouble> > m_statFields;
 };
 }
 }
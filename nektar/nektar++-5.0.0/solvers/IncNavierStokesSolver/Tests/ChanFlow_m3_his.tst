@@ -0,0 +1,21 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Channel at rest P=3, buffered text history points</description>
+    <executable>IncNavierStokesSolver</executable>
+    <parameters>ChanFlow_m3_his.xml</parameters>
+    <files>
+        <file description="Session File">ChanFlow_m3_his.xml</file>
+    </files>
+    <metrics>
+        <metric type="L2" id="1">
+            <value variable="u" tolerance="1e-12">0</value>
+            <value variable="v" tolerance="1e-12">0</value>
+            <value variable="p" tolerance="1e-12">0</value>
+        </metric>
+        <metric type="file" id="2">
+            <file filename="ChanFlow_m3_his.his">
+                <sha1>7e6329a4e7f73df20a0ba25c01058305cc506442</sha1>
+            </file>
+        </metric>
+    </metrics>
+</test>
@@ -0,0 +1,22 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Channel at rest, par(2), binary history points</description>
+    <executable>IncNavierStokesSolver</executable>
+    <parameters>--use-scotch ChanFlow_m3_his_par.xml</parameters>
+    <processes>2</processes>
+    <files>
+        <file description="Session File">ChanFlow_m3_his_par.xml</file>
+    </files>
+    <metrics>
+        <metric type="L2" id="1">
+            <value variable="u" tolerance="1e-12">0</value>
+            <value variable="v" tolerance="1e-12">0</value>
+            <value variable="p" tolerance="1e-12">0</value>
+        </metric>
+        <metric type="file" id="2">
+            <file filename="ChanFlow_m3_his_par.his">
+                <sha1>4e7a998c7303afcc383ba337a44e93d641b789b2</sha1>
+            </file>
+        </metric>
+    </metrics>
+</test>
@@ -0,0 +1,21 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Channel Flow P=3, Successive RHS (Projection)</description>
+    <executable>IncNavierStokesSolver</executable>
+    <parameters>ChanFlow_m3_srhs.xml</parameters>
+    <files>
+        <file description="Session File">ChanFlow_m3_srhs.xml</file>
+    </files>
+    <metrics>
+        <metric type="L2" id="1">
+            <value variable="u" tolerance="1e-8">4.49822e-16</value>
+            <value variable="v" tolerance="1e-8">0</value>
+	    <value variable="p" tolerance="1e-8">8.05332e-15</value>
+        </metric>
+        <metric type="Linf" id="2">
+            <value variable="u" tolerance="1e-8">3.60822e-15</value>
+            <value variable="v" tolerance="1e-8">2.70499e-16</value>
+	    <value variable="p" tolerance="1e-8">6.50591e-14</value>
+        </metric>
+    </metrics>
+</test>
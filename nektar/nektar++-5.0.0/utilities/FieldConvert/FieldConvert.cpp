@@ -32,8 +32,10 @@
 //
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <future>
 #include <string>
 #include <boost/algorithm/string.hpp>
+#include <boost/format.hpp>
 #include <boost/program_options.hpp>
 #include <LibUtilities/BasicUtils/FileSystem.h>
 #include <LibUtilities/BasicUtils/Timer.h>
@@ -49,6 +51,21 @@ void PrintExecutionSequence(vector<ModuleSharedPtr> &modules);
 
 void RunModule(ModuleSharedPtr module, po::variables_map &vm, bool verbose);
 
+/// Configuration option of a module naming the files of a time series.
+struct SeriesFile
+{
+    ModuleSharedPtr module;
+    string          key;
+    string          pattern;
+};
+
+void RunSeries(vector<ModuleSharedPtr> &modules,
+               vector<SeriesFile>      &files,
+               FieldSharedPtr           f,
+               FieldSharedPtr           out,
+               int first, int last, int step,
+               po::variables_map &vm, bool verbose);
+
 int main(int argc, char* argv[])
 {
     LibUtilities::Timer    timer;
@@ -88,6 +105,13 @@ int main(int argc, char* argv[])
             "Partition into specified npart partitions and exit")
         ("part-only-overlapping", po::value<int>(),
             "Partition into specified npart overlapping partitions and exit")
+        ("nthreads", po::value<int>(),
+            "Number of threads used by the modules for their element-wise "
+            "work.")
+        ("series", po::value<string>(),
+            "Process the snapshots first:last[:step] of a time series, "
+            "substituting the snapshot number in the %d patterns of the "
+            "file names.")
         ("modules-opt,p", po::value<string>(),
             "Print options for a module.")
         ("module,m", po::value<vector<string> >(),
@@ -236,6 +260,13 @@ int main(int argc, char* argv[])
             f->m_comm = LibUtilities::GetCommFactory().CreateInstance(
                                                     "Serial", argc, argv);
         }
+        else if(vm.count("series") && MPIComm->GetSize() == 1)
+        {
+            // A serial communicator allows the snapshots of a time series
+            // to be read and written on background threads.
+            f->m_comm = LibUtilities::GetCommFactory().CreateInstance(
+                                                    "Serial", argc, argv);
+        }
         else
         {
             f->m_comm = MPIComm;
@@ -262,6 +293,50 @@ int main(int argc, char* argv[])
         f->m_verbose = true;
     }
 
+    if (vm.count("nthreads"))
+    {
+        f->m_nThreads = vm["nthreads"].as<int>();
+        ASSERTL0(f->m_nThreads > 0, "The number of threads must be positive.");
+    }
+
+    // Parse the range of snapshots of a time series.
+    int seriesFirst = 0, seriesLast = 0, seriesStep = 1;
+    vector<SeriesFile> seriesFiles;
+    FieldSharedPtr     seriesOut;
+    if (vm.count("series"))
+    {
+        vector<string> range;
+        boost::split(range, vm["series"].as<string>(), boost::is_any_of(":"));
+        ASSERTL0(range.size() == 2 || range.size() == 3,
+                 "The series must be given as first:last[:step].");
+        try
+        {
+            seriesFirst = boost::lexical_cast<int>(range[0]);
+            seriesLast  = boost::lexical_cast<int>(range[1]);
+            if (range.size() == 3)
+            {
+                seriesStep = boost::lexical_cast<int>(range[2]);
+            }
+        }
+        catch (const boost::bad_lexical_cast &)
+        {
+            NEKERROR(ErrorUtil::efatal, "Invalid series range: " +
+                     vm["series"].as<string>());
+        }
+        ASSERTL0(seriesStep > 0 && seriesFirst <= seriesLast,
+                 "The series must be an increasing range.");
+        ASSERTL0(nParts == 1, "The series option cannot be used with nparts.");
+
+#ifdef NEKTAR_USE_THREAD_SAFETY
+        // With a serial communicator, the output modules write each
+        // snapshot from their own field while the next one is processed.
+        if (std::dynamic_pointer_cast<LibUtilities::CommSerial>(f->m_comm))
+        {
+            seriesOut = std::shared_ptr<Field>(new Field());
+        }
+#endif
+    }
+
     if (vm.count("module"))
     {
         modcmds = vm["module"].as<vector<string> >();
@@ -372,7 +447,9 @@ int main(int argc, char* argv[])
         }
 
         // Create module.
-        mod = GetModuleFactory().CreateInstance(module, f);
+        mod = GetModuleFactory().CreateInstance(
+            module, (module.first == eOutputModule && seriesOut) ? seriesOut
+                                                                  : f);
         modules.push_back(mod);
 
         if (module.first == eInputModule)
@@ -404,6 +481,13 @@ int main(int argc, char* argv[])
             else if (tmp2.size() == 2)
             {
                 mod->RegisterConfig(tmp2[0], tmp2[1]);
+
+                if (vm.count("series") &&
+                    (tmp2[0] == "infile" || tmp2[0] == "outfile") &&
+                    tmp2[1].find('%') != string::npos)
+                {
+                    seriesFiles.push_back(SeriesFile{mod, tmp2[0], tmp2[1]});
+                }
             }
             else
             {
@@ -457,45 +541,56 @@ int main(int argc, char* argv[])
     }
 
 
-    // Loop on partitions if required
-    LibUtilities::CommSharedPtr defComm = f->m_comm;
-    LibUtilities::CommSharedPtr partComm;
-    for(int p = MPIrank; p < nParts; p += MPInprocs)
+    if (vm.count("series"))
     {
-        // write out which partition is being processed and defined a
-        // new serial communicator
-        if(nParts > 1)
-        {
-            cout << endl << "Processing partition: " << p << endl;
-            
-            int rank = p;
-            f->ClearField();
-            partComm = std::shared_ptr<FieldConvertComm>(
-                             new FieldConvertComm(argc, argv, nParts,rank));
-        }
-        
-        // Run field process.
-        for (int n = 0; n < SIZE_ModulePriority; ++n)
+        ASSERTL0(seriesFiles.size(),
+                 "The series option requires input or output file names "
+                 "containing a %d pattern.");
+        RunSeries(modules, seriesFiles, f, seriesOut, seriesFirst,
+                  seriesLast, seriesStep, vm, verbose);
+    }
+    else
+    {
+        // Loop on partitions if required
+        LibUtilities::CommSharedPtr defComm = f->m_comm;
+        LibUtilities::CommSharedPtr partComm;
+        for(int p = MPIrank; p < nParts; p += MPInprocs)
         {
-            ModulePriority priority = static_cast<ModulePriority>(n);
-
+            // write out which partition is being processed and defined a
+            // new serial communicator
             if(nParts > 1)
             {
-                if(((priority == eCreateGraph)||(priority == eOutput)))
-                {
-                    f->m_comm = partComm;
-                }
-                else
-                {
-                    f->m_comm = defComm;
-                }
+                cout << endl << "Processing partition: " << p << endl;
+
+                int rank = p;
+                f->ClearField();
+                partComm = std::shared_ptr<FieldConvertComm>(
+                                 new FieldConvertComm(argc, argv, nParts,rank));
             }
 
-            for (int i = 0; i < modules.size(); ++i)
+            // Run field process.
+            for (int n = 0; n < SIZE_ModulePriority; ++n)
             {
-                if(modules[i]->GetModulePriority() == priority)
+                ModulePriority priority = static_cast<ModulePriority>(n);
+
+                if(nParts > 1)
                 {
-                    RunModule(modules[i], vm, verbose);
+                    if(((priority == eCreateGraph)||(priority == eOutput)))
+                    {
+                        f->m_comm = partComm;
+                    }
+                    else
+                    {
+                        f->m_comm = defComm;
+                    }
+                }
+
+                for (int i = 0; i < modules.size(); ++i)
+                {
+                    if(modules[i]->GetModulePriority() == priority)
+                    {
+                        RunModule(modules[i], vm, verbose);
+                    }
                 }
             }
         }
@@ -756,3 +851,145 @@ void RunModule(ModuleSharedPtr module, po::variables_map &vm, bool verbose)
              << ss.str() << endl;
     }
 }
+
+/**
+ * @brief Run the modules once for each snapshot of a time series.
+ *
+ * The mesh is only read for the first snapshot; the following ones restart
+ * from the field as it was after the graph was created. When @p out is
+ * set, the output modules have been created on this second field: the
+ * results of each snapshot are handed over to it and written on a
+ * background thread while the next snapshot is processed, and the field
+ * file of the next snapshot is read ahead by the input modules. The copy
+ * of the field shares the mesh graph and session, so the processing
+ * modules then run under Module::GetGraphMutex, which the output modules
+ * take while they set up expansions from the graph.
+ */
+void RunSeries(vector<ModuleSharedPtr> &modules,
+               vector<SeriesFile>      &files,
+               FieldSharedPtr           f,
+               FieldSharedPtr           out,
+               int first, int last, int step,
+               po::variables_map &vm, bool verbose)
+{
+    auto fileName = [](const SeriesFile &file, int k)
+    {
+        return boost::str(boost::format(file.pattern) % k);
+    };
+
+    vector<string>    variables;
+    std::future<void> writer;
+
+    for (int k = first; k <= last; k += step)
+    {
+        if (verbose)
+        {
+            cout << endl << "Processing snapshot: " << k << endl;
+        }
+
+        if (k != first)
+        {
+            f->m_fielddef.clear();
+            f->m_data.clear();
+            f->m_exp.clear();
+            f->m_variables = variables;
+            f->m_fieldPts  = LibUtilities::NullPtsField;
+            f->m_fieldMetaDataMap.clear();
+        }
+
+        for (auto &file : files)
+        {
+            if (file.module->GetModulePriority() != eOutput)
+            {
+                file.module->RegisterConfig(file.key, fileName(file, k));
+            }
+        }
+
+        for (int n = 0; n < eOutput; ++n)
+        {
+            ModulePriority priority = static_cast<ModulePriority>(n);
+            if (priority == eCreateGraph && k != first)
+            {
+                continue;
+            }
+
+            for (int i = 0; i < modules.size(); ++i)
+            {
+                if (modules[i]->GetModulePriority() == priority)
+                {
+                    std::unique_lock<std::mutex> lock(
+                        Module::GetGraphMutex(), std::defer_lock);
+                    if (out)
+                    {
+                        lock.lock();
+                    }
+                    RunModule(modules[i], vm, verbose);
+                }
+            }
+
+            if (priority == eCreateGraph)
+            {
+                variables = f->m_variables;
+            }
+            else if (priority == eCreateFieldData && out && k + step <= last)
+            {
+                // Read the next snapshot while this one is processed.
+                for (auto &file : files)
+                {
+                    InputModuleSharedPtr input =
+                        std::dynamic_pointer_cast<InputModule>(file.module);
+                    if (input && file.key == "infile")
+                    {
+                        input->Prefetch(fileName(file, k + step));
+                    }
+                }
+            }
+        }
+
+        // The output modules may still be writing the previous snapshot.
+        if (writer.valid())
+        {
+            writer.get();
+        }
+
+        for (auto &file : files)
+        {
+            if (file.module->GetModulePriority() == eOutput)
+            {
+                file.module->RegisterConfig(file.key, fileName(file, k));
+            }
+        }
+
+        auto runOutput = [&modules, &vm, verbose]()
+        {
+            for (int i = 0; i < modules.size(); ++i)
+            {
+                if (modules[i]->GetModulePriority() == eOutput)
+                {
+                    RunModule(modules[i], vm, verbose);
+                }
+            }
+        };
+
+        if (out)
+        {
+            *out   = *f;
+            writer = std::async(std::launch::async, runOutput);
+        }
+        else
+        {
+            runOutput();
+        }
+    }
+
+    if (writer.valid())
+    {
+        writer.get();
+    }
+
+    if (out)
+    {
+        // The communicator is finalised with the main field.
+        out->m_comm = LibUtilities::CommSharedPtr();
+    }
+}
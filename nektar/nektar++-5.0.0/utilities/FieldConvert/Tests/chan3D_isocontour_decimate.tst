@@ -0,0 +1,21 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description> Extract a decimated isocontour</description>
+    <executable>FieldConvert</executable>
+    <parameters> -f -e -m isocontour:fieldstr="y":fieldvalue=0.5:globalcondense:decimate=0.25 chan3D.xml chan3D.fld isocontour.dat</parameters>
+    <files>
+        <file description="Session File">chan3D.xml</file>
+        <file description="Session File">chan3D.fld</file>
+    </files>
+
+     <metrics>
+        <metric type="L2" id="1">
+            <value variable="y" tolerance="1e-6">0.5</value>
+            <value variable="isocon" tolerance="1e-6">0.5</value>
+        </metric>
+        <metric type="Linf" id="2">
+            <value variable="y" tolerance="1e-6">0.5</value>
+            <value variable="isocon" tolerance="1e-6">0.5</value>
+        </metric>
+    </metrics>
+</test>
@@ -0,0 +1,43 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description> Process 3D vorticity output of a time series of two
+        snapshots, the second one being twice the first one </description>
+    <executable>FieldConvert</executable>
+    <parameters> -f -e --series 0:1 -m vorticity chan3D.xml chan3D_series_%d.fld chan3D_series_%d_vort.fld</parameters>
+    <files>
+        <file description="Session File">chan3D.xml</file>
+        <file description="Field File">chan3D_series_0.fld</file>
+        <file description="Field File">chan3D_series_1.fld</file>
+    </files>
+     <metrics>
+        <metric type="regex" id="1">
+            <regex>^L 2 error \(variable (u|p|W_y)\) : ([-+]?[0-9]*\.?[0-9]+(?:[eE][-+]?[0-9]+)?)</regex>
+            <matches>
+                <match>
+                    <field id="0">u</field>
+                    <field id="1" tolerance="1e-6">2.06559</field>
+                </match>
+                <match>
+                    <field id="0">p</field>
+                    <field id="1" tolerance="1e-6">6.53197</field>
+                </match>
+                <match>
+                    <field id="0">W_y</field>
+                    <field id="1" tolerance="1e-6">3.26599</field>
+                </match>
+                <match>
+                    <field id="0">u</field>
+                    <field id="1" tolerance="1e-6">4.13118</field>
+                </match>
+                <match>
+                    <field id="0">p</field>
+                    <field id="1" tolerance="1e-6">13.06394</field>
+                </match>
+                <match>
+                    <field id="0">W_y</field>
+                    <field id="1" tolerance="1e-6">6.53198</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>